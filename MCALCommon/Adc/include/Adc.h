@@ -320,6 +320,20 @@ extern "C"{
 #define ADC_E_PARAM_CHANNEL                          ((uint8)0x2BU)
 #endif
 
+#if (ADC_PAIRED_GROUPS == STD_ON)
+/**
+* @brief   Paired group service called with a group whose pair is not configured consistently.
+* */ 
+#define ADC_E_PARAM_PAIRED_GROUP                     ((uint8)0x2CU)
+#endif
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+/**
+* @brief   Adc_GetLatencyHistogram service called using an invalid latency stage.
+* */ 
+#define ADC_E_PARAM_LATENCY_STAGE                    ((uint8)0x2DU)
+#endif
+
 
 #define ADC_E_BUFFER_UNINIT_LIST                     ((uint32)0x00000001U)
 #define ADC_E_WRONG_TRIGG_SRC_LIST                   ((uint32)0x00000002U)
@@ -526,6 +540,92 @@ extern "C"{
 * */
 #define ADC_SETCHANNEL_ID                            (0x31U)
 #endif
+
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+/**
+* @brief API service ID for Adc_GetSampleView function
+* */
+#define ADC_GETSAMPLEVIEW_ID                         (0x32U)
+/**
+* @brief API service ID for Adc_ValidateSampleView function
+* */
+#define ADC_VALIDATESAMPLEVIEW_ID                    (0x33U)
+#endif
+
+#if (ADC_READ_GROUPS_API == STD_ON)
+/**
+* @brief API service ID for Adc_ReadGroups function
+* */
+#define ADC_READGROUPS_ID                            (0x34U)
+#endif
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+/**
+* @brief API service ID for Adc_ReadPairedGroup function
+* */
+#define ADC_READPAIREDGROUP_ID                       (0x35U)
+#endif
+
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+/**
+* @brief API service ID for Adc_CalibrateAsync function
+* */
+#define ADC_CALIBRATEASYNC_ID                        (0x36U)
+/**
+* @brief API service ID for Adc_GetCalibrationState function
+* */
+#define ADC_GETCALIBRATIONSTATE_ID                   (0x37U)
+#endif
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+/**
+* @brief API service ID for Adc_GetCalibrationData function
+* */
+#define ADC_GETCALIBRATIONDATA_ID                    (0x38U)
+/**
+* @brief API service ID for Adc_GetCalibrationOrigin function
+* */
+#define ADC_GETCALIBRATIONORIGIN_ID                  (0x39U)
+#endif
+
+#if (ADC_ASYNC_ABORT == STD_ON) || (ADC_NOTIFICATION_COALESCING == STD_ON)
+/**
+* @brief API service ID for Adc_MainFunction function
+* */
+#define ADC_MAINFUNCTION_ID                          (0x3AU)
+#endif
+
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+/**
+* @brief API service ID for Adc_GetPowerStatistics function
+* */
+#define ADC_GETPOWERSTATISTICS_ID                    (0x3BU)
+#endif
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+/**
+* @brief API service ID for Adc_GetClockStatistics function
+* */
+#define ADC_GETCLOCKSTATISTICS_ID                    (0x3CU)
+#endif
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+/**
+* @brief API service ID for Adc_GetLatencyHistogram function
+* */
+#define ADC_GETLATENCYHISTOGRAM_ID                   (0x3DU)
+#endif
+
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+/**
+* @brief API service ID for Adc_Main_NotificationDispatcher function
+* */
+#define ADC_MAINNOTIFICATIONDISPATCHER_ID            (0x3EU)
+/**
+* @brief API service ID for Adc_GetNotificationStatistics function
+* */
+#define ADC_GETNOTIFICATIONSTATISTICS_ID             (0x3FU)
+#endif
 /* Re-define as workaround e9061 on RaceRunner IS */
 #ifdef ERR_IPV_ADCDIG_0017
     #if (ERR_IPV_ADCDIG_0017 == STD_ON)
@@ -676,6 +776,41 @@ FUNC(Adc_StreamNumSampleType, ADC_CODE) Adc_GetStreamLastPointer
     P2P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) PtrToSamplePtr
 );
 
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+/* Adc_ValidateSampleView assumes that it does not preempt the end of conversion interrupt of the
+   group. A view of a running group with NumSamples 1 that converts with DMA, or with more than
+   ADC_NUM_SC1_N_REGISTER_USED channels, always fails the validation, as its only slot may be being
+   written: use NumSamples 2 or more for such groups. Stopping or restarting a group invalidates
+   its views. */
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetSampleView
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_SampleViewType, AUTOMATIC, ADC_APPL_DATA) pView
+);
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateSampleView
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2CONST(Adc_SampleViewType, AUTOMATIC, ADC_APPL_DATA) pView
+);
+#endif /* ADC_SAMPLE_VIEW_API == STD_ON */
+
+#if (ADC_READ_GROUPS_API == STD_ON)
+FUNC(Std_ReturnType, ADC_CODE) Adc_ReadGroups
+(
+    P2VAR(Adc_ReadGroupRequestType, AUTOMATIC, ADC_APPL_DATA) pRequests,
+    VAR(Adc_GroupType, AUTOMATIC) NumRequests
+);
+#endif /* ADC_READ_GROUPS_API == STD_ON */
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+FUNC(Std_ReturnType, ADC_CODE) Adc_ReadPairedGroup
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) DataBufferPtr
+);
+#endif /* ADC_PAIRED_GROUPS == STD_ON */
+
 #if (ADC_VERSION_INFO_API == STD_ON)
 FUNC(void, ADC_CODE) Adc_GetVersionInfo
 (
@@ -738,6 +873,36 @@ FUNC(void, ADC_CODE) Adc_Calibrate
 );
 #endif /* ADC_CALIBRATION == STD_ON */
 
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+FUNC(Std_ReturnType, ADC_CODE) Adc_CalibrateAsync
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_CalibrationStatusType, AUTOMATIC, ADC_APPL_DATA) pStatus
+);
+
+FUNC(Adc_CalibrationStateType, ADC_CODE) Adc_GetCalibrationState
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetCalibrationData
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_CalibrationDataType, AUTOMATIC, ADC_APPL_DATA) pData
+);
+
+FUNC(Adc_CalibrationOriginType, ADC_CODE) Adc_GetCalibrationOrigin
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
+#if (ADC_ASYNC_ABORT == STD_ON) || (ADC_NOTIFICATION_COALESCING == STD_ON)
+FUNC(void, ADC_CODE) Adc_MainFunction(void);
+#endif /* (ADC_ASYNC_ABORT == STD_ON) || (ADC_NOTIFICATION_COALESCING == STD_ON) */
+
 #if (ADC_SELF_TEST == STD_ON)
 FUNC(Std_ReturnType, ADC_CODE) Adc_SelfTest
 (
@@ -759,8 +924,35 @@ FUNC(Std_ReturnType, ADC_CODE) Adc_SetClockMode
 (
     VAR(Adc_DualClockModeType, AUTOMATIC) eClockMode
 );
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetClockStatistics
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_ClockStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
 #endif
 
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetLatencyHistogram
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_LatencyStageType, AUTOMATIC) eStage,
+    P2VAR(Adc_LatencyHistogramType, AUTOMATIC, ADC_APPL_DATA) pHistogram
+);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+FUNC(void, ADC_CODE) Adc_Main_NotificationDispatcher(void);
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetNotificationStatistics
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_NotificationStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+);
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
+
 #if (CTUV2_ENABLE_TRIGGER_CONFIGURATION_APIS == STD_ON)
 FUNC(Std_ReturnType, ADC_CODE) Adc_SetCtu2TriggerHandlerCtrlRegs
 (
@@ -834,6 +1026,14 @@ FUNC(Std_ReturnType, ADC_CODE) Adc_PreparePowerState
 #if (ADC_POWER_STATE_ASYNCH_MODE_SUPPORTED == STD_ON) || defined(__DOXYGEN__)
 FUNC(void, ADC_CODE) Adc_Main_PowerTransitionManager(void);
 #endif /* (ADC_POWER_STATE_ASYNCH_MODE_SUPPORTED == STD_ON) */
+
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetPowerStatistics
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_PowerStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+);
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
 #endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
 
 #ifdef ERR_IPV_ADC12B_LBA_0001
@@ -263,6 +263,22 @@ FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_StopCurrentConversion
 );
 #endif /* (ADC_ENABLE_START_STOP_GROUP_API == STD_ON) */
 
+#if (ADC_ASYNC_ABORT == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_CompleteAbort
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(boolean, AUTOMATIC) bPeriod
+);
+#endif /* (ADC_ASYNC_ABORT == STD_ON) */
+
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_FlushNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(boolean, AUTOMATIC) bWindow
+);
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
+
 #if (ADC_HW_TRIGGER_API == STD_ON)
 FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartHwTrigConversion
 (
@@ -290,6 +306,28 @@ FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_ReadGroup
 );
 #endif /* (ADC_READ_GROUP_API == STD_ON) */
 
+#if (ADC_READ_GROUPS_API == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ReadGroups
+(
+    P2VAR(Adc_ReadGroupRequestType, AUTOMATIC, ADC_APPL_DATA) pRequests,
+    CONST(Adc_GroupType, AUTOMATIC) NumRequests
+);
+#endif /* (ADC_READ_GROUPS_API == STD_ON) */
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartPairedConversion
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group,
+    CONST(Adc_GroupType, AUTOMATIC) Partner
+);
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_ReadPairedGroup
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pDataPtr
+);
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+
 #if (ADC_DUAL_CLOCK_MODE == STD_ON)
 FUNC (Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_SetClockMode
 (
@@ -297,6 +335,90 @@ FUNC (Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_SetClockMode
 );
 #endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
 
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ClockNoteRequest
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(uint32, AUTOMATIC) u32Now
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ClockCancelRequest
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ClockEndConversion
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_GetClockStatistics
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_ClockStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyStart
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyChunk
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyNotify
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyPost
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyDispatch
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_GetLatencyHistogram
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_LatencyStageType, AUTOMATIC) eStage,
+    P2VAR(Adc_LatencyHistogramType, AUTOMATIC, ADC_APPL_DATA) pHistogram
+);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+
+#if (ADC_EVENT_TRACE == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_TraceChunk
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+
+#if (ADC_POWER_STATE_SUPPORTED == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_SetUnitPowerState
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_PowerStateType, AUTOMATIC) ePowerState
+);
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_SetPowerState
+(
+    VAR(Adc_PowerStateType, AUTOMATIC) ePowerState
+);
+#endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
+
 #if (ADC_CALIBRATION == STD_ON)
 FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Calibrate
 (
@@ -305,6 +427,46 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Calibrate
 );
 #endif /* ADC_CALIBRATION == STD_ON */
 
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_CalibrationStatusType , AUTOMATIC, ADC_APPL_DATA) pStatus
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_CompleteCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(boolean, AUTOMATIC) bAbandon
+);
+
+FUNC(Adc_CalibrationStateType, ADC_CODE) Adc_Adc12bsarv2_GetCalibrationState
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ReadCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_CalibrationDataType, AUTOMATIC, ADC_APPL_DATA) pData
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_WriteCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2CONST(Adc_CalibrationDataType, AUTOMATIC, ADC_APPL_CONST) pData
+);
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_BuildRegisterImages
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+
 FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigurePartialConversion
 (
     CONST(Adc_HwUnitType, AUTOMATIC) Unit,
@@ -124,6 +124,68 @@ extern "C"{
 /** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
 #define ADC_PRE_CHANNEL_INDEX(x) ((((x) % ADC_NUM_SC1_N_REGISTER_USED) == 0U) ? ((x) - ADC_NUM_SC1_N_REGISTER_USED) : ((Adc_ChannelIndexType)((x)-((x) % ADC_NUM_SC1_N_REGISTER_USED))))
 
+/* The macro to get the number of channels currently assigned to a group */
+#if (ADC_SETCHANNEL_API == STD_ON)
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_GROUP_CHANNEL_COUNT(Group) (Adc_aRuntimeGroupChannel[(Group)].ChannelCount)
+#else
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_GROUP_CHANNEL_COUNT(Group) (Adc_pCfgPtr->pGroups[(Group)].AssignedChannelCount)
+#endif /* (ADC_SETCHANNEL_API == STD_ON) */
+
+/* The macros to locate a sample in the group result buffer: offset of the first channel of
+   sample 'Sample' and distance between two consecutive channels of the same sample */
+#if (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON)
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_RESULT_SAMPLE_OFFSET(Group, Sample) \
+    ((ADC_RESULT_LAYOUT_SAMPLE_MAJOR == Adc_pCfgPtr->pGroups[(Group)].eResultLayout) ? \
+     ((uint32)(Sample) * (uint32)ADC_GROUP_CHANNEL_COUNT(Group)) : (uint32)(Sample))
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_RESULT_CHANNEL_STRIDE(Group) \
+    ((ADC_RESULT_LAYOUT_SAMPLE_MAJOR == Adc_pCfgPtr->pGroups[(Group)].eResultLayout) ? \
+     1UL : (uint32)Adc_pCfgPtr->pGroups[(Group)].NumSamples)
+#else
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_RESULT_SAMPLE_OFFSET(Group, Sample) ((uint32)(Sample))
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_RESULT_CHANNEL_STRIDE(Group) ((uint32)Adc_pCfgPtr->pGroups[(Group)].NumSamples)
+#endif /* (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON) */
+
+/* The macros to enclose a write of the result buffer or of ResultIndex of a group, so that
+   Adc_Adc12bsarv2_ReadGroup can detect that its copy overlapped the write */
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_RESULT_PUBLISH_BEGIN(Group) (Adc_aGroupStatus[(Group)].u32PublishSequence++)
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_RESULT_PUBLISH_END(Group)   (Adc_aGroupStatus[(Group)].u32PublishSequence++)
+#else
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_RESULT_PUBLISH_BEGIN(Group)
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_RESULT_PUBLISH_END(Group)
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+
+/* The macro to set the completed state of a group from an end of conversion handler. With
+   ADC_RESULT_SEQLOCK the state is also recorded and the completion counted, so that the state
+   update of Adc_ReadGroup, done without exclusive area, can put back a completion it overwrote */
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_GROUP_SET_COMPLETED(Group, State) \
+    ((Adc_aGroupStatus[(Group)].eCompletion = (State)), \
+     (Adc_aGroupStatus[(Group)].eConversion = (State)), \
+     (Adc_aGroupStatus[(Group)].u32CompletionSequence++))
+#else
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_GROUP_SET_COMPLETED(Group, State) (Adc_aGroupStatus[(Group)].eConversion = (State))
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+/* The macro to get the group of a pair whose notification is raised for both halves */
+/** @violates @ref Adc_Adc12bsarv2_CfgEx_h_REF_2 Function-like macro defined */
+#define ADC_PAIR_NOTIFY_GROUP(Group) \
+    (((Group) < Adc_pCfgPtr->pGroups[(Group)].PairedGroup) ? (Group) : Adc_pCfgPtr->pGroups[(Group)].PairedGroup)
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+
 /*==================================================================================================
 *                                             ENUMS
 ==================================================================================================*/
@@ -185,8 +247,77 @@ typedef struct
 #if (defined(ADC_UNIT_0_PDB_ERR_ISR_USED) || defined(ADC_UNIT_1_PDB_ERR_ISR_USED))
     CONST(Adc_NotifyType, ADC_CONST) pPdbNofitication;
 #endif /* (defined(ADC_UNIT_0_PDB_ERR_ISR_USED) || defined(ADC_UNIT_1_PDB_ERR_ISR_USED)) */
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+    /**< @brief Called at the end of Adc_CalibrateAsync, NULL_PTR if none */
+    CONST(Adc_CalibrationNotifyType, ADC_CONST) pCalibrationNotification;
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+    /**< @brief Calibration data loaded by Adc_Init, NULL_PTR to always start uncalibrated */
+    P2CONST(Adc_CalibrationDataType, ADC_VAR, ADC_APPL_CONST) pCalibrationData;
+    /**< @brief Reads the temperature compared with the stored one, NULL_PTR to skip the check */
+    CONST(Adc_TemperatureReadType, ADC_CONST) pfReadTemperature;
+    /**< @brief Largest accepted difference between the current and the stored temperature */
+    CONST(uint16, ADC_CONST) u16CalibrationTemperatureRange;
+#endif /* (ADC_CALIBRATION_PERSISTENCE == STD_ON) */
+#if (ADC_POWER_STATE_SUPPORTED == STD_ON)
+    /**< @brief CFG1 whose ADICLK and ADIV fields are applied in ADC_LOW_POWER */
+    CONST(uint32, ADC_CONST) u32AdcCfg1RegisterLowPower;
+#endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    /**< @brief Calls of Adc_Main_PowerTransitionManager the unit is woken up before a conversion */
+    CONST(uint16, ADC_CONST) u16PowerWakeupTicks;
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    /**< @brief Time source of the deadlines and of the clock statistics, NULL_PTR reads 0 */
+    CONST(Adc_TimeReadType, ADC_CONST) pfReadTime;
+    /**< @brief Queued groups selecting ADC_NORMAL, 0 leaves the clock to Adc_SetClockMode */
+    CONST(uint8, ADC_CONST) u8ClockFastQueueDepth;
+    /**< @brief Queued groups at or below which ADC_ALTERNATE is selected again */
+    CONST(uint8, ADC_CONST) u8ClockSlowQueueDepth;
+    /**< @brief Time left before a deadline from which ADC_NORMAL is selected */
+    CONST(uint32, ADC_CONST) u32ClockDeadlineMargin;
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
 } Adc_Adc12bsarv2_HwUnitConfigurationType;
 
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+/**
+* @brief          Batching of the notifications of a streaming group.
+* @details        A batch ends on the first of its limits reached, or at the end of the buffer.
+*
+*/
+typedef struct
+{
+    CONST(Adc_StreamNumSampleType, ADC_CONST) Samples; /**< @brief Samples of a batch, 0 if not limited */
+    CONST(Adc_StreamNumSampleType, ADC_CONST) Watermark; /**< @brief Buffer index ending a batch besides NumSamples, 0 if none */
+    CONST(uint32, ADC_CONST) u32Window; /**< @brief ADC_GET_TIMESTAMP ticks from the first sample of a batch, 0 if not limited */
+} Adc_NotifyCoalescingType;
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
+
+#if (ADC_BALANCED_SCANS == STD_ON)
+/**
+* @brief          Logical channel of a balanced scan.
+* @details        aUnitChannel[Unit] is the index of the channel in the configuration of hardware
+*                 unit Unit, ADC_BALANCED_NOT_ROUTED if the pin cannot be converted by that unit.
+*
+*/
+typedef struct
+{
+    CONST(Adc_ChannelType, ADC_CONST) aUnitChannel[ADC_MAX_HW_UNITS]; /**< @brief Channel on each unit */
+} Adc_BalancedChannelType;
+
+/**
+* @brief          Balanced scan shared by the two halves of a paired group.
+*
+*/
+typedef struct
+{
+    P2CONST(Adc_BalancedChannelType, ADC_VAR, ADC_APPL_CONST) pChannels; /**< @brief Logical channels */
+    P2CONST(uint16, ADC_VAR, ADC_APPL_CONST) pDelay; /**< @brief PDB delay of each logical channel, ChannelCount entries */
+    P2VAR(Adc_BalancedPlanType, ADC_VAR, ADC_APPL_DATA) pPlan; /**< @brief Split computed by Adc_Init */
+    CONST(Adc_ChannelIndexType, ADC_CONST) ChannelCount; /**< @brief Number of logical channels */
+} Adc_BalancedScanType;
+#endif /* (ADC_BALANCED_SCANS == STD_ON) */
+
 /**
 * @brief          Structure for group configuration.
 *
@@ -209,6 +340,15 @@ typedef struct
 #if (STD_ON==ADC_GRP_NOTIF_CAPABILITY) || defined(__DOXYGEN__)
     CONST(Adc_NotifyType , ADC_CONST) Notification; /**< @brief Pointer to notification function */
 #endif /* (STD_ON==ADC_GRP_NOTIF_CAPABILITY) || defined(__DOXYGEN__) */
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+    CONST(Adc_ExtendedNotifyType , ADC_CONST) ExtendedNotification; /**< @brief Called instead of Notification, NULL_PTR if none */
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+    CONST(boolean, ADC_CONST) bDeferredNotification; /**< @brief Notification called by Adc_Main_NotificationDispatcher */
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+    P2CONST(Adc_NotifyCoalescingType, ADC_VAR, ADC_APPL_CONST) pNotifyCoalescing; /**< @brief Batching of the notifications, NULL_PTR to notify each sample */
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
 #if (ADC_ENABLE_INITIAL_NOTIFICATION == STD_ON)
     CONST(Adc_NotifyType , ADC_CONST) ExtraNotification; /**< @brief Pointer to extra notification function */
 #endif /* (ADC_ENABLE_INITIAL_NOTIFICATION == STD_ON) */
@@ -216,6 +356,9 @@ typedef struct
     P2P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pResultsBufferPtr; /**< @brief pointer to user result buffer array */
     CONST(Adc_StreamBufferModeType , ADC_CONST) eBufferMode; /**< @brief Buffer Mode */
     CONST(Adc_StreamNumSampleType , ADC_CONST) NumSamples; /**< @brief  Number of samples */
+#if (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON)
+    CONST(Adc_ResultLayoutType , ADC_CONST) eResultLayout; /**< @brief Result buffer layout */
+#endif /* (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON) */
     P2CONST(Adc_GroupDefType , ADC_VAR, ADC_APPL_CONST) pAssignment; /**< @brief Assigned channels to group */
     P2CONST(uint16 , ADC_VAR, ADC_APPL_CONST) pDelay; /**< @brief Assigned channels to group */
     CONST(Adc_ChannelIndexType , ADC_CONST) AssignedChannelCount; /**< @brief Number of channels */
@@ -249,6 +392,18 @@ typedef struct
 #if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
     CONST(boolean, ADC_CONST) bAdcGroupLimitcheck; /**< @brief Enables or disables the usage of limit checking for an ADC group. */
 #endif
+#if (ADC_PAIRED_GROUPS == STD_ON)
+    CONST(Adc_GroupType, ADC_CONST) PairedGroup; /**< @brief Group converted together on the other unit, ADC_NO_PAIRED_GROUP if none */
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+#if (ADC_BALANCED_SCANS == STD_ON)
+    P2CONST(Adc_BalancedScanType, ADC_VAR, ADC_APPL_CONST) pBalancedScan; /**< @brief Scan split with PairedGroup, NULL_PTR if none */
+#endif /* (ADC_BALANCED_SCANS == STD_ON) */
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    CONST(uint32, ADC_CONST) u32PowerPeriodTicks; /**< @brief Calls of Adc_Main_PowerTransitionManager between two starts, 0 if not periodic */
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    CONST(uint32, ADC_CONST) u32ConversionDeadline; /**< @brief pfReadTime ticks from the start request to the first end of conversion, 0 if none */
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
 } Adc_GroupConfigurationType;
 
 /**
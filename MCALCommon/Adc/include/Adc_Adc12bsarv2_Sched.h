@@ -0,0 +1,332 @@
+/**
+*   @file    Adc_Adc12bsarv2_Sched.h
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - ADC12BSARV2 conversion time and schedulability analysis header file.
+*   @details Constant expressions giving the conversion time of a register setup, usable in
+*            preprocessor and compile-time checks of a configuration, and the host analysis which
+*            derives the end-to-end time of each group and checks the group release periods
+*            against the hardware units.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifndef ADC_ADC12BSARV2_SCHED_H
+#define ADC_ADC12BSARV2_SCHED_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Adc12bsarv2_Sched_h_REF_1
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h.
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Adc12bsarv2_Sched_h_REF_2
+* Violates MISRA 2004 Required Rule 1.4,
+* The compiler/linker shall be checked to ensure that 31 character significance and case
+* sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section Adc_Adc12bsarv2_Sched_h_REF_3
+* Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined.
+* The timing macros must stay constant expressions to be usable in #if directives and in the size
+* of an array, which a function cannot provide.
+*
+* @section Adc_Adc12bsarv2_Sched_h_REF_4
+* Violates MISRA 2004 Advisory Rule 19.13, The # and ## preprocessor operators should not be used.
+* The name of the compile-time check is pasted to get one distinct typedef per check.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Adc.h"
+#include "Adc_Reg_eSys_Adc12bsarv2.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_ADC12BSARV2_SCHED                      43
+/**
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SCHED       4
+/**
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SCHED       2
+/**
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SCHED    2
+#define ADC_SW_MAJOR_VERSION_ADC12BSARV2_SCHED               1
+#define ADC_SW_MINOR_VERSION_ADC12BSARV2_SCHED               0
+#define ADC_SW_PATCH_VERSION_ADC12BSARV2_SCHED               3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if header file and Adc header file are of the same vendor */
+#if (ADC_VENDOR_ID_ADC12BSARV2_SCHED != ADC_VENDOR_ID)
+    #error "Adc_Adc12bsarv2_Sched.h and Adc.h have different vendor ids"
+#endif
+
+/* Check if header file and Adc header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SCHED != ADC_AR_RELEASE_MAJOR_VERSION) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SCHED != ADC_AR_RELEASE_MINOR_VERSION) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SCHED != ADC_AR_RELEASE_REVISION_VERSION) \
+    )
+    #error "AutoSar Version Numbers of Adc_Adc12bsarv2_Sched.h and Adc.h are different"
+#endif
+
+/* Check if header file and Adc header file are of the same software version */
+#if ((ADC_SW_MAJOR_VERSION_ADC12BSARV2_SCHED != ADC_SW_MAJOR_VERSION) || \
+     (ADC_SW_MINOR_VERSION_ADC12BSARV2_SCHED != ADC_SW_MINOR_VERSION) || \
+     (ADC_SW_PATCH_VERSION_ADC12BSARV2_SCHED != ADC_SW_PATCH_VERSION) \
+    )
+#error "Software Version Numbers of Adc_Adc12bsarv2_Sched.h and Adc.h are different"
+#endif
+
+/* Check if header file and Adc_Reg_eSys_Adc12bsarv2 header file are of the same vendor */
+#if (ADC_VENDOR_ID_ADC12BSARV2_SCHED != ADC_VENDOR_ID_REG)
+    #error "Adc_Adc12bsarv2_Sched.h and Adc_Reg_eSys_Adc12bsarv2.h have different vendor ids"
+#endif
+
+/* Check if header file and Adc_Reg_eSys_Adc12bsarv2 header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SCHED != ADC_AR_RELEASE_MAJOR_VERSION_REG) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SCHED != ADC_AR_RELEASE_MINOR_VERSION_REG) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SCHED != ADC_AR_RELEASE_REVISION_VERSION_REG) \
+    )
+    #error "AutoSar Version Numbers of Adc_Adc12bsarv2_Sched.h and Adc_Reg_eSys_Adc12bsarv2.h are different"
+#endif
+
+/* Check if header file and Adc_Reg_eSys_Adc12bsarv2 header file are of the same software version */
+#if ((ADC_SW_MAJOR_VERSION_ADC12BSARV2_SCHED != ADC_SW_MAJOR_VERSION_REG) || \
+     (ADC_SW_MINOR_VERSION_ADC12BSARV2_SCHED != ADC_SW_MINOR_VERSION_REG) || \
+     (ADC_SW_PATCH_VERSION_ADC12BSARV2_SCHED != ADC_SW_PATCH_VERSION_REG) \
+    )
+#error "Software Version Numbers of Adc_Adc12bsarv2_Sched.h and Adc_Reg_eSys_Adc12bsarv2.h are different"
+#endif
+
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief          Result bits converted with the MODE field of a CFG1 value.
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_3 Function-like macro defined
+*/
+#define ADC_ADC12BSARV2_SCHED_RESOLUTION_BITS(Cfg1) \
+    ((ADC12BSARV2_CFG1_8_BITS_RESOLUTION_U32 == ((Cfg1) & (ADC12BSARV2_CFG1_10_BITS_RESOLUTION_U32 | ADC12BSARV2_CFG1_12_BITS_RESOLUTION_U32))) ? 8UL : \
+     ((ADC12BSARV2_CFG1_10_BITS_RESOLUTION_U32 == ((Cfg1) & (ADC12BSARV2_CFG1_10_BITS_RESOLUTION_U32 | ADC12BSARV2_CFG1_12_BITS_RESOLUTION_U32))) ? 10UL : 12UL))
+
+/**
+* @brief          Duration of one conversion, in ADC input clock cycles.
+* @details        (SMPLTS + 1) sample cycles, one compare cycle per result bit and Adder, in ADCK
+*                 cycles, multiplied by the averaged samples when SC3[AVGE] is set and scaled to
+*                 input clock cycles by CFG1[ADIV]. Adder is the part of the total conversion time
+*                 which is not set by the registers (synchronization and result transfer), to be
+*                 taken from the conversion timing of the data sheet of the device for the ADCK
+*                 frequency used; it is not defaulted here. Only the MODE and ADIV fields of Cfg1,
+*                 SMPLTS of Cfg2 and AVGE/AVGS of Sc3 are used, so the unit register values or the
+*                 group timing fields can be passed.
+*                 The expression has no cast and can be used in #if directives, e.g.
+*                 @code
+*                 #if (ADC_ADC12BSARV2_SCHED_CONVERSION_CYCLES(0x64UL, 12UL, 0x6UL, ADC_CFG_ADDER_ADCK) > 1000UL)
+*                 #error "ADC conversion of the torque group too slow"
+*                 #endif
+*                 @endcode
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_3 Function-like macro defined
+*/
+#define ADC_ADC12BSARV2_SCHED_CONVERSION_CYCLES(Cfg1, Cfg2, Sc3, Adder) \
+    (((((Cfg2) & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32) + 1UL + ADC_ADC12BSARV2_SCHED_RESOLUTION_BITS(Cfg1) + (Adder)) << \
+      ((ADC12BSARV2_SC3_AVGE_EN_U32 == ((Sc3) & ADC12BSARV2_SC3_AVGE_EN_U32)) ? \
+       (2UL + ((Sc3) & (ADC12BSARV2_SC3_AVG_MASK_U32 & (~ADC12BSARV2_SC3_AVGE_EN_U32)))) : 0UL)) << \
+     (((Cfg1) & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32) >> 5U))
+
+/**
+* @brief          Shortest time of a scan of Channels conversions chained back-to-back.
+* @details        Lower bound of the round of a group whatever its PDB delays, the group cannot be
+*                 released more often than this.
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_3 Function-like macro defined
+*/
+#define ADC_ADC12BSARV2_SCHED_BACK_TO_BACK_CYCLES(Conversion, Channels) ((Conversion) * (Channels))
+
+/**
+* @brief          PDB input clock cycles of one PDB count.
+* @details        Prescaler 2^PRESCALER times the multiplication factor 1, 10, 20 or 40 of MULT,
+*                 the PRESCALER and MULT fields of the PDB_SC value u32AdcPdbClockSettings.
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_3 Function-like macro defined
+*/
+#define ADC_ADC12BSARV2_SCHED_PDB_COUNT_CLOCKS(Sc) \
+    (((0UL == (((Sc) >> 2U) & 3UL)) ? 1UL : ((1UL == (((Sc) >> 2U) & 3UL)) ? 10UL : \
+      ((2UL == (((Sc) >> 2U) & 3UL)) ? 20UL : 40UL))) << (((Sc) >> 12U) & 7UL))
+
+/**
+* @brief          ADC input clock cycles from the PDB trigger to a pre-trigger of Delay counts.
+* @details        The PDB counts its own input clock, a clock of the system clock tree and not the
+*                 ADC input clock, and the ADC starts on its input clock: the time is converted
+*                 with the two frequencies, AdcHz and PdbHz, and rounded up to the next ADC input
+*                 clock cycle. The product overflows 32 bits, the expression is meant for #if
+*                 directives, which compute on the widest integer type.
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_3 Function-like macro defined
+*/
+#define ADC_ADC12BSARV2_SCHED_PDB_DELAY_CYCLES(Sc, Delay, AdcHz, PdbHz) \
+    ((((Delay) * ADC_ADC12BSARV2_SCHED_PDB_COUNT_CLOCKS(Sc) * (AdcHz)) + (PdbHz) - 1UL) / (PdbHz))
+
+/**
+* @brief          Compile-time check of a configuration, fails the build when Condition is false.
+* @details        Condition must be an integer constant expression, typically built with the
+*                 macros above, e.g. a release period of a group compared with its back-to-back
+*                 scan time.
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_3 Function-like macro defined
+* @violates @ref Adc_Adc12bsarv2_Sched_h_REF_4 The # and ## preprocessor operators should not be used
+*/
+#define ADC_ADC12BSARV2_SCHED_STATIC_CHECK(Name, Condition) \
+    typedef uint8 Adc_Adc12bsarv2_SchedCheck_##Name[(Condition) ? 1 : -1]
+
+#ifdef MCAL_REG_SIMULATION
+/**
+* @brief          Response time reported for a group which never completes in the analysis.
+*/
+#define ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32             ((uint32)0xFFFFFFFFUL)
+
+/*==================================================================================================
+*                                             ENUMS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief          Inputs of the analysis which are not part of the driver configuration.
+* @details        All times are ADC input clock cycles of the analyzed clock mode. The clock
+*                 frequencies only convert the PDB counts, their ratio is what matters.
+*/
+typedef struct
+{
+    const uint32 *pPeriods;             /**< @brief Shortest time between two releases of each group, 0 if the group is not analyzed */
+    uint32 u32ChunkOverhead;            /**< @brief From the end of conversion of a chunk to the trigger of the next one */
+    uint32 u32ConversionAdder;          /**< @brief ADCK cycles of a conversion besides the sample and compare cycles, see ADC_ADC12BSARV2_SCHED_CONVERSION_CYCLES */
+    uint32 u32AdcClockHz;               /**< @brief ADC input clock selected by CFG1[ADICLK], before CFG1[ADIV] */
+    uint32 u32PdbClockHz;               /**< @brief PDB input clock, before PDB_SC[PRESCALER] and PDB_SC[MULT] */
+#if (ADC_DUAL_CLOCK_MODE == STD_ON)
+    Adc_DualClockModeType eClockMode;   /**< @brief Clock configuration the groups are converted with */
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+} Adc_Adc12bsarv2_SchedParamType;
+
+/**
+* @brief          Timing of one group.
+* @details        A job is what one release converts: one round for one-shot and hardware
+*                 triggered groups, NumSamples rounds for continuous linear streaming groups.
+*                 Other continuous groups never release the unit and have an unbounded job.
+*/
+typedef struct
+{
+    uint32 u32ConversionCycles;     /**< @brief One conversion of one channel */
+    uint32 u32RoundCycles;          /**< @brief All channels once, chunks and PDB delays included */
+    uint32 u32JobCycles;            /**< @brief Unit busy time of one release */
+    uint32 u32ResponseCycles;       /**< @brief Worst-case time from the release to the end of the job */
+    uint32 u32QueueingCycles;       /**< @brief Worst-case time the job waits for or is preempted by other groups */
+    boolean bSequenceError;         /**< @brief A pre-trigger is asserted while its PDB channel waits for COCO */
+    boolean bChunkOrderError;       /**< @brief The interrupt SC1n of a chunk completes before another SC1n */
+    boolean bSchedulable;           /**< @brief Response time within the period */
+} Adc_Adc12bsarv2_SchedGroupType;
+
+/**
+* @brief          Load of one hardware unit.
+*/
+typedef struct
+{
+    uint32 u32Utilization;          /**< @brief Sum of job over period of the analyzed groups, per mille */
+    uint32 u32MaxQueueingCycles;    /**< @brief Largest queueing time of the analyzed software groups */
+    boolean bSchedulable;           /**< @brief Every analyzed group of the unit is schedulable */
+} Adc_Adc12bsarv2_SchedUnitType;
+
+/**
+* @brief          Result of Adc_Adc12bsarv2_Sched_Analyze.
+*/
+typedef struct
+{
+    Adc_Adc12bsarv2_SchedGroupType aGroup[ADC_MAX_GROUPS];      /**< @brief Indexed by group id */
+    Adc_Adc12bsarv2_SchedUnitType aUnit[ADC_MAX_HW_UNITS];      /**< @brief Indexed by unit id */
+} Adc_Adc12bsarv2_SchedReportType;
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/** @violates @ref Adc_Adc12bsarv2_Sched_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sched_GroupTiming
+(
+    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfg,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_Adc12bsarv2_SchedGroupType, AUTOMATIC, ADC_APPL_DATA) pTiming
+);
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_Sched_Analyze
+(
+    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfg,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    P2VAR(Adc_Adc12bsarv2_SchedReportType, AUTOMATIC, ADC_APPL_DATA) pReport
+);
+
+#define ADC_STOP_SEC_CODE
+/** @violates @ref Adc_Adc12bsarv2_Sched_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+#endif /* MCAL_REG_SIMULATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_ADC12BSARV2_SCHED_H */
+
+/** @} */
@@ -0,0 +1,250 @@
+/**
+*   @file    Adc_Adc12bsarv2_Sim.h
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - ADC12BSARV2 host register model header file.
+*   @details Host side model of the ADC12BSARV2 register blocks used when the register accessors
+*            from StdRegMacros.h are redirected with MCAL_REG_SIMULATION.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifndef ADC_ADC12BSARV2_SIM_H
+#define ADC_ADC12BSARV2_SIM_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Adc12bsarv2_Sim_h_REF_1
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h.
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Adc12bsarv2_Sim_h_REF_2
+* Violates MISRA 2004 Required Rule 1.4,
+* The compiler/linker shall be checked to ensure that 31 character significance and case
+* sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Adc_Reg_eSys_Adc12bsarv2.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_ADC12BSARV2_SIM                      43
+/**
+* @violates @ref Adc_Adc12bsarv2_Sim_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SIM       4
+/**
+* @violates @ref Adc_Adc12bsarv2_Sim_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SIM       2
+/**
+* @violates @ref Adc_Adc12bsarv2_Sim_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SIM    2
+#define ADC_SW_MAJOR_VERSION_ADC12BSARV2_SIM               1
+#define ADC_SW_MINOR_VERSION_ADC12BSARV2_SIM               0
+#define ADC_SW_PATCH_VERSION_ADC12BSARV2_SIM               3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if source file and Adc_Reg_eSys_Adc12bsarv2 header file are of the same vendor */
+#if (ADC_VENDOR_ID_ADC12BSARV2_SIM != ADC_VENDOR_ID_REG)
+    #error "Adc_Adc12bsarv2_Sim.h and Adc_Reg_eSys_Adc12bsarv2.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Reg_eSys_Adc12bsarv2 header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SIM != ADC_AR_RELEASE_MAJOR_VERSION_REG) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SIM != ADC_AR_RELEASE_MINOR_VERSION_REG) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SIM != ADC_AR_RELEASE_REVISION_VERSION_REG) \
+    )
+    #error "AutoSar Version Numbers of Adc_Adc12bsarv2_Sim.h and Adc_Reg_eSys_Adc12bsarv2.h are different"
+#endif
+
+/* Check if source file and Adc_Reg_eSys_Adc12bsarv2 header file are of the same software version */
+#if ((ADC_SW_MAJOR_VERSION_ADC12BSARV2_SIM != ADC_SW_MAJOR_VERSION_REG) || \
+     (ADC_SW_MINOR_VERSION_ADC12BSARV2_SIM != ADC_SW_MINOR_VERSION_REG) || \
+     (ADC_SW_PATCH_VERSION_ADC12BSARV2_SIM != ADC_SW_PATCH_VERSION_REG) \
+    )
+#error "Software Version Numbers of Adc_Adc12bsarv2_Sim.h and Adc_Reg_eSys_Adc12bsarv2.h are different"
+#endif
+
+#ifdef MCAL_REG_SIMULATION
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief          Size in bytes of the register window modeled for each ADC unit.
+*/
+#define ADC_SIM_REG_WINDOW_U32              ((uint32)0x400UL)
+
+/**
+* @brief          Number of analog inputs which can be driven through the model (ADCH range).
+*/
+#define ADC_SIM_MAX_CHANNELS_U8             ((uint8)64U)
+
+/**
+* @brief          Default cost, in ADC input clock cycles, charged for every register access.
+*/
+#define ADC_SIM_ACCESS_CYCLES_U32           ((uint32)1UL)
+
+/*==================================================================================================
+*                                             ENUMS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief          Interrupt handler invoked by the model when COCO is set on an SC1n with AIEN.
+*/
+typedef void (*Adc_Adc12bsarv2_SimIrqType)(void);
+
+/**
+* @brief          Per unit access and conversion counters collected by the model.
+*/
+typedef struct
+{
+    uint32 u32RegReads;      /**< @brief Register reads decoded for the unit */
+    uint32 u32RegWrites;     /**< @brief Register writes decoded for the unit */
+    uint32 u32Conversions;   /**< @brief Conversions which ended with COCO set */
+    uint32 u32Aborts;        /**< @brief Conversions aborted by an SC1n or SC3 write, calibrations by clearing SC3[CAL] */
+    uint32 u32Interrupts;    /**< @brief Calls made to the registered interrupt handler */
+    uint32 u32Calibrations;  /**< @brief Completed calibration sequences */
+    uint32 u32CompareRejects; /**< @brief Conversions discarded by the compare function */
+    uint64 u64BusyCycles;    /**< @brief Input clock cycles spent converting or calibrating */
+} Adc_Adc12bsarv2_SimStatisticsType;
+
+/**
+* @brief          DMA engine attached to the model, see Adc_Mcl_Sim.c.
+*/
+typedef struct
+{
+    boolean (*pfRequest)(Adc_HwUnitType Unit);  /**< @brief Serves one DMA request of a unit, FALSE if none taken */
+    void (*pfDispatchIrq)(void);                /**< @brief Delivers the pending DMA interrupts */
+} Adc_Adc12bsarv2_SimDmaEngineType;
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/** @violates @ref Adc_Adc12bsarv2_Sim_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Reset(void);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetAccessCycles
+(
+    VAR(uint32, AUTOMATIC) u32Cycles
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetAbortCycles
+(
+    VAR(uint32, AUTOMATIC) u32Cycles
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetChannelValue
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8ChId,
+    VAR(uint16, AUTOMATIC) u16Value
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetIrqHandler
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_Adc12bsarv2_SimIrqType, AUTOMATIC) pfIrqHandler
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_HwTrigger
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Sc1Index
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_AdvanceTime
+(
+    VAR(uint32, AUTOMATIC) u32Cycles
+);
+
+FUNC(uint64, ADC_CODE) Adc_Adc12bsarv2_Sim_GetTime(void);
+
+FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sim_GetConversionCycles
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_GetStatistics
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_Adc12bsarv2_SimStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+);
+
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetDmaEngine
+(
+    P2CONST(Adc_Adc12bsarv2_SimDmaEngineType, AUTOMATIC, ADC_APPL_CONST) pEngine
+);
+
+#define ADC_STOP_SEC_CODE
+/** @violates @ref Adc_Adc12bsarv2_Sim_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+#endif /* MCAL_REG_SIMULATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_ADC12BSARV2_SIM_H */
+
+/** @} */
@@ -161,6 +161,10 @@ extern "C"{
   #define Adc_Ipw_StopCurrentConversion   (Adc_Adc12bsarv2_StopCurrentConversion)  
 #endif /* ADC_ENABLE_START_STOP_GROUP_API == STD_ON */
 
+#if (ADC_ASYNC_ABORT == STD_ON)
+  #define Adc_Ipw_CompleteAbort           (Adc_Adc12bsarv2_CompleteAbort)
+#endif /* ADC_ASYNC_ABORT == STD_ON */
+
 #if (ADC_HW_TRIGGER_API == STD_ON)
   #define Adc_Ipw_EnableHardwareTrigger                  (Adc_Adc12bsarv2_EnableHardwareTrigger)
 
@@ -171,14 +175,61 @@ extern "C"{
   #define Adc_Ipw_ReadGroup        (Adc_Adc12bsarv2_ReadGroup)
 #endif /* ADC_HW_TRIGGER_API == STD_ON */
 
+#if (ADC_READ_GROUPS_API == STD_ON)
+  #define Adc_Ipw_ReadGroups       (Adc_Adc12bsarv2_ReadGroups)
+#endif /* ADC_READ_GROUPS_API == STD_ON */
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+  #define Adc_Ipw_StartPairedConversion   (Adc_Adc12bsarv2_StartPairedConversion)
+  #define Adc_Ipw_ReadPairedGroup         (Adc_Adc12bsarv2_ReadPairedGroup)
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+
 #if (ADC_DUAL_CLOCK_MODE == STD_ON)
   #define Adc_Ipw_SetClockMode   (Adc_Adc12bsarv2_SetClockMode)
 #endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
 
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+  #define Adc_Ipw_GetClockStatistics   (Adc_Adc12bsarv2_GetClockStatistics)
+  #define Adc_Ipw_ClockNoteRequest     (Adc_Adc12bsarv2_ClockNoteRequest)
+  #define Adc_Ipw_ClockCancelRequest   (Adc_Adc12bsarv2_ClockCancelRequest)
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+  #define Adc_Ipw_LatencyStart          (Adc_Adc12bsarv2_LatencyStart)
+  #define Adc_Ipw_GetLatencyHistogram   (Adc_Adc12bsarv2_GetLatencyHistogram)
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+  #define Adc_Ipw_FlushNotification     (Adc_Adc12bsarv2_FlushNotification)
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON) && (ADC_DEFERRED_NOTIFICATION == STD_ON)
+  #define Adc_Ipw_LatencyDispatch       (Adc_Adc12bsarv2_LatencyDispatch)
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) && (ADC_DEFERRED_NOTIFICATION == STD_ON) */
+
+#if (ADC_POWER_STATE_SUPPORTED == STD_ON)
+  #define Adc_Ipw_SetPowerState       (Adc_Adc12bsarv2_SetPowerState)
+  #define Adc_Ipw_SetUnitPowerState   (Adc_Adc12bsarv2_SetUnitPowerState)
+#endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
+
 #if (ADC_CALIBRATION == STD_ON)
   #define Adc_Ipw_Calibrate (Adc_Adc12bsarv2_Calibrate)
 #endif /* ADC_CALIBRATION == STD_ON */
 
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+  #define Adc_Ipw_StartCalibration    (Adc_Adc12bsarv2_StartCalibration)
+  #define Adc_Ipw_GetCalibrationState (Adc_Adc12bsarv2_GetCalibrationState)
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+  #define Adc_Ipw_ReadCalibration     (Adc_Adc12bsarv2_ReadCalibration)
+  #define Adc_Ipw_WriteCalibration    (Adc_Adc12bsarv2_WriteCalibration)
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+  #define Adc_Ipw_BuildRegisterImages (Adc_Adc12bsarv2_BuildRegisterImages)
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+
 
 /*==================================================================================================
 *                                             ENUMS
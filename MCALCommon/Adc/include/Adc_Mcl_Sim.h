@@ -0,0 +1,206 @@
+/**
+*   @file    Adc_Mcl_Sim.h
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - eDMA host model header file.
+*   @details Host side stand-in of the Mcl DMA services used by the ADC driver. It replaces the
+*            Mcl module when the driver is built with MCAL_REG_SIMULATION.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifndef ADC_MCL_SIM_H
+#define ADC_MCL_SIM_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Mcl_Sim_h_REF_1
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h.
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Mcl_Sim_h_REF_2
+* Violates MISRA 2004 Required Rule 1.4,
+* The compiler/linker shall be checked to ensure that 31 character significance and case
+* sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "CDD_Mcl.h"
+#include "Adc_Adc12bsarv2_Sim.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_MCL_SIM                      43
+/**
+* @violates @ref Adc_Mcl_Sim_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MAJOR_VERSION_MCL_SIM       4
+/**
+* @violates @ref Adc_Mcl_Sim_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MINOR_VERSION_MCL_SIM       2
+/**
+* @violates @ref Adc_Mcl_Sim_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_REVISION_VERSION_MCL_SIM    2
+#define ADC_SW_MAJOR_VERSION_MCL_SIM               1
+#define ADC_SW_MINOR_VERSION_MCL_SIM               0
+#define ADC_SW_PATCH_VERSION_MCL_SIM               3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if source file and Adc_Adc12bsarv2_Sim header file are of the same vendor */
+#if (ADC_VENDOR_ID_MCL_SIM != ADC_VENDOR_ID_ADC12BSARV2_SIM)
+    #error "Adc_Mcl_Sim.h and Adc_Adc12bsarv2_Sim.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Adc12bsarv2_Sim header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_MCL_SIM != ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_MCL_SIM != ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_MCL_SIM != ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SIM) \
+    )
+    #error "AutoSar Version Numbers of Adc_Mcl_Sim.h and Adc_Adc12bsarv2_Sim.h are different"
+#endif
+
+/* Check if source file and Adc_Adc12bsarv2_Sim header file are of the same software version */
+#if ((ADC_SW_MAJOR_VERSION_MCL_SIM != ADC_SW_MAJOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_SW_MINOR_VERSION_MCL_SIM != ADC_SW_MINOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_SW_PATCH_VERSION_MCL_SIM != ADC_SW_PATCH_VERSION_ADC12BSARV2_SIM) \
+    )
+#error "Software Version Numbers of Adc_Mcl_Sim.h and Adc_Adc12bsarv2_Sim.h are different"
+#endif
+
+/* Check if source file and Mcl header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_MCL_SIM != MCL_AR_RELEASE_MAJOR_VERSION) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_MCL_SIM != MCL_AR_RELEASE_MINOR_VERSION) \
+    )
+    #error "AutoSar Version Numbers of Adc_Mcl_Sim.h and CDD_Mcl.h are different"
+#endif
+
+#ifdef MCAL_REG_SIMULATION
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief          Number of eDMA channels modeled.
+*/
+#define ADC_MCL_SIM_CHANNELS_U8             ((uint8)16U)
+
+/**
+* @brief          Request source of a channel which is not routed to an ADC unit.
+*/
+#define ADC_MCL_SIM_NO_SOURCE_U8            ((uint8)0xFFU)
+
+/*==================================================================================================
+*                                             ENUMS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief          Transfer complete callback of a channel, typically Adc_Adc12bsarv2_DmaTransferCompleteX.
+*/
+typedef void (*Adc_Mcl_SimNotificationType)(void);
+
+/**
+* @brief          Per channel counters collected by the model.
+*/
+typedef struct
+{
+    uint32 u32MinorLoops;       /**< @brief Minor loops executed, one per service request */
+    uint32 u32MajorLoops;       /**< @brief Major loops completed */
+    uint32 u32ScatterGathers;   /**< @brief TCDs loaded from memory at the end of a major loop */
+    uint32 u32Interrupts;       /**< @brief Calls made to the channel notification */
+} Adc_Mcl_SimStatisticsType;
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/** @violates @ref Adc_Mcl_Sim_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+FUNC(void, ADC_CODE) Adc_Mcl_Sim_Reset(void);
+
+FUNC(void, ADC_CODE) Adc_Mcl_Sim_SetRequestSource
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel,
+    VAR(uint8, AUTOMATIC) u8Unit
+);
+
+FUNC(void, ADC_CODE) Adc_Mcl_Sim_SetNotification
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel,
+    VAR(Adc_Mcl_SimNotificationType, AUTOMATIC) pfNotification
+);
+
+FUNC(void, ADC_CODE) Adc_Mcl_Sim_GetStatistics
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel,
+    P2VAR(Adc_Mcl_SimStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+);
+
+#define ADC_STOP_SEC_CODE
+/** @violates @ref Adc_Mcl_Sim_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+#endif /* MCAL_REG_SIMULATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_MCL_SIM_H */
+
+/** @} */
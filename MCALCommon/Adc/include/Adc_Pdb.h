@@ -188,6 +188,19 @@ extern "C"{
 #define ADC_PDB_CHANNELS_USED(x) ((((x)%8U) != 0U) ? (((x)/8U) + 1U) : ((x)/8U))
 /** @violates @ref Adc_Pdb_h_REF_3 Function-like macro defined */
 #define ADC_NUM_CHANNELS_USED(x) ((((x) >> 3U) != 0U) ? 8U : (x))
+
+/* Each PDB channel triggers 8 consecutive SC1n, CHn pre-trigger m triggering SC1[(n * 8) + m] */
+#if (ADC_NUM_SC1_N_REGISTER_USED > (ADC_PDB_CHANNELS_U8 * 8U))
+#error "ADC_NUM_SC1_N_REGISTER_USED exceeds the pre-triggers of the PDB channels"
+#endif
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+/**
+* @brief          Words from MOD to the CHnDLY7 of the last PDB channel: MOD, CNT and IDLY, then
+*                 CHnC1, CHnS and CHnDLY0..7 for every PDB channel.
+*/
+#define ADC_PDB_RELOAD_BLOCK_WORDS      (3U + ((uint32)ADC_PDB_CHANNELS_U8 * 10U))
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) */
 /*==================================================================================================
 *                                             ENUMS
 ==================================================================================================*/
@@ -256,11 +269,53 @@ FUNC(void, ADC_CODE) Adc_Pdb_ConfigurePartialConversion
     VAR(uint8, AUTOMATIC) u8NumChannel
 );
 
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+FUNC(void, ADC_CODE) Adc_Pdb_BuildPartialConversionImage
+(
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr,
+    P2CONST(uint16, AUTOMATIC, ADC_APPL_CONST) pGroupDelay,
+    VAR(uint16, AUTOMATIC) u16CurrentChannel,
+    VAR(uint8, AUTOMATIC) u8NumChannel,
+    P2VAR(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage
+);
+
+FUNC(void, ADC_CODE) Adc_Pdb_LoadPartialConversionImage
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr,
+    VAR(Adc_HwTriggerTimerType, AUTOMATIC) Trigger,
+    P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage
+);
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+FUNC(void, ADC_CODE) Adc_Pdb_BuildReloadBlock
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pu32Block
+);
+
+FUNC(void, ADC_CODE) Adc_Pdb_BuildReloadTrigger
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pu32Sc
+);
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) */
+
 FUNC(void, ADC_CODE) Adc_Pdb_StartSoftwareConversion
 (
     VAR(Adc_HwUnitType, AUTOMATIC) Unit
 );
 
+#if (ADC_PAIRED_GROUPS == STD_ON)
+FUNC(void, ADC_CODE) Adc_Pdb_StartPairedConversion
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) UnitA,
+    VAR(Adc_HwUnitType, AUTOMATIC) UnitB
+);
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+
 #ifdef ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED
 FUNC(void, ADC_CODE) Adc_Pdb_SetPdbMode
 (
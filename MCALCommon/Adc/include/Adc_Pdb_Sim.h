@@ -0,0 +1,280 @@
+/**
+*   @file    Adc_Pdb_Sim.h
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - PDB host model header file.
+*   @details Host side model of the PDB counter and pre-trigger logic driving the modeled ADC units.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifndef ADC_PDB_SIM_H
+#define ADC_PDB_SIM_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Pdb_Sim_h_REF_1
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h.
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Pdb_Sim_h_REF_2
+* Violates MISRA 2004 Required Rule 1.4,
+* The compiler/linker shall be checked to ensure that 31 character significance and case
+* sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Adc_Adc12bsarv2_Sim.h"
+#include "Adc_Reg_eSys_Pdb.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_PDB_SIM                      43
+/**
+* @violates @ref Adc_Pdb_Sim_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MAJOR_VERSION_PDB_SIM       4
+/**
+* @violates @ref Adc_Pdb_Sim_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MINOR_VERSION_PDB_SIM       2
+/**
+* @violates @ref Adc_Pdb_Sim_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_REVISION_VERSION_PDB_SIM    2
+#define ADC_SW_MAJOR_VERSION_PDB_SIM               1
+#define ADC_SW_MINOR_VERSION_PDB_SIM               0
+#define ADC_SW_PATCH_VERSION_PDB_SIM               3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if source file and Adc_Reg_eSys_Pdb header file are of the same vendor */
+#if (ADC_VENDOR_ID_PDB_SIM != ADC_PDB_VENDOR_ID_REG)
+    #error "Adc_Pdb_Sim.h and Adc_Reg_eSys_Pdb.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Reg_eSys_Pdb header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_PDB_SIM != ADC_PDB_AR_RELEASE_MAJOR_VERSION_REG) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_PDB_SIM != ADC_PDB_AR_RELEASE_MINOR_VERSION_REG) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_PDB_SIM != ADC_PDB_AR_RELEASE_REVISION_VERSION_REG) \
+    )
+    #error "AutoSar Version Numbers of Adc_Pdb_Sim.h and Adc_Reg_eSys_Pdb.h are different"
+#endif
+
+/* Check if source file and Adc_Reg_eSys_Pdb header file are of the same software version */
+#if ((ADC_SW_MAJOR_VERSION_PDB_SIM != ADC_PDB_SW_MAJOR_VERSION_REG) || \
+     (ADC_SW_MINOR_VERSION_PDB_SIM != ADC_PDB_SW_MINOR_VERSION_REG) || \
+     (ADC_SW_PATCH_VERSION_PDB_SIM != ADC_PDB_SW_PATCH_VERSION_REG) \
+    )
+#error "Software Version Numbers of Adc_Pdb_Sim.h and Adc_Reg_eSys_Pdb.h are different"
+#endif
+
+/* Check if source file and Adc_Adc12bsarv2_Sim header file are of the same vendor */
+#if (ADC_VENDOR_ID_PDB_SIM != ADC_VENDOR_ID_ADC12BSARV2_SIM)
+    #error "Adc_Pdb_Sim.h and Adc_Adc12bsarv2_Sim.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Adc12bsarv2_Sim header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_PDB_SIM != ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_PDB_SIM != ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_PDB_SIM != ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SIM) \
+    )
+    #error "AutoSar Version Numbers of Adc_Pdb_Sim.h and Adc_Adc12bsarv2_Sim.h are different"
+#endif
+
+/* Check if source file and Adc_Adc12bsarv2_Sim header file are of the same software version */
+#if ((ADC_SW_MAJOR_VERSION_PDB_SIM != ADC_SW_MAJOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_SW_MINOR_VERSION_PDB_SIM != ADC_SW_MINOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_SW_PATCH_VERSION_PDB_SIM != ADC_SW_PATCH_VERSION_ADC12BSARV2_SIM) \
+    )
+#error "Software Version Numbers of Adc_Pdb_Sim.h and Adc_Adc12bsarv2_Sim.h are different"
+#endif
+
+#ifdef MCAL_REG_SIMULATION
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief          Size in bytes of the register window modeled for each PDB.
+*/
+#define ADC_PDB_SIM_REG_WINDOW_U32          ((uint32)0x200UL)
+
+/**
+* @brief          Number of pre-triggers of a PDB channel.
+*/
+#define ADC_PDB_SIM_PRETRIGGERS_U8          ((uint8)8U)
+
+/**
+* @brief          Number of events kept by the timestamp trace, older events are overwritten.
+*/
+#define ADC_PDB_SIM_TRACE_SIZE_U16          ((uint16)512U)
+
+/*==================================================================================================
+*                                             ENUMS
+==================================================================================================*/
+/**
+* @brief          Events recorded in the PDB trace.
+*/
+typedef enum
+{
+    ADC_PDB_SIM_CYCLE_START = 0,    /**< @brief Counter started from a trigger or a continuous reload */
+    ADC_PDB_SIM_PRETRIGGER,         /**< @brief Pre-trigger asserted towards the ADC */
+    ADC_PDB_SIM_CONVERSION_END,     /**< @brief ADC acknowledged the pre-trigger with COCO */
+    ADC_PDB_SIM_SEQUENCE_ERROR      /**< @brief Pre-trigger asserted while the channel was busy */
+} Adc_Pdb_SimEventType;
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief          Error interrupt handler, typically Adc_Pdb_ChannelSequenceErrorX.
+*/
+typedef void (*Adc_Pdb_SimIrqType)(void);
+
+/**
+* @brief          One entry of the PDB timestamp trace.
+*/
+typedef struct
+{
+    uint64 u64Time;                 /**< @brief Simulated time of the event */
+    Adc_Pdb_SimEventType eEvent;    /**< @brief Kind of event */
+    uint8 u8Unit;                   /**< @brief PDB (and ADC) unit */
+    uint8 u8Channel;                /**< @brief PDB channel */
+    uint8 u8PreTrigger;             /**< @brief Pre-trigger of the channel, SC1n = channel * 8 + pre-trigger */
+} Adc_Pdb_SimTraceType;
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/** @violates @ref Adc_Pdb_Sim_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_Reset(void);
+
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_SetErrIrqHandler
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_Pdb_SimIrqType, AUTOMATIC) pfIrqHandler
+);
+
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_ExternalTrigger
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_InjectSequenceError
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Channel,
+    VAR(uint8, AUTOMATIC) u8PreTrigger
+);
+
+FUNC(uint16, ADC_CODE) Adc_Pdb_Sim_GetTraceCount(void);
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_Pdb_Sim_GetTrace
+(
+    VAR(uint16, AUTOMATIC) u16Index,
+    P2VAR(Adc_Pdb_SimTraceType, AUTOMATIC, ADC_APPL_DATA) pEntry
+);
+
+FUNC(Std_ReturnType, ADC_CODE) Adc_Pdb_Sim_GetStartSkew
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) UnitA,
+    VAR(Adc_HwUnitType, AUTOMATIC) UnitB,
+    P2VAR(uint64, AUTOMATIC, ADC_APPL_DATA) pSkew
+);
+
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_ClearTrace(void);
+
+/* Services used by the ADC register model */
+FUNC(boolean, ADC_CODE) Adc_Pdb_Sim_ReadReg
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pValue
+);
+
+FUNC(boolean, ADC_CODE) Adc_Pdb_Sim_WriteReg
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint32, AUTOMATIC) u32Value
+);
+
+FUNC(boolean, ADC_CODE) Adc_Pdb_Sim_GetNextEventTime
+(
+    P2VAR(uint64, AUTOMATIC, ADC_APPL_DATA) pTime
+);
+
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_ProcessDue(void);
+
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_ConversionComplete
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Sc1Index
+);
+
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_DispatchIrq(void);
+
+#define ADC_STOP_SEC_CODE
+/** @violates @ref Adc_Pdb_Sim_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+#endif /* MCAL_REG_SIMULATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_PDB_SIM_H */
+
+/** @} */
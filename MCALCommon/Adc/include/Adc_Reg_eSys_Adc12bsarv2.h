@@ -137,10 +137,21 @@ extern CONST(uint32, ADC_CONST) ADC12BSARV2_BASE_ADDR32[ADC_MAX_HW_UNITS];
 *                                      DEFINES AND MACROS
 ==================================================================================================*/
 
+/**
+* @brief          Number of SC1n/Rn registers at the SC1A/RA offsets on every derivative.
+*/
+#define ADC12BSARV2_SC1_N_BASE_COUNT        (16U)
+
+#if (ADC_NUM_SC1_N_REGISTER > ADC12BSARV2_SC1_N_BASE_COUNT)
+/* S32K148: SC1n/Rn 16 to 31 only exist in the aSC1/aR banks, which also alias 0 to 15 */
+#define ADC12BSAR_SC1_OFFSET_ADDR32     (0x0108UL)
+#define ADC12BSAR_R_N_OFFSET_ADDR32      (0x0188UL)
+#else
 /* The offset for SC1 registers */
 #define ADC12BSAR_SC1_OFFSET_ADDR32     (ADC_SC1_OFFSET_ADDR32)
 /* The offset for Rn registers */
 #define ADC12BSAR_R_N_OFFSET_ADDR32      (ADC_R_N_OFFSET_ADDR32)
+#endif /* (ADC_NUM_SC1_N_REGISTER > ADC12BSARV2_SC1_N_BASE_COUNT) */
 
 /**
 * @brief          ADC Base address definition.
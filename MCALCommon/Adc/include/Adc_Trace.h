@@ -0,0 +1,282 @@
+/**
+*   @file    Adc_Trace.h
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - Binary event trace header file.
+*   @details Layout of the trace ring recorded by the driver when ADC_EVENT_TRACE is STD_ON. The
+*            layout is the format of Adc_TraceFormat.h, also read from the RAM dumps by
+*            tools/Adc_TraceDecode.c, and checked against it by Adc_Trace.c.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifndef ADC_TRACE_H
+#define ADC_TRACE_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Trace_h_REF_1
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h.
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Trace_h_REF_2
+* Violates MISRA 2004 Required Rule 1.4,
+* The compiler/linker shall be checked to ensure that 31 character significance and case
+* sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section Adc_Trace_h_REF_3
+* Violates MISRA 2004 Required Rule 8.7, Objects shall be defined at block scope if they are only
+* accessed from within a single function. The trace ring is exported so that it can be located in
+* a RAM dump by its symbol.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Adc.h"
+#include "Adc_TraceFormat.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_TRACE                      43
+/**
+* @violates @ref Adc_Trace_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MAJOR_VERSION_TRACE       4
+/**
+* @violates @ref Adc_Trace_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MINOR_VERSION_TRACE       2
+/**
+* @violates @ref Adc_Trace_h_REF_2 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_REVISION_VERSION_TRACE    2
+#define ADC_SW_MAJOR_VERSION_TRACE               1
+#define ADC_SW_MINOR_VERSION_TRACE               0
+#define ADC_SW_PATCH_VERSION_TRACE               3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if header file and Adc header file are of the same vendor */
+#if (ADC_VENDOR_ID_TRACE != ADC_VENDOR_ID)
+    #error "Adc_Trace.h and Adc.h have different vendor ids"
+#endif
+
+/* Check if header file and Adc header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_TRACE != ADC_AR_RELEASE_MAJOR_VERSION) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_TRACE != ADC_AR_RELEASE_MINOR_VERSION) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_TRACE != ADC_AR_RELEASE_REVISION_VERSION) \
+    )
+    #error "AutoSar Version Numbers of Adc_Trace.h and Adc.h are different"
+#endif
+
+/* Check if header file and Adc header file are of the same software version */
+#if ((ADC_SW_MAJOR_VERSION_TRACE != ADC_SW_MAJOR_VERSION) || \
+     (ADC_SW_MINOR_VERSION_TRACE != ADC_SW_MINOR_VERSION) || \
+     (ADC_SW_PATCH_VERSION_TRACE != ADC_SW_PATCH_VERSION) \
+    )
+#error "Software Version Numbers of Adc_Trace.h and Adc.h are different"
+#endif
+
+/* Check if header file and Adc_TraceFormat header file are of the same vendor */
+#if (ADC_VENDOR_ID_TRACE != ADC_VENDOR_ID_TRACEFORMAT)
+    #error "Adc_Trace.h and Adc_TraceFormat.h have different vendor ids"
+#endif
+
+/* Check if header file and Adc_TraceFormat header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_TRACE != ADC_AR_RELEASE_MAJOR_VERSION_TRACEFORMAT) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_TRACE != ADC_AR_RELEASE_MINOR_VERSION_TRACEFORMAT) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_TRACE != ADC_AR_RELEASE_REVISION_VERSION_TRACEFORMAT) \
+    )
+    #error "AutoSar Version Numbers of Adc_Trace.h and Adc_TraceFormat.h are different"
+#endif
+
+/* Check if header file and Adc_TraceFormat header file are of the same software version */
+#if ((ADC_SW_MAJOR_VERSION_TRACE != ADC_SW_MAJOR_VERSION_TRACEFORMAT) || \
+     (ADC_SW_MINOR_VERSION_TRACE != ADC_SW_MINOR_VERSION_TRACEFORMAT) || \
+     (ADC_SW_PATCH_VERSION_TRACE != ADC_SW_PATCH_VERSION_TRACEFORMAT) \
+    )
+#error "Software Version Numbers of Adc_Trace.h and Adc_TraceFormat.h are different"
+#endif
+
+#if (ADC_EVENT_TRACE == STD_ON)
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief          First word of the trace ring, the bytes "ADCT" in memory order.
+*/
+#define ADC_TRACE_MAGIC_U32                     ((uint32)ADC_TRACE_FORMAT_MAGIC)
+
+/**
+* @brief          Version of the ring layout and of the event codes.
+*/
+#define ADC_TRACE_VERSION_U16                   ((uint16)ADC_TRACE_FORMAT_VERSION)
+
+/**
+* @brief          Group of the events which do not concern a group.
+*/
+#define ADC_TRACE_NO_GROUP_U16                  ((uint16)ADC_TRACE_FORMAT_NO_GROUP)
+
+/**
+* @brief          Event codes, with the content of u16Data.
+* @details        QUEUE_INSERT    Group queued for a software conversion, data: queue depth
+*                                 after the insertion.
+*                 QUEUE_REMOVE    Group removed from the queue, data: its queue index, 0 for the
+*                                 group under conversion, 1 for a waiting group of a priority
+*                                 bucket queue.
+*                 START           Conversion of the group started on the unit, data: 0 for a
+*                                 software start, 1 for a hardware trigger armed.
+*                 CHUNK           Partial conversion interrupt, data: next channel to convert.
+*                 END             Last partial conversion interrupt of a round, data: channels
+*                                 of the group.
+*                 LIMIT_FAIL      Result rejected by the limit check, data: next channel to
+*                                 convert.
+*                 ABORT           Conversion of the group stopped on the unit, data: next channel
+*                                 to convert. A QUEUE_REMOVE of the group following it tells a
+*                                 stop request from a preemption, a preempted group staying
+*                                 queued.
+*                 PDB_ERROR       PDB sequence error of the unit, no group, data: PDB channel.
+*                 NOTIFY          Notification of the group called.
+*/
+#define ADC_TRACE_EV_QUEUE_INSERT_U8            ((uint8)ADC_TRACE_FORMAT_EV_QUEUE_INSERT)
+#define ADC_TRACE_EV_QUEUE_REMOVE_U8            ((uint8)ADC_TRACE_FORMAT_EV_QUEUE_REMOVE)
+#define ADC_TRACE_EV_START_U8                   ((uint8)ADC_TRACE_FORMAT_EV_START)
+#define ADC_TRACE_EV_CHUNK_U8                   ((uint8)ADC_TRACE_FORMAT_EV_CHUNK)
+#define ADC_TRACE_EV_END_U8                     ((uint8)ADC_TRACE_FORMAT_EV_END)
+#define ADC_TRACE_EV_LIMIT_FAIL_U8              ((uint8)ADC_TRACE_FORMAT_EV_LIMIT_FAIL)
+#define ADC_TRACE_EV_ABORT_U8                   ((uint8)ADC_TRACE_FORMAT_EV_ABORT)
+#define ADC_TRACE_EV_PDB_ERROR_U8               ((uint8)ADC_TRACE_FORMAT_EV_PDB_ERROR)
+#define ADC_TRACE_EV_NOTIFY_U8                  ((uint8)ADC_TRACE_FORMAT_EV_NOTIFY)
+
+/*==================================================================================================
+*                                             ENUMS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief          One event of the trace, 12 bytes.
+* @details        u16Seq holds the low 16 bits of the write index the record was claimed with and
+*                 is written last: a record whose u16Seq does not match its position is being
+*                 written or was overwritten, and is discarded by the decoder.
+*/
+typedef struct
+{
+    uint32 u32Time;         /**< @brief ADC_GET_TIMESTAMP when the event was recorded */
+    uint16 u16Seq;          /**< @brief Commit marker, low bits of the write index */
+    uint8 u8Event;          /**< @brief One of ADC_TRACE_EV_x */
+    uint8 u8Unit;           /**< @brief Hardware unit */
+    uint16 u16Group;        /**< @brief Group, ADC_TRACE_NO_GROUP_U16 if none */
+    uint16 u16Data;         /**< @brief Event data, see ADC_TRACE_EV_x */
+} Adc_TraceRecordType;
+
+/**
+* @brief          Trace ring, 16 bytes of header followed by the records.
+* @details        u32Head counts the events recorded since Adc_Init, the record of write index i
+*                 is aRecord[i % ADC_EVENT_TRACE_ENTRIES]. The last ADC_EVENT_TRACE_ENTRIES
+*                 indexes before u32Head are the valid records, oldest first.
+*/
+typedef struct
+{
+    uint32 u32Magic;        /**< @brief ADC_TRACE_MAGIC_U32 */
+    uint16 u16Version;      /**< @brief ADC_TRACE_VERSION_U16 */
+    uint16 u16Entries;      /**< @brief ADC_EVENT_TRACE_ENTRIES */
+    uint8 u8RecordSize;     /**< @brief sizeof(Adc_TraceRecordType) */
+    uint8 au8Reserved[3];   /**< @brief Zero */
+    uint32 u32Head;         /**< @brief Next write index */
+    Adc_TraceRecordType aRecord[ADC_EVENT_TRACE_ENTRIES];   /**< @brief Records */
+} Adc_TraceBufferType;
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+#define ADC_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/** @violates @ref Adc_Trace_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+/**
+* @brief          Trace ring, accessed as volatile so that the commit marker is stored last.
+*/
+/** @violates @ref Adc_Trace_h_REF_3 Objects shall be defined at block scope */
+extern volatile VAR(Adc_TraceBufferType, ADC_VAR) Adc_TraceBuffer;
+
+#define ADC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/** @violates @ref Adc_Trace_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/** @violates @ref Adc_Trace_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+FUNC(void, ADC_CODE) Adc_Trace_Init(void);
+
+FUNC(void, ADC_CODE) Adc_Trace_Record
+(
+    VAR(uint8, AUTOMATIC) u8Event,
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint16, AUTOMATIC) u16Group,
+    VAR(uint16, AUTOMATIC) u16Data
+);
+
+#define ADC_STOP_SEC_CODE
+/** @violates @ref Adc_Trace_h_REF_1 Repeated include file MemMap.h */
+#include "Adc_MemMap.h"
+
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_TRACE_H */
+
+/** @} */
@@ -0,0 +1,175 @@
+/**
+*   @file    Adc_TraceFormat.h
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - Binary event trace format header file.
+*   @details Byte layout and event codes of the trace ring, shared by the driver (Adc_Trace.h) and
+*            by the host decoder tools/Adc_TraceDecode.c. Plain integer constants without any
+*            include, so that a host program can use it with its own integer types. The fields
+*            are little endian, any change of the layout or of the codes must update
+*            ADC_TRACE_FORMAT_VERSION.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifndef ADC_TRACEFORMAT_H
+#define ADC_TRACEFORMAT_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_TraceFormat_h_REF_1
+* Violates MISRA 2004 Required Rule 1.4,
+* The compiler/linker shall be checked to ensure that 31 character significance and case
+* sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_TRACEFORMAT                      43
+/**
+* @violates @ref Adc_TraceFormat_h_REF_1 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MAJOR_VERSION_TRACEFORMAT       4
+/**
+* @violates @ref Adc_TraceFormat_h_REF_1 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_MINOR_VERSION_TRACEFORMAT       2
+/**
+* @violates @ref Adc_TraceFormat_h_REF_1 The compiler/linker shall be checked to ensure that 31
+* character significance and case sensitivity are supported for external identifiers
+*/
+#define ADC_AR_RELEASE_REVISION_VERSION_TRACEFORMAT    2
+#define ADC_SW_MAJOR_VERSION_TRACEFORMAT               1
+#define ADC_SW_MINOR_VERSION_TRACEFORMAT               0
+#define ADC_SW_PATCH_VERSION_TRACEFORMAT               3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief          First word of the trace ring, the bytes "ADCT" in memory order.
+*/
+#define ADC_TRACE_FORMAT_MAGIC                  (0x54434441UL)
+
+/**
+* @brief          Version of the ring layout and of the event codes.
+*/
+#define ADC_TRACE_FORMAT_VERSION                (1U)
+
+/**
+* @brief          Group of the events which do not concern a group.
+*/
+#define ADC_TRACE_FORMAT_NO_GROUP               (0xFFFFU)
+
+/**
+* @brief          Header of the ring: size and byte offset of its fields.
+* @details        MAGIC 32 bits, VERSION 16 bits, ENTRIES 16 bits (a power of two), RECORD_SIZE 8
+*                 bits, 3 reserved bytes and HEAD 32 bits, the next write index. The records
+*                 follow the header.
+*/
+#define ADC_TRACE_FORMAT_HEADER_SIZE            (16U)
+#define ADC_TRACE_FORMAT_HDR_MAGIC              (0U)
+#define ADC_TRACE_FORMAT_HDR_VERSION            (4U)
+#define ADC_TRACE_FORMAT_HDR_ENTRIES            (6U)
+#define ADC_TRACE_FORMAT_HDR_RECORD_SIZE        (8U)
+#define ADC_TRACE_FORMAT_HDR_HEAD               (12U)
+
+/**
+* @brief          Record of one event: size and byte offset of its fields.
+* @details        TIME 32 bits, SEQ 16 bits (low bits of the write index, the commit marker),
+*                 EVENT 8 bits, UNIT 8 bits, GROUP 16 bits and DATA 16 bits.
+*/
+#define ADC_TRACE_FORMAT_RECORD_SIZE            (12U)
+#define ADC_TRACE_FORMAT_REC_TIME               (0U)
+#define ADC_TRACE_FORMAT_REC_SEQ                (4U)
+#define ADC_TRACE_FORMAT_REC_EVENT              (6U)
+#define ADC_TRACE_FORMAT_REC_UNIT               (7U)
+#define ADC_TRACE_FORMAT_REC_GROUP              (8U)
+#define ADC_TRACE_FORMAT_REC_DATA               (10U)
+
+/**
+* @brief          Event codes, see ADC_TRACE_EV_x of Adc_Trace.h for the content of DATA.
+*/
+#define ADC_TRACE_FORMAT_EV_QUEUE_INSERT        (1U)
+#define ADC_TRACE_FORMAT_EV_QUEUE_REMOVE        (2U)
+#define ADC_TRACE_FORMAT_EV_START               (3U)
+#define ADC_TRACE_FORMAT_EV_CHUNK               (4U)
+#define ADC_TRACE_FORMAT_EV_END                 (5U)
+#define ADC_TRACE_FORMAT_EV_LIMIT_FAIL          (6U)
+#define ADC_TRACE_FORMAT_EV_ABORT               (7U)
+#define ADC_TRACE_FORMAT_EV_PDB_ERROR           (8U)
+#define ADC_TRACE_FORMAT_EV_NOTIFY              (9U)
+/** @brief Highest event code */
+#define ADC_TRACE_FORMAT_EV_LAST                ADC_TRACE_FORMAT_EV_NOTIFY
+
+/*==================================================================================================
+*                                             ENUMS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_TRACEFORMAT_H */
+
+/** @} */
@@ -44,6 +44,10 @@ extern "C"{
 * The compiler/linker shall be checked to ensure that 31 character significance 
 * and case sensitivity are supported for external identifiers.
 *
+* @section Adc_Types_h_REF_4
+* Violates MISRA 2004 Advisory Rule 19.7, A function should be used in preference to a function-like
+* macro. The time source is read in interrupt context, where a call would add to the latency measured.
+*
 * @section [global]
 * Violates MISRA 2004 Required Rule 5.1, 
 * Identifiers (internal and external) shall not rely on the significance of more than 31 characters
@@ -177,6 +181,508 @@ extern "C"{
 #define ADC_BITS_RESOLUTION_10_U8                  (10U)
 #define ADC_BITS_RESOLUTION_12_U8                  (12U)
 
+/**
+* @brief          Software normal queue implementation.
+* @details        STD_OFF keeps the queue as an array sorted by priority. STD_ON keeps only the
+*                 running group in SwNormalQueue[0] and the waiting groups in one FIFO per priority
+*                 level, indexed by a two level priority bitmap, so that inserting and removing a
+*                 group is independent of the queue depth. Requires priorities and queuing.
+*/
+#ifndef ADC_PRIORITY_QUEUE_BUCKETS
+#define ADC_PRIORITY_QUEUE_BUCKETS                 (STD_OFF)
+#endif
+
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+#if ((ADC_PRIORITY_IMPLEMENTATION == ADC_PRIORITY_NONE) || (ADC_ENABLE_QUEUING == STD_OFF))
+#error "ADC_PRIORITY_QUEUE_BUCKETS requires ADC_PRIORITY_IMPLEMENTATION and ADC_ENABLE_QUEUING"
+#endif
+/**
+* @brief          Number of priority levels (range of Adc_GroupPriorityType) and bitmap words.
+*/
+#define ADC_QUEUE_PRIORITY_LEVELS                  (256U)
+#define ADC_QUEUE_PRIORITY_WORDS                   (ADC_QUEUE_PRIORITY_LEVELS >> 5U)
+
+/**
+* @brief          Link value of a group which is not waiting in a priority bucket.
+*/
+#define ADC_QUEUE_NO_GROUP                         ((Adc_GroupType)0xFFFFU)
+#endif /* ADC_PRIORITY_QUEUE_BUCKETS == STD_ON */
+
+/**
+* @brief          Per group selection of the result buffer layout.
+* @details        STD_OFF keeps the AUTOSAR layout, where all samples of a channel are contiguous.
+*                 STD_ON adds eResultLayout to the group configuration so that a group can store
+*                 all channels of one sample contiguously instead.
+*/
+#ifndef ADC_ENABLE_SAMPLE_MAJOR_RESULTS
+#define ADC_ENABLE_SAMPLE_MAJOR_RESULTS            (STD_OFF)
+#endif
+
+/**
+* @brief          Zero-copy access to the latest completed sample of a group.
+* @details        Enables Adc_GetSampleView and Adc_ValidateSampleView. The sample sequence number
+*                 is maintained by the end of conversion handlers, which the optimized one-shot
+*                 hardware trigger mode does not run.
+*/
+#ifndef ADC_SAMPLE_VIEW_API
+#define ADC_SAMPLE_VIEW_API                        (STD_OFF)
+#endif
+
+#if ((ADC_SAMPLE_VIEW_API == STD_ON) && (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_ON))
+#error "ADC_SAMPLE_VIEW_API is not supported with ADC_OPTIMIZE_ONESHOT_HW_TRIGGER"
+#endif
+
+/**
+* @brief          Lock-free publication of the group results.
+* @details        STD_ON replaces exclusive areas 16 and 17 of the end of conversion handlers and
+*                 exclusive area 27 of Adc_ReadGroup by a per group sequence counter. The writer
+*                 makes the counter odd while it updates the result buffer or ResultIndex, and
+*                 Adc_ReadGroup repeats its copy until the counter was even and unchanged around it.
+*                 The state update after the read, under exclusive area 29 otherwise, is done
+*                 without exclusive area: a completion set by a handler during it is put back.
+*                 Results written by the DMA are published when its transfer completes, so a copy
+*                 is only protected against the sample being written when NumSamples is at least 2.
+*/
+#ifndef ADC_RESULT_SEQLOCK
+#define ADC_RESULT_SEQLOCK                         (STD_OFF)
+#endif
+
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+/**
+* @brief          Copy attempts of Adc_ReadGroup before it takes exclusive area 27 as a fallback.
+*/
+#ifndef ADC_RESULT_SEQLOCK_RETRIES
+#define ADC_RESULT_SEQLOCK_RETRIES                 (4U)
+#endif
+#endif /* ADC_RESULT_SEQLOCK == STD_ON */
+
+/**
+* @brief          Reading the results of several groups with one call.
+* @details        Enables Adc_ReadGroups, which validates the whole list of groups first and then
+*                 copies the last sample of every group as Adc_ReadGroup does, without masking
+*                 interrupts for more than one group at a time.
+*/
+#ifndef ADC_READ_GROUPS_API
+#define ADC_READ_GROUPS_API                        (STD_OFF)
+#endif
+
+#if ((ADC_READ_GROUPS_API == STD_ON) && (ADC_READ_GROUP_API == STD_OFF))
+#error "ADC_READ_GROUPS_API requires ADC_READ_GROUP_API"
+#endif
+
+/**
+* @brief          Limit checking against ranges precomputed at initialization.
+* @details        STD_ON converts the range of every channel to a single interval test at Adc_Init,
+*                 so that Adc_CheckConversionValuesInRange no longer depends on the range kind or
+*                 on the resolution of the unit. Costs one Adc_LimitRangeType per channel.
+*/
+#ifndef ADC_LIMIT_CHECK_PRECOMPUTED
+#define ADC_LIMIT_CHECK_PRECOMPUTED                (STD_OFF)
+#endif
+
+#if (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON)
+#if (ADC_ENABLE_LIMIT_CHECK == STD_OFF)
+#error "ADC_LIMIT_CHECK_PRECOMPUTED requires ADC_ENABLE_LIMIT_CHECK"
+#endif
+/**
+* @brief          Number of channels per hardware unit configuration with a precomputed range.
+*                 Must be higher than every channel index checked by a group of the configuration:
+*                 Adc_Init rejects other configurations with ADC_E_PARAM_CONFIG.
+*/
+#ifndef ADC_LIMIT_CHECK_MAX_CHANNELS
+#define ADC_LIMIT_CHECK_MAX_CHANNELS               (64U)
+#endif
+#endif /* ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON */
+
+/**
+* @brief          Limit checking done by the ADC compare function.
+* @details        STD_ON programs CV1, CV2 and SC2[ACFE, ACFGT, ACREN] for hardware triggered, interrupt
+*                 driven groups with one channel and limit checking enabled, so that COCO is only set
+*                 for conversions in range. Out of range conversions raise no interrupt at all.
+*                 Unlike the software check, they are therefore not seen by the driver: the group
+*                 keeps its state and bLimitCheckFailed is not set. Applications which need to know
+*                 that a round was discarded must keep this switch off.
+*/
+#ifndef ADC_LIMIT_CHECK_HW_COMPARE
+#define ADC_LIMIT_CHECK_HW_COMPARE                 (STD_OFF)
+#endif
+
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
+#if ((ADC_ENABLE_LIMIT_CHECK == STD_OFF) || (ADC_HW_TRIGGER_API == STD_OFF))
+#error "ADC_LIMIT_CHECK_HW_COMPARE requires ADC_ENABLE_LIMIT_CHECK and ADC_HW_TRIGGER_API"
+#endif
+#endif /* ADC_LIMIT_CHECK_HW_COMPARE == STD_ON */
+
+/**
+* @brief          Register images of the conversion chain built ahead of the conversion.
+* @details        STD_ON computes the SC1n, PDB CHnC1, CHnDLYm and MOD values of every chunk of every
+*                 group at Adc_Init and again on Adc_SetChannel. Starting a chunk then only copies the
+*                 image to the registers instead of resolving channels, delays and the PDB period.
+*/
+#ifndef ADC_PRECOMPUTED_REGISTER_IMAGES
+#define ADC_PRECOMPUTED_REGISTER_IMAGES            (STD_OFF)
+#endif
+
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+#ifndef ADC_PDB_SUPPORTED
+#error "ADC_PRECOMPUTED_REGISTER_IMAGES requires the PDB"
+#endif
+/**
+* @brief          Number of channels of the longest group of the configuration.
+* @details        Sizes the register images, and the DMA reload list of ADC_DMA_CHAIN_RELOAD, so that
+*                 every chunk of every group is imaged. With ADC_DMA_CHAIN_RELOAD, Adc_Init reports
+*                 ADC_E_PARAM_CONFIG for a longer group.
+*/
+#ifndef ADC_MAX_GROUP_CHANNELS
+#define ADC_MAX_GROUP_CHANNELS                     (2U * ADC_NUM_SC1_N_REGISTER_USED)
+#endif
+
+/**
+* @brief          Number of chunks (ADC_NUM_SC1_N_REGISTER_USED channels each) imaged per group.
+*                 Chunks beyond this count are configured as without images.
+*/
+#ifndef ADC_REGISTER_IMAGE_MAX_CHUNKS
+#define ADC_REGISTER_IMAGE_MAX_CHUNKS              (((ADC_MAX_GROUP_CHANNELS) + (ADC_NUM_SC1_N_REGISTER_USED - 1U)) / ADC_NUM_SC1_N_REGISTER_USED)
+#endif
+#endif /* ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON */
+
+/**
+* @brief          Chunks after the first one reloaded by the DMA instead of the group interrupt.
+* @details        STD_ON links, for DMA groups whose chunks are all imaged, scatter/gather TCDs after
+*                 the result transfer of every chunk which copy the register image of the next chunk
+*                 to SC1n and to the PDB and trigger it. The group then ends with a single DMA
+*                 interrupt whatever its number of chunks. Other groups are converted as before.
+*/
+#ifndef ADC_DMA_CHAIN_RELOAD
+#define ADC_DMA_CHAIN_RELOAD                       (STD_OFF)
+#endif
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+#if ((ADC_PRECOMPUTED_REGISTER_IMAGES == STD_OFF) || (!defined(ADC_DMA_SUPPORTED)))
+#error "ADC_DMA_CHAIN_RELOAD requires ADC_PRECOMPUTED_REGISTER_IMAGES and DMA support"
+#endif
+#if ((ADC_REGISTER_IMAGE_MAX_CHUNKS * ADC_NUM_SC1_N_REGISTER_USED) < ADC_MAX_GROUP_CHANNELS)
+#error "ADC_REGISTER_IMAGE_MAX_CHUNKS does not cover ADC_MAX_GROUP_CHANNELS, the longest groups would not be reloaded by the DMA"
+#endif
+#endif /* ADC_DMA_CHAIN_RELOAD == STD_ON */
+
+/**
+* @brief          Paired groups converted at the same time on two hardware units.
+* @details        STD_ON lets a software triggered group name, through PairedGroup, a partner group
+*                 of another hardware unit. Starting either group starts both, with the two PDB
+*                 counters triggered by consecutive writes, and a single notification, the one of
+*                 the lower group ID, is raised once both halves have converted the sample.
+*                 Adc_ReadPairedGroup returns the results of the two halves interleaved.
+*/
+#ifndef ADC_PAIRED_GROUPS
+#define ADC_PAIRED_GROUPS                          (STD_OFF)
+#endif
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+#if ((ADC_ENABLE_START_STOP_GROUP_API == STD_OFF) || (ADC_READ_GROUP_API == STD_OFF) || \
+     (!defined(ADC_PDB_SUPPORTED)))
+#error "ADC_PAIRED_GROUPS requires the start/stop and read group APIs and the PDB"
+#endif
+/**
+* @brief          PairedGroup value of groups converted on their own.
+*/
+#define ADC_NO_PAIRED_GROUP                        ((Adc_GroupType)0xFFFFU)
+#endif /* ADC_PAIRED_GROUPS == STD_ON */
+
+/**
+* @brief          Scans of logical channels balanced across the two halves of a paired group.
+* @details        STD_ON lets both halves of a pair reference, through pBalancedScan, one list of
+*                 logical channels giving the channel of each pin on every hardware unit it is
+*                 routed to. Adc_Init splits the list between the two units, channels routed to a
+*                 single unit staying on it, so that the halves convert about the same number of
+*                 channels. The halves get their channels as through Adc_SetChannel and
+*                 Adc_ReadPairedGroup merges their results back in logical channel order.
+*/
+#ifndef ADC_BALANCED_SCANS
+#define ADC_BALANCED_SCANS                         (STD_OFF)
+#endif
+
+#if (ADC_BALANCED_SCANS == STD_ON)
+#if ((ADC_PAIRED_GROUPS == STD_OFF) || (ADC_SETCHANNEL_API == STD_OFF))
+#error "ADC_BALANCED_SCANS requires ADC_PAIRED_GROUPS and ADC_SETCHANNEL_API"
+#endif
+/**
+* @brief          Channel of a logical channel on a hardware unit its pin is not routed to.
+*/
+#define ADC_BALANCED_NOT_ROUTED                    ((Adc_ChannelType)0xFFU)
+#endif /* ADC_BALANCED_SCANS == STD_ON */
+
+/**
+* @brief          Calibration started by Adc_CalibrateAsync and completed in the background.
+* @details        STD_ON adds Adc_CalibrateAsync, which prepares the unit and starts the calibration
+*                 inside a short exclusive area then returns. The end of calibration interrupt of
+*                 the unit, or Adc_GetCalibrationState for units served without it, restores the
+*                 unit and calls the pCalibrationNotification of its configuration.
+*/
+#ifndef ADC_CALIBRATION_ASYNC
+#define ADC_CALIBRATION_ASYNC                      (STD_OFF)
+#endif
+
+#if ((ADC_CALIBRATION_ASYNC == STD_ON) && (ADC_CALIBRATION == STD_OFF))
+#error "ADC_CALIBRATION_ASYNC requires ADC_CALIBRATION"
+#endif
+
+/**
+* @brief          Calibration results kept by the application across power cycles.
+* @details        STD_ON adds Adc_GetCalibrationData, which exports the calibration registers and
+*                 USR_OFS of a calibrated unit, and makes Adc_Init load them back from the
+*                 pCalibrationData of the unit configuration when that copy is still valid, so the
+*                 application can skip Adc_Calibrate at startup.
+*/
+#ifndef ADC_CALIBRATION_PERSISTENCE
+#define ADC_CALIBRATION_PERSISTENCE                (STD_OFF)
+#endif
+
+#if ((ADC_CALIBRATION_PERSISTENCE == STD_ON) && (ADC_CALIBRATION == STD_OFF))
+#error "ADC_CALIBRATION_PERSISTENCE requires ADC_CALIBRATION"
+#endif
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+/**
+* @brief          First word of the calibration data exported by Adc_GetCalibrationData ("ADCC").
+*/
+#define ADC_CALIBRATION_DATA_SIGNATURE             ((uint32)0x41444343UL)
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
+/**
+* @brief          Stop of a running conversion that does not wait for the unit to respond.
+* @details        STD_ON makes the stop of a group, also when a higher priority group preempts it,
+*                 write the conversion disable to the SC1n registers and return. A unit that has not
+*                 taken the disable yet is left with an abort pending; the next group is started by
+*                 Adc_MainFunction or by the end of conversion interrupt once it has.
+*/
+#ifndef ADC_ASYNC_ABORT
+#define ADC_ASYNC_ABORT                            (STD_OFF)
+#endif
+
+#if ((ADC_ASYNC_ABORT == STD_ON) && (ADC_ENABLE_START_STOP_GROUP_API == STD_OFF) && (ADC_PRIORITY_IMPLEMENTATION == ADC_PRIORITY_NONE))
+#error "ADC_ASYNC_ABORT requires ADC_ENABLE_START_STOP_GROUP_API or group priorities"
+#endif
+
+/**
+* @brief          Adc_MainFunction periods an abort may stay pending before Adc_E_TimeoutCfg is reported.
+* @details        The first Adc_MainFunction call made more than ADC_ABORT_TIMEOUT_PERIODS periods
+*                 after the stop reports the timeout and starts the next group anyway. The end of
+*                 conversion interrupt completes an abort but does not count towards the timeout.
+*/
+#ifndef ADC_ABORT_TIMEOUT_PERIODS
+#define ADC_ABORT_TIMEOUT_PERIODS                  (2UL)
+#endif
+
+/**
+* @brief          Idle HW units kept in low power between the periodic conversions of their groups.
+* @details        STD_ON makes Adc_Main_PowerTransitionManager switch an idle unit to its low power
+*                 clock configuration and back to full power u16PowerWakeupTicks calls before the
+*                 next conversion expected from the u32PowerPeriodTicks of its groups. A conversion
+*                 started on a unit in low power wakes it first. The time spent in each power state
+*                 is counted per unit, in calls of the manager, and read with Adc_GetPowerStatistics.
+*/
+#ifndef ADC_POWER_DUTY_CYCLING
+#define ADC_POWER_DUTY_CYCLING                     (STD_OFF)
+#endif
+
+#if ((ADC_POWER_DUTY_CYCLING == STD_ON) && (ADC_POWER_STATE_ASYNCH_MODE_SUPPORTED == STD_OFF))
+#error "ADC_POWER_DUTY_CYCLING requires ADC_POWER_STATE_ASYNCH_MODE_SUPPORTED"
+#endif
+
+/**
+* @brief          Clock configuration of each HW unit chosen from its load.
+* @details        STD_ON makes the driver pick between the normal (fast) and the alternate (low
+*                 power) clock configurations of ADC_DUAL_CLOCK_MODE each time a group is started
+*                 from the software queue. The unit takes the normal one when u8ClockFastQueueDepth
+*                 groups are queued or a queued group is within u32ClockDeadlineMargin of its
+*                 u32ConversionDeadline, and the alternate one when at most u8ClockSlowQueueDepth
+*                 groups are queued and no deadline is close. The clock is left unchanged while a
+*                 hardware triggered group is enabled on the unit. Conversions and time spent in
+*                 each configuration are read with Adc_GetClockStatistics.
+*/
+#ifndef ADC_ADAPTIVE_CLOCK
+#define ADC_ADAPTIVE_CLOCK                         (STD_OFF)
+#endif
+
+#if ((ADC_ADAPTIVE_CLOCK == STD_ON) && (ADC_DUAL_CLOCK_MODE == STD_OFF))
+#error "ADC_ADAPTIVE_CLOCK requires ADC_DUAL_CLOCK_MODE"
+#endif
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+/**
+* @brief          Number of Adc_DualClockModeType values.
+*/
+#define ADC_DUAL_CLOCK_MODES                       (2U)
+#endif /* ADC_ADAPTIVE_CLOCK == STD_ON */
+
+/**
+* @brief          Latency histograms of every group, from its start to its notification.
+* @details        STD_ON timestamps the start request of a software group, the handling of each
+*                 partial conversion (chunk) interrupt and the dispatch of the group notification
+*                 with ADC_GET_TIMESTAMP. The intervals are accumulated per group in log2
+*                 histograms with their maximum, read with Adc_GetLatencyHistogram. Each start
+*                 costs one time read, each chunk interrupt one time read and one histogram update,
+*                 each notification one time read and two histogram updates. A histogram update
+*                 is branch bounded: five compares for the bucket and three stores. STD_OFF removes
+*                 the timestamps and the storage.
+*/
+#ifndef ADC_LATENCY_HISTOGRAMS
+#define ADC_LATENCY_HISTOGRAMS                     (STD_OFF)
+#endif
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+/**
+* @brief          Buckets of a latency histogram.
+* @details        Bucket 0 counts the intervals of 0 ticks, bucket b the intervals of 2^(b-1) to
+*                 2^b - 1 ticks, and the last bucket every longer interval.
+*/
+#ifndef ADC_LATENCY_BUCKETS
+#define ADC_LATENCY_BUCKETS                        (24U)
+#endif
+
+#if ((ADC_LATENCY_BUCKETS < 2U) || (ADC_LATENCY_BUCKETS > 33U))
+#error "ADC_LATENCY_BUCKETS must be in the range 2 to 33"
+#endif
+
+/**
+* @brief          Number of Adc_LatencyStageType values.
+*/
+#define ADC_LATENCY_STAGES                         (3U)
+#endif /* ADC_LATENCY_HISTOGRAMS == STD_ON */
+
+/**
+* @brief          Binary trace of the driver events.
+* @details        STD_ON records the queue inserts and removals, the conversion starts, the
+*                 partial conversion (chunk) interrupts, the ends of conversion, the limit check
+*                 rejections, the aborts, the PDB sequence errors and the notifications in the
+*                 ring Adc_TraceBuffer, each with a timestamp of ADC_GET_TIMESTAMP. The ring keeps
+*                 the last ADC_EVENT_TRACE_ENTRIES events and is read from a RAM dump by the host
+*                 tool tools/Adc_TraceDecode.c. Recording an event takes no lock: one time read,
+*                 an increment of the write index and six stores. STD_OFF removes the calls and
+*                 the ring.
+*/
+#ifndef ADC_EVENT_TRACE
+#define ADC_EVENT_TRACE                            (STD_OFF)
+#endif
+
+#if (ADC_EVENT_TRACE == STD_ON)
+/**
+* @brief          Events kept by the trace ring, a power of two.
+*/
+#ifndef ADC_EVENT_TRACE_ENTRIES
+#define ADC_EVENT_TRACE_ENTRIES                    (256U)
+#endif
+
+#if ((ADC_EVENT_TRACE_ENTRIES < 16U) || (ADC_EVENT_TRACE_ENTRIES > 32768U) || \
+     (0U != (ADC_EVENT_TRACE_ENTRIES & (ADC_EVENT_TRACE_ENTRIES - 1U))))
+#error "ADC_EVENT_TRACE_ENTRIES must be a power of two in the range 16 to 32768"
+#endif
+#endif /* ADC_EVENT_TRACE == STD_ON */
+
+/**
+* @brief          Notification of a streaming group once per batch of samples.
+* @details        STD_ON adds pNotifyCoalescing to the group configuration. The end of conversion
+*                 interrupt notifies a group that has one when the samples completed since its last
+*                 notification reach Samples, when the buffer is filled up to Watermark or to its
+*                 end, or when u32Window ticks of ADC_GET_TIMESTAMP have passed since the first of
+*                 them. The window is checked at the end of a sample and by Adc_MainFunction, no
+*                 timer is started for it. Adc_StopGroupConversion and Adc_DisableHardwareTrigger
+*                 notify the open batch before they stop the group. An ExtendedNotification
+*                 receives the whole batch. The groups transferred by DMA are batched by double
+*                 buffering instead.
+*/
+#ifndef ADC_NOTIFICATION_COALESCING
+#define ADC_NOTIFICATION_COALESCING                (STD_OFF)
+#endif
+
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+#if (ADC_GRP_NOTIF_CAPABILITY == STD_OFF)
+#error "ADC_NOTIFICATION_COALESCING requires ADC_GRP_NOTIF_CAPABILITY"
+#endif
+#if (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_ON)
+#error "ADC_NOTIFICATION_COALESCING is not supported with ADC_OPTIMIZE_ONESHOT_HW_TRIGGER"
+#endif
+#endif /* ADC_NOTIFICATION_COALESCING == STD_ON */
+
+#if ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON) || (ADC_NOTIFICATION_COALESCING == STD_ON))
+#ifndef ADC_GET_TIMESTAMP
+/**
+* @brief          DWT cycle counter of the Cortex-M4 core and its enable bits.
+*/
+#define ADC_DWT_DEMCR_ADDR32                       ((uint32)0xE000EDFCUL)
+#define ADC_DWT_DEMCR_TRCENA_U32                   ((uint32)0x01000000UL)
+#define ADC_DWT_CTRL_ADDR32                        ((uint32)0xE0001000UL)
+#define ADC_DWT_CTRL_CYCCNTENA_U32                 ((uint32)0x00000001UL)
+#define ADC_DWT_CYCCNT_ADDR32                      ((uint32)0xE0001004UL)
+
+/**
+* @brief          Time source of the latency histograms, of the event trace and of the notification
+*                 windows, a free running 32 bits counter.
+* @details        Core clock cycles read from DWT CYCCNT by default, Adc_Init enabling the counter.
+*                 Defining ADC_GET_TIMESTAMP before this file selects another counter, which the
+*                 application keeps running.
+*/
+/** @violates @ref Adc_Types_h_REF_4 Function-like macro defined */
+#define ADC_GET_TIMESTAMP()                        (REG_READ32(ADC_DWT_CYCCNT_ADDR32))
+#endif /* ADC_GET_TIMESTAMP */
+#endif /* ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON) || (ADC_NOTIFICATION_COALESCING == STD_ON)) */
+
+/**
+* @brief          Notification carrying the completed samples.
+* @details        STD_ON adds ExtendedNotification to the group configuration. When it is set, the
+*                 end of conversion handlers call it instead of Notification, with the group, the
+*                 samples completed since the previous call and the sequence number of the first
+*                 of them, so that the handler needs no Adc_ReadGroup or
+*                 Adc_GetStreamLastPointer. The sequence number is maintained by the end of
+*                 conversion handlers, which the optimized one-shot hardware trigger mode does not
+*                 run.
+*/
+#ifndef ADC_EXTENDED_NOTIFICATION
+#define ADC_EXTENDED_NOTIFICATION                  (STD_OFF)
+#endif
+
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+#if (ADC_GRP_NOTIF_CAPABILITY == STD_OFF)
+#error "ADC_EXTENDED_NOTIFICATION requires ADC_GRP_NOTIF_CAPABILITY"
+#endif
+#if (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_ON)
+#error "ADC_EXTENDED_NOTIFICATION is not supported with ADC_OPTIMIZE_ONESHOT_HW_TRIGGER"
+#endif
+#endif /* ADC_EXTENDED_NOTIFICATION == STD_ON */
+
+/**
+* @brief          Notifications called outside of the end of conversion interrupts.
+* @details        STD_ON adds bDeferredNotification to the group configuration. The interrupt
+*                 completing a group with bDeferredNotification set posts the group into a queue of
+*                 its HW unit instead of calling Notification, Adc_Main_NotificationDispatcher calls
+*                 the notifications of the posted groups. A group already waiting in the queue is
+*                 not posted again, its completions are merged into one call. The completion
+*                 interrupts of a unit are the only writers of its queue and must not preempt each
+*                 other. An ExtendedNotification is always called from the interrupt, its samples
+*                 could be overwritten before the dispatch.
+*/
+#ifndef ADC_DEFERRED_NOTIFICATION
+#define ADC_DEFERRED_NOTIFICATION                  (STD_OFF)
+#endif
+
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+/**
+* @brief          Groups waiting in the deferred notification queue of a HW unit, a power of two.
+*/
+#ifndef ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE
+#define ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE       (8U)
+#endif
+
+#if (ADC_GRP_NOTIF_CAPABILITY == STD_OFF)
+#error "ADC_DEFERRED_NOTIFICATION requires ADC_GRP_NOTIF_CAPABILITY"
+#endif
+#if ((ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE == 0U) || \
+     ((ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE & (ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE - 1U)) != 0U))
+#error "ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE must be a power of two"
+#endif
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+
 /*==================================================================================================
 *                                             ENUMS
 ==================================================================================================*/
@@ -251,6 +757,20 @@ typedef enum
     ADC_CONV_MODE_CONTINUOUS    /**< @brief Continuous conversion mode */
 } Adc_GroupConvModeType;
 
+#if (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON)
+/**
+* @brief          Adc group result buffer layout.
+* @details        Channel major: result of channel c, sample s is at [c * NumSamples + s].
+*                 Sample major: result of channel c, sample s is at [s * ChannelCount + c].
+*
+*/
+typedef enum
+{
+    ADC_RESULT_LAYOUT_CHANNEL_MAJOR = 0U, /**< @brief Samples of one channel are contiguous */
+    ADC_RESULT_LAYOUT_SAMPLE_MAJOR        /**< @brief Channels of one sample are contiguous */
+} Adc_ResultLayoutType;
+#endif /* (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON) */
+
 /**
 * @brief          Adc group replacement.
 * @details        Used for value received by Tressos interface configuration.
@@ -418,6 +938,87 @@ typedef enum
 } Adc_PowerStateRequestResultType;
 #endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
 
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+/**
+* @brief      Power statistics of a HW unit
+* @details    Filled by Adc_Main_PowerTransitionManager, returned by Adc_GetPowerStatistics.
+*/
+typedef struct
+{
+    uint32 au32StateTicks[ADC_NODEFINE_POWER];  /**< @brief Calls of the manager spent in each power state */
+    uint32 u32Transitions;                      /**< @brief Changes of power state */
+    uint32 u32LateWakeups;                      /**< @brief Conversions started while the unit was in low power */
+} Adc_PowerStatisticsType;
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+/**
+* @brief      Clock statistics of a HW unit
+* @details    Indexed by Adc_DualClockModeType. Times are in ticks of the pfReadTime of the unit.
+*/
+typedef struct
+{
+    uint32 au32Conversions[ADC_DUAL_CLOCK_MODES];   /**< @brief Software group conversions completed */
+    uint32 au32Time[ADC_DUAL_CLOCK_MODES];          /**< @brief Time spent in each clock configuration */
+    uint32 u32Switches;                             /**< @brief Changes of clock configuration */
+    uint32 u32DeadlineMisses;                       /**< @brief Groups converted after their u32ConversionDeadline */
+} Adc_ClockStatisticsType;
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+/**
+* @brief      Intervals measured by the latency histograms of a group
+* @details    Times are in ticks of ADC_GET_TIMESTAMP. The start of a hardware triggered
+*             group is not seen by the CPU, so it has no ADC_LATENCY_END_TO_END samples and its
+*             ADC_LATENCY_CHUNK samples begin with the second chunk of each conversion.
+*/
+typedef enum
+{
+    ADC_LATENCY_CHUNK = 0U,     /**< @brief Start request or previous chunk interrupt to a chunk interrupt */
+    ADC_LATENCY_DISPATCH,       /**< @brief Last chunk interrupt of a conversion to its notification */
+    ADC_LATENCY_END_TO_END      /**< @brief Start of a conversion to its notification */
+} Adc_LatencyStageType;
+
+/**
+* @brief      Latency histogram of a group
+* @details    Filled from the interrupts of the group, and from Adc_Main_NotificationDispatcher for
+*             a deferred notification, returned by Adc_GetLatencyHistogram.
+*/
+typedef struct
+{
+    uint32 au32Bucket[ADC_LATENCY_BUCKETS];   /**< @brief Samples of each log2 bucket, see ADC_LATENCY_BUCKETS */
+    uint32 u32Count;                          /**< @brief Samples recorded since Adc_Init */
+    uint32 u32Max;                            /**< @brief Longest interval recorded */
+} Adc_LatencyHistogramType;
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+/**
+* @brief      State of the asynchronous calibration of a unit
+* @details    Returned by Adc_GetCalibrationState.
+*
+*/
+typedef enum
+{
+    ADC_CALIBRATION_IDLE = 0U,  /**< @brief No calibration started or the last one has completed. */
+    ADC_CALIBRATION_ONGOING     /**< @brief Calibration started by Adc_CalibrateAsync still running. */
+} Adc_CalibrationStateType;
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+/**
+* @brief      Where the calibration registers of a unit come from
+* @details    Returned by Adc_GetCalibrationOrigin.
+*
+*/
+typedef enum
+{
+    ADC_CALIBRATION_NONE = 0U,  /**< @brief Not calibrated since Adc_Init, or the last calibration failed. */
+    ADC_CALIBRATION_RESTORED,   /**< @brief Loaded by Adc_Init from the pCalibrationData of the unit. */
+    ADC_CALIBRATION_MEASURED    /**< @brief Written by a successful Adc_Calibrate or Adc_CalibrateAsync. */
+} Adc_CalibrationOriginType;
+#endif /* (ADC_CALIBRATION_PERSISTENCE == STD_ON) */
+
 /*==================================================================================================
                                  STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
@@ -425,6 +1026,18 @@ typedef void (*Adc_NotifyType)(void);     /**< @brief Notification function poin
 typedef void (*Adc_WdgNotifyType)(void);  /**< @brief Notification function pointer definition - WDG */
 typedef uint16 Adc_ChannelIndexType;      /**< @brief Number of channels */
 typedef uint8 Adc_HwUnitType;             /**< @brief Numeric ID of an ADC Hw Unit */
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+/** @brief End of asynchronous calibration callback, Result is the Adc_UnitSelfTestStatus reported */
+typedef void (*Adc_CalibrationNotifyType)(Adc_HwUnitType Unit, Std_ReturnType Result);
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+/** @brief Returns the current temperature, in the unit the application stores with the calibration */
+typedef sint16 (*Adc_TemperatureReadType)(void);
+#endif /* (ADC_CALIBRATION_PERSISTENCE == STD_ON) */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+/** @brief Returns a free running time, wrapping at 2^32, in ticks chosen by the application */
+typedef uint32 (*Adc_TimeReadType)(void);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
 typedef uint8 Adc_ClockSourceType;        /**< @brief clock source for ADC */
 typedef uint16 Adc_VoltageSourceType;     /**< @brief reference voltage source */
 typedef uint16 Adc_QueueIndexType;        /**< @brief Index for the queue of groups */
@@ -450,6 +1063,33 @@ typedef uint8 Adc_SamplingTimeType;       /**< @brief sampling time */
 typedef uint16 Adc_StreamNumSampleType;   /**< @brief Number of samples of a streaming conversion buffer */
 /** @implements     Adc_HwTriggerTimerType_uint */
 typedef uint16 Adc_HwTriggerTimerType;    /**< @brief Type for the reload value of the ADC embedded timer */
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+/**
+* @brief          Notification with the samples completed since the previous call.
+* @details        pSamples is the first of SampleCount consecutive samples of the group result
+*                 buffer, which keeps its layout: channel n of sample k is at
+*                 pSamples[(n * NumSamples) + k], or pSamples[(k * channels) + n] for a sample-major
+*                 group. u32Sequence is the number of samples the group completed since Adc_Init
+*                 before pSamples[0]; a gap with the previous call counts the samples completed
+*                 while the notification was disabled. The notification of a pair of groups
+*                 receives the samples of the group it is configured on.
+*/
+typedef void (*Adc_ExtendedNotifyType)(Adc_GroupType Group, const Adc_ValueGroupType *pSamples, Adc_StreamNumSampleType SampleCount, uint32 u32Sequence);
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+/**
+* @brief      Deferred notification counters of a group
+* @details    Counted since Adc_Init, returned by Adc_GetNotificationStatistics.
+*/
+typedef struct
+{
+    uint32 u32Posted;       /**< @brief Completions posted into the queue */
+    uint32 u32Merged;       /**< @brief Completions merged with the one already waiting */
+    uint32 u32Dropped;      /**< @brief Completions lost on a full queue */
+    uint32 u32Dispatched;   /**< @brief Notifications called by Adc_Main_NotificationDispatcher */
+} Adc_NotificationStatisticsType;
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
 
 /**
 * @brief          Structure for validation results
@@ -462,6 +1102,38 @@ typedef struct
     VAR(Std_ReturnType, AUTOMATIC) ValidParams; /**< @brief Return status */
 } Adc_ValidationResultType; 
 
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+/**
+* @brief          Read-only view on one sample of a group result buffer.
+* @details        Channel n of the sample is at pSample[n * u32Stride]. u32Sequence identifies the
+*                 sample for Adc_ValidateSampleView.
+*
+*/
+typedef struct
+{
+    P2CONST(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pSample; /**< @brief First channel of the sample */
+    VAR(uint32, AUTOMATIC) u32Stride;                              /**< @brief Distance between two channels */
+    VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount;             /**< @brief Number of channels in the sample */
+    VAR(uint32, AUTOMATIC) u32Sequence;                            /**< @brief Sequence number of the sample */
+} Adc_SampleViewType;
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
+
+#if (ADC_READ_GROUPS_API == STD_ON)
+/**
+* @brief          One entry of the list passed to Adc_ReadGroups.
+* @details        Group and pDataBuffer are inputs with the same meaning as the parameters of
+*                 Adc_ReadGroup. ReadResult is written by Adc_ReadGroups with the value
+*                 Adc_ReadGroup would have returned for the group.
+*
+*/
+typedef struct
+{
+    VAR(Adc_GroupType, AUTOMATIC) Group;                                /**< @brief Group to read */
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pDataBuffer;    /**< @brief Destination of the channel values */
+    VAR(Std_ReturnType, AUTOMATIC) ReadResult;                          /**< @brief E_OK if the results were copied */
+} Adc_ReadGroupRequestType;
+#endif /* (ADC_READ_GROUPS_API == STD_ON) */
+
 /**
 * @brief          Structure for group status.
 * @details        This structure contains the group status information.
@@ -487,6 +1159,57 @@ typedef struct
 #if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
     volatile VAR(boolean, AUTOMATIC) bLimitCheckFailed;   /**< @brief check limit check fail */
 #endif /* ADC_ENABLE_LIMIT_CHECK == STD_ON */
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
+    VAR(boolean, AUTOMATIC) bHwCompare;   /**< @brief Limit checking done by the ADC compare function */
+#endif /* ADC_LIMIT_CHECK_HW_COMPARE == STD_ON */
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+    volatile VAR(uint32, AUTOMATIC) u32SampleSequence;  /**< @brief Completed samples, advanced by NumSamples when ResultIndex restarts */
+#endif /* ADC_SAMPLE_VIEW_API == STD_ON */
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+    VAR(uint32, AUTOMATIC) u32CompletedSamples;  /**< @brief Samples completed since Adc_Init, u32Sequence of the extended notification */
+#endif /* ADC_EXTENDED_NOTIFICATION == STD_ON */
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+    volatile VAR(boolean, AUTOMATIC) bNotifyPending;  /**< @brief Posted, not yet taken by Adc_Main_NotificationDispatcher */
+    VAR(Adc_NotificationStatisticsType, AUTOMATIC) NotifyStatistics;  /**< @brief Deferred notification counters */
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) NotifyBatchSamples;  /**< @brief Samples completed since the last notification */
+    VAR(uint32, AUTOMATIC) u32NotifyBatchStart;  /**< @brief ADC_GET_TIMESTAMP at the first sample of the batch */
+#endif /* ADC_NOTIFICATION_COALESCING == STD_ON */
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+    volatile VAR(uint32, AUTOMATIC) u32PublishSequence;  /**< @brief Odd while results or ResultIndex are being written */
+    volatile VAR(uint32, AUTOMATIC) u32CompletionSequence;  /**< @brief Incremented after each eConversion change of the end of conversion handlers */
+    volatile VAR(Adc_StatusType, AUTOMATIC) eCompletion;  /**< @brief Last eConversion set by the end of conversion handlers */
+#endif /* ADC_RESULT_SEQLOCK == STD_ON */
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+    VAR(Adc_GroupType, AUTOMATIC) QueueNext;   /**< @brief Next group waiting with the same priority */
+    VAR(Adc_GroupType, AUTOMATIC) QueuePrev;   /**< @brief Previous group waiting with the same priority */
+#endif /* ADC_PRIORITY_QUEUE_BUCKETS == STD_ON */
+#if (ADC_PAIRED_GROUPS == STD_ON)
+    volatile VAR(boolean, AUTOMATIC) bPairHalfDone;   /**< @brief Sample converted by this half, not yet by the partner */
+#endif /* ADC_PAIRED_GROUPS == STD_ON */
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    volatile VAR(boolean, AUTOMATIC) bPowerScheduled;  /**< @brief Next start expected one u32PowerPeriodTicks after the last one */
+    VAR(uint32, AUTOMATIC) u32PowerStartTick;   /**< @brief Call of the power manager at the last start */
+#endif /* ADC_POWER_DUTY_CYCLING == STD_ON */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    volatile VAR(boolean, AUTOMATIC) bDeadlinePending; /**< @brief Started with a deadline, not converted yet */
+    VAR(uint32, AUTOMATIC) u32RequestTime;      /**< @brief pfReadTime at Adc_StartGroupConversion */
+#endif /* ADC_ADAPTIVE_CLOCK == STD_ON */
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+    VAR(uint32, AUTOMATIC) u32LatencyStart;       /**< @brief Start of the conversion in progress */
+    VAR(uint32, AUTOMATIC) u32LatencyChunk;       /**< @brief Start or last chunk interrupt of the conversion */
+    VAR(uint32, AUTOMATIC) u32LatencyEnd;         /**< @brief Start of the last conversion completed */
+    VAR(boolean, AUTOMATIC) bLatencyStart;        /**< @brief u32LatencyStart is valid */
+    VAR(boolean, AUTOMATIC) bLatencyChunk;        /**< @brief u32LatencyChunk is valid */
+    VAR(boolean, AUTOMATIC) bLatencyEnd;          /**< @brief u32LatencyEnd is valid and not yet notified */
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+    VAR(uint32, AUTOMATIC) u32LatencyPost;        /**< @brief Last chunk interrupt of the conversion posted for the dispatcher */
+    VAR(uint32, AUTOMATIC) u32LatencyPostEnd;     /**< @brief Start of the conversion posted for the dispatcher */
+    VAR(boolean, AUTOMATIC) bLatencyPostEnd;      /**< @brief u32LatencyPostEnd is valid */
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+    VAR(Adc_LatencyHistogramType, AUTOMATIC) aLatency[ADC_LATENCY_STAGES];  /**< @brief Indexed by Adc_LatencyStageType */
+#endif /* ADC_LATENCY_HISTOGRAMS == STD_ON */
 } Adc_GroupStatusType;
 
 /**
@@ -500,6 +1223,14 @@ typedef struct
     volatile VAR(Adc_QueueIndexType, AUTOMATIC) SwNormalQueueIndex; 
     /** @brief Queued groups indexes, always executing Queue[0] */
     volatile VAR(Adc_GroupType, AUTOMATIC) SwNormalQueue[ADC_QUEUE_MAX_DEPTH_MAX]; 
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+    /** @brief Bit n set when word n of au32PrioBitmap is not zero */
+    VAR(uint8, AUTOMATIC) u8PrioSummary;
+    /** @brief Bit (p % 32) of word (p / 32) set when groups of priority p are waiting */
+    VAR(uint32, AUTOMATIC) au32PrioBitmap[ADC_QUEUE_PRIORITY_WORDS];
+    /** @brief Oldest waiting group of each priority, ADC_QUEUE_NO_GROUP when none */
+    VAR(Adc_GroupType, AUTOMATIC) aPrioHead[ADC_QUEUE_PRIORITY_LEVELS];
+#endif /* ADC_PRIORITY_QUEUE_BUCKETS == STD_ON */
 #if (ADC_HW_TRIGGER_API == STD_ON)
     /** @brief The depth of the hardware injected queue */
     volatile VAR(Adc_GroupType, AUTOMATIC) HwInjectedQueue[ADC_HW_QUEUE]; 
@@ -522,12 +1253,64 @@ typedef struct
     /** @brief Indicates Ctu control mode is ongoing */
     VAR(boolean, AUTOMATIC) bCtuControlOngoing; 
 #endif /* ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON */
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+    /** @brief Calibration started by Adc_CalibrateAsync not completed yet */
+    volatile VAR(boolean, AUTOMATIC) bCalibrationOngoing;
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+    /** @brief Origin of the values in the calibration registers */
+    VAR(Adc_CalibrationOriginType, AUTOMATIC) eCalibrationOrigin;
+    /** @brief Temperature when the calibration registers were measured or stored */
+    VAR(sint32, AUTOMATIC) s32CalibrationTemperature;
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+#if (ADC_ASYNC_ABORT == STD_ON)
+    /** @brief Stopped conversion not yet aborted by the unit */
+    volatile VAR(boolean, AUTOMATIC) bAbortPending;
+    /** @brief Adc_MainFunction periods the pending abort may still last before Adc_E_TimeoutCfg is reported */
+    VAR(uint32, AUTOMATIC) u32AbortTimeout;
+#endif /* ADC_ASYNC_ABORT == STD_ON */
+#if (ADC_POWER_STATE_SUPPORTED == STD_ON)
+    /** @brief Clock configuration currently applied to the unit */
+    volatile VAR(Adc_PowerStateType, AUTOMATIC) ePowerState;
+    /** @brief ADICLK and ADIV fields of CFG1 replaced while in ADC_LOW_POWER */
+    VAR(uint32, AUTOMATIC) u32FullPowerClock;
+#endif /* ADC_POWER_STATE_SUPPORTED == STD_ON */
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    /** @brief Time spent in each power state and transitions */
+    VAR(Adc_PowerStatisticsType, AUTOMATIC) PowerStatistics;
+#endif /* ADC_POWER_DUTY_CYCLING == STD_ON */
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+    /** @brief Groups posted by the completion interrupts, slot (index % size) */
+    volatile VAR(Adc_GroupType, AUTOMATIC) aNotifyQueue[ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE];
+    /** @brief Free running index of the next slot written by the interrupts */
+    volatile VAR(uint32, AUTOMATIC) u32NotifyHead;
+    /** @brief Free running index of the next slot read by Adc_Main_NotificationDispatcher */
+    volatile VAR(uint32, AUTOMATIC) u32NotifyTail;
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    /** @brief Clock configuration currently written to the unit */
+    volatile VAR(Adc_DualClockModeType, AUTOMATIC) eClockMode;
+    /** @brief pfReadTime when eClockMode was last changed or accounted */
+    VAR(uint32, AUTOMATIC) u32ClockModeStart;
+    /** @brief Conversions and time in each clock configuration */
+    VAR(Adc_ClockStatisticsType, AUTOMATIC) ClockStatistics;
+    /** @brief Groups of the unit with bDeadlinePending set */
+    VAR(uint32, AUTOMATIC) u32DeadlinesPending;
+    /** @brief pfReadTime at which the earliest pending deadline of the unit expires */
+    VAR(uint32, AUTOMATIC) u32EarliestDue;
+    /** @brief The group of u32EarliestDue completed, the value is an earlier bound until rescanned */
+    VAR(boolean, AUTOMATIC) bEarliestDueStale;
+#endif /* ADC_ADAPTIVE_CLOCK == STD_ON */
 #if (defined(ADC_DMA_SUPPORTED) && defined(ADC_DMA_SCATTER_GATHER_USED))
     /** @brief Indicates the number of channel segments of group */
     VAR(Adc_ChannelIndexType, AUTOMATIC) NumSegment;
 #endif /* defined(ADC_DMA_SUPPORTED) && defined(ADC_DMA_SCATTER_GATHER_USED) */
 #ifdef ADC_PDB_SUPPORTED
     VAR(uint8, AUTOMATIC) u8Sc1Used;
+#if (ADC_PAIRED_GROUPS == STD_ON)
+    /** @brief Software trigger of the PDB left to Adc_Pdb_StartPairedConversion */
+    VAR(boolean, AUTOMATIC) bPdbTriggerHeld;
+#endif /* ADC_PAIRED_GROUPS == STD_ON */
 #endif /* ADC_PDB_SUPPORTED */
 } Adc_UnitStatusType;
 
@@ -558,6 +1341,60 @@ typedef struct
 } Adc_CalibrationStatusType;
 #endif /* ADC_CALIBRATION == STD_ON */
 
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+/**
+* @brief          Context of a calibration started by Adc_CalibrateAsync
+*/
+typedef struct
+{
+    /** @brief Status updated at the end of the calibration */
+    P2VAR(Adc_CalibrationStatusType, AUTOMATIC, ADC_APPL_DATA) pStatus;
+    /** @brief SC3 restored at the end of the calibration */
+    VAR(uint32, AUTOMATIC) u32Sc3;
+    /** @brief CFG1 restored at the end of the calibration */
+    VAR(uint32, AUTOMATIC) u32Cfg1;
+    /** @brief Adc_GetCalibrationState calls left before the calibration is abandoned */
+    VAR(uint32, AUTOMATIC) u32Timeout;
+} Adc_CalibrationContextType;
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+/**
+* @brief          Calibration results of a unit as stored by the application
+* @details        Filled by Adc_GetCalibrationData. Adc_Init accepts it only when the signature,
+*                 unit, CFG1 and checksum match and the temperature is within range.
+*/
+typedef struct
+{
+    /** @brief ADC_CALIBRATION_DATA_SIGNATURE */
+    VAR(uint32, AUTOMATIC) u32Signature;
+    /** @brief Unit the values were measured on */
+    VAR(uint32, AUTOMATIC) u32Unit;
+    /** @brief Configured CFG1 of the unit (clock source, divider and resolution) */
+    VAR(uint32, AUTOMATIC) u32Cfg1;
+    /** @brief CLPS register */
+    VAR(uint32, AUTOMATIC) u32Clps;
+    /** @brief CLP3 register */
+    VAR(uint32, AUTOMATIC) u32Clp3;
+    /** @brief CLP2 register */
+    VAR(uint32, AUTOMATIC) u32Clp2;
+    /** @brief CLP1 register */
+    VAR(uint32, AUTOMATIC) u32Clp1;
+    /** @brief CLP0 register */
+    VAR(uint32, AUTOMATIC) u32Clp0;
+    /** @brief CLPX register */
+    VAR(uint32, AUTOMATIC) u32Clpx;
+    /** @brief CLP9 register */
+    VAR(uint32, AUTOMATIC) u32Clp9;
+    /** @brief USR_OFS register */
+    VAR(uint32, AUTOMATIC) u32UsrOfs;
+    /** @brief Temperature at calibration, 0 when the unit has no pfReadTemperature */
+    VAR(sint32, AUTOMATIC) s32Temperature;
+    /** @brief Checksum of the words above */
+    VAR(uint32, AUTOMATIC) u32Checksum;
+} Adc_CalibrationDataType;
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
 #if (ADC_SETCHANNEL_API == STD_ON)
 typedef struct
 {
@@ -582,6 +1419,60 @@ typedef struct
     CONST(Adc_ValueGroupType, ADC_CONST) ChannelLowLimit; /**< @brief Low limit channel conversion value */
 } Adc_ChannelLimitCheckingType;
 #endif /* (ADC_ENABLE_LIMIT_CHECK == STD_ON) || defined(__DOXYGEN__) */
+
+#if (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON)
+/**
+* @brief          Range of a channel reduced to one interval.
+* @details        The conversion value is normalized as ((Value & u16ValueMask) >> u8ValueShift).
+*                 It is in range when (uint16)(Normalized - u16Low) <= u16Span, the result being
+*                 inverted when u8Invert is 1.
+*
+*/
+typedef struct
+{
+    VAR(uint16, AUTOMATIC) u16Low;          /**< @brief Lowest value of the interval */
+    VAR(uint16, AUTOMATIC) u16Span;         /**< @brief Width of the interval minus one */
+    VAR(uint16, AUTOMATIC) u16ValueMask;    /**< @brief Significant bits of the conversion value */
+    VAR(uint8, AUTOMATIC) u8ValueShift;     /**< @brief Alignment shift of the conversion value */
+    VAR(uint8, AUTOMATIC) u8Invert;         /**< @brief 1 when the range is outside the interval */
+} Adc_LimitRangeType;
+#endif /* (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) */
+
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+/**
+* @brief          Register image of one chunk of a group.
+* @details        Holds the values written to start the conversion of ADC_NUM_SC1_N_REGISTER_USED
+*                 channels of a group (less for the last chunk). An image with u8NumChannel equal
+*                 to 0 has not been built and is not used.
+*
+*/
+typedef struct
+{
+    VAR(uint32, AUTOMATIC) au32Sc1[ADC_NUM_SC1_N_REGISTER_USED];    /**< @brief SC1n values of the chunk channels */
+    VAR(uint32, AUTOMATIC) au32PdbChC1[ADC_PDB_CHANNELS_U8];         /**< @brief CHnC1 values, 0 for unused PDB channels */
+    VAR(uint16, AUTOMATIC) au16PdbDelay[ADC_PDB_CHANNELS_U8][ADC_PDB_NUM_DELAY_REGISTER];   /**< @brief CHnDLYm values */
+    VAR(uint8, AUTOMATIC) au8PdbDelayCount[ADC_PDB_CHANNELS_U8];     /**< @brief Number of CHnDLYm written from pre-trigger 0 */
+    VAR(uint16, AUTOMATIC) u16PdbPeriod;                             /**< @brief MOD value */
+    VAR(uint8, AUTOMATIC) u8PdbChannelUsed;                          /**< @brief Number of PDB channels triggering the chunk */
+    VAR(uint8, AUTOMATIC) u8NumChannel;                              /**< @brief Number of channels of the chunk */
+} Adc_RegisterImageType;
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+
+#if (ADC_BALANCED_SCANS == STD_ON)
+/**
+* @brief          Split of a balanced scan between the two hardware units.
+* @details        Row Unit holds the channels converted by the half of that unit, in logical
+*                 order, the logical position of each of them in the merged results and the PDB
+*                 delay of each of their conversions.
+*
+*/
+typedef struct
+{
+    VAR(Adc_GroupDefType, AUTOMATIC) aChannel[ADC_MAX_HW_UNITS][ADC_NUM_SC1_N_REGISTER_USED];     /**< @brief Channels of each half */
+    VAR(Adc_ChannelIndexType, AUTOMATIC) aPosition[ADC_MAX_HW_UNITS][ADC_NUM_SC1_N_REGISTER_USED]; /**< @brief Logical position of each channel */
+    VAR(uint16, AUTOMATIC) aDelay[ADC_MAX_HW_UNITS][ADC_NUM_SC1_N_REGISTER_USED];                  /**< @brief PDB delay of each channel */
+} Adc_BalancedPlanType;
+#endif /* (ADC_BALANCED_SCANS == STD_ON) */
 /*==================================================================================================
                                  GLOBAL VARIABLE DECLARATIONS
 ==================================================================================================*/
@@ -107,6 +107,7 @@ extern "C"{
 #include "Adc.h"
 #include "Adc_Ipw.h"
 #include "SchM_Adc.h"
+#include "Adc_Trace.h"
 
 #if (ADC_DEV_ERROR_DETECT == STD_ON)
     #include "Det.h"
@@ -171,6 +172,27 @@ extern "C"{
 #error "Software Version Numbers of Adc.c and Adc_Ipw.h are different"
 #endif
 
+/* Check if source file and Adc_Trace header file are of the same vendor */
+#if (ADC_VENDOR_ID_C != ADC_VENDOR_ID_TRACE)
+#error "Adc.c and Adc_Trace.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_C != ADC_AR_RELEASE_MAJOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_C != ADC_AR_RELEASE_MINOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_C != ADC_AR_RELEASE_REVISION_VERSION_TRACE) \
+    )
+#error "AutoSar Version Numbers of Adc.c and Adc_Trace.h are different"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Software version */
+#if ((ADC_SW_MAJOR_VERSION_C != ADC_SW_MAJOR_VERSION_TRACE) || \
+     (ADC_SW_MINOR_VERSION_C != ADC_SW_MINOR_VERSION_TRACE) || \
+     (ADC_SW_PATCH_VERSION_C != ADC_SW_PATCH_VERSION_TRACE) \
+    )
+#error "Software Version Numbers of Adc.c and Adc_Trace.h are different"
+#endif
+
 /** @violates @ref Adc_c_REF_5 Identifier clash */
 #ifndef DISABLE_MCAL_INTERMODULE_ASR_CHECK
  /* Check if source file and DET header file are of the same version */
@@ -192,6 +214,13 @@ extern "C"{
 *                                       LOCAL MACROS
 ==================================================================================================*/
 
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+/**
+* @brief          Wait returned by Adc_PowerNextConversions for a unit without periodic groups.
+*/
+#define ADC_POWER_NO_CONVERSION_U32      ((uint32)0xFFFFFFFFUL)
+#endif /* ADC_POWER_DUTY_CYCLING == STD_ON */
+
 /*==================================================================================================
 *                                      LOCAL CONSTANTS
 ==================================================================================================*/
@@ -295,6 +324,13 @@ static VAR(Adc_PowerStateType, ADC_VAR) Adc_eCurrentState;
 static VAR(Adc_PowerStateType, ADC_VAR) Adc_eTargetState;
 #endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
 
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+/**
+* @brief          Calls of Adc_Main_PowerTransitionManager since Adc_Init
+*/
+static VAR(uint32, ADC_VAR) Adc_u32PowerTick;
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+
 #if (ADC_ENABLE_CH_DISABLE_CH_NONAUTO_API == STD_ON)
 /**
 * @brief          Unit status structure
@@ -304,6 +340,15 @@ static VAR(Adc_PowerStateType, ADC_VAR) Adc_eTargetState;
 VAR(Adc_NcmrType, ADC_VAR) Adc_aNCMRxMask[ADC_NO_OF_ENABLE_CH_DISABLE_CH_GROUPS];
 #endif /* ADC_ENABLE_CH_DISABLE_CH_NONAUTO_API == STD_ON */
 
+#if (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON)
+/**
+* @brief          Precomputed channel ranges
+* @details        Filled by Adc_Init from Adc_aChannelsLimitCheckingCfg for every channel assigned to a
+*                 group with limit checking enabled, indexed the same way as the configuration table.
+*/
+static VAR(Adc_LimitRangeType, ADC_VAR) Adc_aLimitRange[ADC_MAX_HW_UNITS][ADC_LIMIT_CHECK_MAX_CHANNELS];
+#endif /* ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON */
+
 #define ADC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 /** @violates @ref Adc_c_REF_1 Only preprocessor statements and comments before "#include" */
 /** @violates @ref Adc_c_REF_6 Repeated include file MemMap.h*/
@@ -412,6 +457,36 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidatePtr
     P2CONST(void, AUTOMATIC, ADC_APPL_CONST) pPtrVal
 );
 
+#if ((ADC_READ_GROUPS_API == STD_ON) && (ADC_VALIDATE_CALL_AND_GROUP == STD_ON))
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateReadGroups
+(
+    P2CONST(Adc_ReadGroupRequestType, AUTOMATIC, ADC_APPL_DATA) pRequests,
+    VAR(Adc_GroupType, AUTOMATIC) NumRequests
+);
+#endif /* ((ADC_READ_GROUPS_API == STD_ON) && (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)) */
+
+#if ((ADC_PAIRED_GROUPS == STD_ON) && (ADC_VALIDATE_PARAMS == STD_ON))
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidatePairedGroup
+(
+    VAR(uint8, AUTOMATIC) u8ServiceId,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* ((ADC_PAIRED_GROUPS == STD_ON) && (ADC_VALIDATE_PARAMS == STD_ON)) */
+
+#if ((ADC_PAIRED_GROUPS == STD_ON) && (ADC_VALIDATE_STATE == STD_ON))
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidatePairNotBusy
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* ((ADC_PAIRED_GROUPS == STD_ON) && (ADC_VALIDATE_STATE == STD_ON)) */
+
+#if (ADC_BALANCED_SCANS == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_PlanBalancedHalf
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_BALANCED_SCANS == STD_ON) */
+
 #if ((ADC_ENABLE_START_STOP_GROUP_API == STD_ON) || (ADC_HW_TRIGGER_API == STD_ON))
 LOCAL_INLINE FUNC(void, ADC_CODE) Adc_ValidateBufferUninit
 (
@@ -595,7 +670,8 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateCheckGroupNotConversion
 );
 #endif
 
-#if (((ADC_GET_INJECTED_CONVERSION_STATUS_API == STD_ON) || (ADC_CALIBRATION == STD_ON) || (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON)) && \
+#if (((ADC_GET_INJECTED_CONVERSION_STATUS_API == STD_ON) || (ADC_CALIBRATION == STD_ON) || (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) || \
+      (ADC_POWER_DUTY_CYCLING == STD_ON) || (ADC_ADAPTIVE_CLOCK == STD_ON)) && \
      (ADC_VALIDATE_CALL_AND_UNIT == STD_ON) \
     )
 LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateCallAndUnit
@@ -609,6 +685,57 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitGroupsStatus(void);
 
 LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitUnitStatus(void);
 
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_PowerNoteStart
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_PowerUnitIdle
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_PowerNextConversions
+(
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pWait
+);
+#endif /* ADC_POWER_DUTY_CYCLING == STD_ON */
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_ClockNoteRequest
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* ADC_ADAPTIVE_CLOCK == STD_ON */
+
+#if (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitLimitRange
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex,
+    VAR(Adc_ChannelType, AUTOMATIC) Index
+);
+
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_InitLimitRanges(void);
+#endif /* ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON */
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateDmaChainLengths(void);
+#endif /* ADC_DMA_CHAIN_RELOAD == STD_ON */
+
+#if ((ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) || (ADC_DMA_CHAIN_RELOAD == STD_ON))
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_PrepareConfiguration(void);
+#endif /* (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) || (ADC_DMA_CHAIN_RELOAD == STD_ON) */
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+LOCAL_INLINE FUNC(uint32, ADC_CODE) Adc_CalibrationChecksum
+(
+    P2CONST(Adc_CalibrationDataType, AUTOMATIC, ADC_APPL_CONST) pData
+);
+
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_RestoreCalibration(void);
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
 #if ((ADC_ENABLE_START_STOP_GROUP_API == STD_ON) && (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE))
 LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_InsertIntoQueue
 (
@@ -617,6 +744,39 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_InsertIntoQueue
 );
 #endif
 
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+LOCAL_INLINE FUNC(uint8, ADC_CODE) Adc_HighestBitSet
+(
+    VAR(uint32, AUTOMATIC) u32Value
+);
+
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_PushToBucket
+(
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit,
+    CONST(Adc_GroupType, AUTOMATIC) Group,
+    CONST(boolean, AUTOMATIC) bFront
+);
+
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UnlinkFromBucket
+(
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit,
+    CONST(Adc_GroupType, AUTOMATIC) Group
+);
+
+LOCAL_INLINE FUNC(Adc_GroupType, ADC_CODE) Adc_PopHighestBucket
+(
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit
+);
+#endif /* (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON) */
+
+#if (ADC_ENABLE_QUEUING == STD_ON)
+LOCAL_INLINE FUNC(Adc_QueueIndexType, ADC_CODE) Adc_DequeueGroup
+(
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit,
+    CONST(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_ENABLE_QUEUING == STD_ON) */
+
 #if (ADC_ENABLE_START_STOP_GROUP_API == STD_ON)
 LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStartConversion
 (
@@ -629,6 +789,18 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStopConversion
     VAR(Adc_GroupType, AUTOMATIC) Group,
     VAR(Adc_HwUnitType, AUTOMATIC) Unit
 );
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ClaimPairedUnits
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+);
+
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStartPairedConversion
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
 #endif
 
 #if (ADC_READ_GROUP_API == STD_ON)
@@ -642,6 +814,13 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusReadGroupInt
 (
     CONST(Adc_GroupType, AUTOMATIC) Group
 );
+
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusReadGroupUnlocked
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
 #endif
 
 #if (ADC_HW_TRIGGER_API == STD_ON)
@@ -663,6 +842,23 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusAfterGetStream
     VAR(Adc_GroupType, AUTOMATIC) Group
 );
 
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_RestartSampleSequence
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_IsGroupConverting
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_IsSampleWrittenInParts
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
+
 #if (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON)
 #if (ADC_DEV_ERROR_DETECT == STD_ON)
 LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateUnitActive
@@ -1443,7 +1639,9 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateNotBusyWithPrio
 )
 {
     VAR(boolean, AUTOMATIC) bFlag = (boolean)FALSE;
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_OFF)
     VAR(Adc_QueueIndexType, AUTOMATIC) Index = 0U;
+#endif /* (ADC_PRIORITY_QUEUE_BUCKETS == STD_OFF) */
     VAR(Std_ReturnType, AUTOMATIC) ValidState = (Std_ReturnType)E_NOT_OK;
     /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
     VAR(Adc_HwUnitType, AUTOMATIC) Unit = Adc_pCfgPtr->pGroups[(Group)].HwUnit;
@@ -1451,6 +1649,13 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateNotBusyWithPrio
     VAR(Adc_StatusType, AUTOMATIC) eConversion;
 
     /* ADC335 */
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+    /* Waiting groups are linked in the bucket of their priority */
+    if (ADC_QUEUE_NO_GROUP != Adc_aGroupStatus[Group].QueuePrev)
+    {
+        bFlag = (boolean)TRUE;
+    }
+#else
     if (Adc_aUnitStatus[Unit].SwNormalQueueIndex > (Adc_QueueIndexType)0)
     {
         for (Index = 0U; Index < Adc_aUnitStatus[Unit].SwNormalQueueIndex; Index++)
@@ -1462,6 +1667,7 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateNotBusyWithPrio
             }
         }
     }
+#endif /* (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON) */
     SwNormalQueueIndex = Adc_aUnitStatus[Unit].SwNormalQueueIndex;
     eConversion = Adc_aGroupStatus[Group].eConversion;
     /* ADC348 */
@@ -1534,6 +1740,9 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateNotBusyNoQueue
         || (NoGroupsInHwInjectedQueue > (Adc_QueueIndexType)0)
         || (NoGroupsInHwNormalQueue > (Adc_QueueIndexType)0)
 #endif /* (ADC_HW_TRIGGER_API == STD_ON) */
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+        || ((boolean)TRUE == Adc_aUnitStatus[Unit].bCalibrationOngoing)
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
        )
     {
 
@@ -1966,6 +2175,12 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateStateStartGroupConvNotBu
         Adc_ReportDetError(ADC_STARTGROUPCONVERSION_ID, (uint8)ADC_E_BUSY);
     }
 #endif /* (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) */
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+    else if ((boolean)TRUE == Adc_aUnitStatus[Unit].bCalibrationOngoing)
+    {
+        Adc_ReportDetError(ADC_STARTGROUPCONVERSION_ID, (uint8)ADC_E_BUSY);
+    }
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
     else
     {
 #if (ADC_PRIORITY_IMPLEMENTATION == ADC_PRIORITY_NONE)
@@ -1995,13 +2210,15 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateStateEnableHwTriggNotBus
 )
 {
     VAR(Std_ReturnType, AUTOMATIC) ValidState = (Std_ReturnType)E_NOT_OK;
-#if (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON)
+#if (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) || (ADC_CALIBRATION_ASYNC == STD_ON)
     VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U;
-#endif /* (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) */
+#endif /* (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) || (ADC_CALIBRATION_ASYNC == STD_ON) */
 
-#if (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON)
+#if (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) || (ADC_CALIBRATION_ASYNC == STD_ON)
     /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
     Unit = Adc_pCfgPtr->pGroups[(Group)].HwUnit;
+#endif /* (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) || (ADC_CALIBRATION_ASYNC == STD_ON) */
+#if (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON)
     /* ADC349 */
     if ((boolean)TRUE == Adc_aUnitStatus[Unit].bCtuControlOngoing)
     {
@@ -2009,6 +2226,13 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateStateEnableHwTriggNotBus
     }
     else
 #endif /* (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) */
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+    if ((boolean)TRUE == Adc_aUnitStatus[Unit].bCalibrationOngoing)
+    {
+        Adc_ReportDetError(ADC_ENABLEHARDWARETRIGGER_ID, (uint8)ADC_E_BUSY);
+    }
+    else
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
 #if (ADC_HW_TRIGGER_API == STD_ON)
     {
         ValidState = Adc_ValidateNotBusyEnableHwTrig(Group);
@@ -2044,6 +2268,12 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateStateNotIdle
     switch (u8ServiceId)
     {
 #if (ADC_READ_GROUP_API == STD_ON)
+#if (ADC_READ_GROUPS_API == STD_ON)
+        case ADC_READGROUPS_ID:
+#endif /* ADC_READ_GROUPS_API == STD_ON */
+#if (ADC_PAIRED_GROUPS == STD_ON)
+        case ADC_READPAIREDGROUP_ID:
+#endif /* ADC_PAIRED_GROUPS == STD_ON */
         case ADC_VALUEREADGROUP_ID:
         {
             if (ADC_IDLE == Adc_aGroupStatus[Group].eConversion)
@@ -2099,6 +2329,9 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateStateNotIdle
             break;
         }
 #endif /* ADC_HW_TRIGGER_API == STD_ON */
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+        case ADC_GETSAMPLEVIEW_ID:
+#endif /* ADC_SAMPLE_VIEW_API == STD_ON */
         case ADC_GETSTREAMLASTPOINTER_ID:
         {
             /* ADC215 */
@@ -2162,7 +2395,242 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateCallAndGroup
 }
 #endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
 
-#if (((ADC_GET_INJECTED_CONVERSION_STATUS_API == STD_ON) || (ADC_CALIBRATION == STD_ON) || (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) || defined(__DOXYGEN__)) && \
+#if ((ADC_READ_GROUPS_API == STD_ON) && (ADC_VALIDATE_CALL_AND_GROUP == STD_ON))
+/**
+* @brief        This function validates the list of groups passed to Adc_ReadGroups
+* @details      The driver state and the list pointer are checked once, then every entry is
+*               checked as Adc_ReadGroup checks its parameters. Groups without interrupts are
+*               rejected because their results are read from the hardware registers.
+*               Validation stops at the first invalid entry.
+*
+* @param[in]    pRequests     The list of groups and destination buffers
+* @param[in]    NumRequests   Number of entries in the list
+*
+* @return     Std_ReturnType  Standard return type.
+* @retval     E_OK:           All the entries are valid
+* @retval     E_NOT_OK:       The call or one of the entries is not valid
+*/
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateReadGroups
+(
+    P2CONST(Adc_ReadGroupRequestType, AUTOMATIC, ADC_APPL_DATA) pRequests,
+    VAR(Adc_GroupType, AUTOMATIC) NumRequests
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ValidRequests = (Std_ReturnType)E_NOT_OK;
+    VAR(Adc_GroupType, AUTOMATIC) Index;
+    VAR(Adc_GroupType, AUTOMATIC) Group;
+
+    if (NULL_PTR == Adc_pCfgPtr)
+    {
+        Adc_ReportDetError(ADC_READGROUPS_ID, (uint8)ADC_E_UNINIT);
+    }
+    else if ((NULL_PTR == pRequests) || ((Adc_GroupType)0U == NumRequests))
+    {
+        Adc_ReportDetError(ADC_READGROUPS_ID, (uint8)ADC_E_PARAM_POINTER);
+    }
+    else
+    {
+        ValidRequests = (Std_ReturnType)E_OK;
+        for (Index = 0U; (Index < NumRequests) && ((Std_ReturnType)E_OK == ValidRequests); Index++)
+        {
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            Group = pRequests[Index].Group;
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            if ((Group >= Adc_pCfgPtr->GroupCount) || ((uint8)STD_ON == Adc_pCfgPtr->pGroups[Group].u8AdcWithoutInterrupt))
+            {
+                Adc_ReportDetError(ADC_READGROUPS_ID, (uint8)ADC_E_PARAM_GROUP);
+                ValidRequests = (Std_ReturnType)E_NOT_OK;
+            }
+            else
+            {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                ValidRequests = Adc_ValidatePtr(ADC_READGROUPS_ID, pRequests[Index].pDataBuffer);
+                if ((Std_ReturnType)E_OK == ValidRequests)
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+                {
+#if (ADC_VALIDATE_STATE == STD_ON)
+                    ValidRequests = Adc_ValidateStateNotIdle(ADC_READGROUPS_ID, Group);
+#endif /* ADC_VALIDATE_STATE == STD_ON */
+                }
+            }
+        }
+    }
+
+    return ValidRequests;
+}
+#endif /* ((ADC_READ_GROUPS_API == STD_ON) && (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)) */
+
+#if ((ADC_PAIRED_GROUPS == STD_ON) && (ADC_VALIDATE_PARAMS == STD_ON))
+/**
+* @brief        This function validates the configuration of a paired group
+* @details      The two groups must name each other and belong to different units driven by
+*               interrupts. Both must be normal software triggered groups, without limit
+*               checking or double buffering, converting the same number of channels in a
+*               single chunk with the same mode, access mode, buffer mode and number of samples.
+*               The halves of a balanced scan only need to share the scan, their channel counts
+*               follow from its split.
+*
+* @param[in]    u8ServiceId     The service id of the caller function
+* @param[in]    Group           The group id
+*
+* @return     Std_ReturnType  Standard return type.
+* @retval     E_OK:           The pair is valid
+* @retval     E_NOT_OK:       The group is not paired or its pair is not valid
+*/
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidatePairedGroup
+(
+    VAR(uint8, AUTOMATIC) u8ServiceId,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ValidPair = (Std_ReturnType)E_NOT_OK;
+    VAR(Adc_GroupType, AUTOMATIC) Partner;
+    VAR(Adc_GroupType, AUTOMATIC) aHalf[2];
+    VAR(uint8, AUTOMATIC) u8Half;
+    VAR(boolean, AUTOMATIC) bCountMatch;
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr;
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pPartnerPtr;
+
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    Partner = pGroupPtr->PairedGroup;
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    if ((Partner < Adc_pCfgPtr->GroupCount) && (Group == Adc_pCfgPtr->pGroups[Partner].PairedGroup))
+    {
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        pPartnerPtr = &(Adc_pCfgPtr->pGroups[Partner]);
+        bCountMatch = (ADC_GROUP_CHANNEL_COUNT(Group) == ADC_GROUP_CHANNEL_COUNT(Partner)) ? (boolean)TRUE : (boolean)FALSE;
+#if (ADC_BALANCED_SCANS == STD_ON)
+        if (pGroupPtr->pBalancedScan != pPartnerPtr->pBalancedScan)
+        {
+            bCountMatch = (boolean)FALSE;
+        }
+        else if (NULL_PTR != pGroupPtr->pBalancedScan)
+        {
+            bCountMatch = (boolean)TRUE;
+        }
+        else
+        {
+            /* Plain pair, the channel counts must match */
+        }
+#endif /* (ADC_BALANCED_SCANS == STD_ON) */
+        if ((pGroupPtr->HwUnit != pPartnerPtr->HwUnit) && \
+            ((boolean)TRUE == bCountMatch) && \
+            ((Adc_ChannelIndexType)0U != ADC_GROUP_CHANNEL_COUNT(Group)) && \
+            ((Adc_ChannelIndexType)0U != ADC_GROUP_CHANNEL_COUNT(Partner)) && \
+            (ADC_GROUP_CHANNEL_COUNT(Group) <= ADC_NUM_SC1_N_REGISTER_USED) && \
+            (ADC_GROUP_CHANNEL_COUNT(Partner) <= ADC_NUM_SC1_N_REGISTER_USED) && \
+            (pGroupPtr->NumSamples == pPartnerPtr->NumSamples) && \
+            (pGroupPtr->eMode == pPartnerPtr->eMode) && \
+            (pGroupPtr->eAccessMode == pPartnerPtr->eAccessMode) && \
+            (pGroupPtr->eBufferMode == pPartnerPtr->eBufferMode) \
+           )
+        {
+            ValidPair = (Std_ReturnType)E_OK;
+        }
+        aHalf[0] = Group;
+        aHalf[1] = Partner;
+        for (u8Half = 0U; u8Half < 2U; u8Half++)
+        {
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            pPartnerPtr = &(Adc_pCfgPtr->pGroups[aHalf[u8Half]]);
+            if ((ADC_TRIGG_SRC_SW != pPartnerPtr->eTriggerSource) || \
+                ((Adc_GroupConvType)ADC_CONV_TYPE_NORMAL != pPartnerPtr->eType) || \
+                ((uint8)STD_ON == pPartnerPtr->u8AdcWithoutInterrupt) \
+               )
+            {
+                ValidPair = (Std_ReturnType)E_NOT_OK;
+            }
+#ifdef ADC_DMA_SUPPORTED
+            if (ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[pPartnerPtr->HwUnit])
+            {
+                ValidPair = (Std_ReturnType)E_NOT_OK;
+            }
+#endif /* ADC_DMA_SUPPORTED */
+#if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
+            if ((boolean)TRUE == pPartnerPtr->bAdcGroupLimitcheck)
+            {
+                ValidPair = (Std_ReturnType)E_NOT_OK;
+            }
+#endif /* ADC_ENABLE_LIMIT_CHECK == STD_ON */
+#if (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING)
+            if ((boolean)TRUE == pPartnerPtr->bAdcDoubleBuffering)
+            {
+                ValidPair = (Std_ReturnType)E_NOT_OK;
+            }
+#endif /* (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING) */
+        }
+    }
+
+    if ((Std_ReturnType)E_NOT_OK == ValidPair)
+    {
+        Adc_ReportDetError(u8ServiceId, (uint8)ADC_E_PARAM_PAIRED_GROUP);
+    }
+
+    return ValidPair;
+}
+#endif /* ((ADC_PAIRED_GROUPS == STD_ON) && (ADC_VALIDATE_PARAMS == STD_ON)) */
+
+#if ((ADC_PAIRED_GROUPS == STD_ON) && (ADC_VALIDATE_STATE == STD_ON))
+/**
+* @brief        This function validates that the partner of a group can be started with it
+* @details      The partner must be idle or implicitly stopped, and no other group may be
+*               converting or waiting on the units of the pair.
+*
+* @param[in]    Group         The group id
+*
+* @return     Std_ReturnType  Standard return type.
+* @retval     E_OK:           The pair can be started
+* @retval     E_NOT_OK:       The partner or one of the units is busy
+*/
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidatePairNotBusy
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ValidState = (Std_ReturnType)E_OK;
+    VAR(Adc_StatusType, AUTOMATIC) eConversion;
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pPartnerPtr;
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    VAR(Adc_GroupType, AUTOMATIC) Partner = Adc_pCfgPtr->pGroups[Group].PairedGroup;
+
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    pPartnerPtr = &(Adc_pCfgPtr->pGroups[Partner]);
+    eConversion = Adc_aGroupStatus[Partner].eConversion;
+    if ((ADC_IDLE != eConversion) && \
+        ((ADC_STREAM_COMPLETED != eConversion) || \
+         ((ADC_CONV_MODE_ONESHOT != pPartnerPtr->eMode) && \
+          ((ADC_ACCESS_MODE_STREAMING != pPartnerPtr->eAccessMode) || (ADC_STREAM_BUFFER_LINEAR != pPartnerPtr->eBufferMode)) \
+         ) \
+        ) \
+       )
+    {
+        ValidState = (Std_ReturnType)E_NOT_OK;
+    }
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    else if (((Adc_QueueIndexType)0U != Adc_aUnitStatus[Adc_pCfgPtr->pGroups[Group].HwUnit].SwNormalQueueIndex) || \
+             ((Adc_QueueIndexType)0U != Adc_aUnitStatus[pPartnerPtr->HwUnit].SwNormalQueueIndex) \
+            )
+    {
+        ValidState = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* Both units are free */
+    }
+
+    if ((Std_ReturnType)E_NOT_OK == ValidState)
+    {
+        Adc_ReportDetError(ADC_STARTGROUPCONVERSION_ID, (uint8)ADC_E_BUSY);
+    }
+
+    return ValidState;
+}
+#endif /* ((ADC_PAIRED_GROUPS == STD_ON) && (ADC_VALIDATE_STATE == STD_ON)) */
+
+#if (((ADC_GET_INJECTED_CONVERSION_STATUS_API == STD_ON) || (ADC_CALIBRATION == STD_ON) || (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) || \
+      (ADC_POWER_DUTY_CYCLING == STD_ON) || (ADC_ADAPTIVE_CLOCK == STD_ON) || defined(__DOXYGEN__)) && \
      (ADC_VALIDATE_CALL_AND_UNIT == STD_ON) \
     )
 /**
@@ -2248,7 +2716,12 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_NotifyCapablity
         case ADC_DISABLEGROUPNOTIFICATION_ID:
         {
             /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
-            if (NULL_PTR == Adc_pCfgPtr->pGroups[Group].Notification)
+            if ((NULL_PTR == Adc_pCfgPtr->pGroups[Group].Notification)
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                && (NULL_PTR == Adc_pCfgPtr->pGroups[Group].ExtendedNotification)
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+               )
             {
                 ValidCapability = (Std_ReturnType)E_NOT_OK;
                 /* ADC166, ADC165 */
@@ -2266,24 +2739,154 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_NotifyCapablity
 #endif /* ADC_VALIDATE_NOTIFY_CAPABILITY == STD_ON */
 #endif /* ADC_GRP_NOTIF_CAPABILITY == STD_ON */
 
+#if (ADC_BALANCED_SCANS == STD_ON)
 /**
-* @brief          Initializes the group status structures.
-* @details        Initializes the group status structures with the default values.
-*
-* @param[in]      void
+* @brief          Gives a half of a balanced scan its share of the logical channels.
+* @details        A channel routed to a single unit is converted by that unit. The channels routed
+*                 to both units fill the half of the lower group up to half of the scan, rounded
+*                 up, and go to the other half beyond, spread evenly along the logical order so
+*                 that neighbouring channels are sampled at about the same time. The larger half
+*                 is then as small as the routing allows. Both halves compute the same split, each
+*                 one taking the row of its unit as runtime channel list, and the delays of its
+*                 logical channels, in the same order, as runtime delay list.
+*                 A scan with a channel routed to none of the two units, or needing more than
+*                 ADC_NUM_SC1_N_REGISTER_USED channels on one unit, leaves the half without
+*                 channels so that it is rejected by Adc_ValidatePairedGroup.
+*
+* @param[in]      Group           Half of the balanced scan.
 *
 * @return         void
 *
-* @pre            Driver must be initialized.
+* @pre            The group has a balanced scan.
 */
-LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitGroupsStatus(void)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_PlanBalancedHalf
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+)
 {
-    VAR(Adc_GroupType,AUTOMATIC) Group = 0U;
-
-    /* Initialize Group Status structures to beginning values */
-    for (Group = 0U; Group < Adc_pCfgPtr->GroupCount; Group++)
-    {
-        /* ADC221, ADC307 */
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    P2CONST(Adc_BalancedScanType, AUTOMATIC, ADC_APPL_CONST) pScan = pGroupPtr->pBalancedScan;
+    P2VAR(Adc_BalancedPlanType, AUTOMATIC, ADC_APPL_DATA) pPlan = pScan->pPlan;
+    VAR(Adc_HwUnitType, AUTOMATIC) aUnit[2];
+    VAR(Adc_ChannelType, AUTOMATIC) aChannel[2];
+    VAR(Adc_ChannelIndexType, AUTOMATIC) aCount[2] = {0U, 0U};
+    VAR(Adc_ChannelIndexType, AUTOMATIC) Shared = 0U;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) SharedFirst = 0U;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) SharedSeen = 0U;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) Index;
+    VAR(uint8, AUTOMATIC) u8Half;
+    VAR(boolean, AUTOMATIC) bPlanned = (boolean)TRUE;
+    VAR(Adc_GroupType, AUTOMATIC) Partner = pGroupPtr->PairedGroup;
+
+    if (Partner < Adc_pCfgPtr->GroupCount)
+    {
+        /* Half 0 is the one of the lower group so that both halves compute the same split */
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        aUnit[0] = Adc_pCfgPtr->pGroups[ADC_PAIR_NOTIFY_GROUP(Group)].HwUnit;
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        aUnit[1] = (Group < Partner) ? Adc_pCfgPtr->pGroups[Partner].HwUnit : pGroupPtr->HwUnit;
+        if (aUnit[0] == aUnit[1])
+        {
+            bPlanned = (boolean)FALSE;
+        }
+        /* Channels routed to one unit only are assigned first */
+        for (Index = 0U; Index < pScan->ChannelCount; Index++)
+        {
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            aChannel[0] = pScan->pChannels[Index].aUnitChannel[aUnit[0]];
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            aChannel[1] = pScan->pChannels[Index].aUnitChannel[aUnit[1]];
+            if ((ADC_BALANCED_NOT_ROUTED != aChannel[0]) && (ADC_BALANCED_NOT_ROUTED != aChannel[1]))
+            {
+                Shared++;
+            }
+            else if (ADC_BALANCED_NOT_ROUTED != aChannel[0])
+            {
+                aCount[0]++;
+            }
+            else if (ADC_BALANCED_NOT_ROUTED != aChannel[1])
+            {
+                aCount[1]++;
+            }
+            else
+            {
+                bPlanned = (boolean)FALSE;
+            }
+        }
+        /* Shared channels given to half 0 to reach half of the scan */
+        if (((pScan->ChannelCount + 1U) / 2U) > aCount[0])
+        {
+            SharedFirst = ((pScan->ChannelCount + 1U) / 2U) - aCount[0];
+            if (SharedFirst > Shared)
+            {
+                SharedFirst = Shared;
+            }
+        }
+        aCount[0] = 0U;
+        aCount[1] = 0U;
+        for (Index = 0U; (Index < pScan->ChannelCount) && ((boolean)TRUE == bPlanned); Index++)
+        {
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            aChannel[0] = pScan->pChannels[Index].aUnitChannel[aUnit[0]];
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            aChannel[1] = pScan->pChannels[Index].aUnitChannel[aUnit[1]];
+            if ((ADC_BALANCED_NOT_ROUTED != aChannel[0]) && (ADC_BALANCED_NOT_ROUTED != aChannel[1]))
+            {
+                /* Half 0 takes the shared channel when the running share of half 0 steps up */
+                u8Half = ((((uint32)SharedSeen + 1UL) * (uint32)SharedFirst) / (uint32)Shared) > \
+                         (((uint32)SharedSeen * (uint32)SharedFirst) / (uint32)Shared) ? 0U : 1U;
+                SharedSeen++;
+            }
+            else
+            {
+                u8Half = (ADC_BALANCED_NOT_ROUTED != aChannel[0]) ? 0U : 1U;
+            }
+            if (aCount[u8Half] < (Adc_ChannelIndexType)ADC_NUM_SC1_N_REGISTER_USED)
+            {
+                pPlan->aChannel[aUnit[u8Half]][aCount[u8Half]] = aChannel[u8Half];
+                pPlan->aPosition[aUnit[u8Half]][aCount[u8Half]] = Index;
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                pPlan->aDelay[aUnit[u8Half]][aCount[u8Half]] = pScan->pDelay[Index];
+                aCount[u8Half]++;
+            }
+            else
+            {
+                bPlanned = (boolean)FALSE;
+            }
+        }
+
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        Adc_aRuntimeGroupChannel[Group].pChannel = pPlan->aChannel[pGroupPtr->HwUnit];
+        Adc_aRuntimeGroupChannel[Group].pu16Delays = pPlan->aDelay[pGroupPtr->HwUnit];
+        Adc_aRuntimeGroupChannel[Group].ChannelCount = ((boolean)TRUE == bPlanned) ? \
+            ((aUnit[0] == pGroupPtr->HwUnit) ? aCount[0] : aCount[1]) : (Adc_ChannelIndexType)0U;
+    }
+}
+#endif /* (ADC_BALANCED_SCANS == STD_ON) */
+
+/**
+* @brief          Initializes the group status structures.
+* @details        Initializes the group status structures with the default values.
+*
+* @param[in]      void
+*
+* @return         void
+*
+* @pre            Driver must be initialized.
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitGroupsStatus(void)
+{
+    VAR(Adc_GroupType,AUTOMATIC) Group = 0U;
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+    VAR(uint8, AUTOMATIC) u8Stage;
+    VAR(uint8, AUTOMATIC) u8Bucket;
+#endif /* ADC_LATENCY_HISTOGRAMS == STD_ON */
+
+    /* Initialize Group Status structures to beginning values */
+    for (Group = 0U; Group < Adc_pCfgPtr->GroupCount; Group++)
+    {
+        /* ADC221, ADC307 */
         Adc_aGroupStatus[Group].eConversion = ADC_IDLE;
         /* this group was not converted yet */
         Adc_aGroupStatus[Group].eAlreadyConverted = ADC_NOT_YET_CONVERTED;
@@ -2295,6 +2898,68 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitGroupsStatus(void)
 #if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
         Adc_aGroupStatus[Group].bLimitCheckFailed = (boolean)FALSE;
 #endif /* ADC_ENABLE_LIMIT_CHECK == STD_ON */
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
+        Adc_aGroupStatus[Group].bHwCompare = (boolean)FALSE;
+#endif /* ADC_LIMIT_CHECK_HW_COMPARE == STD_ON */
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+        Adc_aGroupStatus[Group].u32SampleSequence = 0UL;
+#endif /* ADC_SAMPLE_VIEW_API == STD_ON */
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+        Adc_aGroupStatus[Group].u32CompletedSamples = 0UL;
+#endif /* ADC_EXTENDED_NOTIFICATION == STD_ON */
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        Adc_aGroupStatus[Group].bNotifyPending = (boolean)FALSE;
+        Adc_aGroupStatus[Group].NotifyStatistics.u32Posted = 0UL;
+        Adc_aGroupStatus[Group].NotifyStatistics.u32Merged = 0UL;
+        Adc_aGroupStatus[Group].NotifyStatistics.u32Dropped = 0UL;
+        Adc_aGroupStatus[Group].NotifyStatistics.u32Dispatched = 0UL;
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+        Adc_aGroupStatus[Group].NotifyBatchSamples = 0U;
+        Adc_aGroupStatus[Group].u32NotifyBatchStart = 0UL;
+#endif /* ADC_NOTIFICATION_COALESCING == STD_ON */
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+        Adc_aGroupStatus[Group].u32PublishSequence = 0UL;
+        Adc_aGroupStatus[Group].u32CompletionSequence = 0UL;
+        Adc_aGroupStatus[Group].eCompletion = ADC_IDLE;
+#endif /* ADC_RESULT_SEQLOCK == STD_ON */
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+        Adc_aGroupStatus[Group].QueueNext = ADC_QUEUE_NO_GROUP;
+        Adc_aGroupStatus[Group].QueuePrev = ADC_QUEUE_NO_GROUP;
+#endif /* ADC_PRIORITY_QUEUE_BUCKETS == STD_ON */
+#if (ADC_PAIRED_GROUPS == STD_ON)
+        Adc_aGroupStatus[Group].bPairHalfDone = (boolean)FALSE;
+#endif /* ADC_PAIRED_GROUPS == STD_ON */
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+        Adc_aGroupStatus[Group].bPowerScheduled = (boolean)FALSE;
+        Adc_aGroupStatus[Group].u32PowerStartTick = 0UL;
+#endif /* ADC_POWER_DUTY_CYCLING == STD_ON */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+        Adc_aGroupStatus[Group].bDeadlinePending = (boolean)FALSE;
+        Adc_aGroupStatus[Group].u32RequestTime = 0UL;
+#endif /* ADC_ADAPTIVE_CLOCK == STD_ON */
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+        Adc_aGroupStatus[Group].u32LatencyStart = 0UL;
+        Adc_aGroupStatus[Group].u32LatencyChunk = 0UL;
+        Adc_aGroupStatus[Group].u32LatencyEnd = 0UL;
+        Adc_aGroupStatus[Group].bLatencyStart = (boolean)FALSE;
+        Adc_aGroupStatus[Group].bLatencyChunk = (boolean)FALSE;
+        Adc_aGroupStatus[Group].bLatencyEnd = (boolean)FALSE;
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        Adc_aGroupStatus[Group].u32LatencyPost = 0UL;
+        Adc_aGroupStatus[Group].u32LatencyPostEnd = 0UL;
+        Adc_aGroupStatus[Group].bLatencyPostEnd = (boolean)FALSE;
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+        for (u8Stage = 0U; u8Stage < (uint8)ADC_LATENCY_STAGES; u8Stage++)
+        {
+            for (u8Bucket = 0U; u8Bucket < (uint8)ADC_LATENCY_BUCKETS; u8Bucket++)
+            {
+                Adc_aGroupStatus[Group].aLatency[u8Stage].au32Bucket[u8Bucket] = 0UL;
+            }
+            Adc_aGroupStatus[Group].aLatency[u8Stage].u32Count = 0UL;
+            Adc_aGroupStatus[Group].aLatency[u8Stage].u32Max = 0UL;
+        }
+#endif /* ADC_LATENCY_HISTOGRAMS == STD_ON */
 
 /* ADC077 */
 #if (ADC_HW_TRIGGER_API == STD_ON)
@@ -2324,6 +2989,16 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitGroupsStatus(void)
         Adc_aRuntimeGroupChannel[Group].ChannelCount = Adc_pCfgPtr->pGroups[Group].AssignedChannelCount;
         Adc_aRuntimeGroupChannel[Group].bRuntimeUpdated = (boolean)FALSE;
 #endif
+#if (ADC_BALANCED_SCANS == STD_ON)
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        if (NULL_PTR != Adc_pCfgPtr->pGroups[Group].pBalancedScan)
+        {
+            Adc_PlanBalancedHalf(Group);
+        }
+#endif /* (ADC_BALANCED_SCANS == STD_ON) */
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+        Adc_Ipw_BuildRegisterImages(Group);
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
     }
 }
 
@@ -2341,6 +3016,9 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitUnitStatus(void)
 {
     VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U;
     VAR(Adc_QueueIndexType, AUTOMATIC) QueueIdx = 0U;
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+    VAR(uint16, AUTOMATIC) u16Prio = 0U;
+#endif /* ADC_PRIORITY_QUEUE_BUCKETS == STD_ON */
 
     for(Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
     {
@@ -2351,6 +3029,18 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitUnitStatus(void)
         {
             Adc_aUnitStatus[Unit].SwNormalQueue[QueueIdx] = 0U;
         }
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+        /* Empty all the priority buckets */
+        Adc_aUnitStatus[Unit].u8PrioSummary = 0U;
+        for(u16Prio = 0U; u16Prio < ADC_QUEUE_PRIORITY_WORDS; u16Prio++)
+        {
+            Adc_aUnitStatus[Unit].au32PrioBitmap[u16Prio] = 0UL;
+        }
+        for(u16Prio = 0U; u16Prio < ADC_QUEUE_PRIORITY_LEVELS; u16Prio++)
+        {
+            Adc_aUnitStatus[Unit].aPrioHead[u16Prio] = ADC_QUEUE_NO_GROUP;
+        }
+#endif /* ADC_PRIORITY_QUEUE_BUCKETS == STD_ON */
 
         /* SW Injected queue initialization */
         Adc_aUnitStatus[Unit].SwInjectedQueue[0] =0U;
@@ -2372,14 +3062,512 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitUnitStatus(void)
 #endif /* (ADC_HW_TRIGGER_API == STD_ON) */
 #ifdef ADC_PDB_SUPPORTED
         Adc_aUnitStatus[Unit].u8Sc1Used = 0U;
+#if (ADC_PAIRED_GROUPS == STD_ON)
+        Adc_aUnitStatus[Unit].bPdbTriggerHeld = (boolean)FALSE;
+#endif /* ADC_PAIRED_GROUPS == STD_ON */
 #endif /* ADC_PDB_SUPPORTED */
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+        Adc_aUnitStatus[Unit].bCalibrationOngoing = (boolean)FALSE;
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+        Adc_aUnitStatus[Unit].eCalibrationOrigin = ADC_CALIBRATION_NONE;
+        Adc_aUnitStatus[Unit].s32CalibrationTemperature = (sint32)0;
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+#if (ADC_ASYNC_ABORT == STD_ON)
+        Adc_aUnitStatus[Unit].bAbortPending = (boolean)FALSE;
+        Adc_aUnitStatus[Unit].u32AbortTimeout = 0UL;
+#endif /* ADC_ASYNC_ABORT == STD_ON */
+#if (ADC_POWER_STATE_SUPPORTED == STD_ON)
+        Adc_aUnitStatus[Unit].ePowerState = ADC_FULL_POWER;
+        Adc_aUnitStatus[Unit].u32FullPowerClock = 0UL;
+#endif /* ADC_POWER_STATE_SUPPORTED == STD_ON */
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+        Adc_aUnitStatus[Unit].PowerStatistics.au32StateTicks[ADC_FULL_POWER] = 0UL;
+        Adc_aUnitStatus[Unit].PowerStatistics.au32StateTicks[ADC_LOW_POWER] = 0UL;
+        Adc_aUnitStatus[Unit].PowerStatistics.u32Transitions = 0UL;
+        Adc_aUnitStatus[Unit].PowerStatistics.u32LateWakeups = 0UL;
+#endif /* ADC_POWER_DUTY_CYCLING == STD_ON */
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        /* Slots are read only between the indexes, aNotifyQueue needs no initialization */
+        Adc_aUnitStatus[Unit].u32NotifyHead = 0UL;
+        Adc_aUnitStatus[Unit].u32NotifyTail = 0UL;
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+        /* Adc_Init writes the normal clock configuration */
+        Adc_aUnitStatus[Unit].eClockMode = ADC_NORMAL;
+        Adc_aUnitStatus[Unit].u32ClockModeStart = 0UL;
+        Adc_aUnitStatus[Unit].ClockStatistics.au32Conversions[ADC_NORMAL] = 0UL;
+        Adc_aUnitStatus[Unit].ClockStatistics.au32Conversions[ADC_ALTERNATE] = 0UL;
+        Adc_aUnitStatus[Unit].ClockStatistics.au32Time[ADC_NORMAL] = 0UL;
+        Adc_aUnitStatus[Unit].ClockStatistics.au32Time[ADC_ALTERNATE] = 0UL;
+        Adc_aUnitStatus[Unit].ClockStatistics.u32Switches = 0UL;
+        Adc_aUnitStatus[Unit].ClockStatistics.u32DeadlineMisses = 0UL;
+        Adc_aUnitStatus[Unit].u32DeadlinesPending = 0UL;
+        Adc_aUnitStatus[Unit].u32EarliestDue = 0UL;
+        Adc_aUnitStatus[Unit].bEarliestDueStale = (boolean)FALSE;
+#endif /* ADC_ADAPTIVE_CLOCK == STD_ON */
     }
 #if (ADC_POWER_STATE_SUPPORTED == STD_ON) || defined(__DOXYGEN__)
     Adc_eCurrentState = ADC_FULL_POWER;
     Adc_eTargetState = ADC_NODEFINE_POWER;
 #endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    Adc_u32PowerTick = 0UL;
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+}
+
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+/**
+* @brief          Records the start of a group for the power manager.
+* @details        A group with u32PowerPeriodTicks is expected to be started again that many calls
+*                 of Adc_Main_PowerTransitionManager later.
+*
+* @param[in]      Group       The group started.
+*
+* @return         void
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_PowerNoteStart
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    if ((uint32)0UL != Adc_pCfgPtr->pGroups[Group].u32PowerPeriodTicks)
+    {
+        Adc_aGroupStatus[Group].u32PowerStartTick = Adc_u32PowerTick;
+        Adc_aGroupStatus[Group].bPowerScheduled = (boolean)TRUE;
+    }
+}
+
+/**
+* @brief          Checks that nothing is queued or running on a unit.
+*
+* @param[in]      Unit        The hardware unit.
+*
+* @return         boolean     TRUE if the unit can be put in low power.
+*/
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_PowerUnitIdle
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    return (((Adc_QueueIndexType)0 == Adc_aUnitStatus[Unit].SwNormalQueueIndex) && \
+            ((Adc_QueueIndexType)0 == Adc_aUnitStatus[Unit].SwInjectedQueueIndex)
+#if (ADC_HW_TRIGGER_API == STD_ON)
+            && ((Adc_QueueIndexType)0 == Adc_aUnitStatus[Unit].HwNormalQueueIndex) && \
+            ((Adc_QueueIndexType)0 == Adc_aUnitStatus[Unit].HwInjectedQueueIndex)
+#endif /* (ADC_HW_TRIGGER_API == STD_ON) */
+#if (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON)
+            && ((boolean)FALSE == Adc_aUnitStatus[Unit].bCtuControlOngoing)
+#endif /* (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON) */
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+            && ((boolean)FALSE == Adc_aUnitStatus[Unit].bCalibrationOngoing)
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
+#if (ADC_ASYNC_ABORT == STD_ON)
+            && ((boolean)FALSE == Adc_aUnitStatus[Unit].bAbortPending)
+#endif /* (ADC_ASYNC_ABORT == STD_ON) */
+           ) ? (boolean)TRUE : (boolean)FALSE;
+}
+
+/**
+* @brief          Computes how soon a conversion is expected on each unit.
+* @details        A periodic group is expected u32PowerPeriodTicks after its last start. A group
+*                 not started again within one more period is no longer considered periodic.
+*
+* @param[out]     pWait       Per unit, calls of the manager before the next expected start, 0 if
+*                             one is overdue, ADC_POWER_NO_CONVERSION_U32 if none is expected.
+*
+* @return         void
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_PowerNextConversions
+(
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pWait
+)
+{
+    VAR(Adc_GroupType, AUTOMATIC) Group;
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint32, AUTOMATIC) u32Period;
+    VAR(uint32, AUTOMATIC) u32Elapsed;
+    VAR(uint32, AUTOMATIC) u32Wait;
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        pWait[Unit] = ADC_POWER_NO_CONVERSION_U32;
+    }
+    for (Group = 0U; Group < (Adc_GroupType)Adc_pCfgPtr->GroupCount; Group++)
+    {
+        if ((boolean)TRUE == Adc_aGroupStatus[Group].bPowerScheduled)
+        {
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            u32Period = Adc_pCfgPtr->pGroups[Group].u32PowerPeriodTicks;
+            /* Unsigned difference, correct across the wrap of the tick counter */
+            u32Elapsed = Adc_u32PowerTick - Adc_aGroupStatus[Group].u32PowerStartTick;
+            if (u32Elapsed <= u32Period)
+            {
+                u32Wait = u32Period - u32Elapsed;
+            }
+            else if ((u32Elapsed - u32Period) <= u32Period)
+            {
+                u32Wait = 0UL;
+            }
+            else
+            {
+                Adc_aGroupStatus[Group].bPowerScheduled = (boolean)FALSE;
+                u32Wait = ADC_POWER_NO_CONVERSION_U32;
+            }
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            Unit = Adc_pCfgPtr->pGroups[Group].HwUnit;
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            if (u32Wait < pWait[Unit])
+            {
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                pWait[Unit] = u32Wait;
+            }
+        }
+    }
+}
+#endif /* ADC_POWER_DUTY_CYCLING == STD_ON */
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+/**
+* @brief          Records the start request of a group with a conversion deadline.
+*
+* @param[in]      Group       The group started.
+*
+* @return         void
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_ClockNoteRequest
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    Adc_TimeReadType pfReadTime = Adc_pCfgPtr->pAdc[Adc_pCfgPtr->Misc.aHwLogicalId[pGroupPtr->HwUnit]].pfReadTime;
+
+    if (((uint32)0UL != pGroupPtr->u32ConversionDeadline) && (NULL_PTR != pfReadTime))
+    {
+        Adc_Ipw_ClockNoteRequest(pGroupPtr->HwUnit, Group, pfReadTime());
+    }
+}
+#endif /* ADC_ADAPTIVE_CLOCK == STD_ON */
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+/**
+* @brief          Computes the checksum of calibration data.
+* @details        Rotates and adds every word of the structure before u32Checksum, so that a
+*                 swapped or erased word is detected as well as a changed one.
+*
+* @param[in]      pData       Calibration data.
+*
+* @return         uint32      The checksum.
+*/
+LOCAL_INLINE FUNC(uint32, ADC_CODE) Adc_CalibrationChecksum
+(
+    P2CONST(Adc_CalibrationDataType, AUTOMATIC, ADC_APPL_CONST) pData
+)
+{
+    /** @violates @ref Adc_c_REF_10 cast from pointer to pointer */
+    P2CONST(uint32, AUTOMATIC, ADC_APPL_CONST) pu32Word = (P2CONST(uint32, AUTOMATIC, ADC_APPL_CONST))pData;
+    VAR(uint32, AUTOMATIC) u32Checksum = ~ADC_CALIBRATION_DATA_SIGNATURE;
+    VAR(uint32, AUTOMATIC) u32Index;
+
+    for (u32Index = 0UL; u32Index < (((uint32)sizeof(Adc_CalibrationDataType) >> 2U) - 1UL); u32Index++)
+    {
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        u32Checksum = ((u32Checksum << 5U) | (u32Checksum >> 27U)) + pu32Word[u32Index];
+    }
+    return u32Checksum;
 }
 
+/**
+* @brief          Loads the calibration data of the configured units.
+* @details        For each unit with pCalibrationData, writes the stored calibration registers when
+*                 the data carries the signature, was taken on this unit with the configured CFG1,
+*                 has a matching checksum and, if the unit reads the temperature, was taken within
+*                 u16CalibrationTemperatureRange of the current one. Units loaded this way report
+*                 ADC_CALIBRATION_RESTORED; the others stay ADC_CALIBRATION_NONE and need
+*                 Adc_Calibrate.
+*
+* @return         void
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_RestoreCalibration(void)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex;
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pUnitConfig;
+    P2CONST(Adc_CalibrationDataType, AUTOMATIC, ADC_APPL_CONST) pData;
+    VAR(sint32, AUTOMATIC) s32Delta;
+    VAR(boolean, AUTOMATIC) bValid;
+
+    for (HwIndex = 0U; HwIndex < Adc_pCfgPtr->Misc.Adc_MaxHwCfg; HwIndex++)
+    {
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        pUnitConfig = &(Adc_pCfgPtr->pAdc[HwIndex]);
+        Unit = pUnitConfig->AdcHardwareUnitId;
+        pData = pUnitConfig->pCalibrationData;
+        bValid = (boolean)FALSE;
+
+        if (NULL_PTR != pData)
+        {
+            bValid = ((ADC_CALIBRATION_DATA_SIGNATURE == pData->u32Signature) && \
+                      ((uint32)Unit == pData->u32Unit) && \
+                      (pUnitConfig->u32AdcCfg1Register == pData->u32Cfg1) && \
+                      (Adc_CalibrationChecksum(pData) == pData->u32Checksum)) ? (boolean)TRUE : (boolean)FALSE;
+        }
+        if (((boolean)TRUE == bValid) && (NULL_PTR != pUnitConfig->pfReadTemperature))
+        {
+            s32Delta = (sint32)pUnitConfig->pfReadTemperature() - pData->s32Temperature;
+            if ((s32Delta > (sint32)pUnitConfig->u16CalibrationTemperatureRange) || \
+                (s32Delta < -(sint32)pUnitConfig->u16CalibrationTemperatureRange))
+            {
+                bValid = (boolean)FALSE;
+            }
+        }
+        if ((boolean)TRUE == bValid)
+        {
+            Adc_Ipw_WriteCalibration(Unit, pData);
+            Adc_aUnitStatus[Unit].eCalibrationOrigin = ADC_CALIBRATION_RESTORED;
+            Adc_aUnitStatus[Unit].s32CalibrationTemperature = pData->s32Temperature;
+        }
+    }
+}
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
+#if (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON)
+/**
+* @brief          Converts the configured range of one channel to an interval.
+* @details        Every range kind is expressed as Low <= Value <= Low + Span, or as its complement:
+*                 an empty interval is represented by the complement of the full one.
+*
+* @param[in]      HwIndex     Index of the hardware unit in the configuration.
+*                 Index       Adc channel index.
+*
+* @return         void
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_InitLimitRange
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex,
+    VAR(Adc_ChannelType, AUTOMATIC) Index
+)
+{
+    VAR(Adc_ChannelRangeSelectType, AUTOMATIC) eChRange;
+    VAR(uint16, AUTOMATIC) u16LowLimit;
+    VAR(uint16, AUTOMATIC) u16HighLimit;
+    VAR(uint16, AUTOMATIC) u16Low = 0U;
+    VAR(uint16, AUTOMATIC) u16Span = ADC_DATA_MASK_U16;
+    VAR(uint8, AUTOMATIC) u8Invert = 0U;
+    VAR(uint8, AUTOMATIC) u8Shift;
+
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    eChRange = Adc_aChannelsLimitCheckingCfg[HwIndex][Index].eChannelRange;
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    u16LowLimit = (uint16)Adc_aChannelsLimitCheckingCfg[HwIndex][Index].ChannelLowLimit;
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    u16HighLimit = (uint16)Adc_aChannelsLimitCheckingCfg[HwIndex][Index].ChannelHighLimit;
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    u8Shift = (uint8)(16U - (Adc_pCfgPtr->pAdc[HwIndex].Res));
+
+    switch (eChRange)
+    {
+        case ADC_RANGE_ALWAYS:
+        {
+            break;
+        }
+        /* Low < Value <= High, empty when High <= Low */
+        case ADC_RANGE_BETWEEN:
+        case ADC_RANGE_NOT_BETWEEN:
+        {
+            if (u16LowLimit < u16HighLimit)
+            {
+                u16Low = (uint16)(u16LowLimit + 1U);
+                u16Span = (uint16)((u16HighLimit - u16LowLimit) - 1U);
+            }
+            else
+            {
+                u8Invert = 1U;
+            }
+            if (ADC_RANGE_NOT_BETWEEN == eChRange)
+            {
+                u8Invert ^= 1U;
+            }
+            break;
+        }
+        /* Value <= High */
+        case ADC_RANGE_NOT_OVER_HIGH:
+        {
+            u16Span = u16HighLimit;
+            break;
+        }
+        /* Value <= Low */
+        case ADC_RANGE_UNDER_LOW:
+        {
+            u16Span = u16LowLimit;
+            break;
+        }
+        /* Value > Low or Value > High, empty when the limit is the maximum value */
+        case ADC_RANGE_NOT_UNDER_LOW:
+        case ADC_RANGE_OVER_HIGH:
+        {
+            if (ADC_RANGE_OVER_HIGH == eChRange)
+            {
+                u16LowLimit = u16HighLimit;
+            }
+            if (u16LowLimit < ADC_DATA_MASK_U16)
+            {
+                u16Low = (uint16)(u16LowLimit + 1U);
+                u16Span = (uint16)((ADC_DATA_MASK_U16 - u16LowLimit) - 1U);
+            }
+            else
+            {
+                u8Invert = 1U;
+            }
+            break;
+        }
+        /* Unexpected value, never in range */
+        default:
+        {
+            u8Invert = 1U;
+            break;
+        }
+    }
+
+    Adc_aLimitRange[HwIndex][Index].u16Low = u16Low;
+    Adc_aLimitRange[HwIndex][Index].u16Span = u16Span;
+    Adc_aLimitRange[HwIndex][Index].u8Invert = u8Invert;
+#if (ADC_RESULT_ALIGNMENT == ADC_ALIGN_LEFT)
+    Adc_aLimitRange[HwIndex][Index].u16ValueMask = ADC_DATA_MASK_U16;
+    Adc_aLimitRange[HwIndex][Index].u8ValueShift = u8Shift;
+#else
+    Adc_aLimitRange[HwIndex][Index].u16ValueMask = (uint16)(ADC_DATA_MASK_U16 >> u8Shift);
+    Adc_aLimitRange[HwIndex][Index].u8ValueShift = 0U;
+#endif /* (ADC_RESULT_ALIGNMENT == ADC_ALIGN_LEFT) */
+}
+
+/**
+* @brief          Precomputes the range of every channel checked by a group.
+* @details        Only the channels assigned to groups with limit checking enabled are converted, these
+*                 are the only indexes Adc_CheckConversionValuesInRange is called with. A checked
+*                 channel index without an entry in the range table (ADC_LIMIT_CHECK_MAX_CHANNELS)
+*                 makes the configuration unusable: the end of conversion handlers would read past
+*                 the table.
+*
+* @param[in]      void
+*
+* @return         Std_ReturnType  Standard return type.
+* @retval         E_OK:           The ranges of all the checked channels are set
+* @retval         E_NOT_OK:       A checked channel index is not lower than ADC_LIMIT_CHECK_MAX_CHANNELS
+*
+* @pre            Adc_pCfgPtr must be set.
+*/
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_InitLimitRanges(void)
+{
+    VAR(Std_ReturnType, AUTOMATIC) RangesRet = (Std_ReturnType)E_OK;
+    VAR(Adc_GroupType, AUTOMATIC) Group;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) Ch;
+    VAR(Adc_ChannelType, AUTOMATIC) Index;
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex;
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr;
+
+    for (Group = 0U; Group < (Adc_GroupType)Adc_pCfgPtr->GroupCount; Group++)
+    {
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+        if ((boolean)TRUE == pGroupPtr->bAdcGroupLimitcheck)
+        {
+            HwIndex = Adc_pCfgPtr->Misc.aHwLogicalId[pGroupPtr->HwUnit];
+            for (Ch = 0U; Ch < pGroupPtr->AssignedChannelCount; Ch++)
+            {
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                Index = pGroupPtr->pAssignment[Ch];
+                if (Index < (Adc_ChannelType)ADC_LIMIT_CHECK_MAX_CHANNELS)
+                {
+                    Adc_InitLimitRange(HwIndex, Index);
+                }
+                else
+                {
+                    RangesRet = (Std_ReturnType)E_NOT_OK;
+                }
+            }
+        }
+    }
+
+    return RangesRet;
+}
+#endif /* ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON */
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+/**
+* @brief          Checks that the DMA reload list holds every chunk of the DMA groups.
+* @details        The list is sized for ADC_MAX_GROUP_CHANNELS channels. A longer group converted
+*                 through the DMA with interrupt would be reloaded by the end of conversion
+*                 interrupt instead, so the configuration is not used.
+*
+* @param[in]      void
+*
+* @return         Std_ReturnType  Standard return type.
+* @retval         E_OK:           All the DMA groups fit in the reload list
+* @retval         E_NOT_OK:       A DMA group has more than ADC_MAX_GROUP_CHANNELS channels
+*
+* @pre            Adc_pCfgPtr must be set.
+*/
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateDmaChainLengths(void)
+{
+    VAR(Std_ReturnType, AUTOMATIC) LengthsRet = (Std_ReturnType)E_OK;
+    VAR(Adc_GroupType, AUTOMATIC) Group;
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr;
+
+    for (Group = 0U; Group < (Adc_GroupType)Adc_pCfgPtr->GroupCount; Group++)
+    {
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+        if ((ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[pGroupPtr->HwUnit]) && \
+            ((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt) && \
+            ((uint32)pGroupPtr->AssignedChannelCount > (uint32)ADC_MAX_GROUP_CHANNELS))
+        {
+            LengthsRet = (Std_ReturnType)E_NOT_OK;
+        }
+    }
+
+    return LengthsRet;
+}
+#endif /* ADC_DMA_CHAIN_RELOAD == STD_ON */
+
+#if ((ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) || (ADC_DMA_CHAIN_RELOAD == STD_ON))
+/**
+* @brief          Checks the configuration against the compile time sizes and precomputes its tables.
+*
+* @param[in]      void
+*
+* @return         Std_ReturnType  Standard return type.
+* @retval         E_OK:           The configuration can be used
+* @retval         E_NOT_OK:       The configuration does not fit in the compile time sizes
+*
+* @pre            Adc_pCfgPtr must be set.
+*/
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_PrepareConfiguration(void)
+{
+    VAR(Std_ReturnType, AUTOMATIC) PrepareRet = (Std_ReturnType)E_OK;
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+    if ((Std_ReturnType)E_OK != Adc_ValidateDmaChainLengths())
+    {
+        PrepareRet = (Std_ReturnType)E_NOT_OK;
+    }
+#endif /* ADC_DMA_CHAIN_RELOAD == STD_ON */
+#if (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON)
+    if ((Std_ReturnType)E_OK != Adc_InitLimitRanges())
+    {
+        PrepareRet = (Std_ReturnType)E_NOT_OK;
+    }
+#endif /* ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON */
+
+    return PrepareRet;
+}
+#endif /* (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) || (ADC_DMA_CHAIN_RELOAD == STD_ON) */
+
 #if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
 /**
 * @brief          Checks if conversion values are in the configured range.
@@ -2403,6 +3591,17 @@ FUNC(boolean, ADC_CODE) Adc_CheckConversionValuesInRange
     VAR(Adc_ChannelType, AUTOMATIC) Index
 )
 {
+#if (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON)
+    P2CONST(Adc_LimitRangeType, AUTOMATIC, ADC_APPL_CONST) pRange;
+    VAR(uint16, AUTOMATIC) u16Offset;
+
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    pRange = &Adc_aLimitRange[Adc_pCfgPtr->Misc.aHwLogicalId[Unit]][Index];
+    /* Values below u16Low wrap around above u16Span */
+    u16Offset = (uint16)((uint16)((Value & pRange->u16ValueMask) >> pRange->u8ValueShift) - pRange->u16Low);
+
+    return (boolean)(((uint8)((u16Offset <= pRange->u16Span) ? 1U : 0U)) != pRange->u8Invert);
+#else
     VAR(boolean, AUTOMATIC) bValInRange = (boolean)FALSE;
     VAR(Adc_ChannelRangeSelectType, AUTOMATIC) eChRange;
     VAR(Adc_ValueGroupType, AUTOMATIC) LowLimit;
@@ -2483,21 +3682,185 @@ FUNC(boolean, ADC_CODE) Adc_CheckConversionValuesInRange
         /* Range below low limit - low limit value included. */
         case ADC_RANGE_UNDER_LOW:
         {
-            if (Value <= LowLimit)
-            {
-                bValInRange = (boolean)TRUE;
-            }
-            break;
+            if (Value <= LowLimit)
+            {
+                bValInRange = (boolean)TRUE;
+            }
+            break;
+        }
+        /* Unexpected value */
+        default:
+        {
+            break;
+        }
+    }
+    return (boolean)bValInRange;
+#endif /* (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) */
+}
+#endif /* (ADC_ENABLE_LIMIT_CHECK == STD_ON) */
+
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+/**
+* @brief          Returns the index of the most significant bit set.
+* @details        Fixed five step search, the cost does not depend on the value.
+*
+* @param[in]      u32Value    Value to search, must not be zero.
+*
+* @return         uint8       Bit index, 0 to 31.
+*/
+LOCAL_INLINE FUNC(uint8, ADC_CODE) Adc_HighestBitSet
+(
+    VAR(uint32, AUTOMATIC) u32Value
+)
+{
+    VAR(uint32, AUTOMATIC) u32Word = u32Value;
+    VAR(uint8, AUTOMATIC) u8Bit = 0U;
+
+    if (0UL != (u32Word & 0xFFFF0000UL))
+    {
+        u8Bit += 16U;
+        u32Word >>= 16U;
+    }
+    if (0UL != (u32Word & 0x0000FF00UL))
+    {
+        u8Bit += 8U;
+        u32Word >>= 8U;
+    }
+    if (0UL != (u32Word & 0x000000F0UL))
+    {
+        u8Bit += 4U;
+        u32Word >>= 4U;
+    }
+    if (0UL != (u32Word & 0x0000000CUL))
+    {
+        u8Bit += 2U;
+        u32Word >>= 2U;
+    }
+    if (0UL != (u32Word & 0x00000002UL))
+    {
+        u8Bit += 1U;
+    }
+    return u8Bit;
+}
+
+/**
+* @brief          Links a group in the bucket of its priority.
+* @details        The buckets are circular lists threaded through the group status, the head of a
+*                 bucket being its oldest group. The bitmap bits of the priority are set.
+*
+* @param[in]      Unit      The hardware Unit.
+* @param[in]      Group     The group id.
+* @param[in]      bFront    TRUE to link the group as the oldest of its priority (preempted group),
+*                           FALSE to link it as the newest.
+*
+* @return         void
+*
+* @pre This function must be called from a critical region.
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_PushToBucket
+(
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit,
+    CONST(Adc_GroupType, AUTOMATIC) Group,
+    CONST(boolean, AUTOMATIC) bFront
+)
+{
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    VAR(Adc_GroupPriorityType, AUTOMATIC) Prio = Adc_pCfgPtr->pGroups[Group].Priority;
+    VAR(Adc_GroupType, AUTOMATIC) Head = Adc_aUnitStatus[Unit].aPrioHead[Prio];
+    VAR(Adc_GroupType, AUTOMATIC) Tail;
+
+    if (ADC_QUEUE_NO_GROUP == Head)
+    {
+        /* First group of this priority */
+        Adc_aGroupStatus[Group].QueueNext = Group;
+        Adc_aGroupStatus[Group].QueuePrev = Group;
+        Adc_aUnitStatus[Unit].aPrioHead[Prio] = Group;
+        Adc_aUnitStatus[Unit].au32PrioBitmap[(uint8)Prio >> 5U] |= ((uint32)1UL << ((uint8)Prio & 0x1FU));
+        Adc_aUnitStatus[Unit].u8PrioSummary |= (uint8)(1U << ((uint8)Prio >> 5U));
+    }
+    else
+    {
+        /* Insert between the newest and the oldest group */
+        Tail = Adc_aGroupStatus[Head].QueuePrev;
+        Adc_aGroupStatus[Group].QueueNext = Head;
+        Adc_aGroupStatus[Group].QueuePrev = Tail;
+        Adc_aGroupStatus[Tail].QueueNext = Group;
+        Adc_aGroupStatus[Head].QueuePrev = Group;
+        if ((boolean)TRUE == bFront)
+        {
+            Adc_aUnitStatus[Unit].aPrioHead[Prio] = Group;
+        }
+    }
+}
+
+/**
+* @brief          Unlinks a waiting group from the bucket of its priority.
+* @details        The bitmap bits of the priority are cleared when its bucket becomes empty.
+*
+* @param[in]      Unit      The hardware Unit.
+* @param[in]      Group     The group id, linked in a bucket.
+*
+* @return         void
+*
+* @pre This function must be called from a critical region.
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UnlinkFromBucket
+(
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit,
+    CONST(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    VAR(Adc_GroupPriorityType, AUTOMATIC) Prio = Adc_pCfgPtr->pGroups[Group].Priority;
+    VAR(Adc_GroupType, AUTOMATIC) Next = Adc_aGroupStatus[Group].QueueNext;
+    VAR(Adc_GroupType, AUTOMATIC) Prev = Adc_aGroupStatus[Group].QueuePrev;
+
+    if (Next == Group)
+    {
+        /* Last group of this priority */
+        Adc_aUnitStatus[Unit].aPrioHead[Prio] = ADC_QUEUE_NO_GROUP;
+        Adc_aUnitStatus[Unit].au32PrioBitmap[(uint8)Prio >> 5U] &= ~((uint32)1UL << ((uint8)Prio & 0x1FU));
+        if (0UL == Adc_aUnitStatus[Unit].au32PrioBitmap[(uint8)Prio >> 5U])
+        {
+            Adc_aUnitStatus[Unit].u8PrioSummary &= (uint8)(~(uint8)(1U << ((uint8)Prio >> 5U)));
         }
-        /* Unexpected value */
-        default:
+    }
+    else
+    {
+        Adc_aGroupStatus[Prev].QueueNext = Next;
+        Adc_aGroupStatus[Next].QueuePrev = Prev;
+        if (Group == Adc_aUnitStatus[Unit].aPrioHead[Prio])
         {
-            break;
+            Adc_aUnitStatus[Unit].aPrioHead[Prio] = Next;
         }
     }
-    return (boolean)bValInRange;
+    Adc_aGroupStatus[Group].QueueNext = ADC_QUEUE_NO_GROUP;
+    Adc_aGroupStatus[Group].QueuePrev = ADC_QUEUE_NO_GROUP;
 }
-#endif /* (ADC_ENABLE_LIMIT_CHECK == STD_ON) */
+
+/**
+* @brief          Unlinks the oldest group of the highest waiting priority.
+*
+* @param[in]      Unit      The hardware Unit, with at least one waiting group.
+*
+* @return         Adc_GroupType   The unlinked group.
+*
+* @pre This function must be called from a critical region.
+*/
+LOCAL_INLINE FUNC(Adc_GroupType, ADC_CODE) Adc_PopHighestBucket
+(
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(uint8, AUTOMATIC) u8Word = Adc_HighestBitSet((uint32)Adc_aUnitStatus[Unit].u8PrioSummary);
+    VAR(uint16, AUTOMATIC) u16Prio = (uint16)(((uint16)u8Word << 5U) + \
+                                              Adc_HighestBitSet(Adc_aUnitStatus[Unit].au32PrioBitmap[u8Word]));
+    VAR(Adc_GroupType, AUTOMATIC) Group = Adc_aUnitStatus[Unit].aPrioHead[u16Prio];
+
+    Adc_UnlinkFromBucket(Unit, Group);
+    return Group;
+}
+#endif /* (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON) */
 
 #if (ADC_ENABLE_QUEUING == STD_ON)
 /**
@@ -2518,11 +3881,19 @@ FUNC(void, ADC_CODE) Adc_RemoveFromQueue
     CONST(Adc_QueueIndexType, AUTOMATIC) CurQueueIndex
 )
 {
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_OFF)
     VAR(Adc_QueueIndexType, AUTOMATIC) PositionIndex = 0U;
+#endif /* (ADC_PRIORITY_QUEUE_BUCKETS == STD_OFF) */
     VAR(Adc_QueueIndexType, AUTOMATIC) CurrentIndex = 0U;
 
     SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_18();
     CurrentIndex = Adc_aUnitStatus[Unit].SwNormalQueueIndex;
+#if (ADC_EVENT_TRACE == STD_ON)
+    if (CurQueueIndex < CurrentIndex)
+    {
+        Adc_Trace_Record(ADC_TRACE_EV_QUEUE_REMOVE_U8, Unit, (uint16)Adc_aUnitStatus[Unit].SwNormalQueue[CurQueueIndex], (uint16)CurQueueIndex);
+    }
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
     if((Adc_QueueIndexType)1U >= CurrentIndex)
     {
         /* Zero or one element present in the queue */
@@ -2531,17 +3902,84 @@ FUNC(void, ADC_CODE) Adc_RemoveFromQueue
     else
     {
         /* More than one element in the queue */
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+        /* Only the group under conversion has an index, waiting groups leave with Adc_DequeueGroup */
+        (void)CurQueueIndex;
+        /* The oldest group of the highest waiting priority takes its place */
+        Adc_aUnitStatus[Unit].SwNormalQueue[0] = Adc_PopHighestBucket(Unit);
+#else
         /* Move all elements after the one to remove (from CurQueueIndex position) one place to the left */
         for(PositionIndex = (CurQueueIndex + 1U); PositionIndex < CurrentIndex; PositionIndex++)
         {
             Adc_aUnitStatus[Unit].SwNormalQueue[PositionIndex - 1U] =
             (Adc_GroupType)Adc_aUnitStatus[Unit].SwNormalQueue[PositionIndex];
         }
+#endif /* (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON) */
 
         Adc_aUnitStatus[Unit].SwNormalQueueIndex--;
     }
     SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_18();
 }
+
+/**
+* @brief          This function removes a group from the internal ADC queue.
+* @details        The group under conversion (position 0) is removed with Adc_RemoveFromQueue. A
+*                 waiting group is removed from its position in the array, or unlinked from its
+*                 priority bucket when ADC_PRIORITY_QUEUE_BUCKETS is used.
+*
+* @param[in]      Unit      The hardware Unit.
+* @param[in]      Group     The group id.
+*
+* @return         Adc_QueueIndexType  0 if the group was under conversion, the number of queued
+*                                     groups if it was not queued, another value otherwise.
+*
+* @pre This function must be called from a critical region.
+*/
+LOCAL_INLINE FUNC(Adc_QueueIndexType, ADC_CODE) Adc_DequeueGroup
+(
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit,
+    CONST(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(Adc_QueueIndexType, AUTOMATIC) Pos = Adc_aUnitStatus[Unit].SwNormalQueueIndex;
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+
+    if ((Pos > (Adc_QueueIndexType)0U) && (Group == Adc_aUnitStatus[Unit].SwNormalQueue[0]))
+    {
+        Adc_RemoveFromQueue(Unit, 0U);
+        Pos = 0U;
+    }
+    else if (ADC_QUEUE_NO_GROUP != Adc_aGroupStatus[Group].QueuePrev)
+    {
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_18();
+        Adc_UnlinkFromBucket(Unit, Group);
+        Adc_aUnitStatus[Unit].SwNormalQueueIndex--;
+#if (ADC_EVENT_TRACE == STD_ON)
+        Adc_Trace_Record(ADC_TRACE_EV_QUEUE_REMOVE_U8, Unit, (uint16)Group, 1U);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_18();
+        Pos = 1U;
+    }
+    else
+    {
+        /* The group is not in the queue */
+    }
+#else
+    VAR(Adc_QueueIndexType, AUTOMATIC) Index = 0U;
+
+    for (Index = 0U; Index < Pos; Index++)
+    {
+        if (Group == Adc_aUnitStatus[Unit].SwNormalQueue[Index])
+        {
+            /* The group is found in the Queue */
+            Adc_RemoveFromQueue(Unit, Index);
+            Pos = Index;
+            break;
+        }
+    }
+#endif /* (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON) */
+    return Pos;
+}
 #endif /* (ADC_ENABLE_QUEUING == STD_ON) */
 
 #if ((ADC_ENABLE_START_STOP_GROUP_API == STD_ON) && (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE))
@@ -2562,19 +4000,37 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_InsertIntoQueue
     VAR(Adc_GroupType, AUTOMATIC) Group
 )
 {
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_OFF)
 #if (ADC_QUEUE_MAX_DEPTH_MAX != 1U)
     /* Temporary index in the Queue */
     VAR(Adc_QueueIndexType, AUTOMATIC) QueueTemp = 0U;
 #endif
     /* Position of the new Group in the Queue */
     VAR(Adc_QueueIndexType, AUTOMATIC) Pos = 0U;
+    VAR(Adc_QueueIndexType, AUTOMATIC) qPtr = 0U;
+#endif /* (ADC_PRIORITY_QUEUE_BUCKETS == STD_OFF) */
     /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
     VAR(Adc_GroupPriorityType, AUTOMATIC) gPri = Adc_pCfgPtr->pGroups[(Group)].Priority;
-    VAR(Adc_QueueIndexType, AUTOMATIC) qPtr = 0U;
     VAR(Std_ReturnType, AUTOMATIC) DemTest = (Std_ReturnType)E_OK;
 
     /* Critical region ensures that interrupt cannot remove any element in queue before inserting one */
     SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_19();
+#if (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON)
+    /* ADC332, ADC417: only a group of strictly higher priority preempts the group under conversion */
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    if (Adc_pCfgPtr->pGroups[Adc_aUnitStatus[Unit].SwNormalQueue[0]].Priority < gPri)
+    {
+        /* Highest priority group detected */
+        DemTest = Adc_Ipw_StopCurrentConversion(Unit, Adc_aUnitStatus[Unit].SwNormalQueue[0]);
+        /* The preempted group is the next one to resume at its priority */
+        Adc_PushToBucket(Unit, Adc_aUnitStatus[Unit].SwNormalQueue[0], (boolean)TRUE);
+        Adc_aUnitStatus[Unit].SwNormalQueue[0] = Group;
+    }
+    else
+    {
+        Adc_PushToBucket(Unit, Group, (boolean)FALSE);
+    }
+#else
     qPtr = Adc_aUnitStatus[Unit].SwNormalQueueIndex;
     /* Find the right place in Queue (ADC332, ADC417) */
     /**
@@ -2606,6 +4062,7 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_InsertIntoQueue
     #endif
     /* Place the Group in the Queue */
     Adc_aUnitStatus[Unit].SwNormalQueue[Pos] = Group;
+#endif /* (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON) */
 
     /* Increase the Queue Index */
     Adc_aUnitStatus[Unit].SwNormalQueueIndex++;
@@ -2650,7 +4107,12 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStartConversion
     /* ADC222 */
     Adc_aGroupStatus[Group].eConversion = ADC_BUSY;
     /* ADC431 */
+    ADC_RESULT_PUBLISH_BEGIN(Group);
     Adc_aGroupStatus[Group].ResultIndex = 0U;
+    ADC_RESULT_PUBLISH_END(Group);
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+    Adc_RestartSampleSequence(Group);
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
 
 #if (ADC_SOFTWARE_INJECTED_CONVERSIONS_USED == STD_ON)
     /* Injected conversion mode */
@@ -2716,6 +4178,11 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStartConversion
   /* In this case all the StartConversion should be rejected by DET */
  #endif /* (ADC_ENABLE_QUEUING == STD_ON) */
 #endif /* ADC_PRIORITY_IMPLEMENTATION == ADC_PRIORITY_NONE */
+#if (ADC_EVENT_TRACE == STD_ON)
+    /* An empty queue receives the group below */
+    Adc_Trace_Record(ADC_TRACE_EV_QUEUE_INSERT_U8, Unit, (uint16)Group,
+                     (uint16)((0U == Adc_aUnitStatus[Unit].SwNormalQueueIndex) ? 1U : Adc_aUnitStatus[Unit].SwNormalQueueIndex));
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
 
 #if (ADC_ENABLE_QUEUING == STD_ON)
     SwNormalQueueIndex = Adc_aUnitStatus[Unit].SwNormalQueueIndex;
@@ -2771,7 +4238,6 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStopConversion
 {
     /* ADC437 */
 #if (ADC_ENABLE_QUEUING == STD_ON)
-    VAR(Adc_QueueIndexType, AUTOMATIC) SwNormalQueueIndex = 0U;
     VAR(Adc_QueueIndexType, AUTOMATIC) RemovedPos = 0U;
 #endif /* (ADC_ENABLE_QUEUING == STD_ON) */
     VAR(Std_ReturnType, AUTOMATIC) DemTest = (Std_ReturnType)E_OK;
@@ -2795,7 +4261,12 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStopConversion
     eConversion = Adc_aGroupStatus[Group].eConversion;
 
      /* FD reset number of samples completed */
+     ADC_RESULT_PUBLISH_BEGIN(Group);
      Adc_aGroupStatus[Group].ResultIndex = 0U;
+     ADC_RESULT_PUBLISH_END(Group);
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+     Adc_RestartSampleSequence(Group);
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
 #if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
      /* disable group notification (ADC155) */
      Adc_aGroupStatus[Group].eNotification = ADC_NOTIFICATION_DISABLED;
@@ -2835,30 +4306,18 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStopConversion
         {
     #if (ADC_ENABLE_QUEUING == STD_ON)
             /* ADC437 */
-            /* Find the Group in the Queue */
-            RemovedPos = Adc_aUnitStatus[Unit].SwNormalQueueIndex;  /* initialize with something invalid */
-
-            for (SwNormalQueueIndex = 0U; SwNormalQueueIndex < Adc_aUnitStatus[Unit].SwNormalQueueIndex; SwNormalQueueIndex++)
-            {
-                if (Group == Adc_aUnitStatus[Unit].SwNormalQueue[SwNormalQueueIndex] )
-                {
-                    /* The group is found in the Queue */
-                    /* Store the position of the group to be removed */
-                    RemovedPos = SwNormalQueueIndex;
-
-                    /* Stop the conversion of all channels belonging to this group */
-                    if((Adc_QueueIndexType)0U == SwNormalQueueIndex) /* In this case the group might be under conversion */
+            /* Stop the conversion of all channels belonging to this group */
+            if ((Adc_aUnitStatus[Unit].SwNormalQueueIndex > (Adc_QueueIndexType)0U) && \
+                (Group == Adc_aUnitStatus[Unit].SwNormalQueue[0])) /* In this case the group might be under conversion */
     #endif /* (ADC_ENABLE_QUEUING == STD_ON) */
-                    {
-                        /* ADC386 */
-                        DemTest = Adc_Ipw_StopCurrentConversion(Unit, Group);
-                    }
-    #if (ADC_ENABLE_QUEUING == STD_ON)
-                    /* ADC438 */
-                    /* Remove group from Queue */
-                    Adc_RemoveFromQueue(Unit, SwNormalQueueIndex);
-                }
+            {
+                /* ADC386 */
+                DemTest = Adc_Ipw_StopCurrentConversion(Unit, Group);
             }
+    #if (ADC_ENABLE_QUEUING == STD_ON)
+            /* ADC438 */
+            /* Remove group from Queue and store the position it had */
+            RemovedPos = Adc_DequeueGroup(Unit, Group);
     #else
             /* No element will be present in the queue */
             Adc_aUnitStatus[Unit].SwNormalQueueIndex = 0U;
@@ -2894,6 +4353,98 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStopConversion
     #endif /* (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF) */
     }
 }
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+/**
+* @brief          This function reserves the units of both halves of a pair.
+* @details        The pair only starts on two idle units: both queues are checked and claimed
+*                 in one critical section, each half becoming the only group in the queue of its
+*                 unit. When either unit has a group converting or waiting nothing is claimed and
+*                 ADC_E_BUSY is reported, whatever ADC_VALIDATE_STATE is: queueing a half behind
+*                 other groups would break the simultaneous start.
+*
+* @param[in]      Group     The group id.
+*
+* @return         Std_ReturnType  Standard return type.
+* @retval         E_OK:           Both queues hold their half, Adc_UpdateStatusStartPairedConversion must follow
+* @retval         E_NOT_OK:       One of the units is busy
+*
+*/
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_ClaimPairedUnits
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ClaimRet = (Std_ReturnType)E_NOT_OK;
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    VAR(Adc_GroupType, AUTOMATIC) Partner = Adc_pCfgPtr->pGroups[Group].PairedGroup;
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit = Adc_pCfgPtr->pGroups[Group].HwUnit;
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    VAR(Adc_HwUnitType, AUTOMATIC) PartnerUnit = Adc_pCfgPtr->pGroups[Partner].HwUnit;
+
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_21();
+    if (((Adc_QueueIndexType)0U == Adc_aUnitStatus[Unit].SwNormalQueueIndex) && \
+        ((Adc_QueueIndexType)0U == Adc_aUnitStatus[PartnerUnit].SwNormalQueueIndex))
+    {
+        Adc_aUnitStatus[Unit].SwNormalQueue[0] = Group;
+        Adc_aUnitStatus[Unit].SwNormalQueueIndex = 1U;
+        Adc_aUnitStatus[PartnerUnit].SwNormalQueue[0] = Partner;
+        Adc_aUnitStatus[PartnerUnit].SwNormalQueueIndex = 1U;
+        ClaimRet = (Std_ReturnType)E_OK;
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_21();
+
+#if (ADC_DEV_ERROR_DETECT == STD_ON)
+    if ((Std_ReturnType)E_OK != ClaimRet)
+    {
+        Adc_ReportDetError(ADC_STARTGROUPCONVERSION_ID, (uint8)ADC_E_BUSY);
+    }
+#endif /* (ADC_DEV_ERROR_DETECT == STD_ON) */
+
+    return ClaimRet;
+}
+
+/**
+* @brief          This function updates the status of both halves of a pair and starts them.
+* @details        Both halves are already the only group in the queue of their unit, see
+*                 Adc_ClaimPairedUnits, the two units are started together.
+*
+* @param[in]      Group     The group id.
+*
+* @return         void
+*
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusStartPairedConversion
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(Adc_GroupType, AUTOMATIC) aHalf[2];
+    VAR(Adc_GroupType, AUTOMATIC) Half;
+    VAR(uint8, AUTOMATIC) u8Half;
+
+    aHalf[0] = Group;
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    aHalf[1] = Adc_pCfgPtr->pGroups[Group].PairedGroup;
+    for (u8Half = 0U; u8Half < 2U; u8Half++)
+    {
+        Half = aHalf[u8Half];
+        /* ADC222 */
+        Adc_aGroupStatus[Half].eConversion = ADC_BUSY;
+        /* ADC431 */
+        ADC_RESULT_PUBLISH_BEGIN(Half);
+        Adc_aGroupStatus[Half].ResultIndex = 0U;
+        ADC_RESULT_PUBLISH_END(Half);
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+        Adc_RestartSampleSequence(Half);
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
+        Adc_aGroupStatus[Half].bPairHalfDone = (boolean)FALSE;
+    }
+    /* Neither unit is running - no ISR can occur now */
+    Adc_Ipw_StartPairedConversion(aHalf[0], aHalf[1]);
+}
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
 #endif /* (ADC_ENABLE_START_STOP_GROUP_API == STD_ON) */
 
 #if (ADC_READ_GROUP_API == STD_ON)
@@ -2962,15 +4513,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusReadGroupNoInt
                         SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_24();
         #if (ADC_ENABLE_QUEUING == STD_ON)
                         /* remove group without interrupts from queue  */
-                        for (SwNormalQueueIndex = 0U; SwNormalQueueIndex < Adc_aUnitStatus[Unit].SwNormalQueueIndex; SwNormalQueueIndex++)
-                        {
-                            if (Group == Adc_aUnitStatus[Unit].SwNormalQueue[SwNormalQueueIndex])
-                            {
-                                /* The group is found in the Queue */
-                                Adc_RemoveFromQueue(Unit, SwNormalQueueIndex);
-                                break;
-                            }
-                        }
+                        SwNormalQueueIndex = Adc_DequeueGroup(Unit, Group);
         #if (ADC_ENABLE_START_STOP_GROUP_API == STD_ON)
                         /* Start / restore next conversion in the queue*/
                         if (0U == SwNormalQueueIndex)
@@ -3013,16 +4556,32 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusReadGroupNoInt
     #endif /* (ADC_ENABLE_LIMIT_CHECK == STD_ON) */
 }
 
+/**
+* @brief          This function updates the status variables after reading a group with interrupts.
+* @details        This function updates the status variables after reading a group with interrupts.
+*
+* @param[in]      Group       The group which was read.
+*
+* @return         void
+*
+* @pre            Called inside an exclusive area: 29 for Adc_ReadGroup, 33 for one group of
+*                 Adc_ReadGroups, 30 through Adc_UpdateStatusReadGroupUnlocked unless the stream of
+*                 the group completed.
+*/
 LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusReadGroupInt
 (
     CONST(Adc_GroupType, AUTOMATIC) Group
 )
 {
-    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_29();
     /* The following code has been added to respect the State Diagram of Streaming Access Mode */
     if (ADC_COMPLETED == Adc_aGroupStatus[Group].eConversion)
     {
+        ADC_RESULT_PUBLISH_BEGIN(Group);
         Adc_aGroupStatus[Group].ResultIndex = 0U;
+        ADC_RESULT_PUBLISH_END(Group);
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+        Adc_RestartSampleSequence(Group);
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
         /* ADC331 -- ADC222*/
         Adc_aGroupStatus[Group].eConversion = ADC_BUSY;
     }
@@ -3072,9 +4631,51 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusReadGroupInt
     {
         /* Nothing for misra */
     }
-    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_29();
 }
 
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+/**
+* @brief          This function updates the status variables after reading a group with interrupts,
+*                 without exclusive area.
+* @details        The end of conversion handlers may preempt the update. When one of them has set a
+*                 new state of the group in the meantime, the state it set is put back: the sample
+*                 it completed has not been read and the update may have overwritten its state.
+*                 A completed group restarts its buffer: ResultIndex and the publish and sample
+*                 sequences, which the handlers also increment, are reset in exclusive area 30,
+*                 entered unless the stream of the group completed.
+*
+* @param[in]      Group       The group which was read.
+*
+* @return         void
+*
+* @pre            The end of conversion handlers set the state through ADC_GROUP_SET_COMPLETED.
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusReadGroupUnlocked
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(uint32, AUTOMATIC) u32Sequence = Adc_aGroupStatus[Group].u32CompletionSequence;
+
+    /* The handlers only move a busy group to ADC_COMPLETED, never a group whose stream completed */
+    if (ADC_STREAM_COMPLETED != Adc_aGroupStatus[Group].eConversion)
+    {
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_30();
+        Adc_UpdateStatusReadGroupInt(Group);
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_30();
+    }
+    else
+    {
+        Adc_UpdateStatusReadGroupInt(Group);
+    }
+    while (u32Sequence != Adc_aGroupStatus[Group].u32CompletionSequence)
+    {
+        u32Sequence = Adc_aGroupStatus[Group].u32CompletionSequence;
+        Adc_aGroupStatus[Group].eConversion = Adc_aGroupStatus[Group].eCompletion;
+    }
+}
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+
 #endif /* (ADC_READ_GROUP_API == STD_ON) */
 
 #if (ADC_HW_TRIGGER_API == STD_ON)
@@ -3117,7 +4718,12 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusEnableHardware
     Adc_aGroupStatus[Group].eHwTriggering = ADC_HWTRIGGER_ENABLED;
     /* ADC432 */
     /* Put the conversion results from Results Buffer Base Address */
+    ADC_RESULT_PUBLISH_BEGIN(Group);
     Adc_aGroupStatus[Group].ResultIndex = 0U;
+    ADC_RESULT_PUBLISH_END(Group);
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+    Adc_RestartSampleSequence(Group);
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
 }
 
 LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusDisableHardware
@@ -3184,56 +4790,162 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_UpdateStatusAfterGetStream
     /* The following code has been added to respect the State Diagram of Streaming Access Mode */
     if (ADC_COMPLETED == Adc_aGroupStatus[Group].eConversion)
     {
+        ADC_RESULT_PUBLISH_BEGIN(Group);
         Adc_aGroupStatus[Group].ResultIndex = 0U;
+        ADC_RESULT_PUBLISH_END(Group);
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+        Adc_RestartSampleSequence(Group);
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
         /* ADC328 -- ADC222*/
         Adc_aGroupStatus[Group].eConversion = ADC_BUSY;
     }
 
-    if (ADC_STREAM_COMPLETED == Adc_aGroupStatus[Group].eConversion)
+    if (ADC_STREAM_COMPLETED == Adc_aGroupStatus[Group].eConversion)
+    {
+        /* Compliance with State Diagram */
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        if (ADC_TRIGG_SRC_SW == Adc_pCfgPtr->pGroups[Group].eTriggerSource)
+        {
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            if((ADC_CONV_MODE_ONESHOT == Adc_pCfgPtr->pGroups[Group].eMode) || \
+               ((ADC_CONV_MODE_CONTINUOUS == Adc_pCfgPtr->pGroups[Group].eMode) && \
+                (ADC_ACCESS_MODE_STREAMING == Adc_pCfgPtr->pGroups[Group].eAccessMode) && \
+                (ADC_STREAM_BUFFER_LINEAR == Adc_pCfgPtr->pGroups[Group].eBufferMode)
+               )
+              )
+            {
+                /* ADC327 -- ADC221*/
+                Adc_aGroupStatus[Group].eConversion = ADC_IDLE;
+            }
+            else
+            { /* Continuous*/
+                /* ADC326 -- ADC222*/
+                Adc_aGroupStatus[Group].eConversion = ADC_BUSY;
+            }
+        }
+#if (STD_ON == ADC_HW_TRIGGER_API)
+        else
+        {
+            /* Hw Trigger*/
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            if((ADC_ACCESS_MODE_STREAMING == Adc_pCfgPtr->pGroups[Group].eAccessMode) && \
+               (ADC_STREAM_BUFFER_LINEAR == Adc_pCfgPtr->pGroups[Group].eBufferMode)
+              )
+            {
+                /* ADC327 -- ADC221 */
+                Adc_aGroupStatus[Group].eConversion = ADC_IDLE;
+            }
+            else /* One-shot mode or circular streaming*/
+            {
+                /* ADC326 -- ADC222 */
+                Adc_aGroupStatus[Group].eConversion = ADC_BUSY;
+            }
+        }
+#endif /* (STD_ON == ADC_HW_TRIGGER_API ) */
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_30();
+}
+
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+/**
+* @brief          This function invalidates the sample views of a group.
+* @details        Called each time ResultIndex restarts from the base of the result buffer, after
+*                 the reset. Advancing the sequence number by a whole buffer makes every view taken
+*                 before the restart fail Adc_ValidateSampleView.
+*
+* @param[in]      Group       The group whose result buffer restarts.
+*
+* @return         void
+*
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_RestartSampleSequence
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    Adc_aGroupStatus[Group].u32SampleSequence += (uint32)Adc_pCfgPtr->pGroups[Group].NumSamples;
+}
+
+/**
+* @brief          This function tells whether a group may be writing its result buffer.
+* @details        A group writes results only while it is at the head of one of the queues of its
+*                 unit.
+*
+* @param[in]      Group       The group number.
+*
+* @return         boolean
+* @retval         TRUE        The group is in conversion or waiting for its hardware trigger.
+* @retval         FALSE       No result of the group can be written until it is started again.
+*
+*/
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_IsGroupConverting
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(boolean, AUTOMATIC) bConverting = (boolean)FALSE;
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    Unit = Adc_pCfgPtr->pGroups[Group].HwUnit;
+    if (((Adc_QueueIndexType)0U < Adc_aUnitStatus[Unit].SwNormalQueueIndex) && \
+        (Group == Adc_aUnitStatus[Unit].SwNormalQueue[0]))
+    {
+        bConverting = (boolean)TRUE;
+    }
+    if (((Adc_QueueIndexType)0U < Adc_aUnitStatus[Unit].SwInjectedQueueIndex) && \
+        (Group == Adc_aUnitStatus[Unit].SwInjectedQueue[0]))
+    {
+        bConverting = (boolean)TRUE;
+    }
+#if (ADC_HW_TRIGGER_API == STD_ON)
+    if (((Adc_QueueIndexType)0U < Adc_aUnitStatus[Unit].HwNormalQueueIndex) && \
+        (Group == Adc_aUnitStatus[Unit].HwNormalQueue[0]))
+    {
+        bConverting = (boolean)TRUE;
+    }
+    if (((Adc_QueueIndexType)0U < Adc_aUnitStatus[Unit].HwInjectedQueueIndex) && \
+        (Group == Adc_aUnitStatus[Unit].HwInjectedQueue[0]))
+    {
+        bConverting = (boolean)TRUE;
+    }
+#endif /* (ADC_HW_TRIGGER_API == STD_ON) */
+
+    return bConverting;
+}
+
+/**
+* @brief          This function tells whether the results of a sample reach the buffer in parts.
+* @details        The results of a sample converted in a single chunk with interrupts are written
+*                 by one end of conversion interrupt, before u32SampleSequence is advanced. A DMA
+*                 transfer, or a sample of more than ADC_NUM_SC1_N_REGISTER_USED channels, writes
+*                 its slot before the sample is published.
+*
+* @param[in]      Group       The group number.
+*
+* @return         boolean
+* @retval         TRUE        A slot may be partly written while the sequence number is unchanged.
+* @retval         FALSE       A slot is written and published by the same interrupt.
+*
+*/
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_IsSampleWrittenInParts
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(boolean, AUTOMATIC) bInParts = (boolean)FALSE;
+
+    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    if ((ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Adc_pCfgPtr->pGroups[Group].HwUnit]) || \
+        ((Adc_ChannelIndexType)ADC_NUM_SC1_N_REGISTER_USED < ADC_GROUP_CHANNEL_COUNT(Group)))
     {
-        /* Compliance with State Diagram */
-        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
-        if (ADC_TRIGG_SRC_SW == Adc_pCfgPtr->pGroups[Group].eTriggerSource)
-        {
-            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
-            if((ADC_CONV_MODE_ONESHOT == Adc_pCfgPtr->pGroups[Group].eMode) || \
-               ((ADC_CONV_MODE_CONTINUOUS == Adc_pCfgPtr->pGroups[Group].eMode) && \
-                (ADC_ACCESS_MODE_STREAMING == Adc_pCfgPtr->pGroups[Group].eAccessMode) && \
-                (ADC_STREAM_BUFFER_LINEAR == Adc_pCfgPtr->pGroups[Group].eBufferMode)
-               )
-              )
-            {
-                /* ADC327 -- ADC221*/
-                Adc_aGroupStatus[Group].eConversion = ADC_IDLE;
-            }
-            else
-            { /* Continuous*/
-                /* ADC326 -- ADC222*/
-                Adc_aGroupStatus[Group].eConversion = ADC_BUSY;
-            }
-        }
-#if (STD_ON == ADC_HW_TRIGGER_API)
-        else
-        {
-            /* Hw Trigger*/
-            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
-            if((ADC_ACCESS_MODE_STREAMING == Adc_pCfgPtr->pGroups[Group].eAccessMode) && \
-               (ADC_STREAM_BUFFER_LINEAR == Adc_pCfgPtr->pGroups[Group].eBufferMode)
-              )
-            {
-                /* ADC327 -- ADC221 */
-                Adc_aGroupStatus[Group].eConversion = ADC_IDLE;
-            }
-            else /* One-shot mode or circular streaming*/
-            {
-                /* ADC326 -- ADC222 */
-                Adc_aGroupStatus[Group].eConversion = ADC_BUSY;
-            }
-        }
-#endif /* (STD_ON == ADC_HW_TRIGGER_API ) */
+        bInParts = (boolean)TRUE;
     }
-    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_30();
+
+    return bInParts;
 }
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
 
 #if (ADC_ENABLE_CTU_CONTROL_MODE_API == STD_ON)
 #if (ADC_DEV_ERROR_DETECT == STD_ON)
@@ -3527,12 +5239,35 @@ FUNC(void, ADC_CODE) Adc_Init
             Adc_pCfgPtr = ConfigPtr;
 #endif /* ADC_PRECOMPILE_SUPPORT */
 
-            /* Initialize the unit status for all units */
-            Adc_InitUnitStatus();
-            /* Initialize the group status for all groups */
-            Adc_InitGroupsStatus();
-            /* Call the low level function to initialize driver */
-            Adc_Ipw_Init(Adc_pCfgPtr);
+#if ((ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) || (ADC_DMA_CHAIN_RELOAD == STD_ON))
+            /* Convert the channel ranges to intervals. A configuration that does not fit in the
+               range table or in the DMA reload list is not used: the driver stays uninitialized */
+            if ((Std_ReturnType)E_OK != Adc_PrepareConfiguration())
+            {
+                Adc_pCfgPtr = NULL_PTR;
+#if (ADC_DEV_ERROR_DETECT == STD_ON)
+                ValidStatus = (Std_ReturnType)E_NOT_OK;
+                Adc_ReportDetError((uint8)ADC_INIT_ID, (uint8)ADC_E_PARAM_CONFIG);
+#endif /* ADC_DEV_ERROR_DETECT == STD_ON */
+            }
+            else
+#endif /* (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) || (ADC_DMA_CHAIN_RELOAD == STD_ON) */
+            {
+#if (ADC_EVENT_TRACE == STD_ON)
+                /* Empty the event trace before the first event */
+                Adc_Trace_Init();
+#endif /* ADC_EVENT_TRACE == STD_ON */
+                /* Initialize the unit status for all units */
+                Adc_InitUnitStatus();
+                /* Initialize the group status for all groups */
+                Adc_InitGroupsStatus();
+                /* Call the low level function to initialize driver */
+                Adc_Ipw_Init(Adc_pCfgPtr);
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+                /* Load the calibration kept by the application */
+                Adc_RestoreCalibration();
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+            }
         }
 #if (ADC_VALIDATE_GLOBAL_CALL == STD_ON)
     }
@@ -3744,8 +5479,55 @@ FUNC(void, ADC_CODE) Adc_StartGroupConversion
                 /* Get the unit to which the group belongs to */
                 /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
                 Unit = Adc_pCfgPtr->pGroups[(Group)].HwUnit;
-                /* Update queue */
-                Adc_UpdateStatusStartConversion(Group, Unit);
+#if (ADC_PAIRED_GROUPS == STD_ON)
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                if (ADC_NO_PAIRED_GROUP != Adc_pCfgPtr->pGroups[Group].PairedGroup)
+                {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+                    if ((Std_ReturnType)E_OK == Adc_ValidatePairedGroup(ADC_STARTGROUPCONVERSION_ID, Group))
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+                    {
+#if (ADC_VALIDATE_STATE == STD_ON)
+                        if ((Std_ReturnType)E_OK == Adc_ValidatePairNotBusy(Group))
+#endif /* ADC_VALIDATE_STATE == STD_ON */
+                        /* Reserve both units before anything else, a busy unit rejects the pair */
+                        if ((Std_ReturnType)E_OK == Adc_ClaimPairedUnits(Group))
+                        {
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+                            Adc_PowerNoteStart(Group);
+                            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                            Adc_PowerNoteStart(Adc_pCfgPtr->pGroups[Group].PairedGroup);
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+                            Adc_ClockNoteRequest(Group);
+                            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                            Adc_ClockNoteRequest(Adc_pCfgPtr->pGroups[Group].PairedGroup);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+                            Adc_Ipw_LatencyStart(Group);
+                            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                            Adc_Ipw_LatencyStart(Adc_pCfgPtr->pGroups[Group].PairedGroup);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+                            /* Update both queues */
+                            Adc_UpdateStatusStartPairedConversion(Group);
+                        }
+                    }
+                }
+                else
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+                {
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+                    Adc_PowerNoteStart(Group);
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+                    Adc_ClockNoteRequest(Group);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+                    Adc_Ipw_LatencyStart(Group);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+                    /* Update queue */
+                    Adc_UpdateStatusStartConversion(Group, Unit);
+                }
             }
         }
     }
@@ -3779,6 +5561,9 @@ FUNC(void, ADC_CODE) Adc_StopGroupConversion
     /* ADC368, ADC356, ADC413 */
     /* ADC Hardware unit on which the requested group will run */
     VAR(Adc_HwUnitType, AUTOMATIC) Unit = (Adc_HwUnitType)0;
+#if (ADC_PAIRED_GROUPS == STD_ON)
+    VAR(Adc_GroupType, AUTOMATIC) Partner;
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
 
 #if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
     if ((Std_ReturnType)E_OK == Adc_ValidateCallAndGroup(ADC_STOPGROUPCONVERSION_ID, Group))
@@ -3799,7 +5584,37 @@ FUNC(void, ADC_CODE) Adc_StopGroupConversion
                 /* Get the unit to which the group belongs to */
                 /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
                 Unit = Adc_pCfgPtr->pGroups[(Group)].HwUnit;
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+                Adc_aGroupStatus[Group].bPowerScheduled = (boolean)FALSE;
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+                Adc_Ipw_ClockCancelRequest(Unit, Group);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+                /* The stop disables the notification, the samples of the open batch are notified first */
+                Adc_Ipw_FlushNotification(Group, (boolean)FALSE);
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
                 Adc_UpdateStatusStopConversion(Group, Unit);
+#if (ADC_PAIRED_GROUPS == STD_ON)
+                /* The partner of a paired group is stopped with it */
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                Partner = Adc_pCfgPtr->pGroups[Group].PairedGroup;
+                if ((ADC_NO_PAIRED_GROUP != Partner) && (ADC_IDLE != Adc_aGroupStatus[Partner].eConversion))
+                {
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+                    Adc_aGroupStatus[Partner].bPowerScheduled = (boolean)FALSE;
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+                    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                    Adc_Ipw_ClockCancelRequest(Adc_pCfgPtr->pGroups[Partner].HwUnit, Partner);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+                    Adc_Ipw_FlushNotification(Partner, (boolean)FALSE);
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
+                    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                    Adc_UpdateStatusStopConversion(Partner, Adc_pCfgPtr->pGroups[Partner].HwUnit);
+                }
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
             }
         }
     }
@@ -3874,7 +5689,13 @@ FUNC(Std_ReturnType, ADC_CODE) Adc_ReadGroup
                     }
                     else
                     {
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+                        Adc_UpdateStatusReadGroupUnlocked(Group);
+#else
+                        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_29();
                         Adc_UpdateStatusReadGroupInt(Group);
+                        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_29();
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
                     }
                 }
             }
@@ -3885,6 +5706,192 @@ FUNC(Std_ReturnType, ADC_CODE) Adc_ReadGroup
 }
 #endif /* (ADC_READ_GROUP_API == STD_ON) || defined(__DOXYGEN__) */
 
+#if (ADC_READ_GROUPS_API == STD_ON) || defined(__DOXYGEN__)
+/**
+* @brief          Reads the conversion results of a list of groups.
+* @details        Equivalent to calling Adc_ReadGroup for every entry of the list, with the
+*                 outcome of each read stored in the ReadResult field of the entry. The list is
+*                 validated before any group is read, and no group is read if an entry is not
+*                 valid. Each group is then read as by Adc_ReadGroup: with ADC_RESULT_SEQLOCK its
+*                 copy is checked against its publish sequence and no exclusive area is entered,
+*                 otherwise each group is copied and its state updated in its own pass through
+*                 exclusive area 33, so that interrupts are never masked for the whole list.
+*                 All the groups must be configured with interrupts.
+*
+* @param[in,out]  pRequests      The list of groups and destination buffers.
+* @param[in]      NumRequests    Number of entries in the list.
+* @return         Std_ReturnType Standard return type.
+* @retval         E_OK:          results are available for all the groups of the list.
+* @retval         E_NOT_OK:      results are missing for at least one group or
+*                                development error occured.
+* @api
+*
+* @note           The function Non Autosar Service ID[hex]: 0x34.
+* @note           Synchronous.
+* @note           Reentrant function.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_ReadGroups
+(
+    P2VAR(Adc_ReadGroupRequestType, AUTOMATIC, ADC_APPL_DATA) pRequests,
+    VAR(Adc_GroupType, AUTOMATIC) NumRequests
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) GroupsRet = (Std_ReturnType)E_NOT_OK;
+    VAR(Adc_GroupType, AUTOMATIC) Index;
+
+#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateReadGroups(pRequests, NumRequests))
+#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
+    {
+        GroupsRet = (Std_ReturnType)E_OK;
+
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+        /** @violates @ref Adc_c_REF_7 MISRA-C:2004 Rule 1.4: Undefined behaviour.*/
+        Adc_Ipw_ReadGroups(pRequests, NumRequests);
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+        for (Index = 0U; Index < NumRequests; Index++)
+        {
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            if ((Std_ReturnType)E_OK == pRequests[Index].ReadResult)
+            {
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                Adc_UpdateStatusReadGroupUnlocked(pRequests[Index].Group);
+            }
+#else
+            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_33();
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            /** @violates @ref Adc_c_REF_7 MISRA-C:2004 Rule 1.4: Undefined behaviour.*/
+            Adc_Ipw_ReadGroups(&pRequests[Index], 1U);
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            if ((Std_ReturnType)E_OK == pRequests[Index].ReadResult)
+            {
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                Adc_UpdateStatusReadGroupInt(pRequests[Index].Group);
+            }
+            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_33();
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            if ((Std_ReturnType)E_OK != pRequests[Index].ReadResult)
+            {
+                GroupsRet = (Std_ReturnType)E_NOT_OK;
+            }
+        }
+    }
+
+    return(GroupsRet);
+}
+#endif /* (ADC_READ_GROUPS_API == STD_ON) || defined(__DOXYGEN__) */
+
+#if (ADC_PAIRED_GROUPS == STD_ON) || defined(__DOXYGEN__)
+/**
+* @brief          Reads the last sample converted by both halves of a paired group.
+* @details        The channel values of the two halves are stored interleaved: channel i of
+*                 Group at DataBufferPtr[2i] and channel i of its partner at DataBufferPtr[2i + 1].
+*                 The results of a balanced scan are instead merged in its logical channel order.
+*                 No result is returned while only one half has converted the latest sample. The
+*                 state of both groups is then updated as by Adc_ReadGroup.
+*
+* @param[in]      Group          Numeric ID of a group of the pair.
+* @param[out]     DataBufferPtr  Buffer of twice the number of channels of the group, or of the
+*                                number of logical channels of a balanced scan.
+* @return         Std_ReturnType Standard return type.
+* @retval         E_OK:          results of both halves are available and written to the
+*                                data buffer.
+* @retval         E_NOT_OK:      no paired results are available or development
+*                                error occured.
+* @api
+*
+* @note           The function Non Autosar Service ID[hex]: 0x35.
+* @note           Synchronous.
+* @note           Reentrant function.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_ReadPairedGroup
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) DataBufferPtr
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) GroupRet = (Std_ReturnType)E_NOT_OK;
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+    VAR(Adc_GroupType, AUTOMATIC) Partner;
+    VAR(uint32, AUTOMATIC) u32Sequence;
+    VAR(uint32, AUTOMATIC) u32PartnerSequence;
+    VAR(uint32, AUTOMATIC) u32Attempt = 0UL;
+    VAR(boolean, AUTOMATIC) bTorn;
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+
+#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndGroup(ADC_READPAIREDGROUP_ID, Group))
+#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
+    {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        if (((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_READPAIREDGROUP_ID, DataBufferPtr)) && \
+            ((Std_ReturnType)E_OK == Adc_ValidatePairedGroup(ADC_READPAIREDGROUP_ID, Group)) \
+           )
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+        {
+#if (ADC_VALIDATE_STATE == STD_ON)
+            if ((Std_ReturnType)E_OK == Adc_ValidateStateNotIdle(ADC_READPAIREDGROUP_ID, Group))
+#endif /* ADC_VALIDATE_STATE == STD_ON */
+            {
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                Partner = Adc_pCfgPtr->pGroups[Group].PairedGroup;
+                /* Copy both halves without masking interrupts, as Adc_ReadGroup does for one group */
+                do
+                {
+                    u32Sequence = Adc_aGroupStatus[Group].u32PublishSequence;
+                    u32PartnerSequence = Adc_aGroupStatus[Partner].u32PublishSequence;
+                    /** @violates @ref Adc_c_REF_7 MISRA-C:2004 Rule 1.4: Undefined behaviour.*/
+                    GroupRet = Adc_Ipw_ReadPairedGroup(Group, DataBufferPtr);
+                    bTorn = (boolean)((0UL != ((u32Sequence | u32PartnerSequence) & 1UL)) || \
+                                      (u32Sequence != Adc_aGroupStatus[Group].u32PublishSequence) || \
+                                      (u32PartnerSequence != Adc_aGroupStatus[Partner].u32PublishSequence));
+                    u32Attempt++;
+                } while (((boolean)TRUE == bTorn) && (u32Attempt < (uint32)ADC_RESULT_SEQLOCK_RETRIES));
+
+                /* Results are published faster than they can be copied: copy once more with interrupts masked */
+                if ((boolean)TRUE == bTorn)
+                {
+                    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_29();
+                    /** @violates @ref Adc_c_REF_7 MISRA-C:2004 Rule 1.4: Undefined behaviour.*/
+                    GroupRet = Adc_Ipw_ReadPairedGroup(Group, DataBufferPtr);
+                    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_29();
+                }
+                if ((Std_ReturnType)E_OK == GroupRet)
+                {
+                    Adc_UpdateStatusReadGroupUnlocked(Group);
+                    Adc_UpdateStatusReadGroupUnlocked(Partner);
+                }
+#else
+                SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_29();
+                /** @violates @ref Adc_c_REF_7 MISRA-C:2004 Rule 1.4: Undefined behaviour.*/
+                GroupRet = Adc_Ipw_ReadPairedGroup(Group, DataBufferPtr);
+                if ((Std_ReturnType)E_OK == GroupRet)
+                {
+                    Adc_UpdateStatusReadGroupInt(Group);
+                    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                    Adc_UpdateStatusReadGroupInt(Adc_pCfgPtr->pGroups[Group].PairedGroup);
+                }
+                SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_29();
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+            }
+        }
+    }
+
+    return(GroupRet);
+}
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) || defined(__DOXYGEN__) */
+
 #if (ADC_HW_TRIGGER_API == STD_ON) || defined(__DOXYGEN__)
 /**
 * @brief          Enables the hardware trigger for the requested ADC Channel group.
@@ -3938,6 +5945,9 @@ FUNC(void, ADC_CODE) Adc_EnableHardwareTrigger
                 /* Get the unit to which the group belongs to */
                 /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
                 Unit = Adc_pCfgPtr->pGroups[(Group)].HwUnit;
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+                Adc_PowerNoteStart(Group);
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
                 Adc_UpdateStatusEnableHardware(Group, Unit);
 
                 Adc_Ipw_EnableHardwareTrigger(Group, Unit);
@@ -3994,6 +6004,13 @@ FUNC(void, ADC_CODE) Adc_DisableHardwareTrigger
                 /* Get the unit to which the group belongs to */
                 /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
                 Unit = Adc_pCfgPtr->pGroups[(Group)].HwUnit;
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+                Adc_aGroupStatus[Group].bPowerScheduled = (boolean)FALSE;
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+                /* The disable turns the notification off, the samples of the open batch are notified first */
+                Adc_Ipw_FlushNotification(Group, (boolean)FALSE);
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
                 Adc_UpdateStatusDisableHardware(Group, Unit);
 
                 Adc_Ipw_DisableHardwareTrigger(Group, Unit);
@@ -4199,7 +6216,7 @@ FUNC(Adc_StreamNumSampleType, ADC_CODE) Adc_GetStreamLastPointer
                     /** @violates @ref Adc_c_REF_10 cast from pointer to pointer */
                     /** @violates @ref Adc_c_REF_4 only Array indexing shall be allowed */
                     *PtrToSamplePtr = (Adc_ValueGroupType *)(Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + \
-                                                            ResultIndex \
+                                                            ADC_RESULT_SAMPLE_OFFSET(Group, ResultIndex) \
                                                             );
                     Adc_UpdateStatusAfterGetStream(Group);
                 }
@@ -4211,19 +6228,185 @@ FUNC(Adc_StreamNumSampleType, ADC_CODE) Adc_GetStreamLastPointer
         {
             *PtrToSamplePtr = NULL_PTR;
         }
-#endif /* ADC_VALIDATE_STATE == STD_ON */
-
-#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
-    }
-    else
-    {
-        /* ADC302, ADC218 */
-        *PtrToSamplePtr = NULL_PTR;
+#endif /* ADC_VALIDATE_STATE == STD_ON */
+
+#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
+    }
+    else
+    {
+        /* ADC302, ADC218 */
+        *PtrToSamplePtr = NULL_PTR;
+    }
+#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
+
+    return (NumberOfResults);
+}
+
+#if (ADC_SAMPLE_VIEW_API == STD_ON) || defined(__DOXYGEN__)
+/**
+* @brief          Returns a read-only view on the latest completed sample of a group.
+* @details        The view points into the group result buffer, so no result is copied and no
+*                 exclusive area is entered. Unlike Adc_ReadGroup and Adc_GetStreamLastPointer,
+*                 the group status is left unchanged. The results may be overwritten by later
+*                 conversions while they are consumed: call Adc_ValidateSampleView after reading
+*                 them and discard them when it fails.
+*
+* @param[in]      Group       Numeric ID of requested ADC channel group.
+* @param[out]     pView       The view on the latest completed sample.
+*
+* @return         Std_ReturnType  E_OK or E_NOT_OK.
+* @retval         E_OK            The view was filled.
+* @retval         E_NOT_OK        No sample completed since the group was started, or the results
+*                                 of the group are not kept in its result buffer (groups without
+*                                 interrupts and double buffered groups).
+*
+* @api
+*
+* @note           The function Non Autosar Service ID[hex]: 0x32.
+* @note           Synchronous.
+* @note           Reentrant function.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetSampleView
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_SampleViewType, AUTOMATIC, ADC_APPL_DATA) pView
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ViewRet = (Std_ReturnType)E_NOT_OK;
+    VAR(uint32, AUTOMATIC) u32Sequence;
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) ResultIndex;
+    VAR(Adc_StatusType, AUTOMATIC) eConversion;
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
+
+#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndGroup(ADC_GETSAMPLEVIEW_ID, Group))
+#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
+    {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_GETSAMPLEVIEW_ID, pView))
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+        {
+#if (ADC_VALIDATE_STATE == STD_ON)
+            if ((Std_ReturnType)E_OK == Adc_ValidateStateNotIdle(ADC_GETSAMPLEVIEW_ID, Group))
+#endif /* ADC_VALIDATE_STATE == STD_ON */
+            {
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+                if (((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt)
+#if (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING)
+                    && ((boolean)FALSE == pGroupPtr->bAdcDoubleBuffering)
+#endif /* (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING) */
+                   )
+                {
+                    /* The sequence number is read first: an end of conversion interrupt between
+                       the reads gives a view older than its sample, which only makes the
+                       validation stricter */
+                    u32Sequence = Adc_aGroupStatus[Group].u32SampleSequence;
+                    ResultIndex = Adc_aGroupStatus[Group].ResultIndex;
+                    eConversion = Adc_aGroupStatus[Group].eConversion;
+
+                    if ((Adc_StreamNumSampleType)0U != ResultIndex)
+                    {
+                        ResultIndex--;
+                        ViewRet = (Std_ReturnType)E_OK;
+                    }
+                    else if ((ADC_COMPLETED == eConversion) || (ADC_STREAM_COMPLETED == eConversion))
+                    {
+                        /* The buffer wrapped around on the latest sample */
+                        ResultIndex = pGroupPtr->NumSamples - (Adc_StreamNumSampleType)1U;
+                        ViewRet = (Std_ReturnType)E_OK;
+                    }
+                    else
+                    {
+                        /* No sample completed since the start of the conversion */
+                    }
+
+                    if ((Std_ReturnType)E_OK == ViewRet)
+                    {
+                        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                        pView->pSample = pGroupPtr->pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, ResultIndex);
+                        pView->u32Stride = ADC_RESULT_CHANNEL_STRIDE(Group);
+                        pView->ChannelCount = ADC_GROUP_CHANNEL_COUNT(Group);
+                        pView->u32Sequence = u32Sequence;
+                    }
+                }
+            }
+        }
+    }
+
+    return ViewRet;
+}
+
+/**
+* @brief          Checks that the sample of a view was not overwritten.
+* @details        Returns E_OK when no conversion has written the buffer slot of the view since
+*                 Adc_GetSampleView, so the results read through the view before this call are
+*                 consistent. The slot of a sample is reused NumSamples samples later, and
+*                 immediately when the group restarts from the base of its buffer. While the
+*                 group converts with DMA, or in chunks of ADC_NUM_SC1_N_REGISTER_USED channels,
+*                 the slot after the last completed sample is taken as being written, so a view of
+*                 such a group with NumSamples 1 only validates once its conversions completed.
+*
+* @param[in]      Group       Numeric ID of requested ADC channel group.
+* @param[in]      pView       The view returned by Adc_GetSampleView for this group.
+*
+* @return         Std_ReturnType  E_OK or E_NOT_OK.
+* @retval         E_OK            The sample of the view is intact.
+* @retval         E_NOT_OK        The sample of the view may have been overwritten.
+*
+* @api
+*
+* @note           The function Non Autosar Service ID[hex]: 0x33.
+* @note           Synchronous.
+* @note           Reentrant function.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_ValidateSampleView
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2CONST(Adc_SampleViewType, AUTOMATIC, ADC_APPL_DATA) pView
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ViewRet = (Std_ReturnType)E_NOT_OK;
+    VAR(uint32, AUTOMATIC) u32Distance = 0UL;
+
+#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndGroup(ADC_VALIDATESAMPLEVIEW_ID, Group))
+#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
+    {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_VALIDATESAMPLEVIEW_ID, pView))
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+        {
+            /* A group in conversion whose samples are written in parts may already be writing
+               the sample after the last completed one. This is checked before reading the
+               sequence number: a group started in between has advanced it by a whole buffer.
+               A sample written by a single interrupt is published by that interrupt, which the
+               caller sees either before or after it. */
+            if (((boolean)TRUE == Adc_IsGroupConverting(Group)) && ((boolean)TRUE == Adc_IsSampleWrittenInParts(Group)))
+            {
+                u32Distance = 1UL;
+            }
+            u32Distance += Adc_aGroupStatus[Group].u32SampleSequence - pView->u32Sequence;
+
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            if (u32Distance < (uint32)Adc_pCfgPtr->pGroups[Group].NumSamples)
+            {
+                ViewRet = (Std_ReturnType)E_OK;
+            }
+        }
     }
-#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
 
-    return (NumberOfResults);
+    return ViewRet;
 }
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) || defined(__DOXYGEN__) */
 
 #if (ADC_VERSION_INFO_API == STD_ON) || defined(__DOXYGEN__)
 /**
@@ -4497,6 +6680,9 @@ FUNC(Std_ReturnType, ADC_CODE) Adc_PreparePowerState
 /**
 * @brief          Cyclically called and supervises the power state transitions.
 * @details        This API is cyclically called and supervises the power state transitions, checking for the readiness of the module and issuing the callbacks.
+*                 With ADC_POWER_DUTY_CYCLING, while the module is in ADC_FULL_POWER and no transition
+*                 is prepared, puts each idle unit in low power until u16PowerWakeupTicks calls before
+*                 the next conversion expected on it, and counts the calls spent in each power state.
 *
 * @param[in]      none
 * @param[out]     none
@@ -4518,7 +6704,35 @@ FUNC(Std_ReturnType, ADC_CODE) Adc_PreparePowerState
 */
 FUNC(void, ADC_CODE) Adc_Main_PowerTransitionManager(void)
 {
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex;
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint32, AUTOMATIC) au32Wait[ADC_MAX_HW_UNITS];
+    VAR(Adc_PowerStateType, AUTOMATIC) ePowerState;
 
+    /* Not reporting to Det, the scheduler may run the manager before Adc_Init */
+    if (NULL_PTR != Adc_pCfgPtr)
+    {
+        Adc_u32PowerTick++;
+        Adc_PowerNextConversions(au32Wait);
+        for (HwIndex = 0U; HwIndex < Adc_pCfgPtr->Misc.Adc_MaxHwCfg; HwIndex++)
+        {
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            Unit = Adc_pCfgPtr->pAdc[HwIndex].AdcHardwareUnitId;
+            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_38();
+            if ((ADC_FULL_POWER == Adc_eCurrentState) && (Adc_eTargetState >= ADC_NODEFINE_POWER))
+            {
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                ePowerState = (((boolean)TRUE == Adc_PowerUnitIdle(Unit)) && \
+                               (au32Wait[Unit] > (uint32)Adc_pCfgPtr->pAdc[HwIndex].u16PowerWakeupTicks)) ? \
+                              ADC_LOW_POWER : ADC_FULL_POWER;
+                Adc_Ipw_SetUnitPowerState(Unit, ePowerState);
+            }
+            Adc_aUnitStatus[Unit].PowerStatistics.au32StateTicks[Adc_aUnitStatus[Unit].ePowerState]++;
+            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_38();
+        }
+    }
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
 }
 #endif /* (ADC_POWER_STATE_ASYNCH_MODE_SUPPORTED == STD_ON) */
 #endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) || defined(__DOXYGEN__) */
@@ -4855,171 +7069,474 @@ FUNC(void, ADC_CODE) Adc_EnableChannel
 * @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
 * functions at file scope shall have internal linkage unless external linkage is required
 */
-FUNC(void, ADC_CODE) Adc_DisableChannel
+FUNC(void, ADC_CODE) Adc_DisableChannel
+(
+    VAR(Adc_GroupType, AUTOMATIC)Group,
+    VAR(Adc_ChannelType, AUTOMATIC)Channel
+)
+{
+    /* PR-MCAL-3233.adc, ADC413 */
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U;
+    VAR(Adc_ChannelType, AUTOMATIC) ChId;
+    VAR(Adc_GroupType, AUTOMATIC) GroupId = ADC_ENABLE_CH_DISABLE_CH_INVALID_GROUP_INDEX;
+    VAR(Adc_NcmrType , AUTOMATIC) CmrMask;
+
+#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndGroup(ADC_DISABLE_CHANNEL_ID, Group))
+#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
+    {
+
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        if ((Std_ReturnType)E_OK == Adc_ValidateExtraParams(ADC_DISABLE_CHANNEL_ID,
+                                                            ADC_E_WRONG_TRIGG_SRC_LIST | \
+                                                            ADC_E_WRONG_CONV_MODE_LIST | \
+                                                            ADC_E_WRONG_ENABLE_CH_DISABLE_CH_GROUP_LIST | \
+                                                            ADC_E_WRONG_ENABLE_CH_DISABLE_CH_ID_LIST, \
+                                                            Group \
+                                                           )
+           )
+        {
+            if ((Std_ReturnType)E_OK == Adc_ValidateEnableDisbleIdList(ADC_DISABLE_CHANNEL_ID, Group, Channel))
+            {
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+                /** @violates @ref Adc_c_REF_4 Array indexing */
+                Unit = Adc_pCfgPtr->pGroups[(Group)].HwUnit;
+                /** @violates @ref Adc_c_REF_4 Array indexing */
+                ChId = Adc_pCfgPtr->pChannels[Unit][Channel].ChId;
+                /** @violates @ref Adc_c_REF_4 Array indexing */
+                GroupId = (Adc_GroupType)Adc_pCfgPtr->pGroups[Group].EnableChDisableChGroupIndex;
+
+                /** @violates @ref Adc_c_REF_7 It is needed for calculation value of go back space for source address.*/
+                Adc_GetCmrRegister(Unit, Group, &CmrMask);
+                if (ChId < ADC_ST_INTERNAL_CH_U8)
+                {   /* Precision channel */
+                    Adc_aNCMRxMask[GroupId].Adc_u32NCMR0 = (CmrMask.Adc_u32NCMR0 & (~((uint32)1UL << ChId)));
+                }
+                else if ((ChId >= ADC_ST_INTERNAL_CH_U8) && (ChId <= ADC_ED_INTERNAL_CH_U8))
+                {   /* Standard channel */
+                    Adc_aNCMRxMask[GroupId].Adc_u32NCMR1 = (CmrMask.Adc_u32NCMR1 & (~((uint32)1UL << (ChId - ADC_ST_INTERNAL_CH_U8))));
+                }
+                else if ((ChId >= ADC_ST_EXTERNAL_CH_U8) && (ChId <= ADC_ED_EXTERNAL_CH_U8))
+                {   /* External multiplexed channel */
+                    Adc_aNCMRxMask[GroupId].Adc_u32NCMR2 = (CmrMask.Adc_u32NCMR2 & (~((uint32)1UL << (ChId - ADC_ST_EXTERNAL_CH_U8))));
+                }
+                else
+                {
+                    /* nothing for misra */
+                }
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+            }
+        }
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+
+    }
+}
+#endif /* (ADC_ENABLE_CH_DISABLE_CH_NONAUTO_API == STD_ON) || defined(__DOXYGEN__) */
+
+#if (ADC_GET_INJECTED_CONVERSION_STATUS_API == STD_ON) || defined(__DOXYGEN__)
+/**
+* @brief          Get the injected conversions status.
+* @details        This function checks if an injected conversion (HW,SW) is ongoing
+*
+* @param[in]      unit            ADC Unit id.
+*
+* @return         Adc_StatusType  Status of the ADC HW unit.
+* @retval         ADC_IDLE:       SW,HW Injection or Hardware Trigger group are idle.
+* @retval         ADC_BUSY:       SW,HW Injection or Hardware Trigger is inprogress.
+*
+* @api
+* @note           The function Service ID[hex]: 0x14.
+* @note           Synchronous.
+* @note           Re-entrant function.
+* @implements     Adc_GetInjectedConversionStatus_Activity
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Adc_StatusType, ADC_CODE) Adc_GetInjectedConversionStatus
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    /* CPR-MCAL-730.adc, ADC413 */
+    VAR(Adc_StatusType, AUTOMATIC) eTempReturn = (Adc_StatusType)ADC_IDLE;
+
+#if (ADC_VALIDATE_CALL_AND_UNIT == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_GETINJECTEDCONVERSIONSTATUS_ID, Unit))
+#endif /* ADC_VALIDATE_CALL_AND_UNIT == STD_ON */
+    {
+        if (Adc_aUnitStatus[Unit].SwInjectedQueueIndex > (Adc_QueueIndexType)0)
+        {
+            eTempReturn = (Adc_StatusType)ADC_BUSY;
+        }
+#if (ADC_HW_TRIGGER_API == STD_ON)
+        else if (Adc_aUnitStatus[Unit].HwInjectedQueueIndex > (Adc_QueueIndexType)0)
+        {
+            eTempReturn = (Adc_StatusType)ADC_BUSY;
+        }
+#endif
+        else
+        {
+            /* nothing for Mirsa */
+        }
+    }
+
+    return (eTempReturn);
+}
+#endif /* (ADC_GET_INJECTED_CONVERSION_STATUS_API) || defined(__DOXYGEN__) */
+
+#if (ADC_CALIBRATION == STD_ON)
+/**
+* @brief          Executes high accuracy calibration of a ADC HW unit.
+* @details        This function calibrates the ADC HW unit and updates calibration related registers
+*
+* @param[in]      Unit      ADC Unit Id.
+* @param[in]      pStatus    Status of the ADC HW unit calibration and
+*                           list of failed and passed tests.
+*
+* @return         void
+*
+* @api
+*
+* @note           The function Service ID[hex]: 0x15.
+* @implements  Adc_Calibrate_Activity
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(void, ADC_CODE) Adc_Calibrate
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_CalibrationStatusType , AUTOMATIC, ADC_APPL_DATA) pStatus
+)
+{
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pUnitConfig;
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
+    /* SMCAL_SW121.adc, PR-MCAL-3012.adc */
+#if (ADC_VALIDATE_CALL_AND_UNIT == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_CALIBRATE_ID, Unit))
+#endif /* ADC_VALIDATE_CALL_AND_UNIT == STD_ON */
+    {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_CALIBRATE_ID, pStatus))
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+        {
+            if ((Std_ReturnType)E_OK == Adc_ValidateNotBusyNoQueue(Unit, ADC_CALIBRATE_ID))
+            {
+
+                if ((Std_ReturnType)E_OK == Adc_ValidateCheckGroupNotConversion(ADC_CALIBRATE_ID))
+                {
+                    pStatus->Adc_UnitSelfTestStatus = (Std_ReturnType) E_NOT_OK;
+                    Adc_Ipw_Calibrate(Unit, pStatus);
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+                    Adc_aUnitStatus[Unit].eCalibrationOrigin = ADC_CALIBRATION_NONE;
+                    if ((Std_ReturnType)E_OK == pStatus->Adc_UnitSelfTestStatus)
+                    {
+                        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                        pUnitConfig = &(Adc_pCfgPtr->pAdc[Adc_pCfgPtr->Misc.aHwLogicalId[Unit]]);
+                        Adc_aUnitStatus[Unit].eCalibrationOrigin = ADC_CALIBRATION_MEASURED;
+                        Adc_aUnitStatus[Unit].s32CalibrationTemperature = (NULL_PTR != pUnitConfig->pfReadTemperature) ? \
+                                                                          (sint32)pUnitConfig->pfReadTemperature() : (sint32)0;
+                    }
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+                }
+            }
+        }
+    }
+}
+#endif /* ADC_CALIBRATION == STD_ON */
+
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+/**
+* @brief          Starts the high accuracy calibration of a ADC HW unit.
+* @details        Performs the same checks as Adc_Calibrate, starts the calibration and returns
+*                 without waiting for it. Until the calibration ends the unit rejects conversion
+*                 requests with ADC_E_BUSY. At the end pStatus is updated and the
+*                 pCalibrationNotification of the unit, if configured, is called from the end of
+*                 conversion interrupt of the unit or from Adc_GetCalibrationState.
+*
+* @param[in]      Unit      ADC Unit Id.
+* @param[in]      pStatus   Status of the ADC HW unit calibration, written at the end of the
+*                           calibration. Must stay valid until then.
+*
+* @return         Std_ReturnType  Standard return type.
+* @retval         E_OK:           The calibration was started
+* @retval         E_NOT_OK:       The calibration was not started
+*
+* @api
+*
+* @note           The function Service ID[hex]: 0x36.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_CalibrateAsync
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_CalibrationStatusType , AUTOMATIC, ADC_APPL_DATA) pStatus
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) Result = (Std_ReturnType)E_NOT_OK;
+
+#if (ADC_VALIDATE_CALL_AND_UNIT == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_CALIBRATEASYNC_ID, Unit))
+#endif /* ADC_VALIDATE_CALL_AND_UNIT == STD_ON */
+    {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_CALIBRATEASYNC_ID, pStatus))
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+        {
+            if ((Std_ReturnType)E_OK == Adc_ValidateNotBusyNoQueue(Unit, ADC_CALIBRATEASYNC_ID))
+            {
+                if ((Std_ReturnType)E_OK == Adc_ValidateCheckGroupNotConversion(ADC_CALIBRATEASYNC_ID))
+                {
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+                    /* The calibration registers are cleared until the new results are ready */
+                    Adc_aUnitStatus[Unit].eCalibrationOrigin = ADC_CALIBRATION_NONE;
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+                    Adc_Ipw_StartCalibration(Unit, pStatus);
+                    Result = (Std_ReturnType)E_OK;
+                }
+            }
+        }
+    }
+    return Result;
+}
+
+/**
+* @brief          Returns the state of the calibration started by Adc_CalibrateAsync.
+* @details        Also completes the calibration when the unit has finished it, so that units
+*                 whose end of conversion interrupt is not used can be served by polling. A
+*                 calibration still running after ADC_TIMEOUT_COUNTER calls is abandoned and
+*                 reported as failed.
+*
+* @param[in]      Unit      ADC Unit Id.
+*
+* @return         Adc_CalibrationStateType  State of the calibration.
+* @retval         ADC_CALIBRATION_IDLE:     No calibration is running on the unit
+* @retval         ADC_CALIBRATION_ONGOING:  The calibration is still running
+*
+* @api
+*
+* @note           The function Service ID[hex]: 0x37.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Adc_CalibrationStateType, ADC_CODE) Adc_GetCalibrationState
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(Adc_CalibrationStateType, AUTOMATIC) eState = ADC_CALIBRATION_IDLE;
+
+#if (ADC_VALIDATE_CALL_AND_UNIT == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_GETCALIBRATIONSTATE_ID, Unit))
+#endif /* ADC_VALIDATE_CALL_AND_UNIT == STD_ON */
+    {
+        eState = Adc_Ipw_GetCalibrationState(Unit);
+    }
+    return eState;
+}
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
+
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+/**
+* @brief          Exports the calibration results of a ADC HW unit.
+* @details        Fills pData with the calibration registers and USR_OFS of the unit, the
+*                 configured CFG1, the temperature read by pfReadTemperature when the calibration
+*                 completed (or the one stored with the data Adc_Init restored) and the checksum
+*                 Adc_Init checks before loading the data back through pCalibrationData. The
+*                 application stores the structure as is in non-volatile memory.
+*
+* @param[in]      Unit      ADC Unit Id.
+* @param[out]     pData     Calibration data to fill.
+*
+* @return         Std_ReturnType  Standard return type.
+* @retval         E_OK:           pData holds the calibration of the unit
+* @retval         E_NOT_OK:       The unit is not calibrated, pData is unchanged
+*
+* @api
+*
+* @note           The function Service ID[hex]: 0x38.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetCalibrationData
 (
-    VAR(Adc_GroupType, AUTOMATIC)Group,
-    VAR(Adc_ChannelType, AUTOMATIC)Channel
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_CalibrationDataType, AUTOMATIC, ADC_APPL_DATA) pData
 )
 {
-    /* PR-MCAL-3233.adc, ADC413 */
-    VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U;
-    VAR(Adc_ChannelType, AUTOMATIC) ChId;
-    VAR(Adc_GroupType, AUTOMATIC) GroupId = ADC_ENABLE_CH_DISABLE_CH_INVALID_GROUP_INDEX;
-    VAR(Adc_NcmrType , AUTOMATIC) CmrMask;
+    VAR(Std_ReturnType, AUTOMATIC) Result = (Std_ReturnType)E_NOT_OK;
+    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pUnitConfig;
 
-#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
-    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndGroup(ADC_DISABLE_CHANNEL_ID, Group))
-#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
+#if (ADC_VALIDATE_CALL_AND_UNIT == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_GETCALIBRATIONDATA_ID, Unit))
+#endif /* ADC_VALIDATE_CALL_AND_UNIT == STD_ON */
     {
-
 #if (ADC_VALIDATE_PARAMS == STD_ON)
-        if ((Std_ReturnType)E_OK == Adc_ValidateExtraParams(ADC_DISABLE_CHANNEL_ID,
-                                                            ADC_E_WRONG_TRIGG_SRC_LIST | \
-                                                            ADC_E_WRONG_CONV_MODE_LIST | \
-                                                            ADC_E_WRONG_ENABLE_CH_DISABLE_CH_GROUP_LIST | \
-                                                            ADC_E_WRONG_ENABLE_CH_DISABLE_CH_ID_LIST, \
-                                                            Group \
-                                                           )
-           )
+        if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_GETCALIBRATIONDATA_ID, pData))
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
         {
-            if ((Std_ReturnType)E_OK == Adc_ValidateEnableDisbleIdList(ADC_DISABLE_CHANNEL_ID, Group, Channel))
+            if (ADC_CALIBRATION_NONE != Adc_aUnitStatus[Unit].eCalibrationOrigin)
             {
-#endif /* ADC_VALIDATE_PARAMS == STD_ON */
-                /** @violates @ref Adc_c_REF_4 Array indexing */
-                Unit = Adc_pCfgPtr->pGroups[(Group)].HwUnit;
-                /** @violates @ref Adc_c_REF_4 Array indexing */
-                ChId = Adc_pCfgPtr->pChannels[Unit][Channel].ChId;
-                /** @violates @ref Adc_c_REF_4 Array indexing */
-                GroupId = (Adc_GroupType)Adc_pCfgPtr->pGroups[Group].EnableChDisableChGroupIndex;
-
-                /** @violates @ref Adc_c_REF_7 It is needed for calculation value of go back space for source address.*/
-                Adc_GetCmrRegister(Unit, Group, &CmrMask);
-                if (ChId < ADC_ST_INTERNAL_CH_U8)
-                {   /* Precision channel */
-                    Adc_aNCMRxMask[GroupId].Adc_u32NCMR0 = (CmrMask.Adc_u32NCMR0 & (~((uint32)1UL << ChId)));
-                }
-                else if ((ChId >= ADC_ST_INTERNAL_CH_U8) && (ChId <= ADC_ED_INTERNAL_CH_U8))
-                {   /* Standard channel */
-                    Adc_aNCMRxMask[GroupId].Adc_u32NCMR1 = (CmrMask.Adc_u32NCMR1 & (~((uint32)1UL << (ChId - ADC_ST_INTERNAL_CH_U8))));
-                }
-                else if ((ChId >= ADC_ST_EXTERNAL_CH_U8) && (ChId <= ADC_ED_EXTERNAL_CH_U8))
-                {   /* External multiplexed channel */
-                    Adc_aNCMRxMask[GroupId].Adc_u32NCMR2 = (CmrMask.Adc_u32NCMR2 & (~((uint32)1UL << (ChId - ADC_ST_EXTERNAL_CH_U8))));
-                }
-                else
-                {
-                    /* nothing for misra */
-                }
-#if (ADC_VALIDATE_PARAMS == STD_ON)
+                /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                pUnitConfig = &(Adc_pCfgPtr->pAdc[Adc_pCfgPtr->Misc.aHwLogicalId[Unit]]);
+                pData->u32Signature = ADC_CALIBRATION_DATA_SIGNATURE;
+                pData->u32Unit = (uint32)Unit;
+                pData->u32Cfg1 = pUnitConfig->u32AdcCfg1Register;
+                Adc_Ipw_ReadCalibration(Unit, pData);
+                pData->s32Temperature = Adc_aUnitStatus[Unit].s32CalibrationTemperature;
+                pData->u32Checksum = Adc_CalibrationChecksum(pData);
+                Result = (Std_ReturnType)E_OK;
             }
         }
-#endif /* ADC_VALIDATE_PARAMS == STD_ON */
-
     }
+    return Result;
 }
-#endif /* (ADC_ENABLE_CH_DISABLE_CH_NONAUTO_API == STD_ON) || defined(__DOXYGEN__) */
 
-#if (ADC_GET_INJECTED_CONVERSION_STATUS_API == STD_ON) || defined(__DOXYGEN__)
 /**
-* @brief          Get the injected conversions status.
-* @details        This function checks if an injected conversion (HW,SW) is ongoing
+* @brief          Returns where the calibration registers of a ADC HW unit come from.
+* @details        Lets the application run Adc_Calibrate only when Adc_Init could not load the
+*                 stored calibration, and export the data again after a new calibration.
 *
-* @param[in]      unit            ADC Unit id.
+* @param[in]      Unit      ADC Unit Id.
 *
-* @return         Adc_StatusType  Status of the ADC HW unit.
-* @retval         ADC_IDLE:       SW,HW Injection or Hardware Trigger group are idle.
-* @retval         ADC_BUSY:       SW,HW Injection or Hardware Trigger is inprogress.
+* @return         Adc_CalibrationOriginType  Origin of the calibration registers.
 *
 * @api
-* @note           The function Service ID[hex]: 0x14.
-* @note           Synchronous.
-* @note           Re-entrant function.
-* @implements     Adc_GetInjectedConversionStatus_Activity
+*
+* @note           The function Service ID[hex]: 0x39.
 */
 /**
 * @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
 * functions at file scope shall have internal linkage unless external linkage is required
 */
-FUNC(Adc_StatusType, ADC_CODE) Adc_GetInjectedConversionStatus
+FUNC(Adc_CalibrationOriginType, ADC_CODE) Adc_GetCalibrationOrigin
 (
     VAR(Adc_HwUnitType, AUTOMATIC) Unit
 )
 {
-    /* CPR-MCAL-730.adc, ADC413 */
-    VAR(Adc_StatusType, AUTOMATIC) eTempReturn = (Adc_StatusType)ADC_IDLE;
+    VAR(Adc_CalibrationOriginType, AUTOMATIC) eOrigin = ADC_CALIBRATION_NONE;
 
 #if (ADC_VALIDATE_CALL_AND_UNIT == STD_ON)
-    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_GETINJECTEDCONVERSIONSTATUS_ID, Unit))
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_GETCALIBRATIONORIGIN_ID, Unit))
 #endif /* ADC_VALIDATE_CALL_AND_UNIT == STD_ON */
     {
-        if (Adc_aUnitStatus[Unit].SwInjectedQueueIndex > (Adc_QueueIndexType)0)
-        {
-            eTempReturn = (Adc_StatusType)ADC_BUSY;
-        }
-#if (ADC_HW_TRIGGER_API == STD_ON)
-        else if (Adc_aUnitStatus[Unit].HwInjectedQueueIndex > (Adc_QueueIndexType)0)
+        eOrigin = Adc_aUnitStatus[Unit].eCalibrationOrigin;
+    }
+    return eOrigin;
+}
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
+#if (ADC_ASYNC_ABORT == STD_ON) || (ADC_NOTIFICATION_COALESCING == STD_ON)
+/**
+* @brief          Cyclic processing of the ADC driver.
+* @details        Starts the group waiting on a HW unit that has not yet aborted the conversion
+*                 stopped when that group preempted it, or when it was stopped by the application.
+*                 Notifies the batches of coalesced notifications whose u32Window has passed
+*                 without a new sample to end them.
+*                 To be called with a fixed period by the application or the BSW scheduler: the
+*                 abort timeout, ADC_ABORT_TIMEOUT_PERIODS, is counted in these periods, and a
+*                 window is notified at most one period late.
+*
+* @return         void
+*
+* @api
+*
+* @note           The function Service ID[hex]: 0x3A.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(void, ADC_CODE) Adc_MainFunction(void)
+{
+#if (ADC_ASYNC_ABORT == STD_ON)
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex;
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+#endif /* ADC_ASYNC_ABORT == STD_ON */
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+    VAR(Adc_GroupType, AUTOMATIC) Group;
+#endif /* ADC_NOTIFICATION_COALESCING == STD_ON */
+
+    /* Not reporting to Det, the scheduler may run the main function before Adc_Init */
+    if (NULL_PTR != Adc_pCfgPtr)
+    {
+#if (ADC_ASYNC_ABORT == STD_ON)
+        for (HwIndex = 0U; HwIndex < Adc_pCfgPtr->Misc.Adc_MaxHwCfg; HwIndex++)
         {
-            eTempReturn = (Adc_StatusType)ADC_BUSY;
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            Unit = Adc_pCfgPtr->pAdc[HwIndex].AdcHardwareUnitId;
+            if ((boolean)TRUE == Adc_aUnitStatus[Unit].bAbortPending)
+            {
+                Adc_Ipw_CompleteAbort(Unit, (boolean)TRUE);
+            }
         }
-#endif
-        else
+#endif /* ADC_ASYNC_ABORT == STD_ON */
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+        for (Group = 0U; Group < (Adc_GroupType)Adc_pCfgPtr->GroupCount; Group++)
         {
-            /* nothing for Mirsa */
+            Adc_Ipw_FlushNotification(Group, (boolean)TRUE);
         }
+#endif /* ADC_NOTIFICATION_COALESCING == STD_ON */
     }
-
-    return (eTempReturn);
 }
-#endif /* (ADC_GET_INJECTED_CONVERSION_STATUS_API) || defined(__DOXYGEN__) */
+#endif /* (ADC_ASYNC_ABORT == STD_ON) || (ADC_NOTIFICATION_COALESCING == STD_ON) */
 
-#if (ADC_CALIBRATION == STD_ON)
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
 /**
-* @brief          Executes high accuracy calibration of a ADC HW unit.
-* @details        This function calibrates the ADC HW unit and updates calibration related registers
+* @brief          Returns the power statistics of a ADC HW unit.
+* @details        The time spent in each power state is given in calls of
+*                 Adc_Main_PowerTransitionManager since Adc_Init.
 *
-* @param[in]      Unit      ADC Unit Id.
-* @param[in]      pStatus    Status of the ADC HW unit calibration and
-*                           list of failed and passed tests.
+* @param[in]      Unit          ADC Unit Id.
+* @param[out]     pStatistics   Statistics of the unit.
 *
-* @return         void
+* @return         Std_ReturnType  E_OK if pStatistics was filled.
 *
 * @api
 *
-* @note           The function Service ID[hex]: 0x15.
-* @implements  Adc_Calibrate_Activity
+* @note           The function Service ID[hex]: 0x3B.
 */
 /**
 * @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
 * functions at file scope shall have internal linkage unless external linkage is required
 */
-FUNC(void, ADC_CODE) Adc_Calibrate
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetPowerStatistics
 (
     VAR(Adc_HwUnitType, AUTOMATIC) Unit,
-    P2VAR(Adc_CalibrationStatusType , AUTOMATIC, ADC_APPL_DATA) pStatus
+    P2VAR(Adc_PowerStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
 )
 {
-    /* SMCAL_SW121.adc, PR-MCAL-3012.adc */
+    VAR(Std_ReturnType, AUTOMATIC) Result = (Std_ReturnType)E_NOT_OK;
+
 #if (ADC_VALIDATE_CALL_AND_UNIT == STD_ON)
-    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_CALIBRATE_ID, Unit))
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_GETPOWERSTATISTICS_ID, Unit))
 #endif /* ADC_VALIDATE_CALL_AND_UNIT == STD_ON */
     {
 #if (ADC_VALIDATE_PARAMS == STD_ON)
-        if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_CALIBRATE_ID, pStatus))
+        if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_GETPOWERSTATISTICS_ID, pStatistics))
 #endif /* ADC_VALIDATE_PARAMS == STD_ON */
         {
-            if ((Std_ReturnType)E_OK == Adc_ValidateNotBusyNoQueue(Unit, ADC_CALIBRATE_ID))
-            {
-
-                if ((Std_ReturnType)E_OK == Adc_ValidateCheckGroupNotConversion(ADC_CALIBRATE_ID))
-                {
-                    pStatus->Adc_UnitSelfTestStatus = (Std_ReturnType) E_NOT_OK;
-                    Adc_Ipw_Calibrate(Unit, pStatus);
-                }
-            }
+            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_38();
+            *pStatistics = Adc_aUnitStatus[Unit].PowerStatistics;
+            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_38();
+            Result = (Std_ReturnType)E_OK;
         }
     }
+    return Result;
 }
-#endif /* ADC_CALIBRATION == STD_ON */
+#endif /* ADC_POWER_DUTY_CYCLING == STD_ON */
 
 #if (ADC_SELF_TEST == STD_ON)
 /**
@@ -5230,6 +7747,217 @@ FUNC(Std_ReturnType, ADC_CODE) Adc_SetClockMode
 }
 #endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
 
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+/**
+* @brief          Returns the clock statistics of a ADC HW unit.
+* @details        Group conversions completed and time spent in the normal and the alternate clock
+*                 configurations since Adc_Init, with the number of switches and of missed deadlines.
+*                 The throughput of a configuration is its conversions divided by its time.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[out]     pStatistics   Statistics of the unit.
+*
+* @return         Std_ReturnType  E_OK if pStatistics was filled.
+*
+* @api
+*
+* @note           The function Service ID[hex]: 0x3C.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetClockStatistics
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_ClockStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) Result = (Std_ReturnType)E_NOT_OK;
+
+#if (ADC_VALIDATE_CALL_AND_UNIT == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndUnit(ADC_GETCLOCKSTATISTICS_ID, Unit))
+#endif /* ADC_VALIDATE_CALL_AND_UNIT == STD_ON */
+    {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_GETCLOCKSTATISTICS_ID, pStatistics))
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+        {
+            Adc_Ipw_GetClockStatistics(Unit, pStatistics);
+            Result = (Std_ReturnType)E_OK;
+        }
+    }
+    return Result;
+}
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+/**
+* @brief          Returns a latency histogram of a group.
+* @details        The histograms count, since Adc_Init, the intervals between the start request
+*                 of the group, the interrupts of its chunks of ADC_NUM_SC1_N_REGISTER_USED channels
+*                 and the dispatch of its notification, in ticks of ADC_GET_TIMESTAMP. The
+*                 interval of eStage is returned with the longest one recorded.
+*
+* @param[in]      Group         Numeric ID of requested ADC channel group.
+* @param[in]      eStage        Interval of the histogram.
+* @param[out]     pHistogram    Copy of the histogram.
+*
+* @return         Std_ReturnType  E_OK if pHistogram was filled.
+*
+* @api
+*
+* @note           The function Service ID[hex]: 0x3D.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetLatencyHistogram
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_LatencyStageType, AUTOMATIC) eStage,
+    P2VAR(Adc_LatencyHistogramType, AUTOMATIC, ADC_APPL_DATA) pHistogram
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) Result = (Std_ReturnType)E_NOT_OK;
+
+#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndGroup(ADC_GETLATENCYHISTOGRAM_ID, Group))
+#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
+    {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        if ((uint32)eStage >= (uint32)ADC_LATENCY_STAGES)
+        {
+            Adc_ReportDetError((uint8)ADC_GETLATENCYHISTOGRAM_ID, (uint8)ADC_E_PARAM_LATENCY_STAGE);
+        }
+        else if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_GETLATENCYHISTOGRAM_ID, pHistogram))
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+        {
+            Adc_Ipw_GetLatencyHistogram(Group, eStage, pHistogram);
+            Result = (Std_ReturnType)E_OK;
+        }
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        else
+        {
+            /* Reported by Adc_ValidatePtr */
+        }
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+    }
+    return Result;
+}
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+/**
+* @brief          Calls the notifications posted by the end of conversion interrupts.
+* @details        Takes the groups posted in the queue of each HW unit, oldest first, and calls
+*                 the notification of those whose notification is still enabled. Groups posted
+*                 while it runs are left to the next call. The latency histograms and the event
+*                 trace sample each notification here, when it is called. To be called
+*                 periodically by the application or the BSW scheduler, or by a task at a lower
+*                 priority than the ADC and DMA interrupts; the calls must not preempt each other.
+*
+* @return         void
+*
+* @api
+*
+* @note           The function Service ID[hex]: 0x3E.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(void, ADC_CODE) Adc_Main_NotificationDispatcher(void)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex;
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(Adc_GroupType, AUTOMATIC) Group;
+    VAR(uint32, AUTOMATIC) u32Head;
+    VAR(uint32, AUTOMATIC) u32Tail;
+    VAR(boolean, AUTOMATIC) bNotify;
+
+    /* Not reporting to Det, the scheduler may run the main function before Adc_Init */
+    if (NULL_PTR != Adc_pCfgPtr)
+    {
+        for (HwIndex = 0U; HwIndex < Adc_pCfgPtr->Misc.Adc_MaxHwCfg; HwIndex++)
+        {
+            /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            Unit = Adc_pCfgPtr->pAdc[HwIndex].AdcHardwareUnitId;
+            u32Head = Adc_aUnitStatus[Unit].u32NotifyHead;
+            u32Tail = Adc_aUnitStatus[Unit].u32NotifyTail;
+            while (u32Tail != u32Head)
+            {
+                Group = Adc_aUnitStatus[Unit].aNotifyQueue[u32Tail & (ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE - 1U)];
+                bNotify = (ADC_NOTIFICATION_ENABLED == Adc_aGroupStatus[Group].eNotification) ? (boolean)TRUE : (boolean)FALSE;
+                if ((boolean)TRUE == bNotify)
+                {
+                    /* The notification is sampled here, not when the interrupt posted it */
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+                    Adc_Ipw_LatencyDispatch(Group);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+#if (ADC_EVENT_TRACE == STD_ON)
+                    Adc_Trace_Record(ADC_TRACE_EV_NOTIFY_U8, Unit, (uint16)Group, 0U);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+                }
+                /* A completion from now on posts the group again, the slot is released before the call */
+                Adc_aGroupStatus[Group].bNotifyPending = (boolean)FALSE;
+                u32Tail++;
+                Adc_aUnitStatus[Unit].u32NotifyTail = u32Tail;
+                if ((boolean)TRUE == bNotify)
+                {
+                    Adc_aGroupStatus[Group].NotifyStatistics.u32Dispatched++;
+                    /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                    Adc_pCfgPtr->pGroups[Group].Notification();
+                }
+            }
+        }
+    }
+}
+
+/**
+* @brief          Returns the deferred notification counters of a group.
+*
+* @param[in]      Group         Numeric ID of requested ADC channel group.
+* @param[out]     pStatistics   Counters of the group since Adc_Init.
+*
+* @return         Std_ReturnType  E_OK if pStatistics was filled.
+*
+* @api
+*
+* @note           The function Service ID[hex]: 0x3F.
+*/
+/**
+* @violates @ref Adc_c_REF_3 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_GetNotificationStatistics
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_NotificationStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) Result = (Std_ReturnType)E_NOT_OK;
+
+#if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
+    if ((Std_ReturnType)E_OK == Adc_ValidateCallAndGroup(ADC_GETNOTIFICATIONSTATISTICS_ID, Group))
+#endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
+    {
+#if (ADC_VALIDATE_PARAMS == STD_ON)
+        if ((Std_ReturnType)E_OK == Adc_ValidatePtr(ADC_GETNOTIFICATIONSTATISTICS_ID, pStatistics))
+#endif /* ADC_VALIDATE_PARAMS == STD_ON */
+        {
+            /* The interrupts count while the counters are copied */
+            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_40();
+            *pStatistics = Adc_aGroupStatus[Group].NotifyStatistics;
+            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_40();
+            Result = (Std_ReturnType)E_OK;
+        }
+    }
+    return Result;
+}
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
+
 #if (CTUV2_ENABLE_TRIGGER_CONFIGURATION_APIS == STD_ON)
 /**
  * @brief   Function to set the trigger handler control registers of the CTUV2 IP.
@@ -5543,6 +8271,14 @@ FUNC(void, ADC_CODE) Adc_SetChannel
         {
             Adc_ReportDetError(ADC_SETCHANNEL_ID, (uint8)ADC_E_PARAM_CHANNEL);
         }
+    #if (ADC_BALANCED_SCANS == STD_ON)
+        /** @violates @ref Adc_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        else if (NULL_PTR != Adc_pCfgPtr->pGroups[Group].pBalancedScan)
+        {
+            /* The channels of a balanced half are owned by the split done in Adc_Init */
+            Adc_ReportDetError(ADC_SETCHANNEL_ID, (uint8)ADC_E_PARAM_PAIRED_GROUP);
+        }
+    #endif /* (ADC_BALANCED_SCANS == STD_ON) */
         else
 #endif /* ADC_VALIDATE_CALL_AND_GROUP == STD_ON */
         {
@@ -5560,6 +8296,9 @@ FUNC(void, ADC_CODE) Adc_SetChannel
         #endif /* (defined(ADC_PDB_SUPPORTED) || defined(ADC_PTUV3_SUPPORTED)) */
             Adc_aRuntimeGroupChannel[Group].ChannelCount = NumberOfChannel;
             Adc_aRuntimeGroupChannel[Group].bRuntimeUpdated = (boolean) TRUE;
+        #if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+            Adc_Ipw_BuildRegisterImages(Group);
+        #endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
         }
 #if (ADC_VALIDATE_CALL_AND_GROUP == STD_ON)
     }
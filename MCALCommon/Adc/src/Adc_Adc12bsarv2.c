@@ -118,6 +118,7 @@ extern "C"{
 #include "SchM_Adc.h"
 #include "Adc_Adc12bsarv2.h"
 #include "Adc_Pdb.h"
+#include "Adc_Trace.h"
 /** @violates @ref Adc_Adc12bsarv2_c_REF_2 Repeated include file  */
 #include "Mcal.h"
 
@@ -254,6 +255,27 @@ extern "C"{
     #error "Software Version Numbers of Adc_Adc12bsarv2.c and Adc_Pdb.h are different"
 #endif
 
+/* Check if source file and Adc_Trace header file are from the same vendor */
+#if (ADC_AR_VENDOR_ID_ADC12BSARV2_C != ADC_VENDOR_ID_TRACE)
+    #error "Adc_Adc12bsarv2.c and Adc_Trace.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_C != ADC_AR_RELEASE_MAJOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_C != ADC_AR_RELEASE_MINOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_C != ADC_AR_RELEASE_REVISION_VERSION_TRACE) \
+    )
+    #error "AutoSar Version Numbers of Adc_Adc12bsarv2.c and Adc_Trace.h are different"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Software version */
+#if ((ADC_SW_MAJOR_VERSION_ADC12BSARV2_C != ADC_SW_MAJOR_VERSION_TRACE) || \
+     (ADC_SW_MINOR_VERSION_ADC12BSARV2_C != ADC_SW_MINOR_VERSION_TRACE) || \
+     (ADC_SW_PATCH_VERSION_ADC12BSARV2_C != ADC_SW_PATCH_VERSION_TRACE) \
+    )
+    #error "Software Version Numbers of Adc_Adc12bsarv2.c and Adc_Trace.h are different"
+#endif
+
 /** @violates @ref Adc_Adc12bsarv2_c_REF_7 MISRA-C:2004 Rule 1.4: Identifier clash.*/
 #ifndef DISABLE_MCAL_INTERMODULE_ASR_CHECK
 #if (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF)
@@ -292,10 +314,80 @@ extern "C"{
 /*==================================================================================================
 *                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+/**
+* @brief          Number of TCDs linked after the first chunk: SC1n copy, PDB block copy, PDB trigger
+*                 and result transfer for each of the other chunks.
+*/
+#define ADC_ADC12BSARV2_DMA_CHAIN_TCDS          (4U * (ADC_REGISTER_IMAGE_MAX_CHUNKS - 1U))
+
+/**
+* @brief          Descriptors and register values of the chunks reloaded by the DMA for one unit.
+* @details        For every chunk after the first one, aTcd holds in this order the SC1n copy, the
+*                 PDB block copy, the PDB trigger and the result transfer of the chunk. One spare
+*                 TCD leaves room to start the list on the 32 bytes boundary scatter/gather needs.
+*/
+typedef struct
+{
+    VAR(Mcl_DmaTcdType, AUTOMATIC) aTcd[ADC_ADC12BSARV2_DMA_CHAIN_TCDS + 1U];                   /**< @brief TCD list, unaligned */
+    VAR(uint32, AUTOMATIC) au32PdbBlock[ADC_REGISTER_IMAGE_MAX_CHUNKS - 1U][ADC_PDB_RELOAD_BLOCK_WORDS]; /**< @brief PDB words from MOD */
+    VAR(uint32, AUTOMATIC) au32PdbSc[2];                                                    /**< @brief SC with LDOK, then with SWTRIG */
+} Adc_Adc12bsarv2_DmaChainType;
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) */
 
 /*==================================================================================================
 *                                       LOCAL MACROS
 ==================================================================================================*/
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
+/**
+* @brief          SC2 bits selecting the compare function.
+*/
+#define ADC_ADC12BSARV2_SC2_COMPARE_MASK_U32    (ADC12BSARV2_SC2_ACFE_EN_U32 | ADC12BSARV2_SC2_ACFGT_GREATER_U32 | \
+                                                 ADC12BSARV2_SC2_ACREN_EN_U32)
+
+/**
+* @brief          Result register values above this one cannot be compared, CVn is 16 bits wide.
+*/
+#define ADC_ADC12BSARV2_CV_MAX_U32              (0x0000FFFFUL)
+#endif /* (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) */
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+/**
+* @brief          Scatter/gather TCDs must be aligned on 32 bytes.
+*/
+#define ADC_ADC12BSARV2_DMA_TCD_ALIGN_U32       ((uint32)0x1FUL)
+
+/**
+* @brief          DLAST_SGA value loading the TCD pointed by pTcd. The address is reduced to the 32
+*                 bits of the eDMA bus here only, all the computations on it are done on pointers.
+*/
+#define ADC_ADC12BSARV2_DMA_SGA(pTcd)           ((sint32)(uint32)(pTcd))
+
+#ifndef DMA_TCD_START_U8
+/**
+* @brief          TCD CSR[START], the channel runs as soon as the TCD is loaded.
+*/
+#define DMA_TCD_START_U8                        ((uint8)0x01U)
+#endif
+
+#ifndef DMA_TCD_ESG_U8
+/**
+* @brief          TCD CSR[ESG], the TCD at DLAST_SGA is loaded at the end of the major loop.
+*/
+#define DMA_TCD_ESG_U8                          ((uint8)0x10U)
+#endif
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) */
+
+#if (ADC_DUAL_CLOCK_MODE == STD_ON) && (ADC_SET_ADC_CONV_TIME_ONCE == STD_OFF)
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+/**
+* @brief          Clock configuration applied with the group conversion timings of a unit.
+*/
+#define ADC_ADC12BSARV2_CLOCK_MODE(Unit)        (Adc_aUnitStatus[(Unit)].eClockMode)
+#else
+#define ADC_ADC12BSARV2_CLOCK_MODE(Unit)        (Adc_eClockMode)
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) && (ADC_SET_ADC_CONV_TIME_ONCE == STD_OFF) */
 
 /*==================================================================================================
 *                                      LOCAL CONSTANTS
@@ -304,6 +396,57 @@ extern "C"{
 /*==================================================================================================
 *                                      LOCAL VARIABLES
 ==================================================================================================*/
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+#define ADC_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Adc12bsarv2_c_REF_2 Repeated include file MemMap.h
+ * @violates @ref Adc_Adc12bsarv2_c_REF_1 Only preprocessor statements and comments before "#include"
+ */
+#include "Adc_MemMap.h"
+
+/**
+* @brief          Register images of the first ADC_REGISTER_IMAGE_MAX_CHUNKS chunks of each group.
+*/
+/** @violates @ref Adc_Adc12bsarv2_c_REF_15 MISRA 2004 Required Rule 8.7, objects shall be defined at block scope */
+static VAR(Adc_RegisterImageType, ADC_VAR) Adc_Adc12bsarv2_aRegisterImage[ADC_MAX_GROUPS][ADC_REGISTER_IMAGE_MAX_CHUNKS];
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+/**
+* @brief          DMA reload descriptors of the group being converted on each unit.
+*/
+/** @violates @ref Adc_Adc12bsarv2_c_REF_15 MISRA 2004 Required Rule 8.7, objects shall be defined at block scope */
+static VAR(Adc_Adc12bsarv2_DmaChainType, ADC_VAR) Adc_Adc12bsarv2_aDmaChain[ADC_MAX_HW_UNITS];
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) */
+
+#define ADC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Adc12bsarv2_c_REF_1 Only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Adc12bsarv2_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+#define ADC_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Adc12bsarv2_c_REF_2 Repeated include file MemMap.h
+ * @violates @ref Adc_Adc12bsarv2_c_REF_1 Only preprocessor statements and comments before "#include"
+ */
+#include "Adc_MemMap.h"
+
+/**
+* @brief          Context of the calibration started by Adc_CalibrateAsync on each unit.
+*/
+/** @violates @ref Adc_Adc12bsarv2_c_REF_15 MISRA 2004 Required Rule 8.7, objects shall be defined at block scope */
+static VAR(Adc_CalibrationContextType, ADC_VAR) Adc_Adc12bsarv2_aCalibration[ADC_MAX_HW_UNITS];
+
+#define ADC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Adc12bsarv2_c_REF_1 Only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Adc12bsarv2_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
 
 /*==================================================================================================
 *                                      GLOBAL CONSTANTS
@@ -436,6 +579,67 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_StopConversionCheckT
 );
 #endif
 
+#if (ADC_ASYNC_ABORT == STD_ON)
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_IsAborted
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+#endif /* (ADC_ASYNC_ABORT == STD_ON) */
+
+#if (ADC_POWER_STATE_SUPPORTED == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ApplyPowerState
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_PowerStateType, AUTOMATIC) ePowerState
+);
+#endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
+
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_WakeUnit
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+
+#if (ADC_DUAL_CLOCK_MODE == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ApplyClockMode
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_DualClockModeType, AUTOMATIC) eClockMode
+);
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+LOCAL_INLINE FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_ReadTime
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex
+);
+
+LOCAL_INLINE FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_ClockGroupDue
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ClockForgetRequest
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_SelectClockMode
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyRecord
+(
+    P2VAR(Adc_LatencyHistogramType, AUTOMATIC, ADC_APPL_DATA) pHistogram,
+    VAR(uint32, AUTOMATIC) u32Latency
+);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+
 #ifdef ADC_DMA_SUPPORTED
 LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartDmaOperation
 (
@@ -446,6 +650,71 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartDmaOperation
 );
 #endif /* ADC_DMA_SUPPORTED */
 
+#if (ADC_READ_GROUP_API == STD_ON)
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_CopyLastSample
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pDataPtr,
+    VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount,
+    VAR(uint32, AUTOMATIC) u32DataStride,
+    P2CONST(Adc_ChannelIndexType, AUTOMATIC, ADC_APPL_DATA) pPosition
+);
+#endif /* (ADC_READ_GROUP_API == STD_ON) */
+
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
+LOCAL_INLINE FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_CompareThreshold
+(
+    VAR(uint32, AUTOMATIC) u32Value,
+    VAR(uint32, AUTOMATIC) u32Shift
+);
+
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_GetHwCompare
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pCompare
+);
+
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigureHwCompare
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr
+);
+#endif /* (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) */
+
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+LOCAL_INLINE FUNC(P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA), ADC_CODE) Adc_Adc12bsarv2_GetRegisterImage
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_ChannelIndexType, AUTOMATIC) CurrentChannel,
+    VAR(uint8, AUTOMATIC) u8NumChannel
+);
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON) && (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF)
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_ConfigureDmaChain
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) && (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF) */
+
+#if (ADC_CALIBRATION == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_PrepareCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_RestoreCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint32, AUTOMATIC) u32Sc3Status,
+    VAR(uint32, AUTOMATIC) u32Cfg1Status
+);
+#endif /* (ADC_CALIBRATION == STD_ON) */
+
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
 ==================================================================================================*/
@@ -491,6 +760,10 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_InitUnitHardware
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
     REG_WRITE32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), pConfigPtr[HwIndex].u32AdcCfg1Register);
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    /* Time in ADC_NORMAL counted from here */
+    Adc_aUnitStatus[Unit].u32ClockModeStart = Adc_Adc12bsarv2_ReadTime(HwIndex);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
 
 #if (STD_ON == ADC_SET_ADC_CONV_TIME_ONCE)
     /* Sample time duration configuration */
@@ -609,6 +882,9 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DeInitHardware
 /**
 * @brief          This function stops the current conversion.
 * @details        This function stops the current conversion and checks if the hardware has responded to the command.
+*                 With ADC_ASYNC_ABORT the response is checked once; a unit still converting is left
+*                 with bAbortPending set instead of being waited for, and u32Timeout is replaced by
+*                 ADC_ABORT_TIMEOUT_PERIODS.
 *
 * @param[in]      Unit           The hardware Unit.
 * @param[in]      Group          The group id.
@@ -650,6 +926,7 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_StopConversionCheckT
         /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
         /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
         REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32);
+#if (ADC_ASYNC_ABORT == STD_OFF)
         /* Wait until conversion is aborted */
         /* Because some channels in chain are not converted yet */
         /* ADC235, ADC068 */
@@ -674,9 +951,49 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_StopConversionCheckT
             /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
             return (Std_ReturnType) E_NOT_OK;
         }
+#endif /* (ADC_ASYNC_ABORT == STD_OFF) */
     }
+#if (ADC_ASYNC_ABORT == STD_ON)
+    /* A unit still converting is not waited for here: Adc_Adc12bsarv2_CompleteAbort starts the next group */
+    if ((boolean)FALSE == Adc_Adc12bsarv2_IsAborted(Unit))
+    {
+        Adc_aUnitStatus[Unit].u32AbortTimeout = ADC_ABORT_TIMEOUT_PERIODS;
+        Adc_aUnitStatus[Unit].bAbortPending = (boolean)TRUE;
+    }
+    (void)u32Timeout;
+#endif /* (ADC_ASYNC_ABORT == STD_ON) */
     return (Std_ReturnType) E_OK;
 }
+
+#if (ADC_ASYNC_ABORT == STD_ON)
+/**
+* @brief          Checks that the unit has taken the disable written to its SC1n registers.
+*
+* @param[in]      Unit           The hardware Unit.
+*
+* @return         boolean        TRUE if every used SC1n reads back with conversions disabled.
+*/
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_IsAborted
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(uint8, AUTOMATIC) u8SCRegister;
+    VAR(boolean, AUTOMATIC) bAborted = (boolean)TRUE;
+
+    for(u8SCRegister = 0U; u8SCRegister < Adc_aUnitStatus[Unit].u8Sc1Used; u8SCRegister++)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned int to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        if ((REG_READ32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister)) & ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32) != ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32)
+        {
+            bAborted = (boolean)FALSE;
+            break;
+        }
+    }
+    return bAborted;
+}
+#endif /* (ADC_ASYNC_ABORT == STD_ON) */
 #endif /* ((ADC_ENABLE_START_STOP_GROUP_API == STD_ON) || (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE)) */
 
 #ifdef ADC_DMA_SUPPORTED
@@ -732,7 +1049,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartDmaOperation
         Mcl_DmaDisableNotification(DmaChannel);
 #endif
         /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        pResult = pGroupPtr->pResultsBufferPtr[Group] + Adc_aGroupStatus[Group].ResultIndex;
+        pResult = pGroupPtr->pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, Adc_aGroupStatus[Group].ResultIndex);
 #if (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING)
         if ((boolean) TRUE == pGroupPtr->bAdcDoubleBuffering)
         {
@@ -746,12 +1063,12 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartDmaOperation
                 /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
                 u32DestAddr = (uint32)(pResult);
                 u32Iter = u8NumChannel;
-                u16DestNextOffset = (uint16)((pGroupPtr->NumSamples) << (uint16)1); /* use a << 1 instead of a*2*/
+                u16DestNextOffset = (uint16)(ADC_RESULT_CHANNEL_STRIDE(Group) << 1U); /* use a << 1 instead of a*2*/
                 u8DmaTcdFlags = 0U;
                 /** @violates @ref Adc_Adc12bsarv2_c_REF_6 cast from unsigned int to signed int */
                 s32DmaTcdSlast = -(sint32)((uint32)u8NumChannel << 2U); /* use a<<2 instead of a*4*/
                 /** @violates @ref Adc_Adc12bsarv2_c_REF_6 cast from unsigned int to signed int */
-                s32DmaTcdDlast = -(sint32)((((uint32)pGroupPtr->NumSamples*(uint32)u8NumChannel)-1U)<<1); /* use a << 1 instead of a*2*/
+                s32DmaTcdDlast = -(sint32)((((uint32)u8NumChannel*ADC_RESULT_CHANNEL_STRIDE(Group))-ADC_RESULT_SAMPLE_OFFSET(Group, 1U))<<1); /* use a << 1 instead of a*2*/
                 /* Caculate TCD config for DMA channel linking */
                 /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned int to pointer */
                 /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
@@ -829,7 +1146,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartDmaOperation
                 /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
                 u32DestAddr = (uint32)(pResult);
                 u32Iter = (uint32) u8NumChannel;
-                u16DestNextOffset = (uint16)((pGroupPtr->NumSamples) << (uint16)1);
+                u16DestNextOffset = (uint16)(ADC_RESULT_CHANNEL_STRIDE(Group) << 1U);
             }
             u8DmaTcdFlags = DMA_TCD_DISABLE_REQ_U8 | DMA_TCD_INT_MAJOR_U8;
         }
@@ -879,883 +1196,2694 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartDmaOperation
 }
 #endif /* ADC_DMA_SUPPORTED */
 
-/*==================================================================================================
-                                       GLOBAL FUNCTIONS
-==================================================================================================*/
+#if (ADC_READ_GROUP_API == STD_ON)
+#if (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON)
 /**
-* @brief          This function initializes the ADC hardware module, and the ADC driver.
-* @details        This function initializes the ADC hardware module, and the ADC driver.
+* @brief          Copies a contiguous block of results.
+* @details        Used for the samples of sample-major groups: both sides are walked with a unit
+*                 stride, without the stride and position lookups of the channel-major copy. The
+*                 results are accessed as Adc_ValueGroupType only, the result buffer keeping its
+*                 volatile qualification.
 *
-* @param[in]      pCfgPtr      Configuration data pointer.
+* @param[out]     pDataPtr        Destination of the results.
+* @param[in]      pResultPtr      First result of the sample in the group result buffer.
+* @param[in]      ChannelCount    Number of results to copy.
 *
 * @return         void
 *
 */
-FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Init
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_CopyBlock
 (
-    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfgPtr
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pDataPtr,
+    P2CONST(volatile Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pResultPtr,
+    VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount
 )
 {
-    /* Hardware Unit index */
-    VAR(Adc_HwUnitType, AUTOMATIC) Unit = (Adc_HwUnitType)0;
-
-    /* ADC hardware unit config pointer */
-    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pConfigPtr = pCfgPtr->pAdc;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) Index;
 
-    /* Initialize Unit Status structures */
-    /* Initialize for each ADC hardware unit (eg: ADC0, ADC1...) */
-    for(Unit = (Adc_HwUnitType)0; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    for (Index = 0U; Index < ChannelCount; Index++)
     {
-        /* Check if unit is available */
-        if((uint8)STD_ON == ADC_HW_UNITS(Unit))
-        {
-            Adc_Adc12bsarv2_InitUnitHardware(Unit, pConfigPtr);
-        }
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        pDataPtr[Index] = pResultPtr[Index];
     }
 }
+#endif /* (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON) */
 
-#if (ADC_DEINIT_API == STD_ON)
 /**
-* @brief          This function deinitializes the ADC driver, and the ADC hardware.
-* @details        This function deinitializes the ADC driver, and ensures that the ADC hardware
-*                 will be in the power on after reset state.
+* @brief          Copies the last completed sample of a group from its result buffer.
+* @details        The result buffer is read through a volatile pointer so that the copy stays
+*                 between the two reads of u32PublishSequence done by Adc_Adc12bsarv2_ReadGroup.
 *
-* @return         void
+* @param[in]      Group           The group number.
+* @param[in]      pDataPtr        Pointer to a buffer which will be filled by the
+*                                 conversion results.
+* @param[in]      ChannelCount    Number of channels of the group.
+* @param[in]      u32DataStride   Distance in pDataPtr between two consecutive channels.
+* @param[in]      pPosition       Index in pDataPtr of each channel, NULL_PTR to use u32DataStride.
+*
+* @return         Std_ReturnType  E_OK or E_NOT_OK.
+* @retval         E_OK            The sample was copied.
+* @retval         E_NOT_OK        The group has not completed a sample yet.
 *
 */
-FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DeInit(void)
+LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_CopyLastSample
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pDataPtr,
+    VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount,
+    VAR(uint32, AUTOMATIC) u32DataStride,
+    P2CONST(Adc_ChannelIndexType, AUTOMATIC, ADC_APPL_DATA) pPosition
+)
 {
-#if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
-    VAR(Adc_GroupType,AUTOMATIC) GroupIdx = 0U;
-#endif /* (ADC_GRP_NOTIF_CAPABILITY == STD_ON) */
-    VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U; /* Hardware Unit index */
+    P2CONST(volatile Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pResultPtr = NULL_PTR;
+    VAR(uint32, AUTOMATIC) u32DestOffset = 0UL;
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) ResultIndex = (Adc_StreamNumSampleType)0;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) Index;
+    /* Pointer to AdcGroup */
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = NULL_PTR;
 
-    /* De-initialize each ADC hardware unit */
-    for(;Unit<(Adc_HwUnitType)ADC_MAX_HW_UNITS;Unit++)
+    if (ADC_BUSY == Adc_aGroupStatus[Group].eConversion)
     {
-        if((uint8)STD_ON == ADC_HW_UNITS(Unit))
-        {
-            Adc_Adc12bsarv2_DeInitHardware(Unit);
-        }
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
+        return (Std_ReturnType)E_NOT_OK;
     }
 
-    /* De-initialize PDB hardware trigger unit */
-    Adc_Pdb_DeInit();
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
 
-    /* Disable notification of all available groups */
-#if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
-    for(GroupIdx=(Adc_GroupType)0U;GroupIdx<(Adc_GroupType)ADC_MAX_GROUPS;GroupIdx++)
+    /* Get index of last completed sample */
+    ResultIndex = Adc_aGroupStatus[Group].ResultIndex - (Adc_StreamNumSampleType)1;
+    if ((Adc_StreamNumSampleType)0 == Adc_aGroupStatus[Group].ResultIndex)
     {
-        Adc_aGroupStatus[GroupIdx].eNotification = ADC_NOTIFICATION_DISABLED;
+        ResultIndex = pGroupPtr->NumSamples - (Adc_StreamNumSampleType)1;
     }
-#endif /* (ADC_GRP_NOTIF_CAPABILITY == STD_ON) */
 
-}
-#endif /* #if (ADC_DEINIT_API == STD_ON) */
+    /**
+    * @violates @ref Adc_Adc12bsarv2_c_REF_5 Cast from pointer to pointer.
+    * @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic
+    */
+    pResultPtr = (volatile Adc_ValueGroupType *)(pGroupPtr->pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, ResultIndex));
+    u32DestOffset = ADC_RESULT_CHANNEL_STRIDE(Group);
 
-#if ((ADC_ENABLE_START_STOP_GROUP_API == STD_ON) || (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE))
-/**
-* @brief          This function stops the current conversion of a group.
-* @details        This function stops the current conversion of a group.
-*
-* @param[in]      Unit      The hardware Unit.
-* @param[in]      Group     The group id.
-*
-* @return         Std_ReturnType  E_OK or E_NOT_OK.
-* @retval         E_OK            If the conversion has stopped as expected.
-* @retval         E_NOT_OK        In case of timeout while waiting for adc hardware to stop a conversion.
-*
-*/
-/** @violates @ref Adc_Adc12bsarv2_c_REF_10 internal linkage or external linkage*/
-FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_StopCurrentConversion
-(
-    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
-    VAR(Adc_GroupType, AUTOMATIC) Group
-)
-{
-    VAR(volatile uint32, AUTOMATIC) u32Timeout = ADC_TIMEOUT_COUNTER;
-    /* Variable for checking timeout status */
-    VAR(Std_ReturnType, AUTOMATIC) Test = (Std_ReturnType)E_OK;
-
-    /* Counter for SC registers */
-    VAR(uint8, AUTOMATIC) u8SCRegister;
-
-    /* Disable Adc hardware unit and clear all of COCO flag by reading Rn register */
-    for(u8SCRegister = 0U; u8SCRegister < Adc_aUnitStatus[Unit].u8Sc1Used; u8SCRegister++)
-    {
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32);
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        (void)REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)u8SCRegister));
-    }
-
-    /* Disable DMA requests and notifications */
-#ifdef ADC_DMA_SUPPORTED
-    if((uint8)ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Unit])
+#if (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON)
+    /* The channels of a sample-major sample are contiguous on both sides */
+    if ((1UL == u32DestOffset) && (1UL == u32DataStride) && (NULL_PTR == pPosition))
     {
-        Mcl_DmaDisableHwRequest((Mcl_ChannelType)Adc_pCfgPtr->Misc.au8Adc_DmaChannel[Unit]);
-    #if (MCL_DMA_NOTIFICATION_SUPPORTED == STD_ON)
-        Mcl_DmaDisableNotification((Mcl_ChannelType)Adc_pCfgPtr->Misc.au8Adc_DmaChannel[Unit]);
-    #endif
+        Adc_Adc12bsarv2_CopyBlock(pDataPtr, pResultPtr, ChannelCount);
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
+        return (Std_ReturnType)E_OK;
     }
-#endif /* ADC_DMA_SUPPORTED */
-    MCAL_FAULT_INJECTION_POINT(ADC_FIP_0_UPDATE_VARIABLE_TIMEOUT);
-    /* Reset current channel status to 0 */
-    Adc_aGroupStatus[Group].CurrentChannel = 0U;
+#endif /* (ADC_ENABLE_SAMPLE_MAJOR_RESULTS == STD_ON) */
 
-    /* Stop the conversion and abort the current group conversion */
-#if (ADC_BYPASS_CONSISTENCY_LOOP == STD_ON)
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-    if((uint8)STD_OFF == Adc_pCfgPtr->pGroups[Group].u8AdcWithoutInterrupt)
-    {
-        Test = Adc_Adc12bsarv2_StopConversionCheckTimeout(Unit, Group, u32Timeout);
-    }
-    else
+    /* Copy results of last conversion from streaming buffer to internal buffer */
+    for(Index = 0U; Index < ChannelCount; Index++)
     {
-        /* If group is continuous and configured without interrupts, clear the CONTINUOUS bit */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        if (ADC_CONV_MODE_CONTINUOUS == Adc_pCfgPtr->pGroups[Group].eMode)
+        if (NULL_PTR == pPosition)
         {
-#ifdef ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED
-            Adc_Pdb_StopConversion(Unit);
-#endif /* ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            pDataPtr[(uint32)Index * u32DataStride] = (*pResultPtr);
+        }
+        else
+        {
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            pDataPtr[pPosition[Index]] = (*pResultPtr);
         }
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        pResultPtr += u32DestOffset;
     }
-#else /* (ADC_BYPASS_CONSISTENCY_LOOP == STD_ON) */
-    Test = Adc_Adc12bsarv2_StopConversionCheckTimeout(Unit, Group, u32Timeout);
-#endif /* (ADC_BYPASS_CONSISTENCY_LOOP == STD_OFF) */
 
-    return Test;
+    return (Std_ReturnType)E_OK;
 }
-#endif
+#endif /* (ADC_READ_GROUP_API == STD_ON) */
 
-#if (ADC_HW_TRIGGER_API == STD_ON)
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
 /**
-* @brief          This function performs starting a hardware trigger conversion.
-* @details        This function performs starting a hardware trigger conversion.
+* @brief          Returns the lowest result register value whose checked value is at least u32Value.
+* @details        Adc_CheckConversionValuesInRange shifts left aligned results down before comparing
+*                 them with the limits, the threshold is scaled back up to the register value.
 *
-* @param[in]      Unit        The hardware Unit.
-* @param[in]      Group       The group of which conversion will be started.
+* @param[in]      u32Value        Limit in the domain of the configured limits, up to 0x10000.
+* @param[in]      u32Shift        Alignment shift of the hardware unit.
+*
+* @return         uint32          Threshold, above ADC_ADC12BSARV2_CV_MAX_U32 if no result reaches it.
 *
-* @return         void
-* @violates @ref Adc_Adc12bsarv2_c_REF_10 internal linkage or external linkage
 */
-FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartHwTrigConversion
+LOCAL_INLINE FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_CompareThreshold
 (
-    CONST(Adc_HwUnitType, AUTOMATIC) Unit,
-    CONST(Adc_GroupType, AUTOMATIC) Group
+    VAR(uint32, AUTOMATIC) u32Value,
+    VAR(uint32, AUTOMATIC) u32Shift
 )
 {
-    VAR(uint8, AUTOMATIC) u8NumChannel;
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
-
-    /* Calculate the number of channels for current configuration */
-#if (ADC_SETCHANNEL_API == STD_ON)
-    u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(Adc_aRuntimeGroupChannel[Group].ChannelCount);
+#if (ADC_RESULT_ALIGNMENT == ADC_ALIGN_LEFT)
+    return (u32Value << u32Shift);
 #else
-    u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(pGroupPtr->AssignedChannelCount);
-#endif
-
-    /* If it is the first group, u8Sc1Used is assigned as the number channels of group */
-    if(0U == Adc_aUnitStatus[Unit].u8Sc1Used)
-    {
-        Adc_aUnitStatus[Unit].u8Sc1Used = u8NumChannel;
-    }
-    Adc_aGroupStatus[Group].CurrentChannel = 0U;
-
-#ifdef ADC_DMA_SUPPORTED
-    if (ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Unit])
-    {
-        if((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt)
-        {
-            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_04();
-            /* Enable DMA interrupt incase of Group configured with interrupt */
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned int to pointer */
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-            REG_BIT_SET32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_DMA_EN_U32);
-            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_04();
-
-            /* Setting for DMA transfer */
-            Adc_Adc12bsarv2_StartDmaOperation(Unit, Group, pGroupPtr, u8NumChannel);
-        }
-
-        /* Ensure that PDB does not run when ADC configured */
-        Adc_Pdb_StopConversion(Unit);
-
-        /* Setting for ADC in case of DMA transfer was selected, in the first time DMA should not be re-configured */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        Adc_Adc12bsarv2_ConfigureDmaPartialConversion(Unit, Group, pGroupPtr, (Adc_HwTriggerTimerType)pGroupPtr->pHwResource[0], u8NumChannel, (boolean)FALSE);
-    }
-    else
-#endif /* ADC_DMA_SUPPORTED */
-    {
-        /* Setting for ADC hardware in case of DMA transfer was not selected */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        Adc_Adc12bsarv2_ConfigurePartialConversion(Unit, Group, pGroupPtr, pGroupPtr->pHwResource[0], u8NumChannel);
-    }
+    (void)u32Shift;
+    return u32Value;
+#endif /* (ADC_RESULT_ALIGNMENT == ADC_ALIGN_LEFT) */
 }
-#endif
 
-#if (ADC_READ_GROUP_API == STD_ON)
 /**
-* @brief          This function reads the converted data for the requested group.
-* @details        Reads the converted data for the requested group.
+* @brief          Translates the configured range of a group to compare function settings.
+* @details        Only hardware triggered groups with one channel, limit checking and the end of
+*                 conversion interrupt qualify. Ranges which are always or never satisfied are left to
+*                 the software check: the compare function would either not filter anything or stop
+*                 every interrupt, including the ones the driver relies on to report the failure.
 *
+* @param[in]      Unit            The hardware unit.
 * @param[in]      Group           The group number.
-* @param[in]      pDataPtr        Pointer to a buffer which will be filled by the
-*                                 conversion results.
-* @return         Std_ReturnType  E_OK or E_NOT_OK.
-* @retval         E_OK            In case of successfull read of the converted data.
-* @retval         E_NOT_OK        In case of an ongoing conversion.
+* @param[in]      pGroupPtr       The group configuration.
+* @param[out]     pCompare        SC2 compare bits, CV1 and CV2, in this order.
+*
+* @return         boolean         TRUE if the compare function can do the limit checking.
 *
 */
-FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_ReadGroup
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_GetHwCompare
 (
-    CONST(Adc_GroupType, AUTOMATIC) Group,
-    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pDataPtr,
-    P2VAR(boolean, AUTOMATIC, ADC_APPL_DATA) pFlag
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pCompare
 )
 {
-    VAR(Std_ReturnType, AUTOMATIC) ReadGroupRet = (Std_ReturnType)E_OK;
+    VAR(boolean, AUTOMATIC) bHwCompare = (boolean)FALSE;
     VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount;
-    VAR(Adc_ChannelIndexType, AUTOMATIC) Index;
-    /* Pointer to AdcGroup */
-    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = NULL_PTR;
-
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex;
+    VAR(Adc_ChannelType, AUTOMATIC) ChIndex;
+    VAR(uint32, AUTOMATIC) u32Shift;
+    VAR(uint32, AUTOMATIC) u32Low;
+    VAR(uint32, AUTOMATIC) u32High;
+    VAR(Adc_ChannelRangeSelectType, AUTOMATIC) eChRange;
 
 #if (ADC_SETCHANNEL_API == STD_ON)
     ChannelCount = Adc_aRuntimeGroupChannel[Group].ChannelCount;
 #else
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
     ChannelCount = pGroupPtr->AssignedChannelCount;
-#endif
+    (void)Group;
+#endif /* (ADC_SETCHANNEL_API == STD_ON) */
 
-    /* If the group is configured for without interrupts*/
-    if((uint8)STD_ON == pGroupPtr->u8AdcWithoutInterrupt)
+    if (((boolean)TRUE == pGroupPtr->bAdcGroupLimitcheck) && ((Adc_ChannelIndexType)1U == ChannelCount) && \
+        ((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt))
     {
-        VAR(uint32, AUTOMATIC) u32HsValue;
-        VAR(uint16, AUTOMATIC) u16R0Value;
-        VAR(Adc_HwUnitType, AUTOMATIC) Unit;
-        VAR(Adc_HwUnitType, AUTOMATIC) HwIndex;
-        VAR(uint32, AUTOMATIC) u32AdcDataMask;
-#if (STD_ON == ADC_HW_TRIGGER_API)
-        VAR(Adc_GroupType, AUTOMATIC) GroupHWNormalQueue;
-#endif
-#if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
-        VAR(Adc_ChannelType, AUTOMATIC) ChIndex;
-        /* Flag to set if ADC results are in the selected range */
-        VAR(boolean, AUTOMATIC) bWriteFlag = (boolean)TRUE;
-#endif /* (ADC_ENABLE_LIMIT_CHECK == STD_ON) */
-
+        HwIndex = Adc_pCfgPtr->Misc.aHwLogicalId[Unit];
         /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        Unit = Adc_pCfgPtr->pGroups[Group].HwUnit;
-    #if (STD_ON == ADC_HW_TRIGGER_API)
-        GroupHWNormalQueue = Adc_aUnitStatus[Unit].HwNormalQueue[0];
-        if ((Group == Adc_aUnitStatus[Unit].SwNormalQueue[0]) || (Group == GroupHWNormalQueue))
-    #else
-        if (Group == Adc_aUnitStatus[Unit].SwNormalQueue[0])
-    #endif
+        ChIndex = pGroupPtr->pAssignment[0];
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        eChRange = Adc_aChannelsLimitCheckingCfg[HwIndex][ChIndex].eChannelRange;
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        u32Low = (uint32)Adc_aChannelsLimitCheckingCfg[HwIndex][ChIndex].ChannelLowLimit;
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        u32High = (uint32)Adc_aChannelsLimitCheckingCfg[HwIndex][ChIndex].ChannelHighLimit;
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        u32Shift = 16UL - (uint32)Adc_pCfgPtr->pAdc[HwIndex].Res;
+
+        /* Every range is expressed with the thresholds of "Value > Low" and "Value > High" */
+        u32Low = Adc_Adc12bsarv2_CompareThreshold(u32Low + 1UL, u32Shift);
+        u32High = Adc_Adc12bsarv2_CompareThreshold(u32High + 1UL, u32Shift);
+        pCompare[2] = 0UL;
+        switch (eChRange)
         {
-            /*Checking conversion is completed for all channels*/
-            for(Index = 0U; Index < ChannelCount; Index++)
+            /* Low < Value <= High: CV1 <= R <= CV2 */
+            case ADC_RANGE_BETWEEN:
+            /* Value <= Low or Value > High: R < CV1 or R > CV2 */
+            case ADC_RANGE_NOT_BETWEEN:
             {
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-                u32HsValue = REG_READ32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)Index));
-                if(0UL == (u32HsValue & ADC12BSARV2_SC1_N_CONV_COMPLETE_U32))
+                if ((u32Low < u32High) && (u32Low <= ADC_ADC12BSARV2_CV_MAX_U32))
                 {
-                    /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
-                    return (Std_ReturnType)E_NOT_OK;
+                    pCompare[0] = ADC12BSARV2_SC2_ACFE_EN_U32 | ADC12BSARV2_SC2_ACREN_EN_U32;
+                    if (ADC_RANGE_BETWEEN == eChRange)
+                    {
+                        pCompare[0] |= ADC12BSARV2_SC2_ACFGT_GREATER_U32;
+                    }
+                    pCompare[1] = u32Low;
+                    pCompare[2] = ((u32High <= ADC_ADC12BSARV2_CV_MAX_U32) ? u32High : (ADC_ADC12BSARV2_CV_MAX_U32 + 1UL)) - 1UL;
+                    bHwCompare = (boolean)TRUE;
                 }
+                break;
             }
-        }
-        else
-        {
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
-            return (Std_ReturnType)E_NOT_OK;
-        }
-        /* Get the logical id from hardware Unit*/
-        HwIndex = Adc_pCfgPtr->Misc.aHwLogicalId[Unit];
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        u32AdcDataMask = Adc_pCfgPtr->pAdc[HwIndex].u32AdcDataMask;
-#if (ADC_ENABLE_LIMIT_CHECK == STD_OFF)
-        (*pFlag) = (boolean)TRUE;
-#endif /* (ADC_ENABLE_LIMIT_CHECK == STD_OFF) */
-
-        for(Index = 0U; Index < ChannelCount; Index++)
-        {
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-            u16R0Value = (uint16)(REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)Index)));
-
-#if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
-            /* there is only one channel in the group - the first channel */
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-            ChIndex = pGroupPtr->pAssignment[0];
-            if ((boolean)TRUE == pGroupPtr->bAdcGroupLimitcheck)
+            /* Value <= High: R < CV1 */
+            case ADC_RANGE_NOT_OVER_HIGH:
+            /* Value <= Low: R < CV1 */
+            case ADC_RANGE_UNDER_LOW:
             {
-                /* ADC446, ADC447 */
-                (*pFlag) = (boolean)Adc_CheckConversionValuesInRange(u16R0Value, Unit, ChIndex);
-                if ((boolean)FALSE == (*pFlag))
+                pCompare[1] = (ADC_RANGE_UNDER_LOW == eChRange) ? u32Low : u32High;
+                if (pCompare[1] <= ADC_ADC12BSARV2_CV_MAX_U32)
                 {
-                    /* ADC448, ADC449, ADC450 */
-                    ReadGroupRet = (Std_ReturnType)E_NOT_OK;
-                    bWriteFlag = (boolean)FALSE;
+                    pCompare[0] = ADC12BSARV2_SC2_ACFE_EN_U32;
+                    bHwCompare = (boolean)TRUE;
                 }
+                break;
             }
-            if((boolean)TRUE == bWriteFlag)
-#endif /* ADC_ENABLE_LIMIT_CHECK == STD_ON */
+            /* Value > Low: R >= CV1 */
+            case ADC_RANGE_NOT_UNDER_LOW:
+            /* Value > High: R >= CV1 */
+            case ADC_RANGE_OVER_HIGH:
             {
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-                pDataPtr[Index] = (uint16)(u16R0Value & u32AdcDataMask);
+                pCompare[1] = (ADC_RANGE_NOT_UNDER_LOW == eChRange) ? u32Low : u32High;
+                if (pCompare[1] <= ADC_ADC12BSARV2_CV_MAX_U32)
+                {
+                    pCompare[0] = ADC12BSARV2_SC2_ACFE_EN_U32 | ADC12BSARV2_SC2_ACFGT_GREATER_U32;
+                    bHwCompare = (boolean)TRUE;
+                }
+                break;
+            }
+            /* ADC_RANGE_ALWAYS and unexpected values stay with the software check */
+            default:
+            {
+                break;
             }
         }
     }
-    /* If the group is configured for with interrupts*/
-    else
-    {
-        P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pResultPtr = NULL_PTR;
-        VAR(uint32, AUTOMATIC) u32DestOffset = 0UL;
-        VAR(Adc_StreamNumSampleType, AUTOMATIC) ResultIndex = (Adc_StreamNumSampleType)0;
-
-        if (ADC_BUSY == Adc_aGroupStatus[Group].eConversion)
-        {
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
-            return (Std_ReturnType)E_NOT_OK;
-        }
-
-        /* Get index of last completed sample */
-        ResultIndex = Adc_aGroupStatus[Group].ResultIndex - (Adc_StreamNumSampleType)1;
-        if ((Adc_StreamNumSampleType)0 == Adc_aGroupStatus[Group].ResultIndex)
-        {
-            ResultIndex = pGroupPtr->NumSamples - (Adc_StreamNumSampleType)1;
-        }
-
-        
-        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_27();
-        /**
-        * @violates @ref Adc_Adc12bsarv2_c_REF_5 Cast from pointer to pointer.
-        * @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic
-        */
-        pResultPtr = (Adc_ValueGroupType *)(pGroupPtr->pResultsBufferPtr[Group]+ResultIndex);
-        u32DestOffset = pGroupPtr->NumSamples;
-
-        /* Copy results of last conversion from streaming buffer to internal buffer */
-        for(Index = 0U; Index < ChannelCount; Index++)
-        {
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-            pDataPtr[Index] = (*pResultPtr);
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-            pResultPtr += u32DestOffset;
-        }
-        
-        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_27();
-    }
-
-    return(ReadGroupRet);
+    return bHwCompare;
 }
-#endif /* (ADC_READ_GROUP_API == STD_ON) */
 
-#if (ADC_HW_TRIGGER_API == STD_ON)
 /**
-* @brief          This function enables the hardware triggers for the specified group.
-* @details        This function enables the hardware triggers for the specified group.
+* @brief          Programs or disables the compare function for a hardware triggered group.
+* @details        Must be called before the SC1n registers of the group are written.
 *
-* @param[in]      Group           The group for which the hardware triggers will be enabled.
-* @param[in]      Unit            The hardware Unit. (on other platforms there are more hw units)
+* @param[in]      Unit            The hardware unit.
+* @param[in]      Group           The group number.
+* @param[in]      pGroupPtr       The group configuration.
 *
 * @return         void
 *
 */
-FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EnableHardwareTrigger
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigureHwCompare
 (
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
     VAR(Adc_GroupType, AUTOMATIC) Group,
-    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr
 )
 {
-    VAR(uint8, AUTOMATIC) u8SCRegister;
-#if (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)
-    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
-
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
-#endif
-
-    Adc_aGroupStatus[Group].ResultIndex = 0U;
-
-    /* Clear all of COCO flag by reading Rn registers */
-    for(u8SCRegister = 0U; u8SCRegister < Adc_aUnitStatus[Unit].u8Sc1Used; u8SCRegister++)
-    {
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        (void)REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)u8SCRegister));
-    }
-
-#if (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)
-    /* If conversion time once disabled, either normal or alternate clock mode can be configured at runtime */
-    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_05();
-    #if (ADC_DUAL_CLOCK_MODE == STD_ON)
-    if(ADC_ALTERNATE == Adc_eClockMode)
-    {
-        /* Set clock division for alternate clock mode */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32, (pGroupPtr->u32ClockDivideSelectAlternate & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32));
-
-        /* Setting for alternate conversion timing in CFG2 and SC3 register */
-        /* Set alternate sample time */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), (pGroupPtr->u32SampleTimeAlternate & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32));
+    VAR(uint32, AUTOMATIC) au32Compare[3] = {0UL, 0UL, 0UL};
 
-        /* Enable hardware average and set average samples */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_RMW32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVG_MASK_U32, (pGroupPtr->u32AvgSelectAlternate & ADC12BSARV2_SC3_AVG_MASK_U32));
-    }
-    else
-    #endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+    Adc_aGroupStatus[Group].bHwCompare = Adc_Adc12bsarv2_GetHwCompare(Unit, Group, pGroupPtr, au32Compare);
+    if ((boolean)TRUE == Adc_aGroupStatus[Group].bHwCompare)
     {
-        /* Set clock division for normal clock mode */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32, (pGroupPtr->u32ClockDivideSelect & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32));
-
-        /* Setting for conversion timing in CFG2 and SC3 register */
-        /* Set normal sample time */
         /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
         /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), (pGroupPtr->u32SampleTime & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32));
-
-        /* Enable hardware average and set average samples */
+        REG_WRITE32(ADC12BSARV2_CV_N_REG_ADDR32(Unit, 0UL), au32Compare[1]);
         /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
         /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_RMW32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVG_MASK_U32, (pGroupPtr->u32AvgSelect & ADC12BSARV2_SC3_AVG_MASK_U32));
+        REG_WRITE32(ADC12BSARV2_CV_N_REG_ADDR32(Unit, 1UL), au32Compare[2]);
     }
-    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_05();
-#endif /*end (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)*/
-
-    Adc_Adc12bsarv2_StartHwTrigConversion(Unit, Group);
-
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_34();
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_RMW32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC_ADC12BSARV2_SC2_COMPARE_MASK_U32, au32Compare[0]);
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_34();
 }
+#endif /* (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) */
 
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
 /**
-* @brief          This function disables the hardware triggers for the specified group.
-* @details        This function disables the hardware triggers for the specified group.
+* @brief          Returns the register image of the chunk starting at CurrentChannel.
+* @details        NULL_PTR when the chunk is not imaged or its image was built for another number
+*                 of channels, the caller then computes the register values itself.
 *
-* @param[in]      Group           The group for which the hardware triggers will be enabled.
-* @param[in]      Unit            The hardware Unit. (on other platforms there are more hw units)
+* @param[in]      Group           The group number.
+* @param[in]      CurrentChannel  First channel of the chunk.
+* @param[in]      u8NumChannel    Number of channels of the chunk.
 *
-* @return         void
+* @return         P2CONST(Adc_RegisterImageType) Image to write or NULL_PTR.
 *
 */
-FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DisableHardwareTrigger
+LOCAL_INLINE FUNC(P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA), ADC_CODE) Adc_Adc12bsarv2_GetRegisterImage
 (
     VAR(Adc_GroupType, AUTOMATIC) Group,
-    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+    VAR(Adc_ChannelIndexType, AUTOMATIC) CurrentChannel,
+    VAR(uint8, AUTOMATIC) u8NumChannel
 )
 {
-    VAR(uint8, AUTOMATIC) u8SCRegister;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) Chunk = CurrentChannel / ADC_NUM_SC1_N_REGISTER_USED;
+    P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage = NULL_PTR;
 
-
-    (void)Group;
-#ifdef ADC_DMA_SUPPORTED
-    /* Disable DMA */
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-    if (ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Unit])
+    if ((0U == (CurrentChannel % ADC_NUM_SC1_N_REGISTER_USED)) && (Chunk < ADC_REGISTER_IMAGE_MAX_CHUNKS))
     {
-        if ((uint8)STD_ON == Adc_pCfgPtr->Misc.au8Adc_HwUnit[Unit])
+        if (u8NumChannel == Adc_Adc12bsarv2_aRegisterImage[Group][Chunk].u8NumChannel)
         {
-            /* Disable DMA interrupt */
-            Mcl_DmaDisableHwRequest((Mcl_ChannelType)Adc_pCfgPtr->Misc.au8Adc_DmaChannel[Unit]);
-        #if (MCL_DMA_NOTIFICATION_SUPPORTED == STD_ON)
-            Mcl_DmaDisableNotification((Mcl_ChannelType)Adc_pCfgPtr->Misc.au8Adc_DmaChannel[Unit]);
-        #endif
+            pImage = &Adc_Adc12bsarv2_aRegisterImage[Group][Chunk];
         }
     }
-#endif /* ADC_DMA_SUPPORTED */
-
-    Adc_Pdb_StopConversion(Unit);
-
-    /* Disable Adc hardware unit */
-    for(u8SCRegister = 0U; u8SCRegister < Adc_aUnitStatus[Unit].u8Sc1Used; u8SCRegister++)
-    {
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32);
-    }
-
+    return pImage;
 }
-#endif /* (ADC_HW_TRIGGER_API == STD_ON) */
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
 
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON) && (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF)
 /**
-* @brief          This function starts the conversion on the specified hardware Unit.
-* @details        This function starts the conversion on the specified hardware Unit.
-*                 This function should be called with the ADC Unit on standby (no ADC interruptions
-*                 allowed because its code is not protected by critical regions) - no conversions must
-*                 be running.
+* @brief          Lets the DMA start the chunks of a group after the first one.
+* @details        Replaces the result TCD of the unit DMA channel, loaded for the first chunk, by a
+*                 scatter/gather list. At the end of the results of a chunk the DMA copies the SC1n
+*                 image of the next chunk, its PDB block and the PDB trigger, then waits for the
+*                 results of that chunk. Only the results of the last chunk raise the interrupt.
+*                 Nothing is changed when the group has a single chunk or a chunk without image.
 *
-* @param[in]      Unit            the used hw Unit.
+* @param[in]      Unit            ADC hardware unit.
+* @param[in]      Group           Group about to be started from its first chunk.
 *
-* @return         void
+* @return         boolean         TRUE when the chunks after the first one are reloaded by the DMA.
 *
-* @violates @ref Adc_Adc12bsarv2_c_REF_10 All declarations and definitions of objects or
-* functions at file scope shall have internal linkage unless external linkage is required
+* @pre            Called from Adc_Adc12bsarv2_ConfigureDmaPartialConversion, the PDB not triggered yet.
 */
-FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartNormalConversion
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_ConfigureDmaChain
 (
-    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
 )
 {
-    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
-    VAR(Adc_GroupType, AUTOMATIC) Group = (Adc_GroupType)0; /* Active group in the Queue */
-    VAR(uint8, AUTOMATIC) u8SCRegister;
-    VAR(uint8, AUTOMATIC) u8NumChannel;
-
-    /* If software normal queue is empty (i.e no conversion requests) then return without any action */
-    if ((Adc_QueueIndexType)0 == Adc_aUnitStatus[Unit].SwNormalQueueIndex)
-    {
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
-        return;
-    }
-
-    /* Load the first group in the queue */
-    Group = Adc_aUnitStatus[Unit].SwNormalQueue[0];
+    P2VAR(Adc_Adc12bsarv2_DmaChainType, AUTOMATIC, ADC_APPL_DATA) pChain = &Adc_Adc12bsarv2_aDmaChain[Unit];
+    P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) apImage[ADC_REGISTER_IMAGE_MAX_CHUNKS];
+    VAR(uint8, AUTOMATIC) au8NumChannel[ADC_REGISTER_IMAGE_MAX_CHUNKS];
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd;
+    P2VAR(uint8, AUTOMATIC, ADC_APPL_DATA) pu8List;
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pResult;
+    VAR(Mcl_DmaTcdAttributesType, AUTOMATIC) DmaTcdConfig;
+    VAR(uint32, AUTOMATIC) u32Misalign;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) CurrentChannel = 0U;
+    VAR(uint32, AUTOMATIC) u32ChunkCount = 0UL;
+    VAR(uint32, AUTOMATIC) u32Chunk;
+    VAR(uint32, AUTOMATIC) u32Index;
+    VAR(uint32, AUTOMATIC) u32Tcd;
+    VAR(boolean, AUTOMATIC) bImaged = (boolean)TRUE;
 
-    /* Load the group configuration */
+#if (ADC_SETCHANNEL_API == STD_ON)
+    ChannelCount = Adc_aRuntimeGroupChannel[Group].ChannelCount;
+#else
     /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    ChannelCount = Adc_pCfgPtr->pGroups[Group].AssignedChannelCount;
+#endif /* (ADC_SETCHANNEL_API == STD_ON) */
 
-#if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
-    /* Group configured as one-shot mode and limit checking failed then return without any action */
-    if(((boolean)TRUE == Adc_aGroupStatus[Group].bLimitCheckFailed) && (ADC_CONV_MODE_ONESHOT == pGroupPtr->eMode))
+    while ((CurrentChannel < ChannelCount) && (u32ChunkCount < (uint32)ADC_REGISTER_IMAGE_MAX_CHUNKS))
     {
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
-        return;
+        au8NumChannel[u32ChunkCount] = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(ChannelCount - CurrentChannel);
+        apImage[u32ChunkCount] = Adc_Adc12bsarv2_GetRegisterImage(Group, CurrentChannel, au8NumChannel[u32ChunkCount]);
+        if (NULL_PTR == apImage[u32ChunkCount])
+        {
+            bImaged = (boolean)FALSE;
+        }
+        CurrentChannel += au8NumChannel[u32ChunkCount];
+        u32ChunkCount++;
     }
-#endif /* ADC_ENABLE_LIMIT_CHECK == STD_ON */
 
-#if (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)
-    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_06();
-    /* Check the clock mode (and config if needed) every start conversion if conversion time once is disabled */
-    #if (ADC_DUAL_CLOCK_MODE == STD_ON)
-    if(ADC_ALTERNATE == Adc_eClockMode)
+    if ((CurrentChannel < ChannelCount) || (u32ChunkCount < 2UL))
     {
-        /* Clock divide select for alternate mode */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32, (pGroupPtr->u32ClockDivideSelectAlternate & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32));
-
-        /* Setting for alternate conversion timing in CFG2 and SC3 register */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), (pGroupPtr->u32SampleTimeAlternate & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32));
-
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_RMW32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVG_MASK_U32, (pGroupPtr->u32AvgSelectAlternate & ADC12BSARV2_SC3_AVG_MASK_U32));
+        bImaged = (boolean)FALSE;
     }
-    else
-    #endif /* (ADC_DUAL_CLOCK_MODE == STD_ON)*/
+
+    if ((boolean)TRUE == bImaged)
     {
-        /* Clock divide select for normal mode */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /* Only the low bits of the address are taken as an integer, the list start is moved on
+           the pointer so that it keeps the full width of the address */
+        pu8List = (P2VAR(uint8, AUTOMATIC, ADC_APPL_DATA))&pChain->aTcd[0];
         /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32, (pGroupPtr->u32ClockDivideSelect & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32));
+        u32Misalign = ((uint32)pu8List) & ADC_ADC12BSARV2_DMA_TCD_ALIGN_U32;
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        pTcd = (P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA))&pu8List[((ADC_ADC12BSARV2_DMA_TCD_ALIGN_U32 + 1UL) - u32Misalign) & ADC_ADC12BSARV2_DMA_TCD_ALIGN_U32];
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, Adc_aGroupStatus[Group].ResultIndex);
+        Adc_Pdb_BuildReloadTrigger(Unit, pChain->au32PdbSc);
 
-        /* Setting for conversion timing in CFG2 and SC3 register */
+        /* Results of the first chunk, then the list */
         /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
         /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), (pGroupPtr->u32SampleTime & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32));
-
-        /* Select average samples */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        Adc_Adc12bsarv2_aDmaTcdConfig[Unit].u32daddr = (uint32)pResult;
+        Adc_Adc12bsarv2_aDmaTcdConfig[Unit].u32iter = (uint32)au8NumChannel[0];
+        Mcl_DmaConfigTcd(Adc_Adc12bsarv2_aTcdAddress[Unit], &(Adc_Adc12bsarv2_aDmaTcdConfig[Unit]));
+        Mcl_DmaTcdSetFlags(Adc_Adc12bsarv2_aTcdAddress[Unit], DMA_TCD_ESG_U8);
         /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_RMW32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVG_MASK_U32, (pGroupPtr->u32AvgSelect & ADC12BSARV2_SC3_AVG_MASK_U32));
-    }
-    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_06();
-#endif /*end (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)*/
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_6 cast from unsigned int to signed int */
+        Mcl_DmaTcdSetDlast(Adc_Adc12bsarv2_aTcdAddress[Unit], ADC_ADC12BSARV2_DMA_SGA(&pTcd[0]));
 
-    /* Reset to start conversion from channel logical index 0 */
-    Adc_aGroupStatus[Group].CurrentChannel = 0U;
+        DmaTcdConfig.u32ssize = (uint32) DMA_SIZE_4BYTES;
+        DmaTcdConfig.u32dsize = (uint32) DMA_SIZE_4BYTES;
+        DmaTcdConfig.u32soff = (uint32) DMA_OFFSET_32_BITS;
+        DmaTcdConfig.u32smod = (uint32) 0;
+        DmaTcdConfig.u32dmod = (uint32) 0;
+        DmaTcdConfig.u32iter = (uint32) 1;
 
-    /* Calculate the number of channels for current configuration */
-#if (ADC_SETCHANNEL_API == STD_ON)
-    /* Channel enabled at runtime */
-    u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(Adc_aRuntimeGroupChannel[Group].ChannelCount);
-#else
-    /* Channel enabled from initialzing */
-    u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(pGroupPtr->AssignedChannelCount);
-#endif
+        CurrentChannel = (Adc_ChannelIndexType)au8NumChannel[0];
+        for (u32Chunk = 1UL; u32Chunk < u32ChunkCount; u32Chunk++)
+        {
+            u32Index = (u32Chunk - 1UL) << 2U;
 
-    /* Update u8Sc1Used for the first time */
-    if(0U == Adc_aUnitStatus[Unit].u8Sc1Used)
-    {
-        Adc_aUnitStatus[Unit].u8Sc1Used = u8NumChannel;
-    }
+            /* SC1n bank of the chunk */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            DmaTcdConfig.u32saddr = (uint32)&(apImage[u32Chunk]->au32Sc1[0]);
+            DmaTcdConfig.u32daddr = (uint32)ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)0);
+            DmaTcdConfig.u32doff = (uint32) DMA_OFFSET_32_BITS;
+            DmaTcdConfig.u32num_bytes = (uint32)ADC_NUM_SC1_N_REGISTER_USED << 2U;
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            Mcl_DmaConfigTcd(&pTcd[u32Index], &DmaTcdConfig);
 
-#ifdef ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED
-    /* If the continuous group is configured without interrupts then PDB will be configured as continuous mode */
-    if((ADC_CONV_MODE_CONTINUOUS == pGroupPtr->eMode) && ((uint8)STD_ON == pGroupPtr->u8AdcWithoutInterrupt))
-    {
-        /* PDB operation in Continuous mode */
-        Adc_Pdb_SetPdbMode(Unit, (boolean)TRUE);
-    }
-    else
-    {
-        /* PDB operation in One-Shot mode */
-        Adc_Pdb_SetPdbMode(Unit, (boolean)FALSE);
-    }
-#endif /* ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED */
+            /* PDB period, channels and delays */
+            Adc_Pdb_BuildReloadBlock(Unit, apImage[u32Chunk], pChain->au32PdbBlock[u32Chunk - 1UL]);
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            DmaTcdConfig.u32saddr = (uint32)&(pChain->au32PdbBlock[u32Chunk - 1UL][0]);
+            DmaTcdConfig.u32daddr = (uint32)PDB_MOD_REG_ADDR32(Unit);
+            DmaTcdConfig.u32num_bytes = (uint32)ADC_PDB_RELOAD_BLOCK_WORDS << 2U;
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            Mcl_DmaConfigTcd(&pTcd[u32Index + 1UL], &DmaTcdConfig);
 
-#ifdef ADC_DMA_SUPPORTED
-    if (ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Unit])
-    {
-        /* If the group is configured for with interrupts*/
-        if ((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt)
-        {
-            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_07();
-            /* Enable DMA interrupt in case of Group configured with interrupt */
+            /* LDOK then software trigger, both to SC */
             /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
             /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-            REG_BIT_SET32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_DMA_EN_U32);
-            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_07();
-            
-            /* Setting for DMA transfer */
-            Adc_Adc12bsarv2_StartDmaOperation(Unit, Group, pGroupPtr, u8NumChannel);
+            DmaTcdConfig.u32saddr = (uint32)&(pChain->au32PdbSc[0]);
+            DmaTcdConfig.u32daddr = (uint32)PDB_SC_REG_ADDR32(Unit);
+            DmaTcdConfig.u32doff = (uint32) 0;
+            DmaTcdConfig.u32num_bytes = 8UL;
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            Mcl_DmaConfigTcd(&pTcd[u32Index + 2UL], &DmaTcdConfig);
 
-            /* Ensure that PDB does not run when ADC configured */
-            Adc_Pdb_StopConversion(Unit);
-        }
-            /* Setting for Adc in case of DMA transfer was selected, in the first time DMA should not be re-configured */
-            Adc_Adc12bsarv2_ConfigureDmaPartialConversion(Unit, Group, pGroupPtr, PDB_SOFTWARE_TRIGGER_U32, u8NumChannel, (boolean)FALSE);
-    }
-    else
-#endif /* ADC_DMA_SUPPORTED */
-    {
-        /* Clear all of COCO flag by reading Rn registers */
-        for(u8SCRegister = 0U; u8SCRegister < Adc_aUnitStatus[Unit].u8Sc1Used; u8SCRegister++)
-        {
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned int to pointer */
+            /* Results of the chunk */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
             /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-            (void)REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)u8SCRegister));
-        }
-        
-        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_08();
-        /* Enable hardware trigger */
-        /* Both software and hardware trigger will be implemented through PDB */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_BIT_SET32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_ADTRG_HW_U32);
-        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_08();
-        
-        /* Update group configuration to registers and start conversion */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        Adc_Adc12bsarv2_ConfigurePartialConversion(Unit, Group, pGroupPtr, PDB_SOFTWARE_TRIGGER_U32, u8NumChannel);
-    }
-}
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            Adc_Adc12bsarv2_aDmaTcdConfig[Unit].u32daddr = (uint32)(pResult + ((uint32)CurrentChannel * ADC_RESULT_CHANNEL_STRIDE(Group)));
+            Adc_Adc12bsarv2_aDmaTcdConfig[Unit].u32iter = (uint32)au8NumChannel[u32Chunk];
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            Mcl_DmaConfigTcd(&pTcd[u32Index + 3UL], &(Adc_Adc12bsarv2_aDmaTcdConfig[Unit]));
+            CurrentChannel += au8NumChannel[u32Chunk];
 
-#if (ADC_DUAL_CLOCK_MODE == STD_ON)
-/**
-* @brief          This function sets the clock prescaler and conversion timing registers.
+            /* Register copies start as soon as loaded, the results wait for the ADC requests */
+            for (u32Tcd = u32Index; u32Tcd < (u32Index + 3UL); u32Tcd++)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                Mcl_DmaTcdSetFlags(&pTcd[u32Tcd], (uint8)(DMA_TCD_START_U8 | DMA_TCD_ESG_U8));
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_6 cast from unsigned int to signed int */
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                Mcl_DmaTcdSetDlast(&pTcd[u32Tcd], ADC_ADC12BSARV2_DMA_SGA(&pTcd[u32Tcd + 1UL]));
+            }
+            if ((u32Chunk + 1UL) < u32ChunkCount)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                Mcl_DmaTcdSetFlags(&pTcd[u32Index + 3UL], DMA_TCD_ESG_U8);
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_6 cast from unsigned int to signed int */
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                Mcl_DmaTcdSetDlast(&pTcd[u32Index + 3UL], ADC_ADC12BSARV2_DMA_SGA(&pTcd[u32Index + 4UL]));
+            }
+            else
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                Mcl_DmaTcdSetFlags(&pTcd[u32Index + 3UL], (uint8)(DMA_TCD_DISABLE_REQ_U8 | DMA_TCD_INT_MAJOR_U8));
+            }
+        }
+    }
+    return bImaged;
+}
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) && (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF) */
+
+#if (ADC_CALIBRATION == STD_ON)
+/**
+* @brief          Sets up a unit for the calibration sequence.
+* @details        Selects the software trigger, halves the ADC clock, clears the plus-side
+*                 calibration registers and selects the maximum hardware averaging, as required
+*                 before setting SC3[CAL].
+*
+* @param[in]      Unit      ADC Unit Id.
+*
+* @return         void
+*
+* @pre            The caller holds ADC_EXCLUSIVE_AREA_10 and has saved SC3 and CFG1.
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_PrepareCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    /* Clear ADTRG bit to ensure that calibrate success */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_BIT_CLEAR32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_ADTRG_HW_U32);
+
+    /* Set the clock to half the maximum specified frequency */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_BIT_SET32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV2_U32);
+
+    /* Write zero to these register: CLPS, CLP3, CLP2, CLP1, CLP0, CLPX, and CLP9 */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_CLPS_REG_ADDR32(Unit), (uint32)0x0);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_CLP3_REG_ADDR32(Unit), (uint32)0x0);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_CLP2_REG_ADDR32(Unit), (uint32)0x0);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_CLP1_REG_ADDR32(Unit), (uint32)0x0);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_CLP0_REG_ADDR32(Unit), (uint32)0x0);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_CLPX_REG_ADDR32(Unit), (uint32)0x0);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_CLP9_REG_ADDR32(Unit), (uint32)0x0);
+
+    /* Set hardware averaging to maximum */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVGE_EN_U32 | ADC12BSARV2_SC3_AVGS_32_SAMPLES_U32);
+}
+
+/**
+* @brief          Returns a unit to its configuration after the calibration sequence.
+* @details        Clears COCO of SC1A, selects the hardware trigger again and restores SC3 and CFG1.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[in]      u32Sc3Status  SC3 value saved before the calibration.
+* @param[in]      u32Cfg1Status CFG1 value saved before the calibration.
+*
+* @return         void
+*
+* @pre            The caller holds ADC_EXCLUSIVE_AREA_10.
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_RestoreCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint32, AUTOMATIC) u32Sc3Status,
+    VAR(uint32, AUTOMATIC) u32Cfg1Status
+)
+{
+    /* Clear the COCO flag */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    (void)REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)0));
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_BIT_SET32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_ADTRG_HW_U32);
+    /* Reconfigure for SC3 and CFG1 register */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_SC3_REG_ADDR32(Unit), u32Sc3Status);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), u32Cfg1Status);
+}
+#endif /* (ADC_CALIBRATION == STD_ON) */
+
+#if (ADC_POWER_STATE_SUPPORTED == STD_ON)
+/**
+* @brief          Switches the clock of a unit between its full and low power configurations.
+* @details        Entering ADC_LOW_POWER keeps the ADICLK and ADIV fields of CFG1 and replaces them
+*                 with those of u32AdcCfg1RegisterLowPower; ADC_FULL_POWER writes the kept ones back.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[in]      ePowerState   ADC_FULL_POWER or ADC_LOW_POWER.
+*
+* @return         void
+*
+* @pre            The caller holds ADC_EXCLUSIVE_AREA_09.
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ApplyPowerState
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_PowerStateType, AUTOMATIC) ePowerState
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex = Adc_pCfgPtr->Misc.aHwLogicalId[Unit];
+
+    if (ePowerState != Adc_aUnitStatus[Unit].ePowerState)
+    {
+        if (ADC_LOW_POWER == ePowerState)
+        {
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            Adc_aUnitStatus[Unit].u32FullPowerClock = REG_READ32(ADC12BSARV2_CFG1_REG_ADDR32(Unit)) & ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32;
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32, (Adc_pCfgPtr->pAdc[HwIndex].u32AdcCfg1RegisterLowPower & ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32));
+        }
+        else
+        {
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32, Adc_aUnitStatus[Unit].u32FullPowerClock);
+        }
+        Adc_aUnitStatus[Unit].ePowerState = ePowerState;
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+        Adc_aUnitStatus[Unit].PowerStatistics.u32Transitions++;
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+    }
+}
+#endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
+
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+/**
+* @brief          Puts a unit left in low power by the power manager back to full power.
+* @details        Called before a conversion or a calibration is started on the unit; a unit woken
+*                 here was not woken in time by Adc_Main_PowerTransitionManager.
+*
+* @param[in]      Unit          ADC Unit Id.
+*
+* @return         void
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_WakeUnit
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
+    if (ADC_LOW_POWER == Adc_aUnitStatus[Unit].ePowerState)
+    {
+        Adc_Adc12bsarv2_ApplyPowerState(Unit, ADC_FULL_POWER);
+        Adc_aUnitStatus[Unit].PowerStatistics.u32LateWakeups++;
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+}
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+
+#if (ADC_DUAL_CLOCK_MODE == STD_ON)
+/**
+* @brief          Writes the normal or the alternate clock configuration of a unit.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[in]      eClockMode    ADC_NORMAL or ADC_ALTERNATE.
+*
+* @return         void
+*
+* @pre            The caller holds ADC_EXCLUSIVE_AREA_09.
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ApplyClockMode
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_DualClockModeType, AUTOMATIC) eClockMode
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex = Adc_pCfgPtr->Misc.aHwLogicalId[Unit];
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pUnitConfigPtr = &(Adc_pCfgPtr->pAdc[HwIndex]);
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    VAR(uint32, AUTOMATIC) u32Now;
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+
+#if (ADC_POWER_STATE_SUPPORTED == STD_ON)
+    /* The clock fields written below are the full power ones */
+    Adc_Adc12bsarv2_ApplyPowerState(Unit, ADC_FULL_POWER);
+#endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
+    if ((Adc_DualClockModeType)ADC_NORMAL == eClockMode)
+    {
+        /* Normal clock mode */
+        /* Configure clock divide select and input clock select */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32, (pUnitConfigPtr->u32AdcCfg1Register & ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32));
+
+        /* Sampling time and hardware average configuration */
+        #if (STD_ON == ADC_SET_ADC_CONV_TIME_ONCE)
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_SC3_REG_ADDR32(Unit), pUnitConfigPtr->u32AdcSc3Register);
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), pUnitConfigPtr->u32AdcCfg2Register);
+        #endif
+    }
+    else  /* ADC_ALTERNATE == eClockMode */
+    {
+        /* Alternate clock mode */
+        /* Configure clock divide select and input clock select */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32, (pUnitConfigPtr->u32AdcCfg1RegisterAlternate & ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32));
+
+        /* Configure clock divide select and input clock select */
+        #if (STD_ON == ADC_SET_ADC_CONV_TIME_ONCE)
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_SC3_REG_ADDR32(Unit), pUnitConfigPtr->u32AdcSc3RegisterAlternate);
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), pUnitConfigPtr->u32AdcCfg2RegisterAlternate);
+        #endif
+    }
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    if (eClockMode != Adc_aUnitStatus[Unit].eClockMode)
+    {
+        u32Now = Adc_Adc12bsarv2_ReadTime(HwIndex);
+        Adc_aUnitStatus[Unit].ClockStatistics.au32Time[Adc_aUnitStatus[Unit].eClockMode] += u32Now - Adc_aUnitStatus[Unit].u32ClockModeStart;
+        Adc_aUnitStatus[Unit].u32ClockModeStart = u32Now;
+        Adc_aUnitStatus[Unit].ClockStatistics.u32Switches++;
+        Adc_aUnitStatus[Unit].eClockMode = eClockMode;
+    }
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+}
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+/**
+* @brief          Reads the time source of a unit.
+*
+* @param[in]      HwIndex       Index of the unit in the configuration.
+*
+* @return         uint32        Current time, 0 when the unit has no pfReadTime.
+*/
+LOCAL_INLINE FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_ReadTime
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex
+)
+{
+    VAR(uint32, AUTOMATIC) u32Now = 0UL;
+
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    if (NULL_PTR != Adc_pCfgPtr->pAdc[HwIndex].pfReadTime)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        u32Now = Adc_pCfgPtr->pAdc[HwIndex].pfReadTime();
+    }
+    return u32Now;
+}
+
+/**
+* @brief          Time at which the deadline of a started group expires.
+*
+* @param[in]      Group         Group with bDeadlinePending set.
+*
+* @return         uint32        pfReadTime value of the expiry.
+*/
+LOCAL_INLINE FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_ClockGroupDue
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    return Adc_aGroupStatus[Group].u32RequestTime + Adc_pCfgPtr->pGroups[Group].u32ConversionDeadline;
+}
+
+/**
+* @brief          Removes a group from the pending deadlines of its unit.
+* @details        When the group held the earliest due time and others remain, u32EarliestDue is
+*                 kept as an earlier bound of theirs and rescanned by the next
+*                 Adc_Adc12bsarv2_ClockNoteRequest: until then the clock may stay normal longer,
+*                 never switch to the alternate one too early.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[in]      Group         Group with bDeadlinePending set.
+*
+* @return         void
+*
+* @pre            The caller holds ADC_EXCLUSIVE_AREA_09.
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ClockForgetRequest
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    Adc_aGroupStatus[Group].bDeadlinePending = (boolean)FALSE;
+    Adc_aUnitStatus[Unit].u32DeadlinesPending--;
+    if ((uint32)0UL == Adc_aUnitStatus[Unit].u32DeadlinesPending)
+    {
+        Adc_aUnitStatus[Unit].bEarliestDueStale = (boolean)FALSE;
+    }
+    else if (Adc_Adc12bsarv2_ClockGroupDue(Group) == Adc_aUnitStatus[Unit].u32EarliestDue)
+    {
+        Adc_aUnitStatus[Unit].bEarliestDueStale = (boolean)TRUE;
+    }
+    else
+    {
+        /* An earlier deadline than the remaining ones is still pending */
+    }
+}
+
+/**
+* @brief          Chooses the clock configuration of a unit before its next software group starts.
+* @details        ADC_NORMAL is taken when u8ClockFastQueueDepth groups are queued or the earliest
+*                 pending deadline of the unit is less than u32ClockDeadlineMargin away, ADC_ALTERNATE
+*                 when at most u8ClockSlowQueueDepth groups are queued. In between the clock is kept,
+*                 so the two depths give the hysteresis of the policy. Called from the end of
+*                 conversion interrupt: the deadlines are read from the unit, not from its groups.
+*
+* @param[in]      Unit          ADC Unit Id.
+*
+* @return         void
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_SelectClockMode
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex = Adc_pCfgPtr->Misc.aHwLogicalId[Unit];
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pUnitConfigPtr = &(Adc_pCfgPtr->pAdc[HwIndex]);
+    VAR(Adc_QueueIndexType, AUTOMATIC) Depth = Adc_aUnitStatus[Unit].SwNormalQueueIndex;
+    VAR(Adc_DualClockModeType, AUTOMATIC) eClockMode = Adc_aUnitStatus[Unit].eClockMode;
+    VAR(boolean, AUTOMATIC) bUrgent = (boolean)FALSE;
+    VAR(uint32, AUTOMATIC) u32Pending;
+    VAR(uint32, AUTOMATIC) u32Due;
+
+    if (((uint8)0U != pUnitConfigPtr->u8ClockFastQueueDepth)
+#if (ADC_HW_TRIGGER_API == STD_ON)
+        && ((Adc_QueueIndexType)0 == Adc_aUnitStatus[Unit].HwNormalQueueIndex)
+#endif /* (ADC_HW_TRIGGER_API == STD_ON) */
+       )
+    {
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
+        u32Pending = Adc_aUnitStatus[Unit].u32DeadlinesPending;
+        u32Due = Adc_aUnitStatus[Unit].u32EarliestDue;
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+        /* Time left before the earliest deadline, negative once it has expired */
+        if (((uint32)0UL != u32Pending) && \
+            ((sint32)(u32Due - Adc_Adc12bsarv2_ReadTime(HwIndex)) <= (sint32)pUnitConfigPtr->u32ClockDeadlineMargin))
+        {
+            bUrgent = (boolean)TRUE;
+        }
+        if (((boolean)TRUE == bUrgent) || (Depth >= (Adc_QueueIndexType)pUnitConfigPtr->u8ClockFastQueueDepth))
+        {
+            eClockMode = ADC_NORMAL;
+        }
+        else if (Depth <= (Adc_QueueIndexType)pUnitConfigPtr->u8ClockSlowQueueDepth)
+        {
+            eClockMode = ADC_ALTERNATE;
+        }
+        else
+        {
+            /* Between the two depths, keep the current clock */
+        }
+        if (eClockMode != Adc_aUnitStatus[Unit].eClockMode)
+        {
+            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
+            Adc_Adc12bsarv2_ApplyClockMode(Unit, eClockMode);
+            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+        }
+    }
+}
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+/**
+* @brief          Adds one interval to a latency histogram.
+* @details        The bucket is the bit length of the interval, found in five compares.
+*
+* @param[in,out]  pHistogram    Histogram updated.
+* @param[in]      u32Latency    Interval in ticks of ADC_GET_TIMESTAMP.
+*
+* @return         void
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyRecord
+(
+    P2VAR(Adc_LatencyHistogramType, AUTOMATIC, ADC_APPL_DATA) pHistogram,
+    VAR(uint32, AUTOMATIC) u32Latency
+)
+{
+    VAR(uint32, AUTOMATIC) u32Value = u32Latency;
+    VAR(uint32, AUTOMATIC) u32Bucket = 0UL;
+
+    if (u32Value >= 0x10000UL)
+    {
+        u32Value >>= 16U;
+        u32Bucket += 16UL;
+    }
+    if (u32Value >= 0x100UL)
+    {
+        u32Value >>= 8U;
+        u32Bucket += 8UL;
+    }
+    if (u32Value >= 0x10UL)
+    {
+        u32Value >>= 4U;
+        u32Bucket += 4UL;
+    }
+    if (u32Value >= 0x4UL)
+    {
+        u32Value >>= 2U;
+        u32Bucket += 2UL;
+    }
+    if (u32Value >= 0x2UL)
+    {
+        u32Value >>= 1U;
+        u32Bucket += 1UL;
+    }
+    /* u32Value is 0 only for a latency of 0 */
+    u32Bucket += u32Value;
+    if (u32Bucket >= (uint32)ADC_LATENCY_BUCKETS)
+    {
+        u32Bucket = (uint32)ADC_LATENCY_BUCKETS - 1UL;
+    }
+
+    pHistogram->au32Bucket[u32Bucket]++;
+    pHistogram->u32Count++;
+    if (u32Latency > pHistogram->u32Max)
+    {
+        pHistogram->u32Max = u32Latency;
+    }
+}
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+
+/*==================================================================================================
+                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          This function initializes the ADC hardware module, and the ADC driver.
+* @details        This function initializes the ADC hardware module, and the ADC driver.
+*
+* @param[in]      pCfgPtr      Configuration data pointer.
+*
+* @return         void
+*
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Init
+(
+    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfgPtr
+)
+{
+    /* Hardware Unit index */
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit = (Adc_HwUnitType)0;
+
+    /* ADC hardware unit config pointer */
+    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pConfigPtr = pCfgPtr->pAdc;
+
+    /* Initialize Unit Status structures */
+    /* Initialize for each ADC hardware unit (eg: ADC0, ADC1...) */
+    for(Unit = (Adc_HwUnitType)0; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        /* Check if unit is available */
+        if((uint8)STD_ON == ADC_HW_UNITS(Unit))
+        {
+            Adc_Adc12bsarv2_InitUnitHardware(Unit, pConfigPtr);
+        }
+    }
+#ifdef ADC_DWT_CYCCNT_ADDR32
+    /* Start the DWT cycle counter of ADC_GET_TIMESTAMP */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_BIT_SET32(ADC_DWT_DEMCR_ADDR32, ADC_DWT_DEMCR_TRCENA_U32);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_BIT_SET32(ADC_DWT_CTRL_ADDR32, ADC_DWT_CTRL_CYCCNTENA_U32);
+#endif /* ADC_DWT_CYCCNT_ADDR32 */
+}
+
+#if (ADC_DEINIT_API == STD_ON)
+/**
+* @brief          This function deinitializes the ADC driver, and the ADC hardware.
+* @details        This function deinitializes the ADC driver, and ensures that the ADC hardware
+*                 will be in the power on after reset state.
+*
+* @return         void
+*
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DeInit(void)
+{
+#if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
+    VAR(Adc_GroupType,AUTOMATIC) GroupIdx = 0U;
+#endif /* (ADC_GRP_NOTIF_CAPABILITY == STD_ON) */
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U; /* Hardware Unit index */
+
+    /* De-initialize each ADC hardware unit */
+    for(;Unit<(Adc_HwUnitType)ADC_MAX_HW_UNITS;Unit++)
+    {
+        if((uint8)STD_ON == ADC_HW_UNITS(Unit))
+        {
+            Adc_Adc12bsarv2_DeInitHardware(Unit);
+        }
+    }
+
+    /* De-initialize PDB hardware trigger unit */
+    Adc_Pdb_DeInit();
+
+    /* Disable notification of all available groups */
+#if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
+    for(GroupIdx=(Adc_GroupType)0U;GroupIdx<(Adc_GroupType)ADC_MAX_GROUPS;GroupIdx++)
+    {
+        Adc_aGroupStatus[GroupIdx].eNotification = ADC_NOTIFICATION_DISABLED;
+    }
+#endif /* (ADC_GRP_NOTIF_CAPABILITY == STD_ON) */
+
+}
+#endif /* #if (ADC_DEINIT_API == STD_ON) */
+
+#if ((ADC_ENABLE_START_STOP_GROUP_API == STD_ON) || (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE))
+/**
+* @brief          This function stops the current conversion of a group.
+* @details        This function stops the current conversion of a group.
+*
+* @param[in]      Unit      The hardware Unit.
+* @param[in]      Group     The group id.
+*
+* @return         Std_ReturnType  E_OK or E_NOT_OK.
+* @retval         E_OK            If the conversion has stopped as expected.
+* @retval         E_NOT_OK        In case of timeout while waiting for adc hardware to stop a conversion.
+*
+*/
+/** @violates @ref Adc_Adc12bsarv2_c_REF_10 internal linkage or external linkage*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_StopCurrentConversion
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(volatile uint32, AUTOMATIC) u32Timeout = ADC_TIMEOUT_COUNTER;
+    /* Variable for checking timeout status */
+    VAR(Std_ReturnType, AUTOMATIC) Test = (Std_ReturnType)E_OK;
+
+    /* Counter for SC registers */
+    VAR(uint8, AUTOMATIC) u8SCRegister;
+
+#if (ADC_EVENT_TRACE == STD_ON)
+    Adc_Trace_Record(ADC_TRACE_EV_ABORT_U8, Unit, (uint16)Group, (uint16)Adc_aGroupStatus[Group].CurrentChannel);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+    /* Disable Adc hardware unit and clear all of COCO flag by reading Rn register */
+    for(u8SCRegister = 0U; u8SCRegister < Adc_aUnitStatus[Unit].u8Sc1Used; u8SCRegister++)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32);
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        (void)REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)u8SCRegister));
+    }
+
+    /* Disable DMA requests and notifications */
+#ifdef ADC_DMA_SUPPORTED
+    if((uint8)ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Unit])
+    {
+        Mcl_DmaDisableHwRequest((Mcl_ChannelType)Adc_pCfgPtr->Misc.au8Adc_DmaChannel[Unit]);
+    #if (MCL_DMA_NOTIFICATION_SUPPORTED == STD_ON)
+        Mcl_DmaDisableNotification((Mcl_ChannelType)Adc_pCfgPtr->Misc.au8Adc_DmaChannel[Unit]);
+    #endif
+    }
+#endif /* ADC_DMA_SUPPORTED */
+    MCAL_FAULT_INJECTION_POINT(ADC_FIP_0_UPDATE_VARIABLE_TIMEOUT);
+    /* Reset current channel status to 0 */
+    Adc_aGroupStatus[Group].CurrentChannel = 0U;
+
+    /* Stop the conversion and abort the current group conversion */
+#if (ADC_BYPASS_CONSISTENCY_LOOP == STD_ON)
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    if((uint8)STD_OFF == Adc_pCfgPtr->pGroups[Group].u8AdcWithoutInterrupt)
+    {
+        Test = Adc_Adc12bsarv2_StopConversionCheckTimeout(Unit, Group, u32Timeout);
+    }
+    else
+    {
+        /* If group is continuous and configured without interrupts, clear the CONTINUOUS bit */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        if (ADC_CONV_MODE_CONTINUOUS == Adc_pCfgPtr->pGroups[Group].eMode)
+        {
+#ifdef ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED
+            Adc_Pdb_StopConversion(Unit);
+#endif /* ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED */
+        }
+    }
+#else /* (ADC_BYPASS_CONSISTENCY_LOOP == STD_ON) */
+    Test = Adc_Adc12bsarv2_StopConversionCheckTimeout(Unit, Group, u32Timeout);
+#endif /* (ADC_BYPASS_CONSISTENCY_LOOP == STD_OFF) */
+
+    return Test;
+}
+#endif
+
+#if (ADC_ASYNC_ABORT == STD_ON)
+/**
+* @brief          Completes an abort left pending by Adc_Adc12bsarv2_StopCurrentConversion.
+* @details        Once the unit reads back its SC1n registers disabled, starts the group now at the
+*                 head of the software queue. A call from Adc_MainFunction finding the abort still
+*                 pending after ADC_ABORT_TIMEOUT_PERIODS periods reports Adc_E_TimeoutCfg and starts
+*                 the group anyway, as the blocking stop does. The end of conversion interrupt also
+*                 calls it, without counting towards the timeout.
+*
+* @param[in]      Unit           The hardware Unit.
+* @param[in]      bPeriod        TRUE when called by Adc_MainFunction, once per period.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_CompleteAbort
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(boolean, AUTOMATIC) bPeriod
+)
+{
+    VAR(boolean, AUTOMATIC) bStart = (boolean)FALSE;
+    VAR(boolean, AUTOMATIC) bTimeout = (boolean)FALSE;
+
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_37();
+    if ((boolean)TRUE == Adc_aUnitStatus[Unit].bAbortPending)
+    {
+        if ((boolean)TRUE == Adc_Adc12bsarv2_IsAborted(Unit))
+        {
+            bStart = (boolean)TRUE;
+        }
+        else if ((boolean)FALSE == bPeriod)
+        {
+            /* Interrupts are not periodic, only Adc_MainFunction counts the timeout */
+        }
+        else if (Adc_aUnitStatus[Unit].u32AbortTimeout > (uint32)0UL)
+        {
+            Adc_aUnitStatus[Unit].u32AbortTimeout--;
+        }
+        else
+        {
+            bTimeout = (boolean)TRUE;
+            bStart = (boolean)TRUE;
+        }
+        if ((boolean)TRUE == bStart)
+        {
+            Adc_aUnitStatus[Unit].bAbortPending = (boolean)FALSE;
+        }
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_37();
+
+#if (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF)
+    if(((boolean)TRUE == bTimeout) && ((uint32)STD_ON == Adc_E_TimeoutCfg.state))
+    {
+        Dem_ReportErrorStatus((Dem_EventIdType)Adc_E_TimeoutCfg.id, DEM_EVENT_STATUS_FAILED);
+    }
+#else
+    (void)bTimeout;
+#endif /* (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF) */
+    if ((boolean)TRUE == bStart)
+    {
+        Adc_Adc12bsarv2_StartNormalConversion(Unit);
+    }
+}
+#endif /* (ADC_ASYNC_ABORT == STD_ON) */
+
+#if (ADC_HW_TRIGGER_API == STD_ON)
+/**
+* @brief          This function performs starting a hardware trigger conversion.
+* @details        This function performs starting a hardware trigger conversion.
+*
+* @param[in]      Unit        The hardware Unit.
+* @param[in]      Group       The group of which conversion will be started.
+*
+* @return         void
+* @violates @ref Adc_Adc12bsarv2_c_REF_10 internal linkage or external linkage
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartHwTrigConversion
+(
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit,
+    CONST(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(uint8, AUTOMATIC) u8NumChannel;
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+
+    /* Calculate the number of channels for current configuration */
+#if (ADC_SETCHANNEL_API == STD_ON)
+    u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(Adc_aRuntimeGroupChannel[Group].ChannelCount);
+#else
+    u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(pGroupPtr->AssignedChannelCount);
+#endif
+
+    /* If it is the first group, u8Sc1Used is assigned as the number channels of group */
+    if(0U == Adc_aUnitStatus[Unit].u8Sc1Used)
+    {
+        Adc_aUnitStatus[Unit].u8Sc1Used = u8NumChannel;
+    }
+    Adc_aGroupStatus[Group].CurrentChannel = 0U;
+
+#ifdef ADC_DMA_SUPPORTED
+    if (ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Unit])
+    {
+        if((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt)
+        {
+            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_04();
+            /* Enable DMA interrupt incase of Group configured with interrupt */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned int to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            REG_BIT_SET32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_DMA_EN_U32);
+            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_04();
+
+            /* Setting for DMA transfer */
+            Adc_Adc12bsarv2_StartDmaOperation(Unit, Group, pGroupPtr, u8NumChannel);
+        }
+
+        /* Ensure that PDB does not run when ADC configured */
+        Adc_Pdb_StopConversion(Unit);
+
+        /* Setting for ADC in case of DMA transfer was selected, in the first time DMA should not be re-configured */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        Adc_Adc12bsarv2_ConfigureDmaPartialConversion(Unit, Group, pGroupPtr, (Adc_HwTriggerTimerType)pGroupPtr->pHwResource[0], u8NumChannel, (boolean)FALSE);
+    }
+    else
+#endif /* ADC_DMA_SUPPORTED */
+    {
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
+        /* Let the ADC discard out of range conversions of the group */
+        Adc_Adc12bsarv2_ConfigureHwCompare(Unit, Group, pGroupPtr);
+#endif /* (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) */
+        /* Setting for ADC hardware in case of DMA transfer was not selected */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        Adc_Adc12bsarv2_ConfigurePartialConversion(Unit, Group, pGroupPtr, pGroupPtr->pHwResource[0], u8NumChannel);
+    }
+}
+#endif
+
+#if (ADC_READ_GROUP_API == STD_ON)
+/**
+* @brief          This function reads the converted data for the requested group.
+* @details        Reads the converted data for the requested group.
+*
+* @param[in]      Group           The group number.
+* @param[in]      pDataPtr        Pointer to a buffer which will be filled by the
+*                                 conversion results.
+* @return         Std_ReturnType  E_OK or E_NOT_OK.
+* @retval         E_OK            In case of successfull read of the converted data.
+* @retval         E_NOT_OK        In case of an ongoing conversion.
+*
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_ReadGroup
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pDataPtr,
+    P2VAR(boolean, AUTOMATIC, ADC_APPL_DATA) pFlag
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ReadGroupRet = (Std_ReturnType)E_OK;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) Index;
+    /* Pointer to AdcGroup */
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = NULL_PTR;
+
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+
+#if (ADC_SETCHANNEL_API == STD_ON)
+    ChannelCount = Adc_aRuntimeGroupChannel[Group].ChannelCount;
+#else
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    ChannelCount = pGroupPtr->AssignedChannelCount;
+#endif
+
+    /* If the group is configured for without interrupts*/
+    if((uint8)STD_ON == pGroupPtr->u8AdcWithoutInterrupt)
+    {
+        VAR(uint32, AUTOMATIC) u32HsValue;
+        VAR(uint16, AUTOMATIC) u16R0Value;
+        VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+        VAR(Adc_HwUnitType, AUTOMATIC) HwIndex;
+        VAR(uint32, AUTOMATIC) u32AdcDataMask;
+#if (STD_ON == ADC_HW_TRIGGER_API)
+        VAR(Adc_GroupType, AUTOMATIC) GroupHWNormalQueue;
+#endif
+#if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
+        VAR(Adc_ChannelType, AUTOMATIC) ChIndex;
+        /* Flag to set if ADC results are in the selected range */
+        VAR(boolean, AUTOMATIC) bWriteFlag = (boolean)TRUE;
+#endif /* (ADC_ENABLE_LIMIT_CHECK == STD_ON) */
+
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        Unit = Adc_pCfgPtr->pGroups[Group].HwUnit;
+    #if (STD_ON == ADC_HW_TRIGGER_API)
+        GroupHWNormalQueue = Adc_aUnitStatus[Unit].HwNormalQueue[0];
+        if ((Group == Adc_aUnitStatus[Unit].SwNormalQueue[0]) || (Group == GroupHWNormalQueue))
+    #else
+        if (Group == Adc_aUnitStatus[Unit].SwNormalQueue[0])
+    #endif
+        {
+            /*Checking conversion is completed for all channels*/
+            for(Index = 0U; Index < ChannelCount; Index++)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+                u32HsValue = REG_READ32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)Index));
+                if(0UL == (u32HsValue & ADC12BSARV2_SC1_N_CONV_COMPLETE_U32))
+                {
+                    /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
+                    return (Std_ReturnType)E_NOT_OK;
+                }
+            }
+        }
+        else
+        {
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
+            return (Std_ReturnType)E_NOT_OK;
+        }
+        /* Get the logical id from hardware Unit*/
+        HwIndex = Adc_pCfgPtr->Misc.aHwLogicalId[Unit];
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        u32AdcDataMask = Adc_pCfgPtr->pAdc[HwIndex].u32AdcDataMask;
+#if (ADC_ENABLE_LIMIT_CHECK == STD_OFF)
+        (*pFlag) = (boolean)TRUE;
+#endif /* (ADC_ENABLE_LIMIT_CHECK == STD_OFF) */
+
+        for(Index = 0U; Index < ChannelCount; Index++)
+        {
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            u16R0Value = (uint16)(REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)Index)));
+
+#if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
+            /* there is only one channel in the group - the first channel */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            ChIndex = pGroupPtr->pAssignment[0];
+            if ((boolean)TRUE == pGroupPtr->bAdcGroupLimitcheck)
+            {
+                /* ADC446, ADC447 */
+                (*pFlag) = (boolean)Adc_CheckConversionValuesInRange(u16R0Value, Unit, ChIndex);
+                if ((boolean)FALSE == (*pFlag))
+                {
+                    /* ADC448, ADC449, ADC450 */
+                    ReadGroupRet = (Std_ReturnType)E_NOT_OK;
+                    bWriteFlag = (boolean)FALSE;
+                }
+            }
+            if((boolean)TRUE == bWriteFlag)
+#endif /* ADC_ENABLE_LIMIT_CHECK == STD_ON */
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                pDataPtr[Index] = (uint16)(u16R0Value & u32AdcDataMask);
+            }
+        }
+    }
+    /* If the group is configured for with interrupts*/
+    else
+    {
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+        VAR(uint32, AUTOMATIC) u32Sequence;
+        VAR(uint32, AUTOMATIC) u32Attempt = 0UL;
+        VAR(boolean, AUTOMATIC) bTorn;
+
+        /* Copy without masking interrupts. The copy is discarded when the results were being
+           written when it started or have been written while it was running */
+        do
+        {
+            u32Sequence = Adc_aGroupStatus[Group].u32PublishSequence;
+            ReadGroupRet = Adc_Adc12bsarv2_CopyLastSample(Group, pDataPtr, ChannelCount, 1UL, NULL_PTR);
+            bTorn = (boolean)((0UL != (u32Sequence & 1UL)) || (u32Sequence != Adc_aGroupStatus[Group].u32PublishSequence));
+            u32Attempt++;
+        } while (((boolean)TRUE == bTorn) && (u32Attempt < (uint32)ADC_RESULT_SEQLOCK_RETRIES));
+
+        /* Results are published faster than they can be copied: copy once more with interrupts masked */
+        if ((boolean)TRUE == bTorn)
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+        {
+            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_27();
+            ReadGroupRet = Adc_Adc12bsarv2_CopyLastSample(Group, pDataPtr, ChannelCount, 1UL, NULL_PTR);
+            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_27();
+        }
+    }
+
+    return(ReadGroupRet);
+}
+#endif /* (ADC_READ_GROUP_API == STD_ON) */
+
+#if (ADC_READ_GROUPS_API == STD_ON)
+/**
+* @brief          This function reads the converted data for a list of groups.
+* @details        Copies the last completed sample of each group of the list and stores the
+*                 outcome in the ReadResult field of its entry. The groups must be configured
+*                 with interrupts. With ADC_RESULT_SEQLOCK each group is copied as by
+*                 Adc_Adc12bsarv2_ReadGroup, against its own publish sequence.
+*
+* @param[in,out]  pRequests       The list of groups and destination buffers.
+* @param[in]      NumRequests     Number of entries in the list.
+*
+* @return         void
+*
+* @pre            Without ADC_RESULT_SEQLOCK, the caller holds the exclusive area covering the
+*                 groups of the list.
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ReadGroups
+(
+    P2VAR(Adc_ReadGroupRequestType, AUTOMATIC, ADC_APPL_DATA) pRequests,
+    CONST(Adc_GroupType, AUTOMATIC) NumRequests
+)
+{
+    VAR(Adc_GroupType, AUTOMATIC) Index;
+    VAR(Adc_GroupType, AUTOMATIC) Group;
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+    VAR(boolean, AUTOMATIC) bFlag = (boolean)TRUE;
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+
+    for (Index = 0U; Index < NumRequests; Index++)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        Group = pRequests[Index].Group;
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        pRequests[Index].ReadResult = Adc_Adc12bsarv2_ReadGroup(Group, pRequests[Index].pDataBuffer, &bFlag);
+#else
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        pRequests[Index].ReadResult = Adc_Adc12bsarv2_CopyLastSample(Group, pRequests[Index].pDataBuffer, ADC_GROUP_CHANNEL_COUNT(Group), 1UL, NULL_PTR);
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+    }
+}
+#endif /* (ADC_READ_GROUPS_API == STD_ON) */
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+/**
+* @brief          This function reads the last sample converted by both halves of a paired group.
+* @details        Channel i of Group is stored at pDataPtr[2i] and channel i of Partner at
+*                 pDataPtr[2i + 1], or, for the halves of a balanced scan, every channel at its
+*                 logical position in the scan. Nothing is copied while only one half has
+*                 converted the current sample, so that the two values of a channel pair always
+*                 come from the same trigger.
+*
+* @param[in]      Group           The group number.
+* @param[out]     pDataPtr        Buffer of 2 * channel count values, or of the channel count
+*                                 of the balanced scan.
+*
+* @return         Std_ReturnType  E_OK or E_NOT_OK.
+* @retval         E_OK            Both halves were copied.
+* @retval         E_NOT_OK        The pair has not completed a sample yet.
+*
+* @pre            The caller holds the exclusive area covering both halves, or checks the publish
+*                 sequences of both halves around the call.
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_ReadPairedGroup
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pDataPtr
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ReadRet = (Std_ReturnType)E_NOT_OK;
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    CONST(Adc_GroupType, AUTOMATIC) Partner = Adc_pCfgPtr->pGroups[Group].PairedGroup;
+#if (ADC_BALANCED_SCANS == STD_ON)
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_BalancedScanType, AUTOMATIC, ADC_APPL_CONST) pScan = Adc_pCfgPtr->pGroups[Group].pBalancedScan;
+#endif /* (ADC_BALANCED_SCANS == STD_ON) */
+
+    if (((boolean)FALSE == Adc_aGroupStatus[Group].bPairHalfDone) && ((boolean)FALSE == Adc_aGroupStatus[Partner].bPairHalfDone))
+    {
+#if (ADC_BALANCED_SCANS == STD_ON)
+        if (NULL_PTR != pScan)
+        {
+            /* Each half scatters its results to the logical positions of its channels */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            ReadRet = Adc_Adc12bsarv2_CopyLastSample(Group, pDataPtr, ADC_GROUP_CHANNEL_COUNT(Group), 1UL, \
+                                                     pScan->pPlan->aPosition[Adc_pCfgPtr->pGroups[Group].HwUnit]);
+            if ((Std_ReturnType)E_OK == ReadRet)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                ReadRet = Adc_Adc12bsarv2_CopyLastSample(Partner, pDataPtr, ADC_GROUP_CHANNEL_COUNT(Partner), 1UL, \
+                                                         pScan->pPlan->aPosition[Adc_pCfgPtr->pGroups[Partner].HwUnit]);
+            }
+        }
+        else
+#endif /* (ADC_BALANCED_SCANS == STD_ON) */
+        {
+            ReadRet = Adc_Adc12bsarv2_CopyLastSample(Group, pDataPtr, ADC_GROUP_CHANNEL_COUNT(Group), 2UL, NULL_PTR);
+            if ((Std_ReturnType)E_OK == ReadRet)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                ReadRet = Adc_Adc12bsarv2_CopyLastSample(Partner, &pDataPtr[1], ADC_GROUP_CHANNEL_COUNT(Partner), 2UL, NULL_PTR);
+            }
+        }
+    }
+
+    return ReadRet;
+}
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+
+#if (ADC_HW_TRIGGER_API == STD_ON)
+/**
+* @brief          This function enables the hardware triggers for the specified group.
+* @details        This function enables the hardware triggers for the specified group.
+*
+* @param[in]      Group           The group for which the hardware triggers will be enabled.
+* @param[in]      Unit            The hardware Unit. (on other platforms there are more hw units)
+*
+* @return         void
+*
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EnableHardwareTrigger
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(uint8, AUTOMATIC) u8SCRegister;
+#if (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
+
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+#endif
+
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    Adc_Adc12bsarv2_WakeUnit(Unit);
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+    ADC_RESULT_PUBLISH_BEGIN(Group);
+    Adc_aGroupStatus[Group].ResultIndex = 0U;
+    ADC_RESULT_PUBLISH_END(Group);
+
+    /* Clear all of COCO flag by reading Rn registers */
+    for(u8SCRegister = 0U; u8SCRegister < Adc_aUnitStatus[Unit].u8Sc1Used; u8SCRegister++)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        (void)REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)u8SCRegister));
+    }
+
+#if (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)
+    /* If conversion time once disabled, either normal or alternate clock mode can be configured at runtime */
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_05();
+    #if (ADC_DUAL_CLOCK_MODE == STD_ON)
+    if(ADC_ALTERNATE == ADC_ADC12BSARV2_CLOCK_MODE(Unit))
+    {
+        /* Set clock division for alternate clock mode */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32, (pGroupPtr->u32ClockDivideSelectAlternate & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32));
+
+        /* Setting for alternate conversion timing in CFG2 and SC3 register */
+        /* Set alternate sample time */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), (pGroupPtr->u32SampleTimeAlternate & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32));
+
+        /* Enable hardware average and set average samples */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVG_MASK_U32, (pGroupPtr->u32AvgSelectAlternate & ADC12BSARV2_SC3_AVG_MASK_U32));
+    }
+    else
+    #endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+    {
+        /* Set clock division for normal clock mode */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32, (pGroupPtr->u32ClockDivideSelect & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32));
+
+        /* Setting for conversion timing in CFG2 and SC3 register */
+        /* Set normal sample time */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), (pGroupPtr->u32SampleTime & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32));
+
+        /* Enable hardware average and set average samples */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVG_MASK_U32, (pGroupPtr->u32AvgSelect & ADC12BSARV2_SC3_AVG_MASK_U32));
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_05();
+#endif /*end (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)*/
+
+#if (ADC_EVENT_TRACE == STD_ON)
+    Adc_Trace_Record(ADC_TRACE_EV_START_U8, Unit, (uint16)Group, 1U);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+    Adc_Adc12bsarv2_StartHwTrigConversion(Unit, Group);
+
+}
+
+/**
+* @brief          This function disables the hardware triggers for the specified group.
+* @details        This function disables the hardware triggers for the specified group.
+*
+* @param[in]      Group           The group for which the hardware triggers will be enabled.
+* @param[in]      Unit            The hardware Unit. (on other platforms there are more hw units)
+*
+* @return         void
+*
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DisableHardwareTrigger
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(uint8, AUTOMATIC) u8SCRegister;
+
+
+    (void)Group;
+#if (ADC_EVENT_TRACE == STD_ON)
+    Adc_Trace_Record(ADC_TRACE_EV_ABORT_U8, Unit, (uint16)Group, (uint16)Adc_aGroupStatus[Group].CurrentChannel);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+#ifdef ADC_DMA_SUPPORTED
+    /* Disable DMA */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    if (ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Unit])
+    {
+        if ((uint8)STD_ON == Adc_pCfgPtr->Misc.au8Adc_HwUnit[Unit])
+        {
+            /* Disable DMA interrupt */
+            Mcl_DmaDisableHwRequest((Mcl_ChannelType)Adc_pCfgPtr->Misc.au8Adc_DmaChannel[Unit]);
+        #if (MCL_DMA_NOTIFICATION_SUPPORTED == STD_ON)
+            Mcl_DmaDisableNotification((Mcl_ChannelType)Adc_pCfgPtr->Misc.au8Adc_DmaChannel[Unit]);
+        #endif
+        }
+    }
+#endif /* ADC_DMA_SUPPORTED */
+
+    Adc_Pdb_StopConversion(Unit);
+
+    /* Disable Adc hardware unit */
+    for(u8SCRegister = 0U; u8SCRegister < Adc_aUnitStatus[Unit].u8Sc1Used; u8SCRegister++)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32);
+    }
+
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
+    /* Other groups converted on the unit expect every conversion to set COCO */
+    if ((boolean)TRUE == Adc_aGroupStatus[Group].bHwCompare)
+    {
+        Adc_aGroupStatus[Group].bHwCompare = (boolean)FALSE;
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_34();
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_BIT_CLEAR32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC_ADC12BSARV2_SC2_COMPARE_MASK_U32);
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_34();
+    }
+#endif /* (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) */
+}
+#endif /* (ADC_HW_TRIGGER_API == STD_ON) */
+
+/**
+* @brief          This function starts the conversion on the specified hardware Unit.
+* @details        This function starts the conversion on the specified hardware Unit.
+*                 This function should be called with the ADC Unit on standby (no ADC interruptions
+*                 allowed because its code is not protected by critical regions) - no conversions must
+*                 be running.
+*
+* @param[in]      Unit            the used hw Unit.
+*
+* @return         void
+*
+* @violates @ref Adc_Adc12bsarv2_c_REF_10 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartNormalConversion
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
+    VAR(Adc_GroupType, AUTOMATIC) Group = (Adc_GroupType)0; /* Active group in the Queue */
+    VAR(uint8, AUTOMATIC) u8SCRegister;
+    VAR(uint8, AUTOMATIC) u8NumChannel;
+
+    /* If software normal queue is empty (i.e no conversion requests) then return without any action */
+    if ((Adc_QueueIndexType)0 == Adc_aUnitStatus[Unit].SwNormalQueueIndex)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
+        return;
+    }
+#if (ADC_ASYNC_ABORT == STD_ON)
+    /* The unit has not stopped the preempted group yet, Adc_Adc12bsarv2_CompleteAbort starts this one */
+    if ((boolean)TRUE == Adc_aUnitStatus[Unit].bAbortPending)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
+        return;
+    }
+#endif /* (ADC_ASYNC_ABORT == STD_ON) */
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    Adc_Adc12bsarv2_WakeUnit(Unit);
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    /* A group boundary: the clock may change before the timings of the next group are written */
+    Adc_Adc12bsarv2_SelectClockMode(Unit);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+
+    /* Load the first group in the queue */
+    Group = Adc_aUnitStatus[Unit].SwNormalQueue[0];
+
+    /* Load the group configuration */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+
+#if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
+    /* Group configured as one-shot mode and limit checking failed then return without any action */
+    if(((boolean)TRUE == Adc_aGroupStatus[Group].bLimitCheckFailed) && (ADC_CONV_MODE_ONESHOT == pGroupPtr->eMode))
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_4 Return statement before end of function. */
+        return;
+    }
+#endif /* ADC_ENABLE_LIMIT_CHECK == STD_ON */
+#if (ADC_EVENT_TRACE == STD_ON)
+    Adc_Trace_Record(ADC_TRACE_EV_START_U8, Unit, (uint16)Group, 0U);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+
+#if (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_06();
+    /* Check the clock mode (and config if needed) every start conversion if conversion time once is disabled */
+    #if (ADC_DUAL_CLOCK_MODE == STD_ON)
+    if(ADC_ALTERNATE == ADC_ADC12BSARV2_CLOCK_MODE(Unit))
+    {
+        /* Clock divide select for alternate mode */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32, (pGroupPtr->u32ClockDivideSelectAlternate & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32));
+
+        /* Setting for alternate conversion timing in CFG2 and SC3 register */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), (pGroupPtr->u32SampleTimeAlternate & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32));
+
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVG_MASK_U32, (pGroupPtr->u32AvgSelectAlternate & ADC12BSARV2_SC3_AVG_MASK_U32));
+    }
+    else
+    #endif /* (ADC_DUAL_CLOCK_MODE == STD_ON)*/
+    {
+        /* Clock divide select for normal mode */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32, (pGroupPtr->u32ClockDivideSelect & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32));
+
+        /* Setting for conversion timing in CFG2 and SC3 register */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), (pGroupPtr->u32SampleTime & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32));
+
+        /* Select average samples */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_RMW32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVG_MASK_U32, (pGroupPtr->u32AvgSelect & ADC12BSARV2_SC3_AVG_MASK_U32));
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_06();
+#endif /*end (STD_OFF == ADC_SET_ADC_CONV_TIME_ONCE)*/
+
+    /* Reset to start conversion from channel logical index 0 */
+    Adc_aGroupStatus[Group].CurrentChannel = 0U;
+
+    /* Calculate the number of channels for current configuration */
+#if (ADC_SETCHANNEL_API == STD_ON)
+    /* Channel enabled at runtime */
+    u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(Adc_aRuntimeGroupChannel[Group].ChannelCount);
+#else
+    /* Channel enabled from initialzing */
+    u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(pGroupPtr->AssignedChannelCount);
+#endif
+
+    /* Update u8Sc1Used for the first time */
+    if(0U == Adc_aUnitStatus[Unit].u8Sc1Used)
+    {
+        Adc_aUnitStatus[Unit].u8Sc1Used = u8NumChannel;
+    }
+
+#ifdef ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED
+    /* If the continuous group is configured without interrupts then PDB will be configured as continuous mode */
+    if((ADC_CONV_MODE_CONTINUOUS == pGroupPtr->eMode) && ((uint8)STD_ON == pGroupPtr->u8AdcWithoutInterrupt))
+    {
+        /* PDB operation in Continuous mode */
+        Adc_Pdb_SetPdbMode(Unit, (boolean)TRUE);
+    }
+    else
+    {
+        /* PDB operation in One-Shot mode */
+        Adc_Pdb_SetPdbMode(Unit, (boolean)FALSE);
+    }
+#endif /* ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED */
+
+#ifdef ADC_DMA_SUPPORTED
+    if (ADC_DMA == Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Unit])
+    {
+        /* If the group is configured for with interrupts*/
+        if ((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt)
+        {
+            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_07();
+            /* Enable DMA interrupt in case of Group configured with interrupt */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            REG_BIT_SET32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_DMA_EN_U32);
+            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_07();
+            
+            /* Setting for DMA transfer */
+            Adc_Adc12bsarv2_StartDmaOperation(Unit, Group, pGroupPtr, u8NumChannel);
+
+            /* Ensure that PDB does not run when ADC configured */
+            Adc_Pdb_StopConversion(Unit);
+        }
+            /* Setting for Adc in case of DMA transfer was selected, in the first time DMA should not be re-configured */
+            Adc_Adc12bsarv2_ConfigureDmaPartialConversion(Unit, Group, pGroupPtr, PDB_SOFTWARE_TRIGGER_U32, u8NumChannel, (boolean)FALSE);
+    }
+    else
+#endif /* ADC_DMA_SUPPORTED */
+    {
+        /* Clear all of COCO flag by reading Rn registers */
+        for(u8SCRegister = 0U; u8SCRegister < Adc_aUnitStatus[Unit].u8Sc1Used; u8SCRegister++)
+        {
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned int to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            (void)REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)u8SCRegister));
+        }
+        
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_08();
+        /* Enable hardware trigger */
+        /* Both software and hardware trigger will be implemented through PDB */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_BIT_SET32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_ADTRG_HW_U32);
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_08();
+        
+        /* Update group configuration to registers and start conversion */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        Adc_Adc12bsarv2_ConfigurePartialConversion(Unit, Group, pGroupPtr, PDB_SOFTWARE_TRIGGER_U32, u8NumChannel);
+    }
+}
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+/**
+* @brief          This function starts the two halves of a paired group.
+* @details        Both units are configured as by Adc_Adc12bsarv2_StartNormalConversion with the
+*                 software trigger of their PDB held, then the two PDB counters are triggered
+*                 together. Both halves must be at the head of the queue of their unit.
+*
+* @param[in]      Group           A group of the pair.
+* @param[in]      Partner         The other group of the pair.
+*
+* @return         void
+*
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartPairedConversion
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group,
+    CONST(Adc_GroupType, AUTOMATIC) Partner
+)
+{
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit = Adc_pCfgPtr->pGroups[Group].HwUnit;
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    CONST(Adc_HwUnitType, AUTOMATIC) PartnerUnit = Adc_pCfgPtr->pGroups[Partner].HwUnit;
+
+    Adc_aUnitStatus[Unit].bPdbTriggerHeld = (boolean)TRUE;
+    Adc_aUnitStatus[PartnerUnit].bPdbTriggerHeld = (boolean)TRUE;
+    Adc_Adc12bsarv2_StartNormalConversion(Unit);
+    Adc_Adc12bsarv2_StartNormalConversion(PartnerUnit);
+    Adc_Pdb_StartPairedConversion(Unit, PartnerUnit);
+}
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+
+#if (ADC_DUAL_CLOCK_MODE == STD_ON)
+/**
+* @brief          This function sets the clock prescaler and conversion timing registers.
 * @details        This function sets the clock prescaler and conversion timing registers.
 *
-* @param[in]      eClockMode       ADC_NORMAL, ADC_ALTERNATE.
+* @param[in]      eClockMode       ADC_NORMAL, ADC_ALTERNATE.
+*
+* @return         Std_ReturnType  E_OK or E_NOT_OK.
+* @retval         E_OK            In case of successful set mode.
+* @retval         E_NOT_OK        In case of unsuccessful set mode.
+*
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_SetClockMode
+(
+    VAR(Adc_DualClockModeType, AUTOMATIC) eClockMode
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U; /* Hardware Unit index */
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        if((uint8)STD_ON == ADC_HW_UNITS(Unit))
+        {
+            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
+            Adc_Adc12bsarv2_ApplyClockMode(Unit, eClockMode);
+            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+        }
+    }
+
+    return (Std_ReturnType)E_OK;
+}
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+/**
+* @brief          Records the start request of a group with a conversion deadline.
+* @details        Adds the group to the pending deadlines of its unit and keeps their earliest due
+*                 time, the only one Adc_Adc12bsarv2_SelectClockMode reads. The pending groups of the
+*                 unit are only scanned here, in the task starting a group, after the group holding
+*                 the earliest due time completed while others were pending.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[in]      Group         Group started.
+* @param[in]      u32Now        pfReadTime of the unit at the request.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ClockNoteRequest
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(uint32, AUTOMATIC) u32Now
+)
+{
+    VAR(Adc_GroupType, AUTOMATIC) Other;
+    VAR(uint32, AUTOMATIC) u32Due;
+    VAR(uint32, AUTOMATIC) u32OtherDue;
+
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
+    if ((boolean)FALSE == Adc_aGroupStatus[Group].bDeadlinePending)
+    {
+        Adc_aGroupStatus[Group].u32RequestTime = u32Now;
+        u32Due = Adc_Adc12bsarv2_ClockGroupDue(Group);
+        if ((boolean)TRUE == Adc_aUnitStatus[Unit].bEarliestDueStale)
+        {
+            for (Other = 0U; Other < (Adc_GroupType)Adc_pCfgPtr->GroupCount; Other++)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                if (((boolean)TRUE == Adc_aGroupStatus[Other].bDeadlinePending) && (Unit == Adc_pCfgPtr->pGroups[Other].HwUnit))
+                {
+                    u32OtherDue = Adc_Adc12bsarv2_ClockGroupDue(Other);
+                    u32Due = ((sint32)(u32OtherDue - u32Due) < 0) ? u32OtherDue : u32Due;
+                }
+            }
+            Adc_aUnitStatus[Unit].u32EarliestDue = u32Due;
+            Adc_aUnitStatus[Unit].bEarliestDueStale = (boolean)FALSE;
+        }
+        else if (((uint32)0UL == Adc_aUnitStatus[Unit].u32DeadlinesPending) || \
+                 ((sint32)(u32Due - Adc_aUnitStatus[Unit].u32EarliestDue) < 0))
+        {
+            Adc_aUnitStatus[Unit].u32EarliestDue = u32Due;
+        }
+        else
+        {
+            /* A pending deadline expires first */
+        }
+        Adc_aUnitStatus[Unit].u32DeadlinesPending++;
+        Adc_aGroupStatus[Group].bDeadlinePending = (boolean)TRUE;
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+}
+
+/**
+* @brief          Drops the deadline of a group stopped before its first conversion completed.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[in]      Group         Group stopped.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ClockCancelRequest
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
+    if ((boolean)TRUE == Adc_aGroupStatus[Group].bDeadlinePending)
+    {
+        Adc_Adc12bsarv2_ClockForgetRequest(Unit, Group);
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+}
+
+/**
+* @brief          Accounts a software group conversion completed on a unit.
+* @details        Counts it in the current clock configuration and, the first time after the start
+*                 request of a group with a deadline, checks that deadline.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[in]      Group         Group whose conversion completed.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ClockEndConversion
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(uint32, AUTOMATIC) u32Elapsed;
+
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
+    Adc_aUnitStatus[Unit].ClockStatistics.au32Conversions[Adc_aUnitStatus[Unit].eClockMode]++;
+    if ((boolean)TRUE == Adc_aGroupStatus[Group].bDeadlinePending)
+    {
+        u32Elapsed = Adc_Adc12bsarv2_ReadTime(Adc_pCfgPtr->Misc.aHwLogicalId[Unit]) - Adc_aGroupStatus[Group].u32RequestTime;
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        if (u32Elapsed > Adc_pCfgPtr->pGroups[Group].u32ConversionDeadline)
+        {
+            Adc_aUnitStatus[Unit].ClockStatistics.u32DeadlineMisses++;
+        }
+        Adc_Adc12bsarv2_ClockForgetRequest(Unit, Group);
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+}
+
+/**
+* @brief          Returns the clock statistics of a unit.
+* @details        The time of the current clock configuration includes the time since its last
+*                 change.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[out]     pStatistics   Statistics of the unit.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_GetClockStatistics
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_ClockStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+)
+{
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
+    *pStatistics = Adc_aUnitStatus[Unit].ClockStatistics;
+    pStatistics->au32Time[Adc_aUnitStatus[Unit].eClockMode] += \
+        Adc_Adc12bsarv2_ReadTime(Adc_pCfgPtr->Misc.aHwLogicalId[Unit]) - Adc_aUnitStatus[Unit].u32ClockModeStart;
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+}
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+/**
+* @brief          Timestamps the start request of a software group.
+* @details        Called before the group is queued, so that the first chunk interrupt always
+*                 finds the start.
+*
+* @param[in]      Group         Group started.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyStart
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    VAR(uint32, AUTOMATIC) u32Now = ADC_GET_TIMESTAMP();
+
+    Adc_aGroupStatus[Group].u32LatencyStart = u32Now;
+    Adc_aGroupStatus[Group].u32LatencyChunk = u32Now;
+    Adc_aGroupStatus[Group].bLatencyStart = (boolean)TRUE;
+    Adc_aGroupStatus[Group].bLatencyChunk = (boolean)TRUE;
+}
+
+/**
+* @brief          Records a partial conversion interrupt of a group.
+* @details        Called from the interrupt before the results of the chunk are handled, once
+*                 CurrentChannel points past the chunk. After the last chunk the start of the
+*                 conversion is kept for the notification. A continuous software group restarts
+*                 from this interrupt, the other groups wait for a new start or trigger.
+*
+* @param[in]      Group         Group whose chunk completed.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyChunk
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    VAR(uint32, AUTOMATIC) u32Now = ADC_GET_TIMESTAMP();
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount;
+
+#if (ADC_SETCHANNEL_API == STD_ON)
+    ChannelCount = Adc_aRuntimeGroupChannel[Group].ChannelCount;
+#else
+    ChannelCount = pGroupPtr->AssignedChannelCount;
+#endif /* (ADC_SETCHANNEL_API == STD_ON) */
+
+    if ((boolean)TRUE == Adc_aGroupStatus[Group].bLatencyChunk)
+    {
+        Adc_Adc12bsarv2_LatencyRecord(&Adc_aGroupStatus[Group].aLatency[ADC_LATENCY_CHUNK], u32Now - Adc_aGroupStatus[Group].u32LatencyChunk);
+    }
+    Adc_aGroupStatus[Group].u32LatencyChunk = u32Now;
+    Adc_aGroupStatus[Group].bLatencyChunk = (boolean)TRUE;
+
+    if (Adc_aGroupStatus[Group].CurrentChannel >= ChannelCount)
+    {
+        Adc_aGroupStatus[Group].u32LatencyEnd = Adc_aGroupStatus[Group].u32LatencyStart;
+        Adc_aGroupStatus[Group].bLatencyEnd = Adc_aGroupStatus[Group].bLatencyStart;
+        if ((ADC_TRIGG_SRC_SW == pGroupPtr->eTriggerSource) && (ADC_CONV_MODE_CONTINUOUS == pGroupPtr->eMode))
+        {
+            Adc_aGroupStatus[Group].u32LatencyStart = u32Now;
+        }
+        else
+        {
+            Adc_aGroupStatus[Group].bLatencyStart = (boolean)FALSE;
+            Adc_aGroupStatus[Group].bLatencyChunk = (boolean)FALSE;
+        }
+    }
+}
+
+/**
+* @brief          Records the dispatch of the notification of a group.
+*
+* @param[in]      Group         Group notified.
 *
-* @return         Std_ReturnType  E_OK or E_NOT_OK.
-* @retval         E_OK            In case of successful set mode.
-* @retval         E_NOT_OK        In case of unsuccessful set mode.
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyNotify
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    VAR(uint32, AUTOMATIC) u32Now = ADC_GET_TIMESTAMP();
+
+    Adc_Adc12bsarv2_LatencyRecord(&Adc_aGroupStatus[Group].aLatency[ADC_LATENCY_DISPATCH], u32Now - Adc_aGroupStatus[Group].u32LatencyChunk);
+    if ((boolean)TRUE == Adc_aGroupStatus[Group].bLatencyEnd)
+    {
+        Adc_Adc12bsarv2_LatencyRecord(&Adc_aGroupStatus[Group].aLatency[ADC_LATENCY_END_TO_END], u32Now - Adc_aGroupStatus[Group].u32LatencyEnd);
+        Adc_aGroupStatus[Group].bLatencyEnd = (boolean)FALSE;
+    }
+}
+
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+/**
+* @brief          Keeps the timestamps of a conversion whose notification is posted.
+* @details        Called from the interrupt when the group enters the deferred notification queue.
+*                 The next conversions of the group overwrite its timestamps before the dispatch.
+*
+* @param[in]      Group         Group posted.
 *
+* @return         void
 */
-FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_SetClockMode
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyPost
 (
-    VAR(Adc_DualClockModeType, AUTOMATIC) eClockMode
+    VAR(Adc_GroupType, AUTOMATIC) Group
 )
 {
-    VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U; /* Hardware Unit index */
-    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex = 0U; /* Index of hardware Unit */
-    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pUnitConfigPtr; /* Pointer to Hw Unit config */
+    Adc_aGroupStatus[Group].u32LatencyPost = Adc_aGroupStatus[Group].u32LatencyChunk;
+    Adc_aGroupStatus[Group].u32LatencyPostEnd = Adc_aGroupStatus[Group].u32LatencyEnd;
+    Adc_aGroupStatus[Group].bLatencyPostEnd = Adc_aGroupStatus[Group].bLatencyEnd;
+    Adc_aGroupStatus[Group].bLatencyEnd = (boolean)FALSE;
+}
 
-    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+/**
+* @brief          Records the dispatch of a posted notification by Adc_Main_NotificationDispatcher.
+* @details        Called before the queue slot of the group is released, so that no interrupt
+*                 posts the group again meanwhile.
+*
+* @param[in]      Group         Group notified.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_LatencyDispatch
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(uint32, AUTOMATIC) u32Now;
+
+    /* Adc_GetLatencyHistogram may preempt the dispatcher */
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_39();
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    u32Now = ADC_GET_TIMESTAMP();
+    Adc_Adc12bsarv2_LatencyRecord(&Adc_aGroupStatus[Group].aLatency[ADC_LATENCY_DISPATCH], u32Now - Adc_aGroupStatus[Group].u32LatencyPost);
+    if ((boolean)TRUE == Adc_aGroupStatus[Group].bLatencyPostEnd)
     {
-        if((uint8)STD_ON == ADC_HW_UNITS(Unit))
-        {
-            /* Get the logical id of hardware Unit*/
-            HwIndex = Adc_pCfgPtr->Misc.aHwLogicalId[Unit];
+        Adc_Adc12bsarv2_LatencyRecord(&Adc_aGroupStatus[Group].aLatency[ADC_LATENCY_END_TO_END], u32Now - Adc_aGroupStatus[Group].u32LatencyPostEnd);
+        Adc_aGroupStatus[Group].bLatencyPostEnd = (boolean)FALSE;
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_39();
+}
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
 
-            /* Pointer for configure clock mode */
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-            pUnitConfigPtr = &(Adc_pCfgPtr->pAdc[HwIndex]);
-            
-            SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
-            if ((Adc_DualClockModeType)ADC_NORMAL == eClockMode)
-            {
-                /* Normal clock mode */
-                /* Configure clock divide select and input clock select */
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-                REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32, (pUnitConfigPtr->u32AdcCfg1Register & ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32));
+/**
+* @brief          Returns a latency histogram of a group.
+*
+* @param[in]      Group         The group id.
+* @param[in]      eStage        Interval of the histogram.
+* @param[out]     pHistogram    Copy of the histogram.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_GetLatencyHistogram
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_LatencyStageType, AUTOMATIC) eStage,
+    P2VAR(Adc_LatencyHistogramType, AUTOMATIC, ADC_APPL_DATA) pHistogram
+)
+{
+    /* The interrupts of the group update the histogram */
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_39();
+    *pHistogram = Adc_aGroupStatus[Group].aLatency[eStage];
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_39();
+}
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
 
-                /* Sampling time and hardware average configuration */
-                #if (STD_ON == ADC_SET_ADC_CONV_TIME_ONCE)
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-                REG_WRITE32(ADC12BSARV2_SC3_REG_ADDR32(Unit), pUnitConfigPtr->u32AdcSc3Register);
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-                REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), pUnitConfigPtr->u32AdcCfg2Register);
-                #endif
+#if (ADC_EVENT_TRACE == STD_ON)
+/**
+* @brief          Traces a partial conversion interrupt of a group.
+* @details        Called from the interrupt before the results of the chunk are handled, once
+*                 CurrentChannel points past the chunk. The last chunk of a round is traced as
+*                 its end.
+*
+* @param[in]      Unit          Hardware unit converting the group.
+* @param[in]      Group         Group whose chunk completed.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_TraceChunk
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(uint8, AUTOMATIC) u8Event = ADC_TRACE_EV_CHUNK_U8;
+
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    if (Adc_aGroupStatus[Group].CurrentChannel >= ADC_GROUP_CHANNEL_COUNT(Group))
+    {
+        u8Event = ADC_TRACE_EV_END_U8;
+    }
+    Adc_Trace_Record(u8Event, Unit, (uint16)Group, (uint16)Adc_aGroupStatus[Group].CurrentChannel);
+}
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+
+#if (ADC_POWER_STATE_SUPPORTED == STD_ON)
+/**
+* @brief          Applies the clock configuration of a power state to one unit.
+*
+* @param[in]      Unit          ADC Unit Id.
+* @param[in]      ePowerState   ADC_FULL_POWER or ADC_LOW_POWER.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_SetUnitPowerState
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_PowerStateType, AUTOMATIC) ePowerState
+)
+{
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_09();
+    Adc_Adc12bsarv2_ApplyPowerState(Unit, ePowerState);
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+}
+
+/**
+* @brief          Applies the clock configuration of a power state to all configured units.
+*
+* @param[in]      ePowerState   ADC_FULL_POWER or ADC_LOW_POWER.
+*
+* @return         Std_ReturnType  E_OK.
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_SetPowerState
+(
+    VAR(Adc_PowerStateType, AUTOMATIC) ePowerState
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) HwIndex;
+
+    for (HwIndex = 0U; HwIndex < Adc_pCfgPtr->Misc.Adc_MaxHwCfg; HwIndex++)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        Adc_Adc12bsarv2_SetUnitPowerState(Adc_pCfgPtr->pAdc[HwIndex].AdcHardwareUnitId, ePowerState);
+    }
+    return (Std_ReturnType)E_OK;
+}
+#endif /* (ADC_POWER_STATE_SUPPORTED == STD_ON) */
+
+#if (ADC_CALIBRATION == STD_ON)
+/**
+* @brief          Executes high accuracy calibration of a ADC HW Unit.
+* @details        This function calibrates the ADC HW Unit and updates calibration related registers
+*
+* @param[in]      Unit      ADC Unit Id.
+* @param[in]      Status    Status of the ADC HW Unit calibration and
+*                           list of failed/passed tests.
+*
+* @return         void
+*  @violates @ref Adc_Adc12bsarv2_c_REF_14 Pointer parameter.
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Calibrate
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_CalibrationStatusType , AUTOMATIC, ADC_APPL_DATA) pStatus
+)
+{
+    VAR(volatile uint32, AUTOMATIC) u32Timeout = ADC_TIMEOUT_COUNTER;
+    VAR(uint32, AUTOMATIC) u32Sc3Status;
+    VAR(uint32, AUTOMATIC) u32Cfg1Status;
+    
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    Adc_Adc12bsarv2_WakeUnit(Unit);
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_10();
+    /* Back up SC3 status */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    u32Sc3Status = REG_READ32(ADC12BSARV2_SC3_REG_ADDR32(Unit));
+    /* Back up CFG1 status */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    u32Cfg1Status = REG_READ32(ADC12BSARV2_CFG1_REG_ADDR32(Unit));
+    Adc_Adc12bsarv2_PrepareCalibration(Unit);
+    MCAL_FAULT_INJECTION_POINT(ADC_FIP_1_UPDATE_VARIABLE_TIMEOUT);
+    /* Start calibration */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_BIT_SET32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_CAL_EN_U32);
+    pStatus->Adc_UnitSelfTestStatus = (Std_ReturnType) E_OK;
+
+    /* Waiting for calibrate success */
+    /* ADC235, ADC068 */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned int to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    while(ADC12BSARV2_SC1_N_CONV_COMPLETE_U32 != (REG_READ32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)0)) & ADC12BSARV2_SC1_N_CONV_COMPLETE_U32))
+    {
+        if (u32Timeout > (uint32)0UL)
+        {
+            u32Timeout--;
+        }
+        else
+        {
+            #if (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF)
+            if((uint32)STD_ON == Adc_E_TimeoutCfg.state)
+            {
+                Dem_ReportErrorStatus((Dem_EventIdType)Adc_E_TimeoutCfg.id, DEM_EVENT_STATUS_FAILED);
             }
-            else  /* ADC_ALTERNATE == eClockMode */
+            #endif /* (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF) */
+            pStatus->Adc_UnitSelfTestStatus = (Std_ReturnType) E_NOT_OK;
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            REG_BIT_CLEAR32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_CAL_EN_U32);
+            break;
+        }
+    }
+    Adc_Adc12bsarv2_RestoreCalibration(Unit, u32Sc3Status, u32Cfg1Status);
+    
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_10();
+
+}
+#endif /* ADC_CALIBRATION == STD_ON */
+
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+/**
+* @brief          Starts the calibration of a ADC HW Unit and returns.
+* @details        Saves SC3 and CFG1, prepares the unit as Adc_Adc12bsarv2_Calibrate does, enables the
+*                 conversion complete interrupt on SC1A and sets SC3[CAL]. The exclusive area only
+*                 covers these register writes; the calibration itself runs with interrupts enabled
+*                 and is completed by Adc_Adc12bsarv2_CompleteCalibration.
+*
+* @param[in]      Unit      ADC Unit Id.
+* @param[in]      pStatus   Status updated at the end of the calibration.
+*
+* @return         void
+*  @violates @ref Adc_Adc12bsarv2_c_REF_14 Pointer parameter.
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_StartCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_CalibrationStatusType , AUTOMATIC, ADC_APPL_DATA) pStatus
+)
+{
+    P2VAR(Adc_CalibrationContextType, AUTOMATIC, ADC_VAR) pContext = &Adc_Adc12bsarv2_aCalibration[Unit];
+
+    pContext->pStatus = pStatus;
+    pContext->u32Timeout = ADC_TIMEOUT_COUNTER;
+    pStatus->Adc_UnitSelfTestStatus = (Std_ReturnType) E_OK;
+
+#if (ADC_POWER_DUTY_CYCLING == STD_ON)
+    Adc_Adc12bsarv2_WakeUnit(Unit);
+#endif /* (ADC_POWER_DUTY_CYCLING == STD_ON) */
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_10();
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    pContext->u32Sc3 = REG_READ32(ADC12BSARV2_SC3_REG_ADDR32(Unit));
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    pContext->u32Cfg1 = REG_READ32(ADC12BSARV2_CFG1_REG_ADDR32(Unit));
+    Adc_Adc12bsarv2_PrepareCalibration(Unit);
+    /* End of calibration is signalled by COCO of SC1A */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)0), ADC12BSARV2_CONV_COMPLETE_INT_EN_U32 | ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32);
+    Adc_aUnitStatus[Unit].bCalibrationOngoing = (boolean)TRUE;
+    /* Start calibration */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_BIT_SET32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_CAL_EN_U32);
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_10();
+}
+
+/**
+* @brief          Ends the calibration started by Adc_Adc12bsarv2_StartCalibration.
+* @details        Called from the end of conversion interrupt of the unit or from
+*                 Adc_Adc12bsarv2_GetCalibrationState. Restores the unit, then reports the result
+*                 through the status given at start and the pCalibrationNotification of the unit.
+*                 Does nothing when the calibration was already completed by the other caller.
+*
+* @param[in]      Unit      ADC Unit Id.
+* @param[in]      bAbandon  TRUE when the calibration timed out and has to be stopped.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_CompleteCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(boolean, AUTOMATIC) bAbandon
+)
+{
+    P2VAR(Adc_CalibrationContextType, AUTOMATIC, ADC_VAR) pContext = &Adc_Adc12bsarv2_aCalibration[Unit];
+    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pUnitConfig;
+    VAR(boolean, AUTOMATIC) bCompleted = (boolean)FALSE;
+
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_10();
+    if ((boolean)TRUE == Adc_aUnitStatus[Unit].bCalibrationOngoing)
+    {
+        if ((boolean)TRUE == bAbandon)
+        {
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            REG_BIT_CLEAR32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_CAL_EN_U32);
+        }
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)0), ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32);
+        Adc_Adc12bsarv2_RestoreCalibration(Unit, pContext->u32Sc3, pContext->u32Cfg1);
+        Adc_aUnitStatus[Unit].bCalibrationOngoing = (boolean)FALSE;
+        bCompleted = (boolean)TRUE;
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_10();
+
+    if ((boolean)TRUE == bCompleted)
+    {
+        pUnitConfig = &(Adc_pCfgPtr->pAdc[Adc_pCfgPtr->Misc.aHwLogicalId[Unit]]);
+        if ((boolean)TRUE == bAbandon)
+        {
+            #if (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF)
+            if((uint32)STD_ON == Adc_E_TimeoutCfg.state)
             {
-                /* Alternate clock mode */
-                /* Configure clock divide select and input clock select */
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-                REG_RMW32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32, (pUnitConfigPtr->u32AdcCfg1RegisterAlternate & ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32));
+                Dem_ReportErrorStatus((Dem_EventIdType)Adc_E_TimeoutCfg.id, DEM_EVENT_STATUS_FAILED);
+            }
+            #endif /* (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF) */
+            pContext->pStatus->Adc_UnitSelfTestStatus = (Std_ReturnType) E_NOT_OK;
+        }
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
+        else
+        {
+            Adc_aUnitStatus[Unit].eCalibrationOrigin = ADC_CALIBRATION_MEASURED;
+            Adc_aUnitStatus[Unit].s32CalibrationTemperature = (NULL_PTR != pUnitConfig->pfReadTemperature) ? \
+                                                              (sint32)pUnitConfig->pfReadTemperature() : (sint32)0;
+        }
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+        if (NULL_PTR != pUnitConfig->pCalibrationNotification)
+        {
+            pUnitConfig->pCalibrationNotification(Unit, pContext->pStatus->Adc_UnitSelfTestStatus);
+        }
+    }
+}
+
+/**
+* @brief          Polls the calibration started by Adc_Adc12bsarv2_StartCalibration.
+* @details        Completes the calibration when COCO of SC1A is set, which serves units whose end
+*                 of conversion interrupt is not used. Abandons the calibration after
+*                 ADC_TIMEOUT_COUNTER calls without completion.
+*
+* @param[in]      Unit      ADC Unit Id.
+*
+* @return         Adc_CalibrationStateType  State after the poll.
+*/
+FUNC(Adc_CalibrationStateType, ADC_CODE) Adc_Adc12bsarv2_GetCalibrationState
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    P2VAR(Adc_CalibrationContextType, AUTOMATIC, ADC_VAR) pContext = &Adc_Adc12bsarv2_aCalibration[Unit];
 
-                /* Configure clock divide select and input clock select */
-                #if (STD_ON == ADC_SET_ADC_CONV_TIME_ONCE)
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-                REG_WRITE32(ADC12BSARV2_SC3_REG_ADDR32(Unit), pUnitConfigPtr->u32AdcSc3RegisterAlternate);
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-                REG_WRITE32(ADC12BSARV2_CFG2_REG_ADDR32(Unit), pUnitConfigPtr->u32AdcCfg2RegisterAlternate);
-                #endif
-            }
-            SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_09();
+    if ((boolean)TRUE == Adc_aUnitStatus[Unit].bCalibrationOngoing)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned int to pointer */
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+        if (ADC12BSARV2_SC1_N_CONV_COMPLETE_U32 == (REG_READ32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)0)) & ADC12BSARV2_SC1_N_CONV_COMPLETE_U32))
+        {
+            Adc_Adc12bsarv2_CompleteCalibration(Unit, (boolean)FALSE);
+        }
+        else if (pContext->u32Timeout > (uint32)0UL)
+        {
+            pContext->u32Timeout--;
+        }
+        else
+        {
+            Adc_Adc12bsarv2_CompleteCalibration(Unit, (boolean)TRUE);
         }
     }
-
-    return (Std_ReturnType)E_OK;
+    return ((boolean)TRUE == Adc_aUnitStatus[Unit].bCalibrationOngoing) ? ADC_CALIBRATION_ONGOING : ADC_CALIBRATION_IDLE;
 }
-#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
 
-#if (ADC_CALIBRATION == STD_ON)
+#if (ADC_CALIBRATION_PERSISTENCE == STD_ON)
 /**
-* @brief          Executes high accuracy calibration of a ADC HW Unit.
-* @details        This function calibrates the ADC HW Unit and updates calibration related registers
+* @brief          Reads the calibration results of a ADC HW Unit.
+* @details        Copies CLPS, CLP3..CLP0, CLPX, CLP9 and USR_OFS to the register fields of pData.
 *
 * @param[in]      Unit      ADC Unit Id.
-* @param[in]      Status    Status of the ADC HW Unit calibration and
-*                           list of failed/passed tests.
+* @param[out]     pData     Calibration data to fill.
 *
 * @return         void
 *  @violates @ref Adc_Adc12bsarv2_c_REF_14 Pointer parameter.
 */
-FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Calibrate
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ReadCalibration
 (
     VAR(Adc_HwUnitType, AUTOMATIC) Unit,
-    P2VAR(Adc_CalibrationStatusType , AUTOMATIC, ADC_APPL_DATA) pStatus
+    P2VAR(Adc_CalibrationDataType, AUTOMATIC, ADC_APPL_DATA) pData
 )
 {
-    VAR(volatile uint32, AUTOMATIC) u32Timeout = ADC_TIMEOUT_COUNTER;
-    VAR(uint32, AUTOMATIC) u32Sc3Status;
-    VAR(uint32, AUTOMATIC) u32Cfg1Status;
-    
-    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_10();
-    /* Back up SC3 status */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    u32Sc3Status = REG_READ32(ADC12BSARV2_SC3_REG_ADDR32(Unit));
-    /* Back up CFG1 status */
+    pData->u32Clps = REG_READ32(ADC12BSARV2_CLPS_REG_ADDR32(Unit));
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    u32Cfg1Status = REG_READ32(ADC12BSARV2_CFG1_REG_ADDR32(Unit));
-    /* Clear ADTRG bit to ensure that calibrate success */
+    pData->u32Clp3 = REG_READ32(ADC12BSARV2_CLP3_REG_ADDR32(Unit));
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_BIT_CLEAR32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_ADTRG_HW_U32);
-
-    /* Set the clock to half the maximum specified frequency */
+    pData->u32Clp2 = REG_READ32(ADC12BSARV2_CLP2_REG_ADDR32(Unit));
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_BIT_SET32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), ADC12BSARV2_CFG1_CLOCK_DIV2_U32);
-
-    /* Write zero to these register: CLPS, CLP3, CLP2, CLP1, CLP0, CLPX, and CLP9 */
+    pData->u32Clp1 = REG_READ32(ADC12BSARV2_CLP1_REG_ADDR32(Unit));
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_CLPS_REG_ADDR32(Unit), (uint32)0x0);
+    pData->u32Clp0 = REG_READ32(ADC12BSARV2_CLP0_REG_ADDR32(Unit));
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_CLP3_REG_ADDR32(Unit), (uint32)0x0);
+    pData->u32Clpx = REG_READ32(ADC12BSARV2_CLPX_REG_ADDR32(Unit));
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_CLP2_REG_ADDR32(Unit), (uint32)0x0);
+    pData->u32Clp9 = REG_READ32(ADC12BSARV2_CLP9_REG_ADDR32(Unit));
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_CLP1_REG_ADDR32(Unit), (uint32)0x0);
+    pData->u32UsrOfs = REG_READ32(ADC12BSARV2_USR_OFS_REG_ADDR32(Unit));
+}
+
+/**
+* @brief          Loads calibration results into a ADC HW Unit.
+* @details        Writes CLPS, CLP3..CLP0, CLPX, CLP9 and USR_OFS from pData, leaving the unit as
+*                 a successful Adc_Adc12bsarv2_Calibrate would.
+*
+* @param[in]      Unit      ADC Unit Id.
+* @param[in]      pData     Calibration data already checked by the caller.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_WriteCalibration
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2CONST(Adc_CalibrationDataType, AUTOMATIC, ADC_APPL_CONST) pData
+)
+{
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_CLP0_REG_ADDR32(Unit), (uint32)0x0);
+    REG_WRITE32(ADC12BSARV2_CLPS_REG_ADDR32(Unit), pData->u32Clps);
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_CLPX_REG_ADDR32(Unit), (uint32)0x0);
+    REG_WRITE32(ADC12BSARV2_CLP3_REG_ADDR32(Unit), pData->u32Clp3);
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_CLP9_REG_ADDR32(Unit), (uint32)0x0);
-
-    /* Set hardware averaging to maximum */
+    REG_WRITE32(ADC12BSARV2_CLP2_REG_ADDR32(Unit), pData->u32Clp2);
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_AVGE_EN_U32 | ADC12BSARV2_SC3_AVGS_32_SAMPLES_U32);
-    MCAL_FAULT_INJECTION_POINT(ADC_FIP_1_UPDATE_VARIABLE_TIMEOUT);
-    /* Start calibration */
+    REG_WRITE32(ADC12BSARV2_CLP1_REG_ADDR32(Unit), pData->u32Clp1);
     /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_BIT_SET32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_CAL_EN_U32);
-    pStatus->Adc_UnitSelfTestStatus = (Std_ReturnType) E_OK;
-
-    /* Waiting for calibrate success */
-    /* ADC235, ADC068 */
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned int to pointer */
+    REG_WRITE32(ADC12BSARV2_CLP0_REG_ADDR32(Unit), pData->u32Clp0);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
     /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    while(ADC12BSARV2_SC1_N_CONV_COMPLETE_U32 != (REG_READ32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)0)) & ADC12BSARV2_SC1_N_CONV_COMPLETE_U32))
+    REG_WRITE32(ADC12BSARV2_CLPX_REG_ADDR32(Unit), pData->u32Clpx);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_CLP9_REG_ADDR32(Unit), pData->u32Clp9);
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(ADC12BSARV2_USR_OFS_REG_ADDR32(Unit), pData->u32UsrOfs);
+}
+#endif /* ADC_CALIBRATION_PERSISTENCE == STD_ON */
+
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+/**
+* @brief          Builds the register images of a group
+* @details        Computes, for each chunk of ADC_NUM_SC1_N_REGISTER_USED channels of the group, the
+*                 SC1n and PDB values Adc_Adc12bsarv2_ConfigurePartialConversion writes to start it.
+*                 Uses the channels and delays set by Adc_SetChannel when that API is enabled.
+*
+* @param[in]      Group         The group number.
+*
+* @return         void
+*/
+/** @violates @ref Adc_Adc12bsarv2_c_REF_10 internal linkage or external linkage*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_BuildRegisterImages
+(
+    CONST(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    CONST(Adc_HwUnitType, AUTOMATIC) Unit = pGroupPtr->HwUnit;
+    P2CONST(Adc_GroupDefType, AUTOMATIC, ADC_APPL_CONST) pChannel;
+    P2CONST(uint16, AUTOMATIC, ADC_APPL_CONST) pGroupDelay;
+    P2VAR(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) CurrentChannel = 0U;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) Chunk;
+    VAR(Adc_ChannelType, AUTOMATIC) HwChannel;
+    VAR(uint8, AUTOMATIC) u8NumChannel;
+    VAR(uint8, AUTOMATIC) u8SCRegister;
+
+#if (ADC_SETCHANNEL_API == STD_ON)
+    pChannel = Adc_aRuntimeGroupChannel[Group].pChannel;
+    pGroupDelay = Adc_aRuntimeGroupChannel[Group].pu16Delays;
+    ChannelCount = Adc_aRuntimeGroupChannel[Group].ChannelCount;
+#else
+    pChannel = pGroupPtr->pAssignment;
+    pGroupDelay = pGroupPtr->pDelay;
+    ChannelCount = pGroupPtr->AssignedChannelCount;
+#endif /* (ADC_SETCHANNEL_API == STD_ON) */
+
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_35();
+    for (Chunk = 0U; Chunk < ADC_REGISTER_IMAGE_MAX_CHUNKS; Chunk++)
     {
-        if (u32Timeout > (uint32)0UL)
+        pImage = &Adc_Adc12bsarv2_aRegisterImage[Group][Chunk];
+        if (CurrentChannel < ChannelCount)
         {
-            u32Timeout--;
+            u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(ChannelCount - CurrentChannel);
+            for (u8SCRegister = 0U; u8SCRegister < u8NumChannel; u8SCRegister++)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                HwChannel = Adc_pCfgPtr->pChannels[Unit][pChannel[CurrentChannel + u8SCRegister]].ChId;
+                pImage->au32Sc1[u8SCRegister] = ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | (HwChannel & ADC12BSARV2_ADCH_MASK_U32);
+            }
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+            /* The DMA reload copies the whole SC1n bank of the image */
+            for (u8SCRegister = u8NumChannel; u8SCRegister < ADC_NUM_SC1_N_REGISTER_USED; u8SCRegister++)
+            {
+                pImage->au32Sc1[u8SCRegister] = ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32;
+            }
+            /* The conversion complete interrupt of the last channel ends the chunk, the DMA does on DMA units */
+            if (((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt) && ((uint8)ADC_DMA != Adc_pCfgPtr->Misc.u8Adc_DmaInterruptSoftware[Unit]))
+#else
+            /* The conversion complete interrupt of the last channel ends the chunk */
+            if ((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt)
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) */
+            {
+                pImage->au32Sc1[u8NumChannel - 1U] |= ADC12BSARV2_CONV_COMPLETE_INT_EN_U32;
+            }
+            Adc_Pdb_BuildPartialConversionImage(pGroupPtr, pGroupDelay, CurrentChannel, u8NumChannel, pImage);
+            pImage->u8NumChannel = u8NumChannel;
+            CurrentChannel += u8NumChannel;
         }
         else
         {
-            #if (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF)
-            if((uint32)STD_ON == Adc_E_TimeoutCfg.state)
-            {
-                Dem_ReportErrorStatus((Dem_EventIdType)Adc_E_TimeoutCfg.id, DEM_EVENT_STATUS_FAILED);
-            }
-            #endif /* (ADC_DISABLE_DEM_REPORT_ERROR_STATUS == STD_OFF) */
-            pStatus->Adc_UnitSelfTestStatus = (Std_ReturnType) E_NOT_OK;
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-            REG_BIT_CLEAR32(ADC12BSARV2_SC3_REG_ADDR32(Unit), ADC12BSARV2_SC3_CAL_EN_U32);
-            break;
+            pImage->u8NumChannel = 0U;
         }
     }
-    /* Clear the COCO flag */
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    (void)REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)0));
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_BIT_SET32(ADC12BSARV2_SC2_REG_ADDR32(Unit), ADC12BSARV2_SC2_ADTRG_HW_U32);
-    /* Reconfigure for SC3 and CFG1 register */
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_SC3_REG_ADDR32(Unit), u32Sc3Status);
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-    REG_WRITE32(ADC12BSARV2_CFG1_REG_ADDR32(Unit), u32Cfg1Status);
-    
-    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_10();
-
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_35();
 }
-#endif /* ADC_CALIBRATION == STD_ON */
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
 
 /**
 * @brief          Configure channels of a group
@@ -1790,6 +3918,9 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigurePartialConversion
     VAR(uint8, AUTOMATIC) u8SCRegister;
     VAR(uint32, AUTOMATIC) u32RegValue;
     P2CONST(Adc_GroupDefType, AUTOMATIC, ADC_APPL_CONST) pChannel = NULL_PTR;
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+    P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage;
+#endif
 
 #if (ADC_SETCHANNEL_API == STD_ON)
     /* Get status of channels are changed at runtime */
@@ -1809,64 +3940,79 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigurePartialConversion
     pChannel = pGroupPtr->pAssignment;
 #endif
 
-    /* Configure channels from current to (last channel - 1) */
-    for(u8SCRegister = 0U; u8SCRegister < (u8NumChannel - 1U); u8SCRegister++)
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+    pImage = Adc_Adc12bsarv2_GetRegisterImage(Group, CurrentChannel, u8NumChannel);
+    if (NULL_PTR != pImage)
     {
-        /* Logical channel ID */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        Channel = pChannel[(CurrentChannel + u8SCRegister)];
-
-#if (ADC_SETCHANNEL_API == STD_ON)
-        /* Channel was changed? */
-        if (1U == (u32TempMask & 1U))
-#endif
+        for(u8SCRegister = 0U; u8SCRegister < u8NumChannel; u8SCRegister++)
         {
-            /* Hardware channel ID */
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-            HwChannel = Adc_pCfgPtr->pChannels[Unit][Channel].ChId;
-
-            /* Disable interrupt all channels not the last channel */
-            u32RegValue = ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | (HwChannel & ADC12BSARV2_ADCH_MASK_U32);
             /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
             /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-            REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), u32RegValue);
-        }
-#if (ADC_SETCHANNEL_API == STD_ON)
-        u32TempMask = u32TempMask >> 1U;
-        /* There are no channels changed then break out the loop */
-        if (0U == u32TempMask)
-        {
-            break;
+            REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), pImage->au32Sc1[u8SCRegister]);
         }
-#endif
     }
+    else
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+    {
+        /* Configure channels from current to (last channel - 1) */
+        for(u8SCRegister = 0U; u8SCRegister < (u8NumChannel - 1U); u8SCRegister++)
+        {
+            /* Logical channel ID */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            Channel = pChannel[(CurrentChannel + u8SCRegister)];
 
-    /* Configure last channel */
 #if (ADC_SETCHANNEL_API == STD_ON)
-    /* Last channel was changed? */
-    if (1U == (u32TempMask & 1U))
+            /* Channel was changed? */
+            if (1U == (u32TempMask & 1U))
 #endif
-    {
-        /* Get channel ID */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        Channel = pChannel[(CurrentChannel + u8SCRegister)];
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        HwChannel = Adc_pCfgPtr->pChannels[Unit][Channel].ChId;
+            {
+                /* Hardware channel ID */
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                HwChannel = Adc_pCfgPtr->pChannels[Unit][Channel].ChId;
 
-        /* In case of group is configured with interrupt, the complete int bit of the last channel must be enabled */
-        if((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt)
-        {
-            u32RegValue = ADC12BSARV2_CONV_COMPLETE_INT_EN_U32 | (HwChannel & ADC12BSARV2_ADCH_MASK_U32);
+                /* Disable interrupt all channels not the last channel */
+                u32RegValue = ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | (HwChannel & ADC12BSARV2_ADCH_MASK_U32);
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+                REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), u32RegValue);
+            }
+#if (ADC_SETCHANNEL_API == STD_ON)
+            u32TempMask = u32TempMask >> 1U;
+            /* There are no channels changed then break out the loop */
+            if (0U == u32TempMask)
+            {
+                break;
+            }
+#endif
         }
-        else
+
+        /* Configure last channel */
+#if (ADC_SETCHANNEL_API == STD_ON)
+        /* Last channel was changed? */
+        if (1U == (u32TempMask & 1U))
+#endif
         {
-            u32RegValue = ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | (HwChannel & ADC12BSARV2_ADCH_MASK_U32);
-        }
+            /* Get channel ID */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            Channel = pChannel[(CurrentChannel + u8SCRegister)];
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+            HwChannel = Adc_pCfgPtr->pChannels[Unit][Channel].ChId;
 
-        /* Update register */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-        REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), u32RegValue);
+            /* In case of group is configured with interrupt, the complete int bit of the last channel must be enabled */
+            if((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt)
+            {
+                u32RegValue = ADC12BSARV2_CONV_COMPLETE_INT_EN_U32 | (HwChannel & ADC12BSARV2_ADCH_MASK_U32);
+            }
+            else
+            {
+                u32RegValue = ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | (HwChannel & ADC12BSARV2_ADCH_MASK_U32);
+            }
+
+            /* Update register */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+            REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), u32RegValue);
+        }
     }
 
 #if ((ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF) || (ADC_SETCHANNEL_API == STD_ON))
@@ -1884,8 +4030,17 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigurePartialConversion
      Adc_aUnitStatus[Unit].u8Sc1Used = u8NumChannel;
 
      /* Start software trigger through PDB or enable PDB hardware trigger */
-     /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-     Adc_Pdb_ConfigurePartialConversion(Unit, Group, pGroupPtr, Trigger, CurrentChannel, u8NumChannel);
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+    if (NULL_PTR != pImage)
+    {
+        Adc_Pdb_LoadPartialConversionImage(Unit, pGroupPtr, Trigger, pImage);
+    }
+    else
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        Adc_Pdb_ConfigurePartialConversion(Unit, Group, pGroupPtr, Trigger, CurrentChannel, u8NumChannel);
+    }
     
     /* Update current channel */
     Adc_aGroupStatus[Group].CurrentChannel += u8NumChannel;
@@ -1914,6 +4069,12 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigureDmaPartialConversion
     P2VAR(Adc_ValueGroupType, AUTOMATIC, ADC_APPL_DATA) pResult = NULL_PTR;
 #endif /* (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF)  */
     P2CONST(Adc_GroupDefType, AUTOMATIC, ADC_APPL_CONST) pChannel = NULL_PTR;
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+    P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage;
+#endif
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON) && (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF)
+    VAR(boolean, AUTOMATIC) bChained = (boolean)FALSE;
+#endif
 #if (ADC_SETCHANNEL_API == STD_ON)
     VAR(uint32, AUTOMATIC) u32TempMask = Adc_aRuntimeGroupChannel[Group].u32Mask;
 #endif
@@ -1926,33 +4087,49 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigureDmaPartialConversion
     pChannel = pGroupPtr->pAssignment;
 #endif
 
-    /* Disable interrupt for all used channels */
-    /* Interrupt will be generated through MCL module */
-    for(u8SCRegister = 0U; u8SCRegister < u8NumChannel; u8SCRegister++)
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+    pImage = Adc_Adc12bsarv2_GetRegisterImage(Group, CurrentChannel, u8NumChannel);
+    if (NULL_PTR != pImage)
     {
-#if (ADC_SETCHANNEL_API == STD_ON)
-        /* Channel was changed? */
-        if (1U == (u32TempMask & 1U))
-#endif
+        /* Interrupt will be generated through MCL module */
+        for(u8SCRegister = 0U; u8SCRegister < u8NumChannel; u8SCRegister++)
         {
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-            Channel = pChannel[(CurrentChannel + u8SCRegister)];
-            /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-            HwChannel = Adc_pCfgPtr->pChannels[Unit][Channel].ChId;
-
-            u32RegValue = ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | (HwChannel & ADC12BSARV2_ADCH_MASK_U32);
             /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
             /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
-            REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), u32RegValue);
+            REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), pImage->au32Sc1[u8SCRegister] & (~ADC12BSARV2_CONV_COMPLETE_INT_EN_U32));
         }
-#if (ADC_SETCHANNEL_API == STD_ON)
-        u32TempMask = u32TempMask >> 1U;
-        /* There are no channels changed then break out the loop */
-        if (0U == u32TempMask)
+    }
+    else
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+    {
+        /* Disable interrupt for all used channels */
+        /* Interrupt will be generated through MCL module */
+        for(u8SCRegister = 0U; u8SCRegister < u8NumChannel; u8SCRegister++)
         {
-            break;
-        }
+#if (ADC_SETCHANNEL_API == STD_ON)
+            /* Channel was changed? */
+            if (1U == (u32TempMask & 1U))
+#endif
+            {
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                Channel = pChannel[(CurrentChannel + u8SCRegister)];
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+                HwChannel = Adc_pCfgPtr->pChannels[Unit][Channel].ChId;
+
+                u32RegValue = ADC12BSARV2_CONV_COMPLETE_INT_DIS_U32 | (HwChannel & ADC12BSARV2_ADCH_MASK_U32);
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
+                /** @violates @ref Adc_Adc12bsarv2_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
+                REG_WRITE32(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8SCRegister), u32RegValue);
+            }
+#if (ADC_SETCHANNEL_API == STD_ON)
+            u32TempMask = u32TempMask >> 1U;
+            /* There are no channels changed then break out the loop */
+            if (0U == u32TempMask)
+            {
+                break;
+            }
 #endif
+        }
     }
 #if (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING )
     if ((boolean)FALSE == pGroupPtr->bAdcDoubleBuffering)
@@ -1969,11 +4146,21 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigureDmaPartialConversion
 #endif
 
 #if (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF)
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+        /* The DMA itself loads the chunks after the first one */
+        if ((0U == CurrentChannel) && (NULL_PTR != pImage) && ((uint8)STD_OFF == pGroupPtr->u8AdcWithoutInterrupt))
+        {
+            bChained = Adc_Adc12bsarv2_ConfigureDmaChain(Unit, Group);
+        }
+        /* If this is not the first segment of the group, TCD must be reconfigured also */
+        if (((boolean)TRUE == bFromIsr) && ((boolean)FALSE == bChained))
+#else
         /* If this is not the first segment of the group, TCD must be reconfigured also */
         if((boolean)TRUE == bFromIsr)
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) */
         {
             /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-            pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + Adc_aGroupStatus[Group].ResultIndex + (CurrentChannel * pGroupPtr->NumSamples);
+            pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, Adc_aGroupStatus[Group].ResultIndex) + ((uint32)CurrentChannel * ADC_RESULT_CHANNEL_STRIDE(Group));
             Adc_Adc12bsarv2_aDmaTcdConfig[Unit].u32saddr = (uint32) ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)0);
             Adc_Adc12bsarv2_aDmaTcdConfig[Unit].u32num_bytes = 2UL;
             /** @violates @ref Adc_Adc12bsarv2_c_REF_9 cast from unsigned long to pointer */
@@ -1988,10 +4175,34 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_ConfigureDmaPartialConversion
 
     /* Save the Sc1Used register equal the number of channels configured */
     Adc_aUnitStatus[Unit].u8Sc1Used = u8NumChannel;
-    /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-    Adc_Pdb_ConfigurePartialConversion(Unit, Group, pGroupPtr, Trigger, CurrentChannel, u8NumChannel);
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+    if (NULL_PTR != pImage)
+    {
+        Adc_Pdb_LoadPartialConversionImage(Unit, pGroupPtr, Trigger, pImage);
+    }
+    else
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+    {
+        /** @violates @ref Adc_Adc12bsarv2_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        Adc_Pdb_ConfigurePartialConversion(Unit, Group, pGroupPtr, Trigger, CurrentChannel, u8NumChannel);
+    }
     
-    Adc_aGroupStatus[Group].CurrentChannel += u8NumChannel;
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON) && (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF)
+    if ((boolean)TRUE == bChained)
+    {
+        /* All chunks are programmed, the end of the DMA list ends the group */
+        Adc_aUnitStatus[Unit].u8Sc1Used = (uint8)ADC_NUM_SC1_N_REGISTER_USED;
+#if (ADC_SETCHANNEL_API == STD_ON)
+        Adc_aGroupStatus[Group].CurrentChannel = Adc_aRuntimeGroupChannel[Group].ChannelCount;
+#else
+        Adc_aGroupStatus[Group].CurrentChannel = pGroupPtr->AssignedChannelCount;
+#endif /* (ADC_SETCHANNEL_API == STD_ON) */
+    }
+    else
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) && (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF) */
+    {
+        Adc_aGroupStatus[Group].CurrentChannel += u8NumChannel;
+    }
     SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_01();
     
     /* Avoid compiler warning */
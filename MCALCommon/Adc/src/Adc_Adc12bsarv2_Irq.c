@@ -107,6 +107,7 @@ extern "C"{
 #endif
 
 #include "Adc_Pdb.h"
+#include "Adc_Trace.h"
 
 /*==================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
@@ -170,6 +171,27 @@ extern "C"{
     )
     #error "Software Version Numbers of Adc_Adc12bsarv2_Irq.c and Adc_Pdb.h are different"
 #endif
+
+/* Check if source file and Adc_Trace header file are from the same vendor */
+#if (ADC_AR_VENDOR_ID_ADC12BSARV2_IRQ_C != ADC_VENDOR_ID_TRACE)
+    #error "Adc_Adc12bsarv2_Irq.c and Adc_Trace.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_IRQ_C != ADC_AR_RELEASE_MAJOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_IRQ_C != ADC_AR_RELEASE_MINOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_IRQ_C != ADC_AR_RELEASE_REVISION_VERSION_TRACE) \
+    )
+    #error "AutoSar Version Numbers of Adc_Adc12bsarv2_Irq.c and Adc_Trace.h are different"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Software version */
+#if ((ADC_SW_MAJOR_VERSION_ADC12BSARV2_IRQ_C != ADC_SW_MAJOR_VERSION_TRACE) || \
+     (ADC_SW_MINOR_VERSION_ADC12BSARV2_IRQ_C != ADC_SW_MINOR_VERSION_TRACE) || \
+     (ADC_SW_PATCH_VERSION_ADC12BSARV2_IRQ_C != ADC_SW_PATCH_VERSION_TRACE) \
+    )
+    #error "Software Version Numbers of Adc_Adc12bsarv2_Irq.c and Adc_Trace.h are different"
+#endif
 /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_7 Identifier clash */
 #ifndef DISABLE_MCAL_INTERMODULE_ASR_CHECK
 /* Check if source file and SilRegMacros header file are of the same version */
@@ -277,7 +299,7 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_CheckPartialConversi
 (
     VAR(Adc_HwUnitType, AUTOMATIC) Unit,
     VAR(Adc_GroupType, AUTOMATIC) Group,
-    VAR(Adc_StreamNumSampleType, AUTOMATIC) GroupSamples
+    VAR(uint32, AUTOMATIC) u32ChannelStride
 );
 #if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
 LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_HwSwCheckNotification
@@ -305,6 +327,18 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_RestartContinuousConversion
     VAR(Adc_HwUnitType, AUTOMATIC) Unit,
     VAR(Adc_GroupType, AUTOMATIC) Group
 );
+#if (ADC_PAIRED_GROUPS == STD_ON)
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_EndPairedHalf
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_RestartSoftwareConversion
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(boolean, AUTOMATIC) bPairEnd
+);
 LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateSoftwareGroupState
 (
     VAR(Adc_HwUnitType, AUTOMATIC) Unit,
@@ -391,6 +425,34 @@ LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_CheckNotification
 (
     VAR(Adc_GroupType, AUTOMATIC) Group
 );
+#if ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON))
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_SampleNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON)) */
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_CallNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) EndSample,
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) SampleCount
+);
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_PostNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_CoalesceNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) EndSample,
+    P2VAR(Adc_StreamNumSampleType, AUTOMATIC, AUTOMATIC) pSampleCount
+);
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
 #endif /* (ADC_GRP_NOTIF_CAPABILITY == STD_ON) */
 #if (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF)
 LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateQueue
@@ -451,6 +513,14 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndGroupConversion
         }
     }
 
+#if (ADC_ASYNC_ABORT == STD_ON)
+    /* Results of a stopped group still converting are discarded, the queue head is the next group */
+    if ((boolean)TRUE == Adc_aUnitStatus[Unit].bAbortPending)
+    {
+        bLastChannel = (boolean)FALSE;
+    }
+#endif /* (ADC_ASYNC_ABORT == STD_ON) */
+
     if(NULL_PTR != Adc_pCfgPtr)
     {
         if ((boolean)TRUE == bLastChannel)
@@ -497,6 +567,12 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndGroupConversion
             (void)REG_READ32(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)u8ResultReg));
         }
     }
+#if (ADC_ASYNC_ABORT == STD_ON)
+    if ((boolean)TRUE == Adc_aUnitStatus[Unit].bAbortPending)
+    {
+        Adc_Adc12bsarv2_CompleteAbort(Unit, (boolean)FALSE);
+    }
+#endif /* (ADC_ASYNC_ABORT == STD_ON) */
 }
 
 /**
@@ -524,14 +600,25 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndPartialConversion
     VAR(uint8, AUTOMATIC) u8LeftChannel;
 #endif
     VAR(Adc_ChannelIndexType, AUTOMATIC) ChannelCount;
+    VAR(Std_ReturnType, AUTOMATIC) CheckRet;
     P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
 
     /* Get the group configuration */
     /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
     pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
 
-    /* Limit checking */
-    if ((Std_ReturnType)E_OK == Adc_Adc12bsarv2_CheckPartialConversion(Unit, Group, pGroupPtr->NumSamples))
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+    Adc_Adc12bsarv2_LatencyChunk(Group);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+#if (ADC_EVENT_TRACE == STD_ON)
+    Adc_Adc12bsarv2_TraceChunk(Unit, Group);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+
+    /* Limit checking, storing the results of the channels just converted */
+    ADC_RESULT_PUBLISH_BEGIN(Group);
+    CheckRet = Adc_Adc12bsarv2_CheckPartialConversion(Unit, Group, ADC_RESULT_CHANNEL_STRIDE(Group));
+    ADC_RESULT_PUBLISH_END(Group);
+    if ((Std_ReturnType)E_OK == CheckRet)
     {
     /* Get the number of channel configured in group */
     #if (ADC_SETCHANNEL_API == STD_ON)
@@ -575,7 +662,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndPartialConversion
             /* At least once the group was converted */
             Adc_aGroupStatus[Group].eAlreadyConverted = ADC_ALREADY_CONVERTED;
 
-            Adc_aGroupStatus[Group].eConversion = ADC_STREAM_COMPLETED;
+            ADC_GROUP_SET_COMPLETED(Group, ADC_STREAM_COMPLETED);
 
         #if (ADC_SETCHANNEL_API == STD_ON)
 
@@ -605,11 +692,26 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndPartialConversion
 
     #else   /* (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF) */
 
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+            ADC_RESULT_PUBLISH_BEGIN(Group);
+#else
             SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_16();
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
             /* Increment ResultIndex with modulo 'NumSamples' to remember that another sample is completed */
             Adc_aGroupStatus[Group].ResultIndex++;
-
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+            /* Publish the sample after its index, see Adc_GetSampleView */
+            Adc_aGroupStatus[Group].u32SampleSequence++;
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+            Adc_aGroupStatus[Group].u32CompletedSamples++;
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+            ADC_RESULT_PUBLISH_END(Group);
+#else
             SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_16();
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
             
             /* Update state following AutoSar diagrams */
             if ((boolean)TRUE == bNormalconversion)
@@ -639,7 +741,7 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_CheckPartialConversi
 (
     VAR(Adc_HwUnitType, AUTOMATIC) Unit,
     VAR(Adc_GroupType, AUTOMATIC) Group,
-    VAR(Adc_StreamNumSampleType, AUTOMATIC) GroupSamples
+    VAR(uint32, AUTOMATIC) u32ChannelStride
 )
 {
     VAR(Adc_ChannelIndexType, AUTOMATIC) CurrentChannel = Adc_aGroupStatus[Group].CurrentChannel;
@@ -675,7 +777,7 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_CheckPartialConversi
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
         u32AdcDataMask = Adc_pCfgPtr->pAdc[HwIndex].u32AdcDataMask;
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + Adc_aGroupStatus[Group].ResultIndex;
+        pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, Adc_aGroupStatus[Group].ResultIndex);
         /* For each of channels in the list of previous configuration, read data and take result into user buffer */
         for(Index = Temp; Index < CurrentChannel; Index++)
         {
@@ -685,7 +787,13 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_CheckPartialConversi
 #if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
             /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
             HwChannel = Adc_pCfgPtr->pGroups[Group].pAssignment[Index];
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
+            /* COCO is only set for conversions in range when the compare function is programmed.
+               The rounds it discards raise no interrupt, so bLimitCheckFailed is left as it is */
+            if (((boolean)TRUE == pGroupPtr->bAdcGroupLimitcheck) && ((boolean)FALSE == Adc_aGroupStatus[Group].bHwCompare))
+#else
             if ((boolean)TRUE == pGroupPtr->bAdcGroupLimitcheck)
+#endif /* (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) */
             {
                 /* ADC446, ADC447 */
                 bFlag = (boolean)Adc_CheckConversionValuesInRange((uint16)u32AdcDataValue, Unit, HwChannel);
@@ -694,7 +802,7 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_CheckPartialConversi
                     /**
                     * @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic
                     */
-                    *(pResult+((Index)*(GroupSamples))) = (uint16)(u32AdcDataValue & u32AdcDataMask);
+                    *(pResult + ((uint32)Index * u32ChannelStride)) = (uint16)(u32AdcDataValue & u32AdcDataMask);
                     Adc_aGroupStatus[Group].bLimitCheckFailed = (boolean)FALSE;
                 }
                 else
@@ -710,13 +818,13 @@ LOCAL_INLINE FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_CheckPartialConversi
                 /**
                 * @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic
                 */
-                *(pResult + ((Index) * GroupSamples)) = (uint16)(u32AdcDataValue & u32AdcDataMask);
+                *(pResult + ((uint32)Index * u32ChannelStride)) = (uint16)(u32AdcDataValue & u32AdcDataMask);
             }
 #else
             /**
             * @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic
             */
-            *(pResult + ((Index) * GroupSamples)) = (uint16)(u32AdcDataValue & u32AdcDataMask);
+            *(pResult + ((uint32)Index * u32ChannelStride)) = (uint16)(u32AdcDataValue & u32AdcDataMask);
 #endif /* ADC_ENABLE_LIMIT_CHECK == STD_ON */
         }
     }
@@ -740,15 +848,43 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_HwSwCheckNotification
 )
 {
     VAR(boolean, AUTOMATIC)  bCallNotification = (boolean)FALSE;
+#if ((ADC_EXTENDED_NOTIFICATION == STD_ON) || (ADC_NOTIFICATION_COALESCING == STD_ON))
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) EndSample;
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) SampleCount = 1U;
+
+    /* The latest sample is the last of the buffer when ResultIndex restarted from its base */
+    EndSample = Adc_aGroupStatus[Group].ResultIndex;
+    if ((Adc_StreamNumSampleType)0U == EndSample)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        EndSample = Adc_pCfgPtr->pGroups[Group].NumSamples;
+    }
+#endif /* ((ADC_EXTENDED_NOTIFICATION == STD_ON) || (ADC_NOTIFICATION_COALESCING == STD_ON)) */
 
     /* Check if notification function */
     bCallNotification = Adc_Adc12bsarv2_CheckNotification(Group);
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+    /* The batch is counted also while the notification is disabled */
+    if ((boolean)FALSE == Adc_Adc12bsarv2_CoalesceNotification(Group, EndSample, &SampleCount))
+    {
+        bCallNotification = (boolean)FALSE;
+    }
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
 
     if ((boolean)TRUE == bCallNotification)
     {
+#if (ADC_DEFERRED_NOTIFICATION == STD_OFF) && ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON))
+        Adc_Adc12bsarv2_SampleNotification(Group);
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_OFF) && ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON)) */
         /* Execute notification function */
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+        Adc_Adc12bsarv2_CallNotification(Group, EndSample, SampleCount);
+#elif (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        Adc_Adc12bsarv2_PostNotification(Group);
+#else
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
         Adc_pCfgPtr->pGroups[Group].Notification();
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
     }
 }
 #endif
@@ -763,6 +899,9 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateLimitCheckFailed
     VAR(boolean, AUTOMATIC) bNormalconversion
 )
 {
+#if (ADC_EVENT_TRACE == STD_ON)
+    Adc_Trace_Record(ADC_TRACE_EV_LIMIT_FAIL_U8, Unit, (uint16)Group, (uint16)Adc_aGroupStatus[Group].CurrentChannel);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
     if ((boolean)TRUE == bNormalconversion)
     {
         /* Group configured as one-shot mode and limit checking failed will be stop */
@@ -885,6 +1024,95 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_RestartContinuousConversion
     }
 }
 
+#if (ADC_PAIRED_GROUPS == STD_ON)
+/**
+* @brief          This function records the end of the current sample of one half of a pair.
+* @details        The half ending first marks itself done, the half ending last clears the mark
+*                 of its partner and restarts and notifies for both.
+*
+* @param[in]      Group           ADC group number
+*
+* @return         boolean
+* @retval         TRUE            The group is not paired or both halves have ended the sample.
+* @retval         FALSE           The partner has not ended the sample yet.
+*
+*/
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_EndPairedHalf
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    VAR(boolean, AUTOMATIC) bPairEnd = (boolean)TRUE;
+    /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    VAR(Adc_GroupType, AUTOMATIC) Partner = Adc_pCfgPtr->pGroups[Group].PairedGroup;
+
+    if (ADC_NO_PAIRED_GROUP != Partner)
+    {
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_36();
+        if ((boolean)TRUE == Adc_aGroupStatus[Partner].bPairHalfDone)
+        {
+            Adc_aGroupStatus[Partner].bPairHalfDone = (boolean)FALSE;
+        }
+        else
+        {
+            Adc_aGroupStatus[Group].bPairHalfDone = (boolean)TRUE;
+            bPairEnd = (boolean)FALSE;
+        }
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_36();
+    }
+
+    return bPairEnd;
+}
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+
+/**
+* @brief          This function starts the next sample of a software triggered group
+* @details        A paired group is restarted together with its partner by the half ending the
+*                 sample last, with both PDB counters triggered at once.
+*
+* @param[in]      Unit            ADC hardware unit
+* @param[in]      Group           ADC group number
+* @param[in]      bPairEnd        Result of Adc_Adc12bsarv2_EndPairedHalf for the sample
+*
+* @return         void
+*
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_RestartSoftwareConversion
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(boolean, AUTOMATIC) bPairEnd
+)
+{
+#if (ADC_PAIRED_GROUPS == STD_ON)
+    /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    VAR(Adc_GroupType, AUTOMATIC) Partner = Adc_pCfgPtr->pGroups[Group].PairedGroup;
+    VAR(Adc_HwUnitType, AUTOMATIC) PartnerUnit;
+
+    if (ADC_NO_PAIRED_GROUP == Partner)
+    {
+        Adc_Adc12bsarv2_RestartContinuousConversion(Unit, Group);
+    }
+    else if ((boolean)TRUE == bPairEnd)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        PartnerUnit = Adc_pCfgPtr->pGroups[Partner].HwUnit;
+        Adc_aUnitStatus[Unit].bPdbTriggerHeld = (boolean)TRUE;
+        Adc_aUnitStatus[PartnerUnit].bPdbTriggerHeld = (boolean)TRUE;
+        Adc_Adc12bsarv2_RestartContinuousConversion(Unit, Group);
+        Adc_Adc12bsarv2_RestartContinuousConversion(PartnerUnit, Partner);
+        Adc_Pdb_StartPairedConversion(Unit, PartnerUnit);
+    }
+    else
+    {
+        /* Restarted by the partner when it ends the sample */
+    }
+#else
+    (void)bPairEnd;
+    Adc_Adc12bsarv2_RestartContinuousConversion(Unit, Group);
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+}
+
 /**
 * @brief          This function update state of software conversion according to AutoSar diagrams
 * @details        This function update state of software conversion according to AutoSar diagrams
@@ -906,23 +1134,31 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateSoftwareGroupState
     VAR(Adc_StreamNumSampleType, AUTOMATIC) GroupSamples
 )
 {
+    VAR(boolean, AUTOMATIC) bPairEnd = (boolean)TRUE;
+
     /* At least once the group was converted */
     /* It's already check for validation */
     Adc_aGroupStatus[Group].eAlreadyConverted = ADC_ALREADY_CONVERTED;
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    Adc_Adc12bsarv2_ClockEndConversion(Unit, Group);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
+#if (ADC_PAIRED_GROUPS == STD_ON)
+    bPairEnd = Adc_Adc12bsarv2_EndPairedHalf(Group);
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
 
     
     SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_31();
     /* Change when configuration is ADC streaming access mode */
     if(ADC_BUSY == Adc_aGroupStatus[Group].eConversion)
     {
-        Adc_aGroupStatus[Group].eConversion = ADC_COMPLETED;
+        ADC_GROUP_SET_COMPLETED(Group, ADC_COMPLETED);
     }
 
     /* If buffer is full of samples */
     if (Adc_aGroupStatus[Group].ResultIndex >= GroupSamples)
     {
         /* Change to stream complete according to AutoSar diagram */
-        Adc_aGroupStatus[Group].eConversion = ADC_STREAM_COMPLETED;
+        ADC_GROUP_SET_COMPLETED(Group, ADC_STREAM_COMPLETED);
 
         
         SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_31();
@@ -936,7 +1172,14 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateSoftwareGroupState
             
             #if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
             /* Check user notification function and execute if available */
+            #if (ADC_PAIRED_GROUPS == STD_ON)
+            if ((boolean)TRUE == bPairEnd)
+            {
+                Adc_Adc12bsarv2_HwSwCheckNotification(ADC_PAIR_NOTIFY_GROUP(Group));
+            }
+            #else
             Adc_Adc12bsarv2_HwSwCheckNotification(Group);
+            #endif /* (ADC_PAIRED_GROUPS == STD_ON) */
             #endif /* (ADC_GRP_NOTIF_CAPABILITY == STD_ON) */
             
             /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_4 Return statement before end of function. */
@@ -950,7 +1193,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateSoftwareGroupState
             {
                 /* Restart new continuous conversion */
                 Adc_aGroupStatus[Group].ResultIndex = 0U;
-                Adc_Adc12bsarv2_RestartContinuousConversion(Unit, Group);
+                Adc_Adc12bsarv2_RestartSoftwareConversion(Unit, Group, bPairEnd);
             }
             else /* (ADC_CONV_MODE_ONESHOT == Adc_pCfgPtr->pGroups[Group].eMode) */
             {
@@ -963,12 +1206,19 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateSoftwareGroupState
     {
         SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_31();
         /* Need to restart conversion until buffer is full */
-        Adc_Adc12bsarv2_RestartContinuousConversion(Unit, Group);
+        Adc_Adc12bsarv2_RestartSoftwareConversion(Unit, Group, bPairEnd);
     }
 
     #if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
     /* Implement user notification function if available */
+    #if (ADC_PAIRED_GROUPS == STD_ON)
+    if ((boolean)TRUE == bPairEnd)
+    {
+        Adc_Adc12bsarv2_HwSwCheckNotification(ADC_PAIR_NOTIFY_GROUP(Group));
+    }
+    #else
     Adc_Adc12bsarv2_HwSwCheckNotification(Group);
+    #endif /* (ADC_PAIRED_GROUPS == STD_ON) */
     #endif /* (ADC_GRP_NOTIF_CAPABILITY == STD_ON) */
     
 }
@@ -1011,12 +1261,12 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateHardwareGroupState
 
     if (ADC_BUSY == Adc_aGroupStatus[Group].eConversion)
     {
-        Adc_aGroupStatus[Group].eConversion = ADC_COMPLETED;
+        ADC_GROUP_SET_COMPLETED(Group, ADC_COMPLETED);
     }
 
     if (Adc_aGroupStatus[Group].ResultIndex >= GroupSamples)
     {
-        Adc_aGroupStatus[Group].eConversion = ADC_STREAM_COMPLETED;
+        ADC_GROUP_SET_COMPLETED(Group, ADC_STREAM_COMPLETED);
         
         SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_32();
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
@@ -1130,6 +1380,18 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndDmaPartialConversion
     pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
 #endif
 
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+    Adc_Adc12bsarv2_LatencyChunk(Group);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+#if (ADC_EVENT_TRACE == STD_ON)
+    Adc_Adc12bsarv2_TraceChunk(Unit, Group);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+
+    /* The DMA has written results of the group without the handlers: make a copy of the result
+       buffer which ran during the transfer fail its sequence check */
+    ADC_RESULT_PUBLISH_BEGIN(Group);
+    ADC_RESULT_PUBLISH_END(Group);
+
 #if (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF)
     #if (ADC_ENABLE_LIMIT_CHECK == STD_ON)
     if((Std_ReturnType)E_OK == Adc_Adc12bsarv2_TransferToInternalBuffer(Unit, Group))
@@ -1165,7 +1427,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndDmaPartialConversion
             /* At least once the group was converted */
             Adc_aGroupStatus[Group].eAlreadyConverted = ADC_ALREADY_CONVERTED;
 
-            Adc_aGroupStatus[Group].eConversion=ADC_STREAM_COMPLETED;
+            ADC_GROUP_SET_COMPLETED(Group, ADC_STREAM_COMPLETED);
         #if (ADC_SETCHANNEL_API == STD_ON)
             /* Configure new channel if channels of group updated */
             if ((boolean)TRUE == Adc_aRuntimeGroupChannel[Group].bRuntimeUpdated)
@@ -1210,7 +1472,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndDmaPartialConversion
                 /* Update group status as ADC_COMPLETE when the haft of sample transfered and ADC_STREAM_COMPLETED when all of sample transfered  */
                 if(pGroupPtr->NumSamples == u16Iter)
                 {
-                    Adc_aGroupStatus[Group].eConversion = ADC_STREAM_COMPLETED;
+                    ADC_GROUP_SET_COMPLETED(Group, ADC_STREAM_COMPLETED);
                     
                     if ((ADC_ACCESS_MODE_STREAMING == pGroupPtr->eAccessMode) && \
                         (ADC_STREAM_BUFFER_LINEAR == pGroupPtr->eBufferMode) \
@@ -1249,7 +1511,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndDmaPartialConversion
                         Mcl_DmaTcdSetSlast(Adc_Adc12bsarv2_aTcdAddress[Unit], -(sint32)((uint32)NumChannel << 2U));
                         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_13 cast from unsigned int to signed int */
                         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-                        Mcl_DmaTcdSetDlast(Adc_Adc12bsarv2_aTcdAddress[Unit], -(sint32)((((uint32)Adc_pCfgPtr->pGroups[Group].NumSamples*(uint32)NumChannel)-1U)<<1));
+                        Mcl_DmaTcdSetDlast(Adc_Adc12bsarv2_aTcdAddress[Unit], -(sint32)((((uint32)NumChannel*ADC_RESULT_CHANNEL_STRIDE(Group))-ADC_RESULT_SAMPLE_OFFSET(Group, 1U))<<1));
                         
                     }
                     else
@@ -1262,7 +1524,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndDmaPartialConversion
                 }
                 else
                 {
-                    Adc_aGroupStatus[Group].eConversion = ADC_COMPLETED;
+                    ADC_GROUP_SET_COMPLETED(Group, ADC_COMPLETED);
                 }
                 #if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
                 Adc_Adc12bsarv2_DmaCheckNotification(Group);
@@ -1271,10 +1533,25 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_EndDmaPartialConversion
             else
         #endif
             {
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+                ADC_RESULT_PUBLISH_BEGIN(Group);
+#else
                 SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_17();
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
                 /* Increment ResultIndex with modulo 'NumSamples' to remember that another sample is completed */
                 Adc_aGroupStatus[Group].ResultIndex++;
+#if (ADC_SAMPLE_VIEW_API == STD_ON)
+                /* Publish the sample after its index, see Adc_GetSampleView */
+                Adc_aGroupStatus[Group].u32SampleSequence++;
+#endif /* (ADC_SAMPLE_VIEW_API == STD_ON) */
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+                Adc_aGroupStatus[Group].u32CompletedSamples++;
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+                ADC_RESULT_PUBLISH_END(Group);
+#else
                 SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_17();
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
                 if ((boolean)TRUE == bSoftwareConversion)
                 {
                     Adc_Adc12bsarv2_DmaEndNormalConv(Unit, Group, DmaChannel, pGroupPtr);
@@ -1308,13 +1585,56 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaCheckNotification
 )
 {
     VAR(boolean, AUTOMATIC)  bCallNotification = (boolean)FALSE;
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) EndSample;
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) SampleCount = 1U;
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
+
+    /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    EndSample = Adc_aGroupStatus[Group].ResultIndex;
+#if (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING)
+    if ((boolean)TRUE == pGroupPtr->bAdcDoubleBuffering)
+    {
+        /* ResultIndex is not used: the half interrupt ends the first NumSamples - NumSamples / 2
+           samples, the major loop the rest of the buffer, or all of it without half interrupt */
+        EndSample = pGroupPtr->NumSamples - (pGroupPtr->NumSamples >> 1U);
+        SampleCount = EndSample;
+        if (ADC_STREAM_COMPLETED == Adc_aGroupStatus[Group].eConversion)
+        {
+            SampleCount = ((boolean)TRUE == pGroupPtr->bHalfInterrupt) ? (pGroupPtr->NumSamples - EndSample) : pGroupPtr->NumSamples;
+            EndSample = pGroupPtr->NumSamples;
+        }
+        Adc_aGroupStatus[Group].u32CompletedSamples += (uint32)SampleCount;
+    }
+    else
+#endif /* (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING) */
+    if ((Adc_StreamNumSampleType)0U == EndSample)
+    {
+        /* The latest sample is the last of the buffer when ResultIndex restarted from its base */
+        EndSample = pGroupPtr->NumSamples;
+    }
+    else
+    {
+        /* Latest sample before ResultIndex */
+    }
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
 
     bCallNotification = Adc_Adc12bsarv2_CheckNotification(Group);
 
     if ((boolean)TRUE == bCallNotification)
     {
+#if (ADC_DEFERRED_NOTIFICATION == STD_OFF) && ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON))
+        Adc_Adc12bsarv2_SampleNotification(Group);
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_OFF) && ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON)) */
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+        Adc_Adc12bsarv2_CallNotification(Group, EndSample, SampleCount);
+#elif (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        Adc_Adc12bsarv2_PostNotification(Group);
+#else
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
         Adc_pCfgPtr->pGroups[Group].Notification();
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
     }
 }
 #endif
@@ -1347,17 +1667,20 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaEndNormalConv
 
     /* At least once the group was converted */
     Adc_aGroupStatus[Group].eAlreadyConverted = ADC_ALREADY_CONVERTED;
+#if (ADC_ADAPTIVE_CLOCK == STD_ON)
+    Adc_Adc12bsarv2_ClockEndConversion(Unit, Group);
+#endif /* (ADC_ADAPTIVE_CLOCK == STD_ON) */
 
     if (ADC_BUSY == Adc_aGroupStatus[Group].eConversion)
     {
-        Adc_aGroupStatus[Group].eConversion = ADC_COMPLETED;
+        ADC_GROUP_SET_COMPLETED(Group, ADC_COMPLETED);
     }
 
     /* If all samples completed, wrap to 0 */
     /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
     if (Adc_aGroupStatus[Group].ResultIndex >= pGroupPtr->NumSamples)
     {
-        Adc_aGroupStatus[Group].eConversion = ADC_STREAM_COMPLETED;
+        ADC_GROUP_SET_COMPLETED(Group, ADC_STREAM_COMPLETED);
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
         if ((ADC_STREAM_BUFFER_LINEAR == pGroupPtr->eBufferMode) && \
             (ADC_ACCESS_MODE_STREAMING == pGroupPtr->eAccessMode) \
@@ -1399,7 +1722,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaEndNormalConv
     {
         Adc_Adc12bsarv2_StopDmaAndConversion(Unit, DmaChannel);
 
-        Adc_aGroupStatus[Group].eConversion = ADC_STREAM_COMPLETED;
+        ADC_GROUP_SET_COMPLETED(Group, ADC_STREAM_COMPLETED);
 
         Adc_Adc12bsarv2_UpdateQueue(Unit);
 
@@ -1483,13 +1806,13 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaEndHardwareConv
     Adc_aGroupStatus[Group].CurrentChannel = 0U;
     if (ADC_BUSY == Adc_aGroupStatus[Group].eConversion)
     {
-        Adc_aGroupStatus[Group].eConversion = ADC_COMPLETED;
+        ADC_GROUP_SET_COMPLETED(Group, ADC_COMPLETED);
     }
     /* If all samples completed, wrap to 0 */
     /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
     if (Adc_aGroupStatus[Group].ResultIndex >= pGroupPtr->NumSamples)
     {
-        Adc_aGroupStatus[Group].eConversion=ADC_STREAM_COMPLETED;
+        ADC_GROUP_SET_COMPLETED(Group, ADC_STREAM_COMPLETED);
         Adc_aGroupStatus[Group].ResultIndex = 0U;
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
         if ((ADC_ACCESS_MODE_STREAMING == pGroupPtr->eAccessMode) && \
@@ -1529,7 +1852,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaEndHardwareConv
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_9 cast from unsigned int to pointer. */
-        Adc_Adc12bsarv2_aDmaTcdConfig[Unit].u32daddr = (uint32)(Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + Adc_aGroupStatus[Group].ResultIndex);
+        Adc_Adc12bsarv2_aDmaTcdConfig[Unit].u32daddr = (uint32)(Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, Adc_aGroupStatus[Group].ResultIndex));
         Mcl_DmaConfigTcd(Adc_Adc12bsarv2_aTcdAddress[Unit], &(Adc_Adc12bsarv2_aDmaTcdConfig[Unit]));
         Mcl_DmaTcdSetFlags(Adc_Adc12bsarv2_aTcdAddress[Unit], (uint8)(DMA_TCD_DISABLE_REQ_U8 | DMA_TCD_INT_MAJOR_U8));
         SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_02();
@@ -1564,7 +1887,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaUpdateDaddr
 #endif /* (ADC_ENABLE_LIMIT_CHECK == STD_ON) */
     {
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-        pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + Adc_aGroupStatus[Group].ResultIndex;
+        pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, Adc_aGroupStatus[Group].ResultIndex);
         /* Configure the destination result address in TCD of the DMA channels */
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_9 cast from unsigned int to pointer */
         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_3 A cast should not be performed between a pointer type and an integral type. */
@@ -1592,7 +1915,7 @@ LOCAL_INLINE FUNC (Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_TransferToInternalB
     /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
     pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
     /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
-    pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + (Adc_aGroupStatus[Group].ResultIndex);
+    pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, Adc_aGroupStatus[Group].ResultIndex);
     /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
     ChIndex = Adc_pCfgPtr->pGroups[Group].pAssignment[0];
     if ((boolean)TRUE == pGroupPtr->bAdcGroupLimitcheck)
@@ -1610,7 +1933,9 @@ LOCAL_INLINE FUNC (Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_TransferToInternalB
         else
         {
             Adc_aGroupStatus[Group].bLimitCheckFailed = (boolean)FALSE;
+            ADC_RESULT_PUBLISH_BEGIN(Group);
             *(pResult) = u16ResultValue;
+            ADC_RESULT_PUBLISH_END(Group);
         }
     }
 
@@ -1626,6 +1951,9 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateDmaLimitCheckFailed
     VAR(Adc_HwTriggerTimerType, AUTOMATIC) Trigger
 )
 {
+#if (ADC_EVENT_TRACE == STD_ON)
+    Adc_Trace_Record(ADC_TRACE_EV_LIMIT_FAIL_U8, Unit, (uint16)Group, (uint16)Adc_aGroupStatus[Group].CurrentChannel);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
     /* Group with limit checking failed and one-shot mode will be stop */
     /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
     if(ADC_CONV_MODE_ONESHOT == pGroupPtr->eMode)
@@ -1660,6 +1988,33 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateDmaLimitCheckFailed
 
 #if ((defined(ADC_UNIT_0_ISR_USED)) || (defined(ADC_UNIT_1_ISR_USED)) || (defined(ADC_DMA_SUPPORTED)))
 #if (ADC_GRP_NOTIF_CAPABILITY == STD_ON)
+#if ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON))
+/**
+* @brief          This function samples the notification of a group called from the interrupt.
+* @details        Records the ADC_LATENCY_DISPATCH and ADC_LATENCY_END_TO_END intervals and the
+*                 NOTIFY trace event. A notification posted to the deferred notification queue is
+*                 sampled by Adc_Main_NotificationDispatcher when it is called.
+*
+* @param[in]      Group           The ADC channel group
+*
+* @return         void
+*
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_SampleNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+    Adc_Adc12bsarv2_LatencyNotify(Group);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+#if (ADC_EVENT_TRACE == STD_ON)
+    /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    Adc_Trace_Record(ADC_TRACE_EV_NOTIFY_U8, Adc_pCfgPtr->pGroups[Group].HwUnit, (uint16)Group, 0U);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+}
+#endif /* ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON)) */
+
 /**
 * @brief          This function checks if notification function is available or not
 * @details        This function checks if notification function is available or not
@@ -1682,13 +2037,187 @@ LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_CheckNotification
     /* If group notification enabled and notification function available, return true */
     /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
     if ((ADC_NOTIFICATION_ENABLED == Adc_aGroupStatus[Group].eNotification) && \
-        (Adc_pCfgPtr->pGroups[Group].Notification != NULL_PTR)
+        ((Adc_pCfgPtr->pGroups[Group].Notification != NULL_PTR)
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+         /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+         || (Adc_pCfgPtr->pGroups[Group].ExtendedNotification != NULL_PTR)
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+        )
        )
     {
         bCallNotification = (boolean)TRUE;
     }
     return bCallNotification;
 }
+
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+/**
+* @brief          This function calls the notification function of a group.
+* @details        The extended notification, when configured, is called instead of Notification
+*                 with the SampleCount samples of the result buffer before EndSample. Their
+*                 sequence number is taken from the completed samples count, which the caller has
+*                 already advanced past them.
+*
+* @param[in]      Group           The ADC channel group
+* @param[in]      EndSample       Index of the sample following the last completed one
+* @param[in]      SampleCount     Number of samples completed since the previous notification
+*
+* @return         void
+*
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_CallNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) EndSample,
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) SampleCount
+)
+{
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
+
+    /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    if (NULL_PTR != pGroupPtr->ExtendedNotification)
+    {
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON) && ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON))
+        /* Never deferred */
+        Adc_Adc12bsarv2_SampleNotification(Group);
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) && ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON)) */
+        /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+        pGroupPtr->ExtendedNotification(Group, \
+                                        pGroupPtr->pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, EndSample - SampleCount), \
+                                        SampleCount, \
+                                        Adc_aGroupStatus[Group].u32CompletedSamples - (uint32)SampleCount);
+    }
+    else
+    {
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        Adc_Adc12bsarv2_PostNotification(Group);
+#else
+        pGroupPtr->Notification();
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
+    }
+}
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+/**
+* @brief          This function calls or posts the notification function of a group.
+* @details        The notification of a group with bDeferredNotification is posted into the queue
+*                 of its HW unit for Adc_Main_NotificationDispatcher, once until it is taken. The
+*                 queue is written only here, from the completion interrupts of the unit or under
+*                 ADC_EXCLUSIVE_AREA_41, and the slot is written before the head index publishes it.
+*
+* @param[in]      Group           The ADC channel group
+*
+* @return         void
+*
+*/
+LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_PostNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint32, AUTOMATIC) u32Head;
+
+    /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    if ((boolean)FALSE == pGroupPtr->bDeferredNotification)
+    {
+#if ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON))
+        Adc_Adc12bsarv2_SampleNotification(Group);
+#endif /* ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON)) */
+        pGroupPtr->Notification();
+    }
+    else if ((boolean)TRUE == Adc_aGroupStatus[Group].bNotifyPending)
+    {
+        Adc_aGroupStatus[Group].NotifyStatistics.u32Merged++;
+    }
+    else
+    {
+        Unit = pGroupPtr->HwUnit;
+        u32Head = Adc_aUnitStatus[Unit].u32NotifyHead;
+        if ((u32Head - Adc_aUnitStatus[Unit].u32NotifyTail) >= (uint32)ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE)
+        {
+            Adc_aGroupStatus[Group].NotifyStatistics.u32Dropped++;
+        }
+        else
+        {
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+            /* Sampled by Adc_Main_NotificationDispatcher */
+            Adc_Adc12bsarv2_LatencyPost(Group);
+#endif /* (ADC_LATENCY_HISTOGRAMS == STD_ON) */
+            Adc_aUnitStatus[Unit].aNotifyQueue[u32Head & (ADC_DEFERRED_NOTIFICATION_QUEUE_SIZE - 1U)] = Group;
+            Adc_aGroupStatus[Group].bNotifyPending = (boolean)TRUE;
+            Adc_aUnitStatus[Unit].u32NotifyHead = u32Head + 1UL;
+            Adc_aGroupStatus[Group].NotifyStatistics.u32Posted++;
+        }
+    }
+}
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
+
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+/**
+* @brief          This function decides if a completed sample ends a notification batch.
+* @details        A group without pNotifyCoalescing is notified at each sample. Otherwise the
+*                 sample is added to the batch of the group, which ends at the end of the buffer
+*                 whatever the configuration so that its samples stay contiguous.
+*
+* @param[in]      Group           The ADC channel group
+* @param[in]      EndSample       Index of the sample following the completed one
+* @param[out]     pSampleCount    Samples of the batch, written when it ends
+*
+* @return         boolean         TRUE when the notification is due
+*
+*/
+LOCAL_INLINE FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_CoalesceNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) EndSample,
+    P2VAR(Adc_StreamNumSampleType, AUTOMATIC, AUTOMATIC) pSampleCount
+)
+{
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
+    P2CONST(Adc_NotifyCoalescingType, AUTOMATIC, ADC_APPL_CONST) pCoalescing;
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) BatchSamples;
+    VAR(boolean, AUTOMATIC) bEndBatch = (boolean)TRUE;
+
+    /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    pCoalescing = pGroupPtr->pNotifyCoalescing;
+    if (NULL_PTR != pCoalescing)
+    {
+        BatchSamples = Adc_aGroupStatus[Group].NotifyBatchSamples + 1U;
+        /* A batch left by a stopped conversion does not extend before the base of the buffer */
+        if (BatchSamples > EndSample)
+        {
+            BatchSamples = EndSample;
+        }
+        if (((Adc_StreamNumSampleType)1U == BatchSamples) && (0UL != pCoalescing->u32Window))
+        {
+            Adc_aGroupStatus[Group].u32NotifyBatchStart = ADC_GET_TIMESTAMP();
+        }
+
+        if ((EndSample < pGroupPtr->NumSamples) && \
+            (EndSample != pCoalescing->Watermark) && \
+            (((Adc_StreamNumSampleType)0U == pCoalescing->Samples) || (BatchSamples < pCoalescing->Samples)) && \
+            ((0UL == pCoalescing->u32Window) || \
+             ((ADC_GET_TIMESTAMP() - Adc_aGroupStatus[Group].u32NotifyBatchStart) < pCoalescing->u32Window)) \
+           )
+        {
+            Adc_aGroupStatus[Group].NotifyBatchSamples = BatchSamples;
+            bEndBatch = (boolean)FALSE;
+        }
+        else
+        {
+            Adc_aGroupStatus[Group].NotifyBatchSamples = 0U;
+            *pSampleCount = BatchSamples;
+        }
+    }
+    return bEndBatch;
+}
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
 #endif /* (ADC_GRP_NOTIF_CAPABILITY == STD_ON) */
 
 #if (ADC_OPTIMIZE_ONESHOT_HW_TRIGGER == STD_OFF)
@@ -1742,7 +2271,17 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Adc12bsarv2_UpdateQueue
 */
 ISR(Adc_Adc12bsarv2_EndGroupConvUnit0)
 {
-    Adc_Adc12bsarv2_EndGroupConversion((Adc_HwUnitType)ADC_UNIT_0);
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+    if ((boolean)TRUE == Adc_aUnitStatus[ADC_UNIT_0].bCalibrationOngoing)
+    {
+        /* End of the calibration started by Adc_CalibrateAsync */
+        Adc_Adc12bsarv2_CompleteCalibration((Adc_HwUnitType)ADC_UNIT_0, (boolean)FALSE);
+    }
+    else
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
+    {
+        Adc_Adc12bsarv2_EndGroupConversion((Adc_HwUnitType)ADC_UNIT_0);
+    }
 
     EXIT_INTERRUPT();
 }
@@ -1782,7 +2321,17 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaTransferComplete0()
 */
 ISR(Adc_Adc12bsarv2_EndGroupConvUnit1)
 {
-    Adc_Adc12bsarv2_EndGroupConversion((Adc_HwUnitType)ADC_UNIT_1);
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+    if ((boolean)TRUE == Adc_aUnitStatus[ADC_UNIT_1].bCalibrationOngoing)
+    {
+        /* End of the calibration started by Adc_CalibrateAsync */
+        Adc_Adc12bsarv2_CompleteCalibration((Adc_HwUnitType)ADC_UNIT_1, (boolean)FALSE);
+    }
+    else
+#endif /* (ADC_CALIBRATION_ASYNC == STD_ON) */
+    {
+        Adc_Adc12bsarv2_EndGroupConversion((Adc_HwUnitType)ADC_UNIT_1);
+    }
 
     EXIT_INTERRUPT();
 }
@@ -1806,6 +2355,101 @@ FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaTransferComplete1()
 }
 #endif /* (ADC_DMA_SUPPORTED) && (ADC_UNIT_1) */
 
+#if (ADC_NOTIFICATION_COALESCING == STD_ON)
+/**
+* @brief          This function notifies the batch a group has not completed yet.
+* @details        Called by Adc_StopGroupConversion and Adc_DisableHardwareTrigger before the
+*                 group is stopped, and with bWindow by Adc_MainFunction, which notifies only a
+*                 batch whose u32Window has passed. The batch is taken from the interrupts of the
+*                 unit under ADC_EXCLUSIVE_AREA_41. The notification is called after it, in the
+*                 context of the caller: the stop turns the notification off before
+*                 Adc_Main_NotificationDispatcher could call it. Only the main function posts the
+*                 notification of a group with bDeferredNotification, in the exclusive area as the
+*                 interrupts post to the same queue.
+*
+* @param[in]      Group           The ADC channel group
+* @param[in]      bWindow         TRUE to notify the batch only once its u32Window has passed
+*
+* @return         void
+*
+* @violates @ref Adc_Adc12bsarv2_Irq_c_REF_11 External linkage.
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_FlushNotification
+(
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    VAR(boolean, AUTOMATIC) bWindow
+)
+{
+#if ((defined(ADC_UNIT_0_ISR_USED)) || (defined(ADC_UNIT_1_ISR_USED)) || (defined(ADC_DMA_SUPPORTED)))
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr; /* Pointer to AdcGroup */
+    P2CONST(Adc_NotifyCoalescingType, AUTOMATIC, ADC_APPL_CONST) pCoalescing;
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) EndSample = 0U;
+    VAR(Adc_StreamNumSampleType, AUTOMATIC) SampleCount;
+    VAR(boolean, AUTOMATIC) bCallNotification = (boolean)FALSE;
+
+    /** @violates @ref Adc_Adc12bsarv2_Irq_c_REF_8 Array indexing shall be the only allowed form of pointer arithmetic */
+    pGroupPtr = &(Adc_pCfgPtr->pGroups[Group]);
+    pCoalescing = pGroupPtr->pNotifyCoalescing;
+    if ((NULL_PTR != pCoalescing) && (((boolean)FALSE == bWindow) || (0UL != pCoalescing->u32Window)))
+    {
+        SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_41();
+        SampleCount = Adc_aGroupStatus[Group].NotifyBatchSamples;
+        if (((Adc_StreamNumSampleType)0U != SampleCount) && \
+            (((boolean)FALSE == bWindow) || \
+             ((ADC_GET_TIMESTAMP() - Adc_aGroupStatus[Group].u32NotifyBatchStart) >= pCoalescing->u32Window)) \
+           )
+        {
+            Adc_aGroupStatus[Group].NotifyBatchSamples = 0U;
+            /* The latest sample is the last of the buffer when ResultIndex restarted from its base */
+            EndSample = Adc_aGroupStatus[Group].ResultIndex;
+            if ((Adc_StreamNumSampleType)0U == EndSample)
+            {
+                EndSample = pGroupPtr->NumSamples;
+            }
+            bCallNotification = Adc_Adc12bsarv2_CheckNotification(Group);
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+            if (((boolean)TRUE == bCallNotification) && ((boolean)TRUE == bWindow) && \
+                ((boolean)TRUE == pGroupPtr->bDeferredNotification)
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+                && (NULL_PTR == pGroupPtr->ExtendedNotification)
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+               )
+            {
+                Adc_Adc12bsarv2_PostNotification(Group);
+                bCallNotification = (boolean)FALSE;
+            }
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_ON) */
+        }
+        SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_41();
+
+        if ((boolean)TRUE == bCallNotification)
+        {
+#if (ADC_EXTENDED_NOTIFICATION == STD_ON)
+            if (NULL_PTR != pGroupPtr->ExtendedNotification)
+            {
+#if (ADC_DEFERRED_NOTIFICATION == STD_OFF) && ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON))
+                Adc_Adc12bsarv2_SampleNotification(Group);
+#endif /* (ADC_DEFERRED_NOTIFICATION == STD_OFF) && ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON)) */
+                Adc_Adc12bsarv2_CallNotification(Group, EndSample, SampleCount);
+            }
+            else
+#endif /* (ADC_EXTENDED_NOTIFICATION == STD_ON) */
+            {
+#if ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON))
+                Adc_Adc12bsarv2_SampleNotification(Group);
+#endif /* ((ADC_LATENCY_HISTOGRAMS == STD_ON) || (ADC_EVENT_TRACE == STD_ON)) */
+                pGroupPtr->Notification();
+            }
+        }
+    }
+#else
+    /* No batch without the end of conversion interrupts */
+    (void)Group;
+    (void)bWindow;
+#endif /* ((defined(ADC_UNIT_0_ISR_USED)) || (defined(ADC_UNIT_1_ISR_USED)) || (defined(ADC_DMA_SUPPORTED))) */
+}
+#endif /* (ADC_NOTIFICATION_COALESCING == STD_ON) */
+
 #define ADC_STOP_SEC_CODE
 /**
  * @violates @ref Adc_Adc12bsarv2_Irq_c_REF_1 only preprocessor statements and comments before "#include"
@@ -0,0 +1,765 @@
+/**
+*   @file    Adc_Adc12bsarv2_Sched.c
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - ADC12BSARV2 conversion time and schedulability analysis.
+*   @details Host side analysis of a driver configuration. The end-to-end time of each group is
+*            derived from its conversion timing, its chunks of ADC_NUM_SC1_N_REGISTER_USED
+*            channels and the PDB pre-trigger delays and back-to-back chains programmed by
+*            Adc_Pdb_ConfigurePartialConversion. The release periods of the groups are then
+*            checked against each unit with a response time analysis of the software queue.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Adc12bsarv2_Sched_c_REF_1
+* Violates MISRA 2004 Advisory Rule 19.1, only preprocessor statements and comments before "#include"
+* This violation is not fixed since the inclusion of MemMap.h is as per Autosar requirement.
+*
+* @section Adc_Adc12bsarv2_Sched_c_REF_2
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Adc12bsarv2_Sched_c_REF_3
+* Violates MISRA 2004 Required Rule 1.4, The compiler/linker shall be checked to ensure that
+* 31 characters significance and case sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section Adc_Adc12bsarv2_Sched_c_REF_4
+* Violates MISRA 2004 Required Rule 17.4, Array indexing shall be the only allowed form of pointer
+* arithmetic. The configuration tables are accessed through the pointers of the configuration.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Adc_Adc12bsarv2_Sched.h"
+#include "Adc_Adc12bsarv2.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_ADC12BSARV2_SCHED_C                    43
+/** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SCHED_C     4
+/** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SCHED_C     2
+/** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SCHED_C  2
+#define ADC_SW_MAJOR_VERSION_ADC12BSARV2_SCHED_C             1
+#define ADC_SW_MINOR_VERSION_ADC12BSARV2_SCHED_C             0
+#define ADC_SW_PATCH_VERSION_ADC12BSARV2_SCHED_C             3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if source file and Adc_Adc12bsarv2_Sched header file are of the same vendor */
+#if (ADC_VENDOR_ID_ADC12BSARV2_SCHED_C != ADC_VENDOR_ID_ADC12BSARV2_SCHED)
+    #error "Adc_Adc12bsarv2_Sched.c and Adc_Adc12bsarv2_Sched.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Adc12bsarv2_Sched header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SCHED_C != ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SCHED) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SCHED_C != ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SCHED) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SCHED_C != ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SCHED) \
+    )
+    #error "AutoSar Version Numbers of Adc_Adc12bsarv2_Sched.c and Adc_Adc12bsarv2_Sched.h are different"
+#endif
+
+/* Check if source file and Adc_Adc12bsarv2_Sched header file are of the same Software version */
+#if ((ADC_SW_MAJOR_VERSION_ADC12BSARV2_SCHED_C != ADC_SW_MAJOR_VERSION_ADC12BSARV2_SCHED) || \
+     (ADC_SW_MINOR_VERSION_ADC12BSARV2_SCHED_C != ADC_SW_MINOR_VERSION_ADC12BSARV2_SCHED) || \
+     (ADC_SW_PATCH_VERSION_ADC12BSARV2_SCHED_C != ADC_SW_PATCH_VERSION_ADC12BSARV2_SCHED) \
+    )
+    #error "Software Version Numbers of Adc_Adc12bsarv2_Sched.c and Adc_Adc12bsarv2_Sched.h are different"
+#endif
+
+#ifdef MCAL_REG_SIMULATION
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/** @brief Pre-triggers of a PDB channel, one SC1n each */
+#define ADC_SCHED_PRETRIGGERS_U8            ((uint8)8U)
+
+/** @brief No SC1n selected */
+#define ADC_SCHED_NO_SLOT_U8                ((uint8)0xFFU)
+
+/** @brief States of an SC1n while a chunk is replayed */
+#define ADC_SCHED_DELAYED_U8                ((uint8)0U)
+#define ADC_SCHED_CHAINED_U8                ((uint8)1U)
+#define ADC_SCHED_PENDING_U8                ((uint8)2U)
+#define ADC_SCHED_CONVERTING_U8             ((uint8)3U)
+#define ADC_SCHED_DONE_U8                   ((uint8)4U)
+#define ADC_SCHED_LOST_U8                   ((uint8)5U)
+
+/** @brief Utilization of a unit which is never released */
+#define ADC_SCHED_FULL_LOAD_U32             ((uint32)1000UL)
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/**
+ * @violates @ref Adc_Adc12bsarv2_Sched_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Adc12bsarv2_Sched_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+static FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sched_Saturate
+(
+    VAR(uint64, AUTOMATIC) u64Cycles
+);
+
+static FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sched_ConversionCycles
+(
+    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfg,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr
+);
+
+static FUNC(uint64, ADC_CODE) Adc_Adc12bsarv2_Sched_PdbCycles
+(
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    VAR(uint32, AUTOMATIC) u32CountClocks,
+    VAR(uint16, AUTOMATIC) u16Delay
+);
+
+static FUNC(uint64, ADC_CODE) Adc_Adc12bsarv2_Sched_ChunkCycles
+(
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr,
+    VAR(Adc_ChannelIndexType, AUTOMATIC) FirstChannel,
+    VAR(uint8, AUTOMATIC) u8NumChannel,
+    VAR(uint32, AUTOMATIC) u32Conversion,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    VAR(uint32, AUTOMATIC) u32CountClocks,
+    P2VAR(Adc_Adc12bsarv2_SchedGroupType, AUTOMATIC, ADC_APPL_DATA) pTiming
+);
+
+static FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sched_ResponseCycles
+(
+    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfg,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    P2CONST(Adc_Adc12bsarv2_SchedReportType, AUTOMATIC, ADC_APPL_CONST) pReport,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          Clips a cycle count to the range of the report.
+*
+* @return         uint32      u64Cycles, ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 if it does not fit.
+*/
+static FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sched_Saturate
+(
+    VAR(uint64, AUTOMATIC) u64Cycles
+)
+{
+    VAR(uint32, AUTOMATIC) u32Cycles = ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32;
+
+    if (u64Cycles < (uint64)ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32)
+    {
+        u32Cycles = (uint32)u64Cycles;
+    }
+    return u32Cycles;
+}
+
+/**
+* @brief          Duration of one conversion of a group.
+* @details        Resolves the CFG1, CFG2 and SC3 values Adc_Adc12bsarv2_StartNormalConversion
+*                 leaves in the unit for the group: the unit registers with
+*                 ADC_SET_ADC_CONV_TIME_ONCE, the timing fields of the group otherwise, in the
+*                 clock mode of the analysis. The resolution always comes from the unit CFG1.
+*
+* @return         uint32      Conversion time in ADC input clock cycles.
+*/
+static FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sched_ConversionCycles
+(
+    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfg,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr
+)
+{
+    /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, AUTOMATIC, ADC_APPL_CONST) pUnitPtr = &pCfg->pAdc[pCfg->Misc.aHwLogicalId[pGroupPtr->HwUnit]];
+    VAR(uint32, AUTOMATIC) u32Cfg1 = pUnitPtr->u32AdcCfg1Register;
+    VAR(uint32, AUTOMATIC) u32Cfg2;
+    VAR(uint32, AUTOMATIC) u32Sc3;
+
+#if (STD_ON == ADC_SET_ADC_CONV_TIME_ONCE)
+    u32Cfg2 = pUnitPtr->u32AdcCfg2Register;
+    u32Sc3 = pUnitPtr->u32AdcSc3Register;
+#if (ADC_DUAL_CLOCK_MODE == STD_ON)
+    if (ADC_ALTERNATE == pParam->eClockMode)
+    {
+        u32Cfg1 = (u32Cfg1 & (~ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32)) | \
+                  (pUnitPtr->u32AdcCfg1RegisterAlternate & ADC12BSARV2_CFG1_SET_CLOCKMODE_MASK_U32);
+        u32Cfg2 = pUnitPtr->u32AdcCfg2RegisterAlternate;
+        u32Sc3 = pUnitPtr->u32AdcSc3RegisterAlternate;
+    }
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+#else
+#if (ADC_DUAL_CLOCK_MODE == STD_ON)
+    if (ADC_ALTERNATE == pParam->eClockMode)
+    {
+        u32Cfg1 = (u32Cfg1 & (~ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32)) | (pGroupPtr->u32ClockDivideSelectAlternate & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32);
+        u32Cfg2 = pGroupPtr->u32SampleTimeAlternate;
+        u32Sc3 = pGroupPtr->u32AvgSelectAlternate;
+    }
+    else
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+    {
+        u32Cfg1 = (u32Cfg1 & (~ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32)) | (pGroupPtr->u32ClockDivideSelect & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32);
+        u32Cfg2 = pGroupPtr->u32SampleTime;
+        u32Sc3 = pGroupPtr->u32AvgSelect;
+    }
+#endif /* (STD_ON == ADC_SET_ADC_CONV_TIME_ONCE) */
+#if (ADC_DUAL_CLOCK_MODE == STD_OFF)
+    (void)pParam;
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_OFF) */
+
+    return ADC_ADC12BSARV2_SCHED_CONVERSION_CYCLES(u32Cfg1, u32Cfg2, u32Sc3, pParam->u32ConversionAdder);
+}
+
+/**
+* @brief          Time from the PDB trigger to a pre-trigger delay.
+* @details        Same conversion as ADC_ADC12BSARV2_SCHED_PDB_DELAY_CYCLES, on 64 bits: the delay
+*                 is counted on the PDB input clock and the conversion starts on the next ADC input
+*                 clock cycle.
+*
+* @param[in]      pParam          Analysis inputs, the clock frequencies are used.
+* @param[in]      u32CountClocks  PDB input clock cycles of one PDB count.
+* @param[in]      u16Delay        Delay in PDB counts.
+*
+* @return         uint64          Delay in ADC input clock cycles, rounded up.
+*/
+static FUNC(uint64, ADC_CODE) Adc_Adc12bsarv2_Sched_PdbCycles
+(
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    VAR(uint32, AUTOMATIC) u32CountClocks,
+    VAR(uint16, AUTOMATIC) u16Delay
+)
+{
+    VAR(uint64, AUTOMATIC) u64PdbClocks = (uint64)u16Delay * (uint64)u32CountClocks;
+
+    return ((u64PdbClocks * (uint64)pParam->u32AdcClockHz) + (uint64)pParam->u32PdbClockHz - 1ULL) / (uint64)pParam->u32PdbClockHz;
+}
+
+/**
+* @brief          Time from the PDB trigger of a chunk to its last end of conversion.
+* @details        Replays the pre-triggers as Adc_Pdb_ConfigurePartialConversion programs them:
+*                 pre-trigger 0 of each PDB channel at its CHnDLY0 delay, or with the trigger
+*                 when its delay is not selected, and the other pre-triggers at their own delay or
+*                 back-to-back on the conversion complete of the previous one. At a conversion
+*                 complete the ADC first starts the lowest SC1n already pending, then the
+*                 back-to-back successor is asserted; delayed pre-triggers reaching their delay at
+*                 the same time follow, the highest one first. A pre-trigger asserted while its PDB
+*                 channel waits for a conversion complete raises a sequence error and is lost.
+*                 Only the last SC1n of the chunk raises the interrupt that ends it, so a chunk
+*                 where it completes before another SC1n is reported as a chunk order error.
+*
+* @param[in]      pGroupPtr       Group configuration.
+* @param[in]      FirstChannel    Index of the first channel of the chunk in the group.
+* @param[in]      u8NumChannel    Channels of the chunk.
+* @param[in]      u32Conversion   Duration of one conversion.
+* @param[in]      pParam          Analysis inputs, the clock frequencies are used.
+* @param[in]      u32CountClocks  PDB input clock cycles of one PDB count.
+* @param[in,out]  pTiming         bSequenceError and bChunkOrderError are set to TRUE on the
+*                                 respective error, left unchanged otherwise.
+*
+* @return         uint64          Chunk time in ADC input clock cycles.
+*/
+static FUNC(uint64, ADC_CODE) Adc_Adc12bsarv2_Sched_ChunkCycles
+(
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr,
+    VAR(Adc_ChannelIndexType, AUTOMATIC) FirstChannel,
+    VAR(uint8, AUTOMATIC) u8NumChannel,
+    VAR(uint32, AUTOMATIC) u32Conversion,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    VAR(uint32, AUTOMATIC) u32CountClocks,
+    P2VAR(Adc_Adc12bsarv2_SchedGroupType, AUTOMATIC, ADC_APPL_DATA) pTiming
+)
+{
+    VAR(uint64, AUTOMATIC) au64Release[ADC_NUM_SC1_N_REGISTER_USED];
+    VAR(uint8, AUTOMATIC) au8State[ADC_NUM_SC1_N_REGISTER_USED];
+    VAR(uint64, AUTOMATIC) u64Now = 0ULL;
+    VAR(uint64, AUTOMATIC) u64Free = 0ULL;
+    VAR(uint64, AUTOMATIC) u64Last = 0ULL;
+    VAR(uint16, AUTOMATIC) u16Delay;
+    VAR(uint8, AUTOMATIC) u8Slot;
+    VAR(uint8, AUTOMATIC) u8Other;
+    VAR(uint8, AUTOMATIC) u8Next;
+    VAR(uint8, AUTOMATIC) u8Current = ADC_SCHED_NO_SLOT_U8;
+    VAR(uint8, AUTOMATIC) u8Asserted;
+    VAR(uint8, AUTOMATIC) u8PdbChannel;
+    VAR(uint8, AUTOMATIC) u8PreTrigger;
+
+    for (u8Slot = 0U; u8Slot < u8NumChannel; u8Slot++)
+    {
+        u8PdbChannel = (uint8)(u8Slot / ADC_SCHED_PRETRIGGERS_U8);
+        u8PreTrigger = (uint8)(u8Slot % ADC_SCHED_PRETRIGGERS_U8);
+        au8State[u8Slot] = ADC_SCHED_DELAYED_U8;
+        u16Delay = 0U;
+        if ((uint8)STD_ON == pGroupPtr->u8AdcGroupChannelDelays)
+        {
+            if ((uint8)STD_OFF == pGroupPtr->u8AdcGroupBackToBack)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                u16Delay = pGroupPtr->pDelay[FirstChannel + u8Slot];
+            }
+            else if (0U != u8PreTrigger)
+            {
+                au8State[u8Slot] = ADC_SCHED_CHAINED_U8;
+            }
+            else if (0U == FirstChannel)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                u16Delay = (uint16)(pGroupPtr->pDelay[0] + (pGroupPtr->u16PdbDelay * u8PdbChannel));
+            }
+            else
+            {
+                /* Pre-trigger 0 of PDB channel 0 has no delay in the following chunks */
+                u16Delay = (uint16)(pGroupPtr->u16PdbDelay * u8PdbChannel);
+            }
+        }
+        else if (0U == u8PreTrigger)
+        {
+            u16Delay = (uint16)(pGroupPtr->u16PdbDelay * u8PdbChannel);
+        }
+        else if ((uint8)STD_ON == pGroupPtr->u8AdcGroupBackToBack)
+        {
+            au8State[u8Slot] = ADC_SCHED_CHAINED_U8;
+        }
+        else
+        {
+            /* Neither delayed nor chained: asserted with the trigger */
+        }
+        au64Release[u8Slot] = Adc_Adc12bsarv2_Sched_PdbCycles(pParam, u32CountClocks, u16Delay);
+    }
+
+    for (;;)
+    {
+        /* Next delayed pre-trigger, the highest one on equal delays */
+        u8Next = ADC_SCHED_NO_SLOT_U8;
+        for (u8Slot = 0U; u8Slot < u8NumChannel; u8Slot++)
+        {
+            if ((ADC_SCHED_DELAYED_U8 == au8State[u8Slot]) && \
+                ((ADC_SCHED_NO_SLOT_U8 == u8Next) || (au64Release[u8Slot] <= au64Release[u8Next])))
+            {
+                u8Next = u8Slot;
+            }
+        }
+
+        u8Asserted = ADC_SCHED_NO_SLOT_U8;
+        if ((ADC_SCHED_NO_SLOT_U8 != u8Current) && ((ADC_SCHED_NO_SLOT_U8 == u8Next) || (u64Free <= au64Release[u8Next])))
+        {
+            /* Conversion complete */
+            u64Now = u64Free;
+            u64Last = u64Free;
+            au8State[u8Current] = ADC_SCHED_DONE_U8;
+            if ((uint8)(u8NumChannel - 1U) == u8Current)
+            {
+                for (u8Slot = 0U; u8Slot < u8NumChannel; u8Slot++)
+                {
+                    if (ADC_SCHED_DONE_U8 != au8State[u8Slot])
+                    {
+                        pTiming->bChunkOrderError = (boolean)TRUE;
+                    }
+                }
+            }
+            u8Slot = (uint8)(u8Current + 1U);
+            u8Current = ADC_SCHED_NO_SLOT_U8;
+            for (u8Other = 0U; u8Other < u8NumChannel; u8Other++)
+            {
+                if ((ADC_SCHED_NO_SLOT_U8 == u8Current) && (ADC_SCHED_PENDING_U8 == au8State[u8Other]))
+                {
+                    u8Current = u8Other;
+                }
+            }
+            if ((u8Slot < u8NumChannel) && (ADC_SCHED_CHAINED_U8 == au8State[u8Slot]))
+            {
+                u8Asserted = u8Slot;
+            }
+        }
+        else if (ADC_SCHED_NO_SLOT_U8 != u8Next)
+        {
+            u64Now = au64Release[u8Next];
+            u8Asserted = u8Next;
+        }
+        else
+        {
+            break;
+        }
+
+        if (ADC_SCHED_NO_SLOT_U8 != u8Current)
+        {
+            if (ADC_SCHED_PENDING_U8 == au8State[u8Current])
+            {
+                au8State[u8Current] = ADC_SCHED_CONVERTING_U8;
+                u64Free = u64Now + (uint64)u32Conversion;
+            }
+        }
+        if (ADC_SCHED_NO_SLOT_U8 != u8Asserted)
+        {
+            au8State[u8Asserted] = ADC_SCHED_PENDING_U8;
+            for (u8Other = 0U; u8Other < u8NumChannel; u8Other++)
+            {
+                if ((u8Other != u8Asserted) && \
+                    ((u8Other / ADC_SCHED_PRETRIGGERS_U8) == (u8Asserted / ADC_SCHED_PRETRIGGERS_U8)) && \
+                    ((ADC_SCHED_PENDING_U8 == au8State[u8Other]) || (ADC_SCHED_CONVERTING_U8 == au8State[u8Other])))
+                {
+                    pTiming->bSequenceError = (boolean)TRUE;
+                    au8State[u8Asserted] = ADC_SCHED_LOST_U8;
+                }
+            }
+            if ((ADC_SCHED_PENDING_U8 == au8State[u8Asserted]) && (ADC_SCHED_NO_SLOT_U8 == u8Current))
+            {
+                u8Current = u8Asserted;
+                au8State[u8Current] = ADC_SCHED_CONVERTING_U8;
+                u64Free = u64Now + (uint64)u32Conversion;
+            }
+        }
+    }
+    return u64Last;
+}
+
+/**
+* @brief          Worst-case response time of an analyzed group.
+* @details        A hardware triggered group owns the unit while its trigger is enabled, software
+*                 starts being refused meanwhile, so its response is its job and the software
+*                 groups of its unit are not schedulable. Software groups are queued once at most:
+*                 without priorities every other software group of the unit can be ahead in the
+*                 FIFO. With priorities, the groups of the same priority can be ahead once, the
+*                 conversion of a lower priority group can be running and every release of a
+*                 higher priority group preempts the job, which restarts its interrupted round.
+*                 The response time is iterated until it is stable or exceeds the period.
+*
+* @return         uint32      Response time, ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 if unbounded.
+*/
+static FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sched_ResponseCycles
+(
+    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfg,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    P2CONST(Adc_Adc12bsarv2_SchedReportType, AUTOMATIC, ADC_APPL_CONST) pReport,
+    VAR(Adc_GroupType, AUTOMATIC) Group
+)
+{
+    /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = &pCfg->pGroups[Group];
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pOtherPtr;
+    VAR(uint64, AUTOMATIC) u64Fixed = (uint64)pReport->aGroup[Group].u32JobCycles;
+    VAR(uint64, AUTOMATIC) u64Response;
+#if (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE)
+    VAR(uint64, AUTOMATIC) u64Blocking = 0ULL;
+    VAR(uint64, AUTOMATIC) u64Previous;
+#endif /* (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE) */
+    VAR(boolean, AUTOMATIC) bUnbounded = (boolean)(ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 == pReport->aGroup[Group].u32JobCycles);
+    VAR(Adc_GroupType, AUTOMATIC) Other;
+
+    if (ADC_TRIGG_SRC_SW == pGroupPtr->eTriggerSource)
+    {
+        for (Other = 0U; Other < pCfg->GroupCount; Other++)
+        {
+            /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            pOtherPtr = &pCfg->pGroups[Other];
+            /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            if ((Other != Group) && (0UL != pParam->pPeriods[Other]) && (pOtherPtr->HwUnit == pGroupPtr->HwUnit))
+            {
+                if (ADC_TRIGG_SRC_SW != pOtherPtr->eTriggerSource)
+                {
+                    bUnbounded = (boolean)TRUE;
+                }
+#if (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE)
+                else if (pOtherPtr->Priority > pGroupPtr->Priority)
+                {
+                    /* Preemption, added by the iteration */
+                    if (ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 == pReport->aGroup[Other].u32JobCycles)
+                    {
+                        bUnbounded = (boolean)TRUE;
+                    }
+                }
+                else if (pOtherPtr->Priority < pGroupPtr->Priority)
+                {
+                    if ((uint64)pReport->aGroup[Other].u32ConversionCycles > u64Blocking)
+                    {
+                        u64Blocking = (uint64)pReport->aGroup[Other].u32ConversionCycles;
+                    }
+                }
+#endif /* (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE) */
+                else if (ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 == pReport->aGroup[Other].u32JobCycles)
+                {
+                    bUnbounded = (boolean)TRUE;
+                }
+                else
+                {
+                    u64Fixed += (uint64)pReport->aGroup[Other].u32JobCycles;
+                }
+            }
+        }
+    }
+
+    u64Response = u64Fixed;
+#if (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE)
+    u64Fixed += u64Blocking;
+    u64Response = u64Fixed;
+    if ((boolean)FALSE == bUnbounded)
+    {
+        do
+        {
+            u64Previous = u64Response;
+            u64Response = u64Fixed;
+            for (Other = 0U; Other < pCfg->GroupCount; Other++)
+            {
+                /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                pOtherPtr = &pCfg->pGroups[Other];
+                /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                if ((0UL != pParam->pPeriods[Other]) && (pOtherPtr->HwUnit == pGroupPtr->HwUnit) && \
+                    (ADC_TRIGG_SRC_SW == pOtherPtr->eTriggerSource) && (pOtherPtr->Priority > pGroupPtr->Priority))
+                {
+                    /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                    u64Response += ((u64Previous + (uint64)pParam->pPeriods[Other] - 1ULL) / (uint64)pParam->pPeriods[Other]) * \
+                                   ((uint64)pReport->aGroup[Other].u32JobCycles + (uint64)pReport->aGroup[Group].u32RoundCycles);
+                }
+            }
+        } while ((u64Response != u64Previous) && (u64Response <= (uint64)pParam->pPeriods[Group]));
+    }
+#endif /* (ADC_PRIORITY_IMPLEMENTATION != ADC_PRIORITY_NONE) */
+
+    return ((boolean)TRUE == bUnbounded) ? ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 : Adc_Adc12bsarv2_Sched_Saturate(u64Response);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          Computes the conversion, round and job times of a group.
+* @details        A round converts the channels in chunks of ADC_NUM_SC1_N_REGISTER_USED, each
+*                 chunk but the first being triggered u32ChunkOverhead after the end of the
+*                 previous one. PDB counts are converted with the u32AdcPdbClockSettings of the
+*                 unit and the clock frequencies of pParam. The channels and delays of the configuration are used, not the ones set
+*                 at runtime with Adc_SetChannel. The response fields are cleared, they depend on
+*                 the other groups and are filled in by Adc_Adc12bsarv2_Sched_Analyze.
+*
+* @param[in]      pCfg        Driver configuration.
+* @param[in]      pParam      Analysis inputs, pPeriods is not used.
+* @param[in]      Group       The group id.
+* @param[out]     pTiming     Timing of the group.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sched_GroupTiming
+(
+    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfg,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    VAR(Adc_GroupType, AUTOMATIC) Group,
+    P2VAR(Adc_Adc12bsarv2_SchedGroupType, AUTOMATIC, ADC_APPL_DATA) pTiming
+)
+{
+    /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr = &pCfg->pGroups[Group];
+    /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+    VAR(uint32, AUTOMATIC) u32CountClocks = ADC_ADC12BSARV2_SCHED_PDB_COUNT_CLOCKS(pCfg->pAdc[pCfg->Misc.aHwLogicalId[pGroupPtr->HwUnit]].u32AdcPdbClockSettings);
+    VAR(uint64, AUTOMATIC) u64Round = 0ULL;
+    VAR(uint64, AUTOMATIC) u64Rounds = 1ULL;
+    VAR(Adc_ChannelIndexType, AUTOMATIC) CurrentChannel = 0U;
+    VAR(uint8, AUTOMATIC) u8NumChannel;
+
+    pTiming->bSequenceError = (boolean)FALSE;
+    pTiming->bChunkOrderError = (boolean)FALSE;
+    pTiming->u32ConversionCycles = Adc_Adc12bsarv2_Sched_ConversionCycles(pCfg, pParam, pGroupPtr);
+    while (CurrentChannel < pGroupPtr->AssignedChannelCount)
+    {
+        if (0U != CurrentChannel)
+        {
+            u64Round += (uint64)pParam->u32ChunkOverhead;
+        }
+        u8NumChannel = (uint8)ADC_ADC12BSARV2_GET_LEFT_CHANNEL(pGroupPtr->AssignedChannelCount - CurrentChannel);
+        u64Round += Adc_Adc12bsarv2_Sched_ChunkCycles(pGroupPtr, CurrentChannel, u8NumChannel, pTiming->u32ConversionCycles, \
+                                                       pParam, u32CountClocks, pTiming);
+        CurrentChannel += (Adc_ChannelIndexType)u8NumChannel;
+    }
+    pTiming->u32RoundCycles = Adc_Adc12bsarv2_Sched_Saturate(u64Round);
+
+    if ((ADC_CONV_MODE_CONTINUOUS == pGroupPtr->eMode) && (ADC_TRIGG_SRC_SW == pGroupPtr->eTriggerSource))
+    {
+        if ((ADC_ACCESS_MODE_STREAMING == pGroupPtr->eAccessMode) && (ADC_STREAM_BUFFER_LINEAR == pGroupPtr->eBufferMode))
+        {
+            u64Rounds = (uint64)pGroupPtr->NumSamples;
+        }
+        else
+        {
+            /* Converts until stopped */
+            u64Rounds = 0ULL;
+        }
+    }
+    pTiming->u32JobCycles = (0ULL == u64Rounds) ? ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 : \
+                            Adc_Adc12bsarv2_Sched_Saturate((u64Rounds * u64Round) + ((u64Rounds - 1ULL) * (uint64)pParam->u32ChunkOverhead));
+    pTiming->u32ResponseCycles = 0UL;
+    pTiming->u32QueueingCycles = 0UL;
+    pTiming->bSchedulable = (boolean)FALSE;
+}
+
+/**
+* @brief          Checks the release periods of the groups against the hardware units.
+* @details        Only the groups with a non zero period in pParam->pPeriods are analyzed, a
+*                 period being the shortest time between two starts of a software group or two
+*                 triggers of a hardware triggered group. The utilization of a unit sums the job
+*                 over the period of its analyzed groups, a group converting until stopped
+*                 loading it completely. A group is schedulable when its response time does not
+*                 exceed its period, none of its pre-triggers raises a sequence error and each of
+*                 its chunks ends with its last SC1n.
+*
+* @param[in]      pCfg        Driver configuration.
+* @param[in]      pParam      Analysis inputs, pPeriods has one entry per group.
+* @param[out]     pReport     Timing of every group and load of every unit.
+*
+* @return         Std_ReturnType  E_OK if every unit is schedulable, E_NOT_OK otherwise.
+*
+* @api
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_Adc12bsarv2_Sched_Analyze
+(
+    P2CONST(Adc_ConfigType, AUTOMATIC, ADC_APPL_CONST) pCfg,
+    P2CONST(Adc_Adc12bsarv2_SchedParamType, AUTOMATIC, ADC_APPL_CONST) pParam,
+    P2VAR(Adc_Adc12bsarv2_SchedReportType, AUTOMATIC, ADC_APPL_DATA) pReport
+)
+{
+    P2VAR(Adc_Adc12bsarv2_SchedGroupType, AUTOMATIC, ADC_APPL_DATA) pTiming;
+    P2VAR(Adc_Adc12bsarv2_SchedUnitType, AUTOMATIC, ADC_APPL_DATA) pUnit;
+    VAR(uint64, AUTOMATIC) u64Utilization;
+    VAR(Std_ReturnType, AUTOMATIC) Result = (Std_ReturnType)E_OK;
+    VAR(Adc_GroupType, AUTOMATIC) Group;
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr;
+
+    for (Group = 0U; Group < pCfg->GroupCount; Group++)
+    {
+        Adc_Adc12bsarv2_Sched_GroupTiming(pCfg, pParam, Group, &pReport->aGroup[Group]);
+    }
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        pReport->aUnit[Unit].u32Utilization = 0UL;
+        pReport->aUnit[Unit].u32MaxQueueingCycles = 0UL;
+        pReport->aUnit[Unit].bSchedulable = (boolean)TRUE;
+    }
+
+    for (Group = 0U; Group < pCfg->GroupCount; Group++)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        pGroupPtr = &pCfg->pGroups[Group];
+        pTiming = &pReport->aGroup[Group];
+        pUnit = &pReport->aUnit[pGroupPtr->HwUnit];
+        /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+        if (0UL != pParam->pPeriods[Group])
+        {
+            pTiming->u32ResponseCycles = Adc_Adc12bsarv2_Sched_ResponseCycles(pCfg, pParam, pReport, Group);
+            if (ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 == pTiming->u32ResponseCycles)
+            {
+                pTiming->u32QueueingCycles = ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32;
+            }
+            else
+            {
+                pTiming->u32QueueingCycles = pTiming->u32ResponseCycles - pTiming->u32JobCycles;
+            }
+            /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+            pTiming->bSchedulable = (boolean)((pTiming->u32ResponseCycles <= pParam->pPeriods[Group]) && \
+                                              ((boolean)FALSE == pTiming->bSequenceError) && \
+                                              ((boolean)FALSE == pTiming->bChunkOrderError));
+
+            if (ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 == pTiming->u32JobCycles)
+            {
+                u64Utilization = (uint64)ADC_SCHED_FULL_LOAD_U32;
+            }
+            else
+            {
+                /** @violates @ref Adc_Adc12bsarv2_Sched_c_REF_4 Array indexing shall be the only allowed form of pointer arithmetic */
+                u64Utilization = (((uint64)pTiming->u32JobCycles * 1000ULL) + (uint64)pParam->pPeriods[Group] - 1ULL) / (uint64)pParam->pPeriods[Group];
+            }
+            pUnit->u32Utilization = Adc_Adc12bsarv2_Sched_Saturate((uint64)pUnit->u32Utilization + u64Utilization);
+            if ((ADC_TRIGG_SRC_SW == pGroupPtr->eTriggerSource) && (pTiming->u32QueueingCycles > pUnit->u32MaxQueueingCycles))
+            {
+                pUnit->u32MaxQueueingCycles = pTiming->u32QueueingCycles;
+            }
+            if (((boolean)FALSE == pTiming->bSchedulable) || (pUnit->u32Utilization > ADC_SCHED_FULL_LOAD_U32))
+            {
+                pUnit->bSchedulable = (boolean)FALSE;
+                Result = (Std_ReturnType)E_NOT_OK;
+            }
+        }
+    }
+    return Result;
+}
+
+#define ADC_STOP_SEC_CODE
+/**
+ * @violates @ref Adc_Adc12bsarv2_Sched_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Adc12bsarv2_Sched_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+#endif /* MCAL_REG_SIMULATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,1347 @@
+/**
+*   @file    Adc_Adc12bsarv2_Sim.c
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - ADC12BSARV2 host register model.
+*   @details Host side model of the ADC0/ADC1 register blocks. When MCAL_REG_SIMULATION is defined
+*            the REG_* accessors from StdRegMacros.h are routed to the Mcal_SimReg* hooks below,
+*            so the unmodified driver can be executed and timed off-target.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Adc12bsarv2_Sim_c_REF_1
+* Violates MISRA 2004 Advisory Rule 19.1, only preprocessor statements and comments before "#include"
+* This violation is not fixed since the inclusion of MemMap.h is as per Autosar requirement.
+*
+* @section Adc_Adc12bsarv2_Sim_c_REF_2
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Adc12bsarv2_Sim_c_REF_3
+* Violates MISRA 2004 Required Rule 1.4, The compiler/linker shall be checked to ensure that
+* 31 characters significance and case sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section Adc_Adc12bsarv2_Sim_c_REF_4
+* Violates MISRA 2004 Required Rule 8.10, all declarations and definitions of objects or functions
+* at file scope shall have internal linkage unless external linkage is required.
+* The register hooks are referenced from the StdRegMacros.h accessors of every driver.
+*
+* @section Adc_Adc12bsarv2_Sim_c_REF_6
+* Violates MISRA 2004 Required Rule 11.3, A cast should not be performed between a pointer type and
+* an integral type. The hooks receive host memory addresses above the 32 bits bus as integers.
+*
+* @section Adc_Adc12bsarv2_Sim_c_REF_5
+* Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined
+* This violation is due to function like macros defined for register offset decoding.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Adc_Adc12bsarv2_Sim.h"
+#include "Adc_Pdb_Sim.h"
+#include "StdRegMacros.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_ADC12BSARV2_SIM_C                    43
+/** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SIM_C     4
+/** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SIM_C     2
+/** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SIM_C  2
+#define ADC_SW_MAJOR_VERSION_ADC12BSARV2_SIM_C             1
+#define ADC_SW_MINOR_VERSION_ADC12BSARV2_SIM_C             0
+#define ADC_SW_PATCH_VERSION_ADC12BSARV2_SIM_C             3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if source file and Adc_Adc12bsarv2_Sim header file are of the same vendor */
+#if (ADC_VENDOR_ID_ADC12BSARV2_SIM_C != ADC_VENDOR_ID_ADC12BSARV2_SIM)
+    #error "Adc_Adc12bsarv2_Sim.c and Adc_Adc12bsarv2_Sim.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Adc12bsarv2_Sim header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SIM_C != ADC_AR_RELEASE_MAJOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SIM_C != ADC_AR_RELEASE_MINOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SIM_C != ADC_AR_RELEASE_REVISION_VERSION_ADC12BSARV2_SIM) \
+    )
+    #error "AutoSar Version Numbers of Adc_Adc12bsarv2_Sim.c and Adc_Adc12bsarv2_Sim.h are different"
+#endif
+
+/* Check if source file and Adc_Adc12bsarv2_Sim header file are of the same Software version */
+#if ((ADC_SW_MAJOR_VERSION_ADC12BSARV2_SIM_C != ADC_SW_MAJOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_SW_MINOR_VERSION_ADC12BSARV2_SIM_C != ADC_SW_MINOR_VERSION_ADC12BSARV2_SIM) || \
+     (ADC_SW_PATCH_VERSION_ADC12BSARV2_SIM_C != ADC_SW_PATCH_VERSION_ADC12BSARV2_SIM) \
+    )
+    #error "Software Version Numbers of Adc_Adc12bsarv2_Sim.c and Adc_Adc12bsarv2_Sim.h are different"
+#endif
+
+#ifdef MCAL_REG_SIMULATION
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief          State of one modeled ADC unit.
+*/
+typedef struct
+{
+    uint32 au32Reg[ADC_SIM_REG_WINDOW_U32 >> 2U];   /**< @brief Register image of the unit */
+    uint16 au16Input[ADC_SIM_MAX_CHANNELS_U8];      /**< @brief 12 bit value seen on each ADCH */
+    uint32 u32PendingMask;                          /**< @brief Latched triggers, one bit per SC1n */
+    uint8 u8ActiveSc1;                              /**< @brief SC1n being converted */
+    boolean bCalibrating;                           /**< @brief Calibration sequence in progress */
+    uint64 u64StartTime;                            /**< @brief Start of the running operation */
+    uint64 u64EndTime;                              /**< @brief End of the running operation */
+    uint8 u8AbortSc1;                               /**< @brief SC1n still showing an aborted conversion */
+    uint32 u32AbortSc1Value;                        /**< @brief Value read from that SC1n until the abort ends */
+    uint64 u64AbortEndTime;                         /**< @brief End of the abort of that SC1n */
+    Adc_Adc12bsarv2_SimIrqType pfIrqHandler;        /**< @brief Handler of the unit interrupt */
+    Adc_Adc12bsarv2_SimStatisticsType Statistics;   /**< @brief Access and conversion counters */
+} Adc_Adc12bsarv2_SimUnitType;
+
+/**
+* @brief          Storage for accesses outside the modeled peripherals.
+*/
+typedef struct
+{
+    uint32 u32Address;
+    uint32 u32Value;
+} Adc_Adc12bsarv2_SimFlatType;
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/** @brief SC1n index used when no conversion is running */
+#define ADC_SIM_NO_CONVERSION_U8            ((uint8)0xFFU)
+
+/** @brief ADCK cycles added to sample and compare phases of every conversion */
+#define ADC_SIM_CONV_OVERHEAD_CYCLES_U32    ((uint32)5UL)
+
+/** @brief Number of averaged passes performed by a calibration sequence */
+#define ADC_SIM_CAL_PASSES_U32              ((uint32)16UL)
+
+/** @brief Number of accesses outside the peripheral windows which can be stored */
+#define ADC_SIM_FLAT_ENTRIES_U8             ((uint8)32U)
+
+/** @brief Address of the DWT cycle counter, read back as the model time in ADCK cycles */
+#define ADC_SIM_DWT_CYCCNT_ADDR32           ((uint32)0xE0001004UL)
+
+/** @brief Highest address of the modeled 32 bits bus, anything above is host memory */
+#define ADC_SIM_BUS_ADDRESS_MAX             ((Mcal_SimAddressType)0xFFFFFFFFUL)
+
+/**
+* @brief          Offset of a register from the base of its unit.
+* @violates @ref Adc_Adc12bsarv2_Sim_c_REF_5 Function-like macro defined
+*/
+#define ADC_SIM_OFFSET(RegAddr, Unit)       ((uint32)((RegAddr) - ADC12BSARV2_ADDR32(Unit)))
+
+/**
+* @brief          Register image word of a unit.
+* @violates @ref Adc_Adc12bsarv2_Sim_c_REF_5 Function-like macro defined
+*/
+#define ADC_SIM_REG(Unit, Offset)           (Adc_Adc12bsarv2_Sim_aUnit[(Unit)].au32Reg[(Offset) >> 2U])
+
+#if (ADC_NUM_SC1_N_REGISTER > ADC12BSARV2_SC1_N_BASE_COUNT)
+/** @brief Offsets of SC1A and RA, aliases of aSC1[0] and aR[0] on the extended bank */
+#define ADC_SIM_SC1A_OFFSET_U32             ((uint32)0x0000UL)
+#define ADC_SIM_RA_OFFSET_U32               ((uint32)0x0048UL)
+#endif /* (ADC_NUM_SC1_N_REGISTER > ADC12BSARV2_SC1_N_BASE_COUNT) */
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+#define ADC_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Adc12bsarv2_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Adc12bsarv2_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+static VAR(Adc_Adc12bsarv2_SimUnitType, ADC_VAR) Adc_Adc12bsarv2_Sim_aUnit[ADC_MAX_HW_UNITS];
+static VAR(Adc_Adc12bsarv2_SimFlatType, ADC_VAR) Adc_Adc12bsarv2_Sim_aFlat[ADC_SIM_FLAT_ENTRIES_U8];
+static VAR(uint8, ADC_VAR) Adc_Adc12bsarv2_Sim_u8FlatUsed;
+static VAR(uint64, ADC_VAR) Adc_Adc12bsarv2_Sim_u64Time;
+static VAR(uint32, ADC_VAR) Adc_Adc12bsarv2_Sim_u32AccessCycles;
+static VAR(uint32, ADC_VAR) Adc_Adc12bsarv2_Sim_u32AbortCycles;
+static VAR(boolean, ADC_VAR) Adc_Adc12bsarv2_Sim_bInIrq;
+static P2CONST(Adc_Adc12bsarv2_SimDmaEngineType, ADC_VAR, ADC_APPL_CONST) Adc_Adc12bsarv2_Sim_pDmaEngine = NULL_PTR;
+static VAR(boolean, ADC_VAR) Adc_Adc12bsarv2_Sim_bInDma;
+
+#define ADC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Adc12bsarv2_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Adc12bsarv2_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/**
+ * @violates @ref Adc_Adc12bsarv2_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Adc12bsarv2_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+static FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_Sim_DecodeUnit
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    P2VAR(Adc_HwUnitType, AUTOMATIC, ADC_APPL_DATA) pUnit,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pOffset
+);
+
+static FUNC(uint8, ADC_CODE) Adc_Adc12bsarv2_Sim_DecodeSc1
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint32, AUTOMATIC) u32Offset
+);
+
+static FUNC(uint8, ADC_CODE) Adc_Adc12bsarv2_Sim_DecodeRn
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint32, AUTOMATIC) u32Offset
+);
+
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_StartNext
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint64, AUTOMATIC) u64StartTime
+);
+
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Abort
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+
+static FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_Sim_CompareTrue
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint32, AUTOMATIC) u32Result
+);
+
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Complete
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_CompleteDue(void);
+
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_DispatchIrq(void);
+
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_ServiceDma(void);
+
+static FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sim_ReadWord
+(
+    VAR(uint32, AUTOMATIC) u32Address
+);
+
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_WriteWord
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint32, AUTOMATIC) u32Value
+);
+
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Run
+(
+    VAR(uint64, AUTOMATIC) u64Target,
+    VAR(boolean, AUTOMATIC) bDispatch
+);
+
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Tick(void);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          Maps a bus address on one of the modeled ADC units.
+*
+* @param[in]      u32Address  The accessed address.
+* @param[out]     pUnit       The unit owning the address.
+* @param[out]     pOffset     The offset of the address inside the unit window.
+*
+* @return         boolean     TRUE if the address belongs to an ADC unit.
+*/
+static FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_Sim_DecodeUnit
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    P2VAR(Adc_HwUnitType, AUTOMATIC, ADC_APPL_DATA) pUnit,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pOffset
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(boolean, AUTOMATIC) bFound = (boolean)FALSE;
+
+    for (Unit = 0U; (Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS) && ((boolean)FALSE == bFound); Unit++)
+    {
+        if ((u32Address >= ADC12BSARV2_ADDR32(Unit)) && \
+            ((u32Address - ADC12BSARV2_ADDR32(Unit)) < ADC_SIM_REG_WINDOW_U32))
+        {
+            *pUnit = Unit;
+            *pOffset = (u32Address - ADC12BSARV2_ADDR32(Unit)) & (~(uint32)3UL);
+#if (ADC_NUM_SC1_N_REGISTER > ADC12BSARV2_SC1_N_BASE_COUNT)
+            /* SC1A..SC1P and RA..RP are the first 16 registers of the aSC1 and aR banks */
+            if ((*pOffset - ADC_SIM_SC1A_OFFSET_U32) < ((uint32)ADC12BSARV2_SC1_N_BASE_COUNT << 2U))
+            {
+                *pOffset = ADC12BSAR_SC1_OFFSET_ADDR32 + (*pOffset - ADC_SIM_SC1A_OFFSET_U32);
+            }
+            else if ((*pOffset >= ADC_SIM_RA_OFFSET_U32) && \
+                     ((*pOffset - ADC_SIM_RA_OFFSET_U32) < ((uint32)ADC12BSARV2_SC1_N_BASE_COUNT << 2U)))
+            {
+                *pOffset = ADC12BSAR_R_N_OFFSET_ADDR32 + (*pOffset - ADC_SIM_RA_OFFSET_U32);
+            }
+            else
+            {
+                /* Not aliased */
+            }
+#endif /* (ADC_NUM_SC1_N_REGISTER > ADC12BSARV2_SC1_N_BASE_COUNT) */
+            bFound = (boolean)TRUE;
+        }
+    }
+    return bFound;
+}
+
+/**
+* @brief          Returns the SC1n index addressed by an offset.
+*
+* @return         uint8     The index or ADC_SIM_NO_CONVERSION_U8 if the offset is not an SC1n.
+*/
+static FUNC(uint8, ADC_CODE) Adc_Adc12bsarv2_Sim_DecodeSc1
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint32, AUTOMATIC) u32Offset
+)
+{
+    VAR(uint32, AUTOMATIC) u32First = ADC_SIM_OFFSET(ADC12BSARV2_SC1_REG_ADDR32(Unit, 0UL), Unit);
+    VAR(uint8, AUTOMATIC) u8Index = ADC_SIM_NO_CONVERSION_U8;
+
+    if ((u32Offset >= u32First) && (((u32Offset - u32First) >> 2U) < (uint32)ADC_NUM_SC1_N_REGISTER))
+    {
+        u8Index = (uint8)((u32Offset - u32First) >> 2U);
+    }
+    return u8Index;
+}
+
+/**
+* @brief          Returns the Rn index addressed by an offset.
+*
+* @return         uint8     The index or ADC_SIM_NO_CONVERSION_U8 if the offset is not an Rn.
+*/
+static FUNC(uint8, ADC_CODE) Adc_Adc12bsarv2_Sim_DecodeRn
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint32, AUTOMATIC) u32Offset
+)
+{
+    VAR(uint32, AUTOMATIC) u32First = ADC_SIM_OFFSET(ADC12BSARV2_R_N_REG_ADDR32(Unit, 0UL), Unit);
+    VAR(uint8, AUTOMATIC) u8Index = ADC_SIM_NO_CONVERSION_U8;
+
+    if ((u32Offset >= u32First) && (((u32Offset - u32First) >> 2U) < (uint32)ADC_NUM_SC1_N_REGISTER))
+    {
+        u8Index = (uint8)((u32Offset - u32First) >> 2U);
+    }
+    return u8Index;
+}
+
+/**
+* @brief          Starts the lowest latched SC1n if the converter is idle.
+*/
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_StartNext
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint64, AUTOMATIC) u64StartTime
+)
+{
+    P2VAR(Adc_Adc12bsarv2_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim = &Adc_Adc12bsarv2_Sim_aUnit[Unit];
+    VAR(uint8, AUTOMATIC) u8Index = 0U;
+
+    if ((ADC_SIM_NO_CONVERSION_U8 == pSim->u8ActiveSc1) && ((boolean)FALSE == pSim->bCalibrating) && \
+        (0UL != pSim->u32PendingMask))
+    {
+        while (0UL == (pSim->u32PendingMask & ((uint32)1UL << u8Index)))
+        {
+            u8Index++;
+        }
+        pSim->u32PendingMask &= ~((uint32)1UL << u8Index);
+        pSim->u8ActiveSc1 = u8Index;
+        pSim->u64StartTime = u64StartTime;
+        pSim->u64EndTime = u64StartTime + (uint64)Adc_Adc12bsarv2_Sim_GetConversionCycles(Unit);
+    }
+}
+
+/**
+* @brief          Aborts the running conversion of a unit, if any.
+*/
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Abort
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    P2VAR(Adc_Adc12bsarv2_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim = &Adc_Adc12bsarv2_Sim_aUnit[Unit];
+
+    if (ADC_SIM_NO_CONVERSION_U8 != pSim->u8ActiveSc1)
+    {
+        pSim->Statistics.u64BusyCycles += Adc_Adc12bsarv2_Sim_u64Time - pSim->u64StartTime;
+        pSim->Statistics.u32Aborts++;
+        pSim->u8ActiveSc1 = ADC_SIM_NO_CONVERSION_U8;
+    }
+}
+
+/**
+* @brief          Evaluates the compare function of a unit for a conversion result.
+* @details        Follows the ACFGT/ACREN table of the reference manual. With ACREN set, CV1 > CV2
+*                 selects the exclusive (ACFGT clear) or inclusive (ACFGT set) complementary range.
+*
+* @return         boolean     TRUE if the compare function is disabled or the result matches.
+*/
+static FUNC(boolean, ADC_CODE) Adc_Adc12bsarv2_Sim_CompareTrue
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint32, AUTOMATIC) u32Result
+)
+{
+    VAR(uint32, AUTOMATIC) u32Sc2 = ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC2_REG_ADDR32(Unit), Unit));
+    VAR(uint32, AUTOMATIC) u32Cv1 = ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CV_N_REG_ADDR32(Unit, 0UL), Unit)) & 0xFFFFUL;
+    VAR(uint32, AUTOMATIC) u32Cv2 = ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CV_N_REG_ADDR32(Unit, 1UL), Unit)) & 0xFFFFUL;
+    VAR(boolean, AUTOMATIC) bGreater = (boolean)(0UL != (u32Sc2 & ADC12BSARV2_SC2_ACFGT_GREATER_U32));
+    VAR(boolean, AUTOMATIC) bTrue = (boolean)TRUE;
+
+    if (0UL != (u32Sc2 & ADC12BSARV2_SC2_ACFE_EN_U32))
+    {
+        if (0UL == (u32Sc2 & ADC12BSARV2_SC2_ACREN_EN_U32))
+        {
+            /* Less than CV1, or greater than or equal to CV1 */
+            bTrue = (boolean)(((boolean)TRUE == bGreater) ? (u32Result >= u32Cv1) : (u32Result < u32Cv1));
+        }
+        else if (u32Cv1 <= u32Cv2)
+        {
+            /* Inside [CV1, CV2], or outside ]CV1, CV2[ */
+            bTrue = (boolean)(((boolean)TRUE == bGreater) ? ((u32Result >= u32Cv1) && (u32Result <= u32Cv2)) : \
+                                                           ((u32Result < u32Cv1) || (u32Result > u32Cv2)));
+        }
+        else
+        {
+            /* Outside [CV2, CV1] inclusive of the limits, or strictly inside ]CV2, CV1[ */
+            bTrue = (boolean)(((boolean)TRUE == bGreater) ? ((u32Result >= u32Cv1) || (u32Result <= u32Cv2)) : \
+                                                           ((u32Result < u32Cv1) && (u32Result > u32Cv2)));
+        }
+    }
+    return bTrue;
+}
+
+/**
+* @brief          Ends the running conversion or calibration of a unit.
+* @details        Loads Rn with the input of the converted channel scaled to the configured
+*                 resolution and sets COCO. A result rejected by the compare function leaves Rn and
+*                 COCO untouched but still ends the PDB pre-trigger. A software triggered continuous
+*                 conversion is relatched so the next one starts at the end time of this one.
+*/
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Complete
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    P2VAR(Adc_Adc12bsarv2_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim = &Adc_Adc12bsarv2_Sim_aUnit[Unit];
+    VAR(uint32, AUTOMATIC) u32Sc1Offset;
+    VAR(uint32, AUTOMATIC) u32Sc3;
+    VAR(uint32, AUTOMATIC) u32Mode;
+    VAR(uint32, AUTOMATIC) u32ChId;
+    VAR(uint32, AUTOMATIC) u32Result = 0UL;
+    VAR(uint8, AUTOMATIC) u8Index = 0U;
+    VAR(boolean, AUTOMATIC) bConversion = (boolean)FALSE;
+    VAR(boolean, AUTOMATIC) bComplete = (boolean)TRUE;
+
+    pSim->Statistics.u64BusyCycles += pSim->u64EndTime - pSim->u64StartTime;
+    u32Sc3 = ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC3_REG_ADDR32(Unit), Unit));
+
+    if ((boolean)TRUE == pSim->bCalibrating)
+    {
+        /* Calibration ends with nominal plus-side gains and COCO on SC1A */
+        pSim->bCalibrating = (boolean)FALSE;
+        ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC3_REG_ADDR32(Unit), Unit)) = u32Sc3 & (~ADC12BSARV2_SC3_CAL_EN_U32);
+        ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CLPS_REG_ADDR32(Unit), Unit)) = (uint32)0x2AUL;
+        ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CLP3_REG_ADDR32(Unit), Unit)) = (uint32)0xF0UL;
+        ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CLP2_REG_ADDR32(Unit), Unit)) = (uint32)0x78UL;
+        ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CLP1_REG_ADDR32(Unit), Unit)) = (uint32)0x3CUL;
+        ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CLP0_REG_ADDR32(Unit), Unit)) = (uint32)0x1EUL;
+        pSim->Statistics.u32Calibrations++;
+    }
+    else
+    {
+        u8Index = pSim->u8ActiveSc1;
+        u32Sc1Offset = ADC_SIM_OFFSET(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8Index), Unit);
+        u32ChId = ADC_SIM_REG(Unit, u32Sc1Offset) & ADC12BSARV2_ADCH_MASK_U32;
+        if (u32ChId < (uint32)ADC_SIM_MAX_CHANNELS_U8)
+        {
+            u32Result = (uint32)pSim->au16Input[u32ChId] & ADC12BSARV2_RESULT_DATA_MASK_12_BIT_U32;
+        }
+        u32Mode = ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CFG1_REG_ADDR32(Unit), Unit)) & \
+                  (ADC12BSARV2_CFG1_10_BITS_RESOLUTION_U32 | ADC12BSARV2_CFG1_12_BITS_RESOLUTION_U32);
+        if (ADC12BSARV2_CFG1_8_BITS_RESOLUTION_U32 == u32Mode)
+        {
+            u32Result >>= 4U;
+        }
+        else if (ADC12BSARV2_CFG1_10_BITS_RESOLUTION_U32 == u32Mode)
+        {
+            u32Result >>= 2U;
+        }
+        else
+        {
+            /* 12 bits result is stored as sampled */
+        }
+        bComplete = Adc_Adc12bsarv2_Sim_CompareTrue(Unit, u32Result);
+        if ((boolean)TRUE == bComplete)
+        {
+            ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_R_N_REG_ADDR32(Unit, (uint32)u8Index), Unit)) = u32Result;
+            pSim->Statistics.u32Conversions++;
+        }
+        else
+        {
+            pSim->Statistics.u32CompareRejects++;
+        }
+        bConversion = (boolean)TRUE;
+    }
+
+    if ((boolean)TRUE == bComplete)
+    {
+        ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8Index), Unit)) |= ADC12BSARV2_SC1_N_CONV_COMPLETE_U32;
+    }
+    pSim->u8ActiveSc1 = ADC_SIM_NO_CONVERSION_U8;
+
+    if ((0U == u8Index) && \
+        (ADC12BSARV2_SC3_CONTINUOUS_U32 == (u32Sc3 & ADC12BSARV2_SC3_CONTINUOUS_U32)) && \
+        (0UL == (ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC2_REG_ADDR32(Unit), Unit)) & ADC12BSARV2_SC2_ADTRG_HW_U32)))
+    {
+        pSim->u32PendingMask |= 1UL;
+    }
+    Adc_Adc12bsarv2_Sim_StartNext(Unit, pSim->u64EndTime);
+
+    if ((boolean)TRUE == bConversion)
+    {
+        /* COCO acknowledges the PDB pre-trigger mapped on this SC1n */
+        Adc_Pdb_Sim_ConversionComplete(Unit, u8Index);
+    }
+}
+
+/**
+* @brief          Ends every operation whose end time has been reached.
+*/
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_CompleteDue(void)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    P2VAR(Adc_Adc12bsarv2_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim;
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        pSim = &Adc_Adc12bsarv2_Sim_aUnit[Unit];
+        while (((ADC_SIM_NO_CONVERSION_U8 != pSim->u8ActiveSc1) || ((boolean)TRUE == pSim->bCalibrating)) && \
+               (pSim->u64EndTime <= Adc_Adc12bsarv2_Sim_u64Time))
+        {
+            Adc_Adc12bsarv2_Sim_Complete(Unit);
+        }
+    }
+}
+
+/**
+* @brief          Calls the handler of every unit with COCO set on an SC1n having AIEN.
+* @details        Handlers are not nested: register accesses done by a handler advance time and end
+*                 conversions, interrupts raised meanwhile are tail-chained by scanning the units
+*                 again until no handler has run.
+*/
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_DispatchIrq(void)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint32, AUTOMATIC) u32Index;
+    VAR(uint32, AUTOMATIC) u32Sc1;
+    VAR(boolean, AUTOMATIC) bRaised;
+    VAR(boolean, AUTOMATIC) bServed = (boolean)TRUE;
+    P2VAR(Adc_Adc12bsarv2_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim;
+
+    if ((boolean)FALSE == Adc_Adc12bsarv2_Sim_bInIrq)
+    {
+        while ((boolean)TRUE == bServed)
+        {
+            bServed = (boolean)FALSE;
+            for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+            {
+                pSim = &Adc_Adc12bsarv2_Sim_aUnit[Unit];
+                bRaised = (boolean)FALSE;
+                for (u32Index = 0UL; u32Index < (uint32)ADC_NUM_SC1_N_REGISTER; u32Index++)
+                {
+                    u32Sc1 = ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC1_REG_ADDR32(Unit, u32Index), Unit));
+                    if ((ADC12BSARV2_SC1_N_CONV_COMPLETE_U32 | ADC12BSARV2_CONV_COMPLETE_INT_EN_U32) == \
+                        (u32Sc1 & (ADC12BSARV2_SC1_N_CONV_COMPLETE_U32 | ADC12BSARV2_CONV_COMPLETE_INT_EN_U32)))
+                    {
+                        bRaised = (boolean)TRUE;
+                    }
+                }
+                if (((boolean)TRUE == bRaised) && (NULL_PTR != pSim->pfIrqHandler))
+                {
+                    Adc_Adc12bsarv2_Sim_bInIrq = (boolean)TRUE;
+                    pSim->Statistics.u32Interrupts++;
+                    pSim->pfIrqHandler();
+                    Adc_Adc12bsarv2_Sim_bInIrq = (boolean)FALSE;
+                    bServed = (boolean)TRUE;
+                }
+            }
+        }
+        if (NULL_PTR != Adc_Adc12bsarv2_Sim_pDmaEngine)
+        {
+            Adc_Adc12bsarv2_Sim_bInIrq = (boolean)TRUE;
+            Adc_Adc12bsarv2_Sim_pDmaEngine->pfDispatchIrq();
+            Adc_Adc12bsarv2_Sim_bInIrq = (boolean)FALSE;
+        }
+    }
+    Adc_Pdb_Sim_DispatchIrq();
+}
+
+/**
+* @brief          Raises the DMA request of every unit with SC2[DMAEN] while one of its COCO is set.
+* @details        Each request is one minor loop of the attached engine, which normally reads the
+*                 result and clears COCO. The accesses done by the engine advance time without
+*                 serving requests again.
+*/
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_ServiceDma(void)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint32, AUTOMATIC) u32Index;
+    VAR(uint32, AUTOMATIC) u32Requests;
+    VAR(boolean, AUTOMATIC) bRequest;
+
+    if ((NULL_PTR != Adc_Adc12bsarv2_Sim_pDmaEngine) && ((boolean)FALSE == Adc_Adc12bsarv2_Sim_bInDma))
+    {
+        Adc_Adc12bsarv2_Sim_bInDma = (boolean)TRUE;
+        for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+        {
+            bRequest = (boolean)TRUE;
+            for (u32Requests = 0UL; (u32Requests < (uint32)ADC_NUM_SC1_N_REGISTER) && ((boolean)TRUE == bRequest); u32Requests++)
+            {
+                bRequest = (boolean)FALSE;
+                if (ADC12BSARV2_SC2_DMA_EN_U32 == (ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC2_REG_ADDR32(Unit), Unit)) & ADC12BSARV2_SC2_DMA_EN_U32))
+                {
+                    for (u32Index = 0UL; u32Index < (uint32)ADC_NUM_SC1_N_REGISTER; u32Index++)
+                    {
+                        if (ADC12BSARV2_SC1_N_CONV_COMPLETE_U32 == (ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC1_REG_ADDR32(Unit, u32Index), Unit)) & ADC12BSARV2_SC1_N_CONV_COMPLETE_U32))
+                        {
+                            bRequest = (boolean)TRUE;
+                        }
+                    }
+                }
+                if ((boolean)TRUE == bRequest)
+                {
+                    bRequest = Adc_Adc12bsarv2_Sim_pDmaEngine->pfRequest(Unit);
+                }
+            }
+        }
+        Adc_Adc12bsarv2_Sim_bInDma = (boolean)FALSE;
+    }
+}
+
+/**
+* @brief          Reads a 32 bits word from the model applying the read side effects.
+*/
+static FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sim_ReadWord
+(
+    VAR(uint32, AUTOMATIC) u32Address
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U;
+    VAR(uint32, AUTOMATIC) u32Offset = 0UL;
+    VAR(uint32, AUTOMATIC) u32Value = 0UL;
+    VAR(uint8, AUTOMATIC) u8Index;
+    VAR(uint8, AUTOMATIC) u8Flat;
+
+    if ((boolean)TRUE == Adc_Adc12bsarv2_Sim_DecodeUnit(u32Address, &Unit, &u32Offset))
+    {
+        Adc_Adc12bsarv2_Sim_aUnit[Unit].Statistics.u32RegReads++;
+        u32Value = ADC_SIM_REG(Unit, u32Offset);
+        u8Index = Adc_Adc12bsarv2_Sim_DecodeRn(Unit, u32Offset);
+        if (ADC_SIM_NO_CONVERSION_U8 != u8Index)
+        {
+            /* Reading Rn acknowledges COCO of the matching SC1n */
+            ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC1_REG_ADDR32(Unit, (uint32)u8Index), Unit)) &= ~ADC12BSARV2_SC1_N_CONV_COMPLETE_U32;
+        }
+        else if ((Adc_Adc12bsarv2_Sim_DecodeSc1(Unit, u32Offset) == Adc_Adc12bsarv2_Sim_aUnit[Unit].u8AbortSc1) && \
+                 (Adc_Adc12bsarv2_Sim_u64Time < Adc_Adc12bsarv2_Sim_aUnit[Unit].u64AbortEndTime))
+        {
+            /* The aborted conversion has not released the SC1n yet */
+            u32Value = Adc_Adc12bsarv2_Sim_aUnit[Unit].u32AbortSc1Value;
+        }
+        else if (ADC_SIM_OFFSET(ADC12BSARV2_SC2_REG_ADDR32(Unit), Unit) == u32Offset)
+        {
+            if ((ADC_SIM_NO_CONVERSION_U8 != Adc_Adc12bsarv2_Sim_aUnit[Unit].u8ActiveSc1) || \
+                ((boolean)TRUE == Adc_Adc12bsarv2_Sim_aUnit[Unit].bCalibrating))
+            {
+                u32Value |= ADC12BSARV2_SC2_ADACT_U32;
+            }
+        }
+        else
+        {
+            /* Plain register */
+        }
+    }
+    else if (ADC_SIM_DWT_CYCCNT_ADDR32 == (u32Address & (~(uint32)3UL)))
+    {
+        /* Free running counter, wraps as the 32 bits core counter */
+        u32Value = (uint32)Adc_Adc12bsarv2_Sim_u64Time;
+    }
+    else if ((boolean)FALSE == Adc_Pdb_Sim_ReadReg(u32Address, &u32Value))
+    {
+        for (u8Flat = 0U; u8Flat < Adc_Adc12bsarv2_Sim_u8FlatUsed; u8Flat++)
+        {
+            if ((u32Address & (~(uint32)3UL)) == Adc_Adc12bsarv2_Sim_aFlat[u8Flat].u32Address)
+            {
+                u32Value = Adc_Adc12bsarv2_Sim_aFlat[u8Flat].u32Value;
+            }
+        }
+    }
+    else
+    {
+        /* PDB register */
+    }
+    return u32Value;
+}
+
+/**
+* @brief          Writes a 32 bits word to the model applying the write side effects.
+*/
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_WriteWord
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint32, AUTOMATIC) u32Value
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit = 0U;
+    VAR(uint32, AUTOMATIC) u32Offset = 0UL;
+    VAR(uint8, AUTOMATIC) u8Index;
+    VAR(uint8, AUTOMATIC) u8Flat;
+    VAR(boolean, AUTOMATIC) bStored = (boolean)FALSE;
+    P2VAR(Adc_Adc12bsarv2_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim;
+
+    if ((boolean)TRUE == Adc_Adc12bsarv2_Sim_DecodeUnit(u32Address, &Unit, &u32Offset))
+    {
+        pSim = &Adc_Adc12bsarv2_Sim_aUnit[Unit];
+        pSim->Statistics.u32RegWrites++;
+        u8Index = Adc_Adc12bsarv2_Sim_DecodeSc1(Unit, u32Offset);
+        if (ADC_SIM_NO_CONVERSION_U8 != u8Index)
+        {
+            if ((u8Index == pSim->u8ActiveSc1) && ((uint32)0UL != Adc_Adc12bsarv2_Sim_u32AbortCycles))
+            {
+                pSim->u8AbortSc1 = u8Index;
+                pSim->u32AbortSc1Value = ADC_SIM_REG(Unit, u32Offset) & (~ADC12BSARV2_SC1_N_CONV_COMPLETE_U32);
+                pSim->u64AbortEndTime = Adc_Adc12bsarv2_Sim_u64Time + (uint64)Adc_Adc12bsarv2_Sim_u32AbortCycles;
+            }
+            /* COCO is read only and any SC1n write clears it and aborts that SC1n */
+            ADC_SIM_REG(Unit, u32Offset) = u32Value & (~ADC12BSARV2_SC1_N_CONV_COMPLETE_U32);
+            pSim->u32PendingMask &= ~((uint32)1UL << u8Index);
+            if (u8Index == pSim->u8ActiveSc1)
+            {
+                Adc_Adc12bsarv2_Sim_Abort(Unit);
+            }
+            /* A valid channel written to SC1A in software trigger mode starts a conversion */
+            if ((0U == u8Index) && \
+                (ADC12BSARV2_ADCH_CONVERSION_DISABLE_U32 != (u32Value & ADC12BSARV2_ADCH_MASK_U32)) && \
+                (0UL == (ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC2_REG_ADDR32(Unit), Unit)) & ADC12BSARV2_SC2_ADTRG_HW_U32)))
+            {
+                Adc_Adc12bsarv2_Sim_Abort(Unit);
+                pSim->u32PendingMask |= 1UL;
+                Adc_Adc12bsarv2_Sim_StartNext(Unit, Adc_Adc12bsarv2_Sim_u64Time);
+            }
+        }
+        else if (ADC_SIM_NO_CONVERSION_U8 != Adc_Adc12bsarv2_Sim_DecodeRn(Unit, u32Offset))
+        {
+            /* Rn is read only */
+        }
+        else if (ADC_SIM_OFFSET(ADC12BSARV2_SC3_REG_ADDR32(Unit), Unit) == u32Offset)
+        {
+            ADC_SIM_REG(Unit, u32Offset) = u32Value;
+            if (ADC12BSARV2_SC3_CAL_EN_U32 == (u32Value & ADC12BSARV2_SC3_CAL_EN_U32))
+            {
+                Adc_Adc12bsarv2_Sim_Abort(Unit);
+                pSim->u32PendingMask = 0UL;
+                pSim->bCalibrating = (boolean)TRUE;
+                pSim->u64StartTime = Adc_Adc12bsarv2_Sim_u64Time;
+                pSim->u64EndTime = Adc_Adc12bsarv2_Sim_u64Time + \
+                    ((uint64)Adc_Adc12bsarv2_Sim_GetConversionCycles(Unit) * (uint64)ADC_SIM_CAL_PASSES_U32);
+            }
+            else if ((boolean)TRUE == pSim->bCalibrating)
+            {
+                /* Clearing CAL aborts the calibration sequence, COCO stays clear */
+                pSim->Statistics.u64BusyCycles += Adc_Adc12bsarv2_Sim_u64Time - pSim->u64StartTime;
+                pSim->Statistics.u32Aborts++;
+                pSim->bCalibrating = (boolean)FALSE;
+            }
+            else
+            {
+                /* No calibration to start or abort */
+            }
+        }
+        else
+        {
+            ADC_SIM_REG(Unit, u32Offset) = u32Value;
+        }
+    }
+    else if ((boolean)FALSE == Adc_Pdb_Sim_WriteReg(u32Address, u32Value))
+    {
+        for (u8Flat = 0U; u8Flat < Adc_Adc12bsarv2_Sim_u8FlatUsed; u8Flat++)
+        {
+            if ((u32Address & (~(uint32)3UL)) == Adc_Adc12bsarv2_Sim_aFlat[u8Flat].u32Address)
+            {
+                Adc_Adc12bsarv2_Sim_aFlat[u8Flat].u32Value = u32Value;
+                bStored = (boolean)TRUE;
+            }
+        }
+        if (((boolean)FALSE == bStored) && (Adc_Adc12bsarv2_Sim_u8FlatUsed < ADC_SIM_FLAT_ENTRIES_U8))
+        {
+            Adc_Adc12bsarv2_Sim_aFlat[Adc_Adc12bsarv2_Sim_u8FlatUsed].u32Address = u32Address & (~(uint32)3UL);
+            Adc_Adc12bsarv2_Sim_aFlat[Adc_Adc12bsarv2_Sim_u8FlatUsed].u32Value = u32Value;
+            Adc_Adc12bsarv2_Sim_u8FlatUsed++;
+        }
+    }
+    else
+    {
+        /* PDB register */
+    }
+}
+
+/**
+* @brief          Moves the simulated time up to a target, one event at a time.
+* @details        The next event is the earliest end of conversion or calibration of the ADC units
+*                 or the earliest PDB pre-trigger or counter reload. Time is set to each event
+*                 before it is processed so the ADC and PDB models stay ordered.
+*
+* @param[in]      u64Target   Time to reach.
+* @param[in]      bDispatch   TRUE to deliver the interrupts raised by each event.
+*/
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Run
+(
+    VAR(uint64, AUTOMATIC) u64Target,
+    VAR(boolean, AUTOMATIC) bDispatch
+)
+{
+    VAR(uint64, AUTOMATIC) u64Next;
+    VAR(uint64, AUTOMATIC) u64PdbNext = 0ULL;
+    VAR(boolean, AUTOMATIC) bPending = (boolean)TRUE;
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    P2VAR(Adc_Adc12bsarv2_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim;
+
+    while ((boolean)TRUE == bPending)
+    {
+        bPending = (boolean)FALSE;
+        u64Next = (Adc_Adc12bsarv2_Sim_u64Time > u64Target) ? Adc_Adc12bsarv2_Sim_u64Time : u64Target;
+        for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+        {
+            pSim = &Adc_Adc12bsarv2_Sim_aUnit[Unit];
+            if (((ADC_SIM_NO_CONVERSION_U8 != pSim->u8ActiveSc1) || ((boolean)TRUE == pSim->bCalibrating)) && \
+                (pSim->u64EndTime <= u64Next))
+            {
+                u64Next = pSim->u64EndTime;
+                bPending = (boolean)TRUE;
+            }
+        }
+        if (((boolean)TRUE == Adc_Pdb_Sim_GetNextEventTime(&u64PdbNext)) && (u64PdbNext <= u64Next))
+        {
+            u64Next = u64PdbNext;
+            bPending = (boolean)TRUE;
+        }
+        if ((boolean)TRUE == bPending)
+        {
+            if (u64Next > Adc_Adc12bsarv2_Sim_u64Time)
+            {
+                Adc_Adc12bsarv2_Sim_u64Time = u64Next;
+            }
+            Adc_Adc12bsarv2_Sim_CompleteDue();
+            Adc_Pdb_Sim_ProcessDue();
+            Adc_Adc12bsarv2_Sim_ServiceDma();
+            if ((boolean)TRUE == bDispatch)
+            {
+                Adc_Adc12bsarv2_Sim_DispatchIrq();
+            }
+        }
+    }
+    if (Adc_Adc12bsarv2_Sim_u64Time < u64Target)
+    {
+        Adc_Adc12bsarv2_Sim_u64Time = u64Target;
+    }
+    /* Requests enabled since the last event */
+    Adc_Adc12bsarv2_Sim_ServiceDma();
+}
+
+/**
+* @brief          Charges the bus cost of one access and processes the events now due.
+* @details        No interrupt is delivered from here: the driver code issuing the access is not
+*                 preempted, handlers only run from Adc_Adc12bsarv2_Sim_AdvanceTime.
+*/
+static FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Tick(void)
+{
+    Adc_Adc12bsarv2_Sim_Run(Adc_Adc12bsarv2_Sim_u64Time + (uint64)Adc_Adc12bsarv2_Sim_u32AccessCycles, (boolean)FALSE);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          Puts every modeled unit in its reset state.
+* @details        Clears the register images, the latched triggers, the statistics, the registered
+*                 handlers and the simulated time. The PDB model is reset as well.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_Reset(void)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint32, AUTOMATIC) u32Index;
+    P2VAR(Adc_Adc12bsarv2_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim;
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        pSim = &Adc_Adc12bsarv2_Sim_aUnit[Unit];
+        for (u32Index = 0UL; u32Index < (ADC_SIM_REG_WINDOW_U32 >> 2U); u32Index++)
+        {
+            pSim->au32Reg[u32Index] = 0UL;
+        }
+        for (u32Index = 0UL; u32Index < (uint32)ADC_SIM_MAX_CHANNELS_U8; u32Index++)
+        {
+            pSim->au16Input[u32Index] = 0U;
+        }
+        for (u32Index = 0UL; u32Index < (uint32)ADC_NUM_SC1_N_REGISTER; u32Index++)
+        {
+            ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC1_REG_ADDR32(Unit, u32Index), Unit)) = ADC12BSARV2_SC1_N_RESET_VALUE_U32;
+        }
+        ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CFG2_REG_ADDR32(Unit), Unit)) = ADC12BSARV2_CFG2_RESET_VALUE_U32;
+        pSim->u32PendingMask = 0UL;
+        pSim->u8ActiveSc1 = ADC_SIM_NO_CONVERSION_U8;
+        pSim->bCalibrating = (boolean)FALSE;
+        pSim->u64StartTime = 0ULL;
+        pSim->u64EndTime = 0ULL;
+        pSim->u8AbortSc1 = ADC_SIM_NO_CONVERSION_U8;
+        pSim->u32AbortSc1Value = 0UL;
+        pSim->u64AbortEndTime = 0ULL;
+        pSim->pfIrqHandler = NULL_PTR;
+        pSim->Statistics.u32RegReads = 0UL;
+        pSim->Statistics.u32RegWrites = 0UL;
+        pSim->Statistics.u32Conversions = 0UL;
+        pSim->Statistics.u32Aborts = 0UL;
+        pSim->Statistics.u32Interrupts = 0UL;
+        pSim->Statistics.u32Calibrations = 0UL;
+        pSim->Statistics.u32CompareRejects = 0UL;
+        pSim->Statistics.u64BusyCycles = 0ULL;
+    }
+    Adc_Adc12bsarv2_Sim_u8FlatUsed = 0U;
+    Adc_Adc12bsarv2_Sim_u64Time = 0ULL;
+    Adc_Adc12bsarv2_Sim_u32AccessCycles = ADC_SIM_ACCESS_CYCLES_U32;
+    Adc_Adc12bsarv2_Sim_u32AbortCycles = 0UL;
+    Adc_Adc12bsarv2_Sim_bInIrq = (boolean)FALSE;
+    Adc_Adc12bsarv2_Sim_bInDma = (boolean)FALSE;
+    Adc_Pdb_Sim_Reset();
+}
+
+/**
+* @brief          Sets the cost, in ADC input clock cycles, of one register access.
+*
+* @param[in]      u32Cycles   Cycles charged for every REG_* access.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetAccessCycles
+(
+    VAR(uint32, AUTOMATIC) u32Cycles
+)
+{
+    Adc_Adc12bsarv2_Sim_u32AccessCycles = u32Cycles;
+}
+
+/**
+* @brief          Sets the time a unit takes to abort the running conversion.
+* @details        For that many cycles after the SC1n being converted is written, reads of that SC1n
+*                 return its previous value, as a unit still finishing the conversion would.
+*                 The default is 0, an abort taken on the write.
+*
+* @param[in]      u32Cycles   Abort latency in ADC input clock cycles.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetAbortCycles
+(
+    VAR(uint32, AUTOMATIC) u32Cycles
+)
+{
+    Adc_Adc12bsarv2_Sim_u32AbortCycles = u32Cycles;
+}
+
+/**
+* @brief          Sets the 12 bits value converted for an ADCH input.
+*
+* @param[in]      Unit        The ADC unit.
+* @param[in]      u8ChId      The ADCH input.
+* @param[in]      u16Value    The value returned by the next conversions of the input.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetChannelValue
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8ChId,
+    VAR(uint16, AUTOMATIC) u16Value
+)
+{
+    if ((Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS) && (u8ChId < ADC_SIM_MAX_CHANNELS_U8))
+    {
+        Adc_Adc12bsarv2_Sim_aUnit[Unit].au16Input[u8ChId] = u16Value;
+    }
+}
+
+/**
+* @brief          Registers the function called when the unit raises its interrupt.
+*
+* @param[in]      Unit          The ADC unit.
+* @param[in]      pfIrqHandler  Typically Adc_Adc12bsarv2_EndGroupConvUnitX, NULL_PTR to mask.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetIrqHandler
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_Adc12bsarv2_SimIrqType, AUTOMATIC) pfIrqHandler
+)
+{
+    if (Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS)
+    {
+        Adc_Adc12bsarv2_Sim_aUnit[Unit].pfIrqHandler = pfIrqHandler;
+    }
+}
+
+/**
+* @brief          Hardware trigger input of a unit.
+* @details        Latches a conversion request for SC1n. Triggers are ignored while SC2[ADTRG]
+*                 selects the software trigger.
+*
+* @param[in]      Unit          The ADC unit.
+* @param[in]      u8Sc1Index    The SC1n selected by the trigger.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_HwTrigger
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Sc1Index
+)
+{
+    if ((Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS) && ((uint32)u8Sc1Index < (uint32)ADC_NUM_SC1_N_REGISTER) && \
+        (ADC12BSARV2_SC2_ADTRG_HW_U32 == (ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC2_REG_ADDR32(Unit), Unit)) & ADC12BSARV2_SC2_ADTRG_HW_U32)))
+    {
+        Adc_Adc12bsarv2_Sim_aUnit[Unit].u32PendingMask |= ((uint32)1UL << u8Sc1Index);
+        Adc_Adc12bsarv2_Sim_StartNext(Unit, Adc_Adc12bsarv2_Sim_u64Time);
+    }
+}
+
+/**
+* @brief          Advances the simulated time.
+* @details        Operations are ended in time order and the unit interrupt handlers are called
+*                 after each end of conversion, so results are not overwritten before the driver
+*                 gets a chance to read them. Time spent in the handlers is charged on top.
+*
+* @param[in]      u32Cycles   ADC input clock cycles to advance.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_AdvanceTime
+(
+    VAR(uint32, AUTOMATIC) u32Cycles
+)
+{
+    Adc_Adc12bsarv2_Sim_DispatchIrq();
+    Adc_Adc12bsarv2_Sim_Run(Adc_Adc12bsarv2_Sim_u64Time + (uint64)u32Cycles, (boolean)TRUE);
+}
+
+/**
+* @brief          Returns the simulated time in ADC input clock cycles.
+*
+* @return         uint64      Cycles elapsed since Adc_Adc12bsarv2_Sim_Reset.
+*
+* @api
+*/
+FUNC(uint64, ADC_CODE) Adc_Adc12bsarv2_Sim_GetTime(void)
+{
+    return Adc_Adc12bsarv2_Sim_u64Time;
+}
+
+/**
+* @brief          Returns the duration of one conversion with the current unit setup.
+* @details        The conversion takes (SMPLTS + 1) sample cycles, one compare cycle per result bit
+*                 and a fixed overhead, all in ADCK cycles. Hardware averaging multiplies it by the
+*                 number of averaged samples and ADIV scales ADCK to input clock cycles.
+*
+* @param[in]      Unit        The ADC unit.
+*
+* @return         uint32      Conversion time in ADC input clock cycles.
+*
+* @api
+*/
+FUNC(uint32, ADC_CODE) Adc_Adc12bsarv2_Sim_GetConversionCycles
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(uint32, AUTOMATIC) u32Cfg1 = ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CFG1_REG_ADDR32(Unit), Unit));
+    VAR(uint32, AUTOMATIC) u32Cfg2 = ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_CFG2_REG_ADDR32(Unit), Unit));
+    VAR(uint32, AUTOMATIC) u32Sc3 = ADC_SIM_REG(Unit, ADC_SIM_OFFSET(ADC12BSARV2_SC3_REG_ADDR32(Unit), Unit));
+    VAR(uint32, AUTOMATIC) u32Bits = 12UL;
+    VAR(uint32, AUTOMATIC) u32Cycles;
+
+    if (ADC12BSARV2_CFG1_8_BITS_RESOLUTION_U32 == (u32Cfg1 & (ADC12BSARV2_CFG1_10_BITS_RESOLUTION_U32 | ADC12BSARV2_CFG1_12_BITS_RESOLUTION_U32)))
+    {
+        u32Bits = 8UL;
+    }
+    else if (ADC12BSARV2_CFG1_10_BITS_RESOLUTION_U32 == (u32Cfg1 & (ADC12BSARV2_CFG1_10_BITS_RESOLUTION_U32 | ADC12BSARV2_CFG1_12_BITS_RESOLUTION_U32)))
+    {
+        u32Bits = 10UL;
+    }
+    else
+    {
+        /* 12 bits */
+    }
+    u32Cycles = ((u32Cfg2 & ADC12BSARV2_CFG2_SAMPLE_TIME_MASK_U32) + 1UL) + u32Bits + ADC_SIM_CONV_OVERHEAD_CYCLES_U32;
+    if (ADC12BSARV2_SC3_AVGE_EN_U32 == (u32Sc3 & ADC12BSARV2_SC3_AVGE_EN_U32))
+    {
+        u32Cycles <<= (2UL + (u32Sc3 & (ADC12BSARV2_SC3_AVG_MASK_U32 & (~ADC12BSARV2_SC3_AVGE_EN_U32))));
+    }
+    u32Cycles <<= ((u32Cfg1 & ADC12BSARV2_CFG1_CLOCK_DIV_MASK_U32) >> 5U);
+    return u32Cycles;
+}
+
+/**
+* @brief          Returns the counters collected for a unit since the last reset.
+*
+* @param[in]      Unit          The ADC unit.
+* @param[out]     pStatistics   Copy of the unit counters.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_GetStatistics
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(Adc_Adc12bsarv2_SimStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+)
+{
+    if ((Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS) && (NULL_PTR != pStatistics))
+    {
+        *pStatistics = Adc_Adc12bsarv2_Sim_aUnit[Unit].Statistics;
+    }
+}
+
+/**
+* @brief          Attaches the DMA engine serving the DMAEN requests of the units.
+* @details        The engine stays attached across Adc_Adc12bsarv2_Sim_Reset.
+*
+* @param[in]      pEngine       The engine, NULL_PTR to detach.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Adc12bsarv2_Sim_SetDmaEngine
+(
+    P2CONST(Adc_Adc12bsarv2_SimDmaEngineType, AUTOMATIC, ADC_APPL_CONST) pEngine
+)
+{
+    Adc_Adc12bsarv2_Sim_pDmaEngine = pEngine;
+}
+
+/**
+* @brief          Register hooks of StdRegMacros.h.
+* @details        Every access costs the configured access cycles. Narrow accesses are merged in
+*                 the containing 32 bits word. Addresses which do not fit the 32 bits bus can only
+*                 be host memory, they are accessed in place and cost nothing.
+* @violates @ref Adc_Adc12bsarv2_Sim_c_REF_4 External linkage
+*/
+void Mcal_SimRegWrite32(Mcal_SimAddressType Address, uint32 u32Value)
+{
+    if (Address > ADC_SIM_BUS_ADDRESS_MAX)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_6 cast from integral type to pointer */
+        *((P2VAR(volatile uint32, AUTOMATIC, ADC_APPL_DATA))Address) = u32Value;
+    }
+    else
+    {
+        Adc_Adc12bsarv2_Sim_Tick();
+        Adc_Adc12bsarv2_Sim_WriteWord((uint32)Address, u32Value);
+    }
+}
+
+/** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_4 External linkage */
+uint32 Mcal_SimRegRead32(Mcal_SimAddressType Address)
+{
+    VAR(uint32, AUTOMATIC) u32Value;
+
+    if (Address > ADC_SIM_BUS_ADDRESS_MAX)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_6 cast from integral type to pointer */
+        u32Value = *((P2CONST(volatile uint32, AUTOMATIC, ADC_APPL_DATA))Address);
+    }
+    else
+    {
+        Adc_Adc12bsarv2_Sim_Tick();
+        u32Value = Adc_Adc12bsarv2_Sim_ReadWord((uint32)Address);
+    }
+    return u32Value;
+}
+
+/** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_4 External linkage */
+void Mcal_SimRegWrite16(Mcal_SimAddressType Address, uint16 u16Value)
+{
+    VAR(uint32, AUTOMATIC) u32Shift = ((uint32)Address & 2UL) << 3U;
+    VAR(uint32, AUTOMATIC) u32Word;
+
+    if (Address > ADC_SIM_BUS_ADDRESS_MAX)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_6 cast from integral type to pointer */
+        *((P2VAR(volatile uint16, AUTOMATIC, ADC_APPL_DATA))Address) = u16Value;
+    }
+    else
+    {
+        Adc_Adc12bsarv2_Sim_Tick();
+        u32Word = Adc_Adc12bsarv2_Sim_ReadWord((uint32)Address) & (~((uint32)0xFFFFUL << u32Shift));
+        Adc_Adc12bsarv2_Sim_WriteWord((uint32)Address, u32Word | ((uint32)u16Value << u32Shift));
+    }
+}
+
+/** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_4 External linkage */
+uint16 Mcal_SimRegRead16(Mcal_SimAddressType Address)
+{
+    VAR(uint16, AUTOMATIC) u16Value;
+
+    if (Address > ADC_SIM_BUS_ADDRESS_MAX)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_6 cast from integral type to pointer */
+        u16Value = *((P2CONST(volatile uint16, AUTOMATIC, ADC_APPL_DATA))Address);
+    }
+    else
+    {
+        Adc_Adc12bsarv2_Sim_Tick();
+        u16Value = (uint16)(Adc_Adc12bsarv2_Sim_ReadWord((uint32)Address) >> (((uint32)Address & 2UL) << 3U));
+    }
+    return u16Value;
+}
+
+/** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_4 External linkage */
+void Mcal_SimRegWrite8(Mcal_SimAddressType Address, uint8 u8Value)
+{
+    VAR(uint32, AUTOMATIC) u32Shift = ((uint32)Address & 3UL) << 3U;
+    VAR(uint32, AUTOMATIC) u32Word;
+
+    if (Address > ADC_SIM_BUS_ADDRESS_MAX)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_6 cast from integral type to pointer */
+        *((P2VAR(volatile uint8, AUTOMATIC, ADC_APPL_DATA))Address) = u8Value;
+    }
+    else
+    {
+        Adc_Adc12bsarv2_Sim_Tick();
+        u32Word = Adc_Adc12bsarv2_Sim_ReadWord((uint32)Address) & (~((uint32)0xFFUL << u32Shift));
+        Adc_Adc12bsarv2_Sim_WriteWord((uint32)Address, u32Word | ((uint32)u8Value << u32Shift));
+    }
+}
+
+/** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_4 External linkage */
+uint8 Mcal_SimRegRead8(Mcal_SimAddressType Address)
+{
+    VAR(uint8, AUTOMATIC) u8Value;
+
+    if (Address > ADC_SIM_BUS_ADDRESS_MAX)
+    {
+        /** @violates @ref Adc_Adc12bsarv2_Sim_c_REF_6 cast from integral type to pointer */
+        u8Value = *((P2CONST(volatile uint8, AUTOMATIC, ADC_APPL_DATA))Address);
+    }
+    else
+    {
+        Adc_Adc12bsarv2_Sim_Tick();
+        u8Value = (uint8)(Adc_Adc12bsarv2_Sim_ReadWord((uint32)Address) >> (((uint32)Address & 3UL) << 3U));
+    }
+    return u8Value;
+}
+
+#define ADC_STOP_SEC_CODE
+/**
+ * @violates @ref Adc_Adc12bsarv2_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Adc12bsarv2_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+#endif /* MCAL_REG_SIMULATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
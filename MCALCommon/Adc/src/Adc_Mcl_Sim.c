@@ -0,0 +1,824 @@
+/**
+*   @file    Adc_Mcl_Sim.c
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - eDMA host model.
+*   @details Host side stand-in of the Mcl DMA services called by the ADC driver. Channel TCDs are
+*            kept in the eDMA layout and executed by a small engine: ADC units with DMAEN request
+*            minor loops through the ADC register model, memory to register TCDs started with
+*            START run at once, and scatter/gather, major link, DREQ and the major and half
+*            interrupts are applied at the end of each major loop.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Mcl_Sim_c_REF_1
+* Violates MISRA 2004 Advisory Rule 19.1, only preprocessor statements and comments before "#include"
+* This violation is not fixed since the inclusion of MemMap.h is as per Autosar requirement.
+*
+* @section Adc_Mcl_Sim_c_REF_2
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Mcl_Sim_c_REF_3
+* Violates MISRA 2004 Required Rule 1.4, The compiler/linker shall be checked to ensure that
+* 31 characters significance and case sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section Adc_Mcl_Sim_c_REF_4
+* Violates MISRA 2004 Required Rule 8.10, all declarations and definitions of objects or functions
+* at file scope shall have internal linkage unless external linkage is required.
+* The Mcl services are referenced from the ADC driver.
+*
+* @section Adc_Mcl_Sim_c_REF_5
+* Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined
+* This violation is due to function like macros defined for TCD field decoding.
+*
+* @section Adc_Mcl_Sim_c_REF_6
+* Violates MISRA 2004 Required Rule 11.3, A cast should not be performed between a pointer type and
+* an integral type. The engine moves data between bus addresses held in the TCDs.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Adc_Mcl_Sim.h"
+#include "Adc_Pdb_Sim.h"
+#include "StdRegMacros.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_MCL_SIM_C                    43
+/** @violates @ref Adc_Mcl_Sim_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MAJOR_VERSION_MCL_SIM_C     4
+/** @violates @ref Adc_Mcl_Sim_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MINOR_VERSION_MCL_SIM_C     2
+/** @violates @ref Adc_Mcl_Sim_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_REVISION_VERSION_MCL_SIM_C  2
+#define ADC_SW_MAJOR_VERSION_MCL_SIM_C             1
+#define ADC_SW_MINOR_VERSION_MCL_SIM_C             0
+#define ADC_SW_PATCH_VERSION_MCL_SIM_C             3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if source file and Adc_Mcl_Sim header file are of the same vendor */
+#if (ADC_VENDOR_ID_MCL_SIM_C != ADC_VENDOR_ID_MCL_SIM)
+    #error "Adc_Mcl_Sim.c and Adc_Mcl_Sim.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Mcl_Sim header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_MCL_SIM_C != ADC_AR_RELEASE_MAJOR_VERSION_MCL_SIM) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_MCL_SIM_C != ADC_AR_RELEASE_MINOR_VERSION_MCL_SIM) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_MCL_SIM_C != ADC_AR_RELEASE_REVISION_VERSION_MCL_SIM) \
+    )
+    #error "AutoSar Version Numbers of Adc_Mcl_Sim.c and Adc_Mcl_Sim.h are different"
+#endif
+
+/* Check if source file and Adc_Mcl_Sim header file are of the same Software version */
+#if ((ADC_SW_MAJOR_VERSION_MCL_SIM_C != ADC_SW_MAJOR_VERSION_MCL_SIM) || \
+     (ADC_SW_MINOR_VERSION_MCL_SIM_C != ADC_SW_MINOR_VERSION_MCL_SIM) || \
+     (ADC_SW_PATCH_VERSION_MCL_SIM_C != ADC_SW_PATCH_VERSION_MCL_SIM) \
+    )
+    #error "Software Version Numbers of Adc_Mcl_Sim.c and Adc_Mcl_Sim.h are different"
+#endif
+
+#ifdef MCAL_REG_SIMULATION
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief          State of one modeled eDMA channel.
+*/
+typedef struct
+{
+    Mcl_DmaTcdType Tcd;                         /**< @brief TCD of the channel, eDMA layout */
+    boolean bRequestEnabled;                    /**< @brief ERQ bit of the channel */
+    boolean bIntPending;                        /**< @brief INT bit of the channel */
+    uint8 u8Source;                             /**< @brief ADC unit routed to the channel request */
+    Adc_Mcl_SimNotificationType pfNotification; /**< @brief Transfer complete callback */
+    Adc_Mcl_SimStatisticsType Statistics;       /**< @brief Loop and interrupt counters */
+} Adc_Mcl_SimChannelType;
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/** @brief Words of a TCD: SADDR, SOFF/ATTR, NBYTES, SLAST, DADDR, DOFF/CITER, DLAST_SGA, CSR/BITER */
+#define ADC_MCL_SIM_SADDR_U8                ((uint8)0U)
+#define ADC_MCL_SIM_SOFF_ATTR_U8            ((uint8)1U)
+#define ADC_MCL_SIM_NBYTES_U8               ((uint8)2U)
+#define ADC_MCL_SIM_SLAST_U8                ((uint8)3U)
+#define ADC_MCL_SIM_DADDR_U8                ((uint8)4U)
+#define ADC_MCL_SIM_DOFF_CITER_U8           ((uint8)5U)
+#define ADC_MCL_SIM_DLAST_SGA_U8            ((uint8)6U)
+#define ADC_MCL_SIM_CSR_BITER_U8            ((uint8)7U)
+#define ADC_MCL_SIM_TCD_WORDS_U8            ((uint8)8U)
+
+/** @brief CSR bits handled by the model */
+#define ADC_MCL_SIM_CSR_START_U32           ((uint32)0x0001UL)
+#define ADC_MCL_SIM_CSR_INTMAJOR_U32        ((uint32)0x0002UL)
+#define ADC_MCL_SIM_CSR_INTHALF_U32         ((uint32)0x0004UL)
+#define ADC_MCL_SIM_CSR_DREQ_U32            ((uint32)0x0008UL)
+#define ADC_MCL_SIM_CSR_ESG_U32             ((uint32)0x0010UL)
+#define ADC_MCL_SIM_CSR_MAJORELINK_U32      ((uint32)0x0020UL)
+#define ADC_MCL_SIM_CSR_FLAGS_MASK_U32      ((uint32)0x001FUL)
+#define ADC_MCL_SIM_CSR_LINKCH_SHIFT_U32    ((uint32)8UL)
+#define ADC_MCL_SIM_CSR_LINKCH_MASK_U32     ((uint32)0x0F00UL)
+#define ADC_MCL_SIM_ITER_MASK_U32           ((uint32)0x7FFFUL)
+
+/** @brief Bits of a host address above the 32 bits bus of the engine */
+#define ADC_MCL_SIM_HOST_WINDOW_MASK        (~(Mcal_SimAddressType)0xFFFFFFFFUL)
+
+/**
+* @brief          Host address of a bus address outside the modeled peripherals.
+* @details        The TCD address fields are 32 bits wide. The engine places them in the 4 GiB
+*                 window of the host which holds its own static data, where the driver tables, TCD
+*                 lists and result buffers also are as long as they are statically allocated.
+* @violates @ref Adc_Mcl_Sim_c_REF_5 Function-like macro defined
+* @violates @ref Adc_Mcl_Sim_c_REF_6 Cast from pointer to integral type
+*/
+#define ADC_MCL_SIM_HOST_ADDRESS(u32Address) \
+    ((((Mcal_SimAddressType)&Adc_Mcl_Sim_aChannel[0]) & ADC_MCL_SIM_HOST_WINDOW_MASK) | (Mcal_SimAddressType)(u32Address))
+
+/**
+* @brief          Word of a TCD. The layout of Mcl_DmaTcdType is not used, only its 32 bytes.
+* @violates @ref Adc_Mcl_Sim_c_REF_5 Function-like macro defined
+*/
+#define ADC_MCL_SIM_TCD(pTcd, Word)         (((P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA))(pTcd))[(Word)])
+
+/**
+* @brief          Current major loop iteration count of a TCD.
+* @violates @ref Adc_Mcl_Sim_c_REF_5 Function-like macro defined
+*/
+#define ADC_MCL_SIM_CITER(pTcd)             ((ADC_MCL_SIM_TCD((pTcd), ADC_MCL_SIM_DOFF_CITER_U8) >> 16U) & ADC_MCL_SIM_ITER_MASK_U32)
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+#define ADC_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Mcl_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Mcl_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+static VAR(Adc_Mcl_SimChannelType, ADC_VAR) Adc_Mcl_Sim_aChannel[ADC_MCL_SIM_CHANNELS_U8];
+static VAR(boolean, ADC_VAR) Adc_Mcl_Sim_bInIrq;
+
+#define ADC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Mcl_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Mcl_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/**
+ * @violates @ref Adc_Mcl_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Mcl_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+static FUNC(boolean, ADC_CODE) Adc_Mcl_Sim_IsRegister
+(
+    VAR(uint32, AUTOMATIC) u32Address
+);
+
+static FUNC(uint32, ADC_CODE) Adc_Mcl_Sim_Read
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint32, AUTOMATIC) u32Size
+);
+
+static FUNC(void, ADC_CODE) Adc_Mcl_Sim_Write
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint32, AUTOMATIC) u32Size,
+    VAR(uint32, AUTOMATIC) u32Value
+);
+
+static FUNC(void, ADC_CODE) Adc_Mcl_Sim_MinorLoop
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel
+);
+
+static FUNC(void, ADC_CODE) Adc_Mcl_Sim_Service
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel
+);
+
+static FUNC(boolean, ADC_CODE) Adc_Mcl_Sim_Request
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+
+static FUNC(void, ADC_CODE) Adc_Mcl_Sim_DispatchIrq(void);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          Tells whether a bus address belongs to the register window of a modeled ADC or PDB.
+*/
+static FUNC(boolean, ADC_CODE) Adc_Mcl_Sim_IsRegister
+(
+    VAR(uint32, AUTOMATIC) u32Address
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(boolean, AUTOMATIC) bRegister = (boolean)FALSE;
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        if ((u32Address >= ADC12BSARV2_ADDR32(Unit)) && ((u32Address - ADC12BSARV2_ADDR32(Unit)) < ADC_SIM_REG_WINDOW_U32))
+        {
+            bRegister = (boolean)TRUE;
+        }
+    }
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES; Unit++)
+    {
+        if ((u32Address >= PDB_ADDR32(Unit)) && ((u32Address - PDB_ADDR32(Unit)) < ADC_PDB_SIM_REG_WINDOW_U32))
+        {
+            bRegister = (boolean)TRUE;
+        }
+    }
+    return bRegister;
+}
+
+/**
+* @brief          Reads 1, 2 or 4 bytes from a bus address.
+* @details        Register addresses go through the register accessors so the ADC and PDB models
+*                 see the access. Other addresses are host memory, see ADC_MCL_SIM_HOST_ADDRESS.
+*/
+static FUNC(uint32, ADC_CODE) Adc_Mcl_Sim_Read
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint32, AUTOMATIC) u32Size
+)
+{
+    VAR(uint32, AUTOMATIC) u32Value;
+
+    if ((boolean)TRUE == Adc_Mcl_Sim_IsRegister(u32Address))
+    {
+        if (1UL == u32Size)
+        {
+            u32Value = (uint32)REG_READ8(u32Address);
+        }
+        else if (2UL == u32Size)
+        {
+            u32Value = (uint32)REG_READ16(u32Address);
+        }
+        else
+        {
+            u32Value = REG_READ32(u32Address);
+        }
+    }
+    else if (1UL == u32Size)
+    {
+        /** @violates @ref Adc_Mcl_Sim_c_REF_6 cast from integral type to pointer */
+        u32Value = (uint32)*((P2CONST(uint8, AUTOMATIC, ADC_APPL_DATA))ADC_MCL_SIM_HOST_ADDRESS(u32Address));
+    }
+    else if (2UL == u32Size)
+    {
+        /** @violates @ref Adc_Mcl_Sim_c_REF_6 cast from integral type to pointer */
+        u32Value = (uint32)*((P2CONST(uint16, AUTOMATIC, ADC_APPL_DATA))ADC_MCL_SIM_HOST_ADDRESS(u32Address));
+    }
+    else
+    {
+        /** @violates @ref Adc_Mcl_Sim_c_REF_6 cast from integral type to pointer */
+        u32Value = *((P2CONST(uint32, AUTOMATIC, ADC_APPL_DATA))ADC_MCL_SIM_HOST_ADDRESS(u32Address));
+    }
+    return u32Value;
+}
+
+/**
+* @brief          Writes 1, 2 or 4 bytes to a bus address.
+*/
+static FUNC(void, ADC_CODE) Adc_Mcl_Sim_Write
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint32, AUTOMATIC) u32Size,
+    VAR(uint32, AUTOMATIC) u32Value
+)
+{
+    if ((boolean)TRUE == Adc_Mcl_Sim_IsRegister(u32Address))
+    {
+        if (1UL == u32Size)
+        {
+            REG_WRITE8(u32Address, u32Value);
+        }
+        else if (2UL == u32Size)
+        {
+            REG_WRITE16(u32Address, u32Value);
+        }
+        else
+        {
+            REG_WRITE32(u32Address, u32Value);
+        }
+    }
+    else if (1UL == u32Size)
+    {
+        /** @violates @ref Adc_Mcl_Sim_c_REF_6 cast from integral type to pointer */
+        *((P2VAR(uint8, AUTOMATIC, ADC_APPL_DATA))ADC_MCL_SIM_HOST_ADDRESS(u32Address)) = (uint8)u32Value;
+    }
+    else if (2UL == u32Size)
+    {
+        /** @violates @ref Adc_Mcl_Sim_c_REF_6 cast from integral type to pointer */
+        *((P2VAR(uint16, AUTOMATIC, ADC_APPL_DATA))ADC_MCL_SIM_HOST_ADDRESS(u32Address)) = (uint16)u32Value;
+    }
+    else
+    {
+        /** @violates @ref Adc_Mcl_Sim_c_REF_6 cast from integral type to pointer */
+        *((P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA))ADC_MCL_SIM_HOST_ADDRESS(u32Address)) = u32Value;
+    }
+}
+
+/**
+* @brief          Executes one minor loop of a channel and ends the major loop when CITER reaches 0.
+* @details        Source and destination sizes are expected to match, SMOD and DMOD are ignored.
+*/
+static FUNC(void, ADC_CODE) Adc_Mcl_Sim_MinorLoop
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel
+)
+{
+    P2VAR(Adc_Mcl_SimChannelType, AUTOMATIC, ADC_APPL_DATA) pSim = &Adc_Mcl_Sim_aChannel[Channel];
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd = &pSim->Tcd;
+    P2CONST(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pNext;
+    VAR(uint32, AUTOMATIC) u32Saddr = ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SADDR_U8);
+    VAR(uint32, AUTOMATIC) u32Daddr = ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DADDR_U8);
+    VAR(uint32, AUTOMATIC) u32Attr = ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SOFF_ATTR_U8);
+    VAR(uint32, AUTOMATIC) u32Soff = (uint32)(sint32)(sint16)(uint16)u32Attr;
+    VAR(uint32, AUTOMATIC) u32Doff = (uint32)(sint32)(sint16)(uint16)ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DOFF_CITER_U8);
+    VAR(uint32, AUTOMATIC) u32Size = (uint32)1UL << ((u32Attr >> 24U) & 7UL);
+    VAR(uint32, AUTOMATIC) u32Csr = ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8);
+    VAR(uint32, AUTOMATIC) u32Biter = (u32Csr >> 16U) & ADC_MCL_SIM_ITER_MASK_U32;
+    VAR(uint32, AUTOMATIC) u32Citer = ADC_MCL_SIM_CITER(pTcd);
+    VAR(uint32, AUTOMATIC) u32Count;
+    VAR(uint8, AUTOMATIC) u8Word;
+    VAR(Mcl_ChannelType, AUTOMATIC) LinkChannel;
+
+    for (u32Count = 0UL; u32Count < ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_NBYTES_U8); u32Count += u32Size)
+    {
+        Adc_Mcl_Sim_Write(u32Daddr, u32Size, Adc_Mcl_Sim_Read(u32Saddr, u32Size));
+        u32Saddr += u32Soff;
+        u32Daddr += u32Doff;
+    }
+    pSim->Statistics.u32MinorLoops++;
+    u32Citer = (u32Citer > 0UL) ? (u32Citer - 1UL) : 0UL;
+
+    if ((ADC_MCL_SIM_CSR_INTHALF_U32 == (u32Csr & ADC_MCL_SIM_CSR_INTHALF_U32)) && (u32Citer == (u32Biter >> 1U)))
+    {
+        pSim->bIntPending = (boolean)TRUE;
+    }
+
+    if (0UL == u32Citer)
+    {
+        pSim->Statistics.u32MajorLoops++;
+        if (ADC_MCL_SIM_CSR_INTMAJOR_U32 == (u32Csr & ADC_MCL_SIM_CSR_INTMAJOR_U32))
+        {
+            pSim->bIntPending = (boolean)TRUE;
+        }
+        if (ADC_MCL_SIM_CSR_DREQ_U32 == (u32Csr & ADC_MCL_SIM_CSR_DREQ_U32))
+        {
+            pSim->bRequestEnabled = (boolean)FALSE;
+        }
+        if (ADC_MCL_SIM_CSR_ESG_U32 == (u32Csr & ADC_MCL_SIM_CSR_ESG_U32))
+        {
+            /** @violates @ref Adc_Mcl_Sim_c_REF_6 cast from integral type to pointer */
+            pNext = (P2CONST(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA))ADC_MCL_SIM_HOST_ADDRESS(ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DLAST_SGA_U8));
+            for (u8Word = 0U; u8Word < ADC_MCL_SIM_TCD_WORDS_U8; u8Word++)
+            {
+                ADC_MCL_SIM_TCD(pTcd, u8Word) = ADC_MCL_SIM_TCD(pNext, u8Word);
+            }
+            pSim->Statistics.u32ScatterGathers++;
+        }
+        else
+        {
+            ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SADDR_U8) = u32Saddr + ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SLAST_U8);
+            ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DADDR_U8) = u32Daddr + ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DLAST_SGA_U8);
+            ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DOFF_CITER_U8) = (ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DOFF_CITER_U8) & 0xFFFFUL) | (u32Biter << 16U);
+        }
+        if (ADC_MCL_SIM_CSR_MAJORELINK_U32 == (u32Csr & ADC_MCL_SIM_CSR_MAJORELINK_U32))
+        {
+            LinkChannel = (Mcl_ChannelType)((u32Csr & ADC_MCL_SIM_CSR_LINKCH_MASK_U32) >> ADC_MCL_SIM_CSR_LINKCH_SHIFT_U32);
+            if ((LinkChannel != Channel) && (LinkChannel < ADC_MCL_SIM_CHANNELS_U8))
+            {
+                ADC_MCL_SIM_TCD(&Adc_Mcl_Sim_aChannel[LinkChannel].Tcd, ADC_MCL_SIM_CSR_BITER_U8) |= ADC_MCL_SIM_CSR_START_U32;
+                Adc_Mcl_Sim_Service(LinkChannel);
+            }
+        }
+    }
+    else
+    {
+        ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SADDR_U8) = u32Saddr;
+        ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DADDR_U8) = u32Daddr;
+        ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DOFF_CITER_U8) = (ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DOFF_CITER_U8) & 0xFFFFUL) | (u32Citer << 16U);
+    }
+}
+
+/**
+* @brief          Serves one request of a channel.
+* @details        A TCD loaded with START set, by scatter/gather or by a major link, is run at once,
+*                 so a list of register copies executes as one request.
+*/
+static FUNC(void, ADC_CODE) Adc_Mcl_Sim_Service
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel
+)
+{
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd = &Adc_Mcl_Sim_aChannel[Channel].Tcd;
+
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8) &= ~ADC_MCL_SIM_CSR_START_U32;
+    Adc_Mcl_Sim_MinorLoop(Channel);
+    while (ADC_MCL_SIM_CSR_START_U32 == (ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8) & ADC_MCL_SIM_CSR_START_U32))
+    {
+        ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8) &= ~ADC_MCL_SIM_CSR_START_U32;
+        Adc_Mcl_Sim_MinorLoop(Channel);
+    }
+}
+
+/**
+* @brief          DMA request of an ADC unit, called by the ADC model while a COCO is set with DMAEN.
+*
+* @return         boolean     TRUE if a channel accepted the request.
+*/
+static FUNC(boolean, ADC_CODE) Adc_Mcl_Sim_Request
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel;
+    VAR(boolean, AUTOMATIC) bServed = (boolean)FALSE;
+
+    for (Channel = 0U; (Channel < ADC_MCL_SIM_CHANNELS_U8) && ((boolean)FALSE == bServed); Channel++)
+    {
+        if (((uint8)Unit == Adc_Mcl_Sim_aChannel[Channel].u8Source) && \
+            ((boolean)TRUE == Adc_Mcl_Sim_aChannel[Channel].bRequestEnabled))
+        {
+            Adc_Mcl_Sim_Service(Channel);
+            bServed = (boolean)TRUE;
+        }
+    }
+    return bServed;
+}
+
+/**
+* @brief          Calls the notification of every channel with a pending interrupt.
+*/
+static FUNC(void, ADC_CODE) Adc_Mcl_Sim_DispatchIrq(void)
+{
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel;
+    P2VAR(Adc_Mcl_SimChannelType, AUTOMATIC, ADC_APPL_DATA) pSim;
+
+    if ((boolean)FALSE == Adc_Mcl_Sim_bInIrq)
+    {
+        for (Channel = 0U; Channel < ADC_MCL_SIM_CHANNELS_U8; Channel++)
+        {
+            pSim = &Adc_Mcl_Sim_aChannel[Channel];
+            if (((boolean)TRUE == pSim->bIntPending) && (NULL_PTR != pSim->pfNotification))
+            {
+                pSim->bIntPending = (boolean)FALSE;
+                pSim->Statistics.u32Interrupts++;
+                Adc_Mcl_Sim_bInIrq = (boolean)TRUE;
+                pSim->pfNotification();
+                Adc_Mcl_Sim_bInIrq = (boolean)FALSE;
+            }
+        }
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          Puts every modeled channel in its reset state and attaches the engine.
+* @details        Call after Adc_Adc12bsarv2_Sim_Reset. Requests and interrupts of the channels are
+*                 then served by the ADC model while it advances time.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Mcl_Sim_Reset(void)
+{
+    static CONST(Adc_Adc12bsarv2_SimDmaEngineType, ADC_CONST) Engine = { &Adc_Mcl_Sim_Request, &Adc_Mcl_Sim_DispatchIrq };
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel;
+    VAR(uint8, AUTOMATIC) u8Word;
+    P2VAR(Adc_Mcl_SimChannelType, AUTOMATIC, ADC_APPL_DATA) pSim;
+
+    for (Channel = 0U; Channel < ADC_MCL_SIM_CHANNELS_U8; Channel++)
+    {
+        pSim = &Adc_Mcl_Sim_aChannel[Channel];
+        for (u8Word = 0U; u8Word < ADC_MCL_SIM_TCD_WORDS_U8; u8Word++)
+        {
+            ADC_MCL_SIM_TCD(&pSim->Tcd, u8Word) = 0UL;
+        }
+        pSim->bRequestEnabled = (boolean)FALSE;
+        pSim->bIntPending = (boolean)FALSE;
+        pSim->u8Source = ADC_MCL_SIM_NO_SOURCE_U8;
+        pSim->pfNotification = NULL_PTR;
+        pSim->Statistics.u32MinorLoops = 0UL;
+        pSim->Statistics.u32MajorLoops = 0UL;
+        pSim->Statistics.u32ScatterGathers = 0UL;
+        pSim->Statistics.u32Interrupts = 0UL;
+    }
+    Adc_Mcl_Sim_bInIrq = (boolean)FALSE;
+    Adc_Adc12bsarv2_Sim_SetDmaEngine(&Engine);
+}
+
+/**
+* @brief          Routes the DMA request of an ADC unit to a channel.
+*
+* @param[in]      Channel     The eDMA channel, as configured in au8Adc_DmaChannel.
+* @param[in]      u8Unit      The ADC unit, ADC_MCL_SIM_NO_SOURCE_U8 to disconnect.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Mcl_Sim_SetRequestSource
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel,
+    VAR(uint8, AUTOMATIC) u8Unit
+)
+{
+    if (Channel < ADC_MCL_SIM_CHANNELS_U8)
+    {
+        Adc_Mcl_Sim_aChannel[Channel].u8Source = u8Unit;
+    }
+}
+
+/**
+* @brief          Registers the function called when the channel raises its interrupt.
+*
+* @param[in]      Channel         The eDMA channel.
+* @param[in]      pfNotification  Typically Adc_Adc12bsarv2_DmaTransferCompleteX, NULL_PTR to mask.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Mcl_Sim_SetNotification
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel,
+    VAR(Adc_Mcl_SimNotificationType, AUTOMATIC) pfNotification
+)
+{
+    if (Channel < ADC_MCL_SIM_CHANNELS_U8)
+    {
+        Adc_Mcl_Sim_aChannel[Channel].pfNotification = pfNotification;
+    }
+}
+
+/**
+* @brief          Returns the counters collected for a channel since the last reset.
+*
+* @param[in]      Channel       The eDMA channel.
+* @param[out]     pStatistics   Copy of the channel counters.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Mcl_Sim_GetStatistics
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel,
+    P2VAR(Adc_Mcl_SimStatisticsType, AUTOMATIC, ADC_APPL_DATA) pStatistics
+)
+{
+    if ((Channel < ADC_MCL_SIM_CHANNELS_U8) && (NULL_PTR != pStatistics))
+    {
+        *pStatistics = Adc_Mcl_Sim_aChannel[Channel].Statistics;
+    }
+}
+
+/*==================================================================================================
+*                                 MCL SERVICES USED BY THE DRIVER
+==================================================================================================*/
+/** @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage */
+FUNC(void, ADC_CODE) Mcl_DmaEnableHwRequest(VAR(Mcl_ChannelType, AUTOMATIC) Channel)
+{
+    Adc_Mcl_Sim_aChannel[Channel].bRequestEnabled = (boolean)TRUE;
+}
+
+/** @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage */
+FUNC(void, ADC_CODE) Mcl_DmaDisableHwRequest(VAR(Mcl_ChannelType, AUTOMATIC) Channel)
+{
+    Adc_Mcl_Sim_aChannel[Channel].bRequestEnabled = (boolean)FALSE;
+}
+
+/**
+* @brief          Drops the interrupt pending on the channel.
+* @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage
+*/
+FUNC(void, ADC_CODE) Mcl_DmaDisableNotification(VAR(Mcl_ChannelType, AUTOMATIC) Channel)
+{
+    Adc_Mcl_Sim_aChannel[Channel].bIntPending = (boolean)FALSE;
+}
+
+/** @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage */
+FUNC_P2VAR(Mcl_DmaTcdType, ADC_APPL_DATA, ADC_CODE) Mcl_DmaGetChannelTcdAddress(VAR(Mcl_ChannelType, AUTOMATIC) Channel)
+{
+    return &Adc_Mcl_Sim_aChannel[Channel].Tcd;
+}
+
+/**
+* @brief          Loads a TCD from its attributes: CITER = BITER = iter, SLAST, DLAST and CSR cleared.
+* @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage
+*/
+FUNC(void, ADC_CODE) Mcl_DmaConfigTcd
+(
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd,
+    P2CONST(Mcl_DmaTcdAttributesType, AUTOMATIC, ADC_APPL_CONST) pAttributes
+)
+{
+    VAR(uint32, AUTOMATIC) u32Attr = ((pAttributes->u32smod & 0x1FUL) << 11U) | ((pAttributes->u32ssize & 7UL) << 8U) | \
+                                     ((pAttributes->u32dmod & 0x1FUL) << 3U) | (pAttributes->u32dsize & 7UL);
+    VAR(uint32, AUTOMATIC) u32Iter = pAttributes->u32iter & ADC_MCL_SIM_ITER_MASK_U32;
+
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SADDR_U8) = pAttributes->u32saddr;
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SOFF_ATTR_U8) = (pAttributes->u32soff & 0xFFFFUL) | (u32Attr << 16U);
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_NBYTES_U8) = pAttributes->u32num_bytes;
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SLAST_U8) = 0UL;
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DADDR_U8) = pAttributes->u32daddr;
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DOFF_CITER_U8) = (pAttributes->u32doff & 0xFFFFUL) | (u32Iter << 16U);
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DLAST_SGA_U8) = 0UL;
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8) = u32Iter << 16U;
+}
+
+/**
+* @brief          Loads the channel TCD and starts the linked channel at the end of its major loop.
+* @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage
+*/
+FUNC(void, ADC_CODE) Mcl_DmaConfigLinkedChannel
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel,
+    P2CONST(Mcl_DmaTcdAttributesType, AUTOMATIC, ADC_APPL_CONST) pAttributes,
+    VAR(Mcl_ChannelType, AUTOMATIC) LinkChannel
+)
+{
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd = &Adc_Mcl_Sim_aChannel[Channel].Tcd;
+
+    Mcl_DmaConfigTcd(pTcd, pAttributes);
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8) |= ADC_MCL_SIM_CSR_MAJORELINK_U32 | \
+        (((uint32)LinkChannel << ADC_MCL_SIM_CSR_LINKCH_SHIFT_U32) & ADC_MCL_SIM_CSR_LINKCH_MASK_U32);
+}
+
+/**
+* @brief          Replaces the START, INTMAJOR, INTHALF, DREQ and ESG bits of a TCD.
+* @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage
+*/
+FUNC(void, ADC_CODE) Mcl_DmaTcdSetFlags
+(
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd,
+    VAR(uint8, AUTOMATIC) u8Flags
+)
+{
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8) = (ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8) & (~ADC_MCL_SIM_CSR_FLAGS_MASK_U32)) | \
+                                                      ((uint32)u8Flags & ADC_MCL_SIM_CSR_FLAGS_MASK_U32);
+}
+
+/** @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage */
+FUNC(void, ADC_CODE) Mcl_DmaTcdSetSlast
+(
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd,
+    VAR(sint32, AUTOMATIC) s32Slast
+)
+{
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SLAST_U8) = (uint32)s32Slast;
+}
+
+/**
+* @brief          Sets DLAST, or the address of the next TCD when ESG is used.
+* @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage
+*/
+FUNC(void, ADC_CODE) Mcl_DmaTcdSetDlast
+(
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd,
+    VAR(sint32, AUTOMATIC) s32Dlast
+)
+{
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DLAST_SGA_U8) = (uint32)s32Dlast;
+}
+
+/** @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage */
+FUNC(void, ADC_CODE) Mcl_DmaTcdSetSaddr
+(
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd,
+    VAR(uint32, AUTOMATIC) u32Saddr
+)
+{
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_SADDR_U8) = u32Saddr;
+}
+
+/** @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage */
+FUNC(void, ADC_CODE) Mcl_DmaTcdSetDaddr
+(
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd,
+    VAR(uint32, AUTOMATIC) u32Daddr
+)
+{
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DADDR_U8) = u32Daddr;
+}
+
+/** @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage */
+FUNC(uint16, ADC_CODE) Mcl_DmaTcdGetIterCount
+(
+    P2CONST(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd
+)
+{
+    return (uint16)((((P2CONST(uint32, AUTOMATIC, ADC_APPL_DATA))(pTcd))[ADC_MCL_SIM_DOFF_CITER_U8] >> 16U) & ADC_MCL_SIM_ITER_MASK_U32);
+}
+
+/** @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage */
+FUNC(void, ADC_CODE) Mcl_DmaUpdateIterCount
+(
+    VAR(Mcl_ChannelType, AUTOMATIC) Channel,
+    VAR(uint32, AUTOMATIC) u32Iter
+)
+{
+    P2VAR(Mcl_DmaTcdType, AUTOMATIC, ADC_APPL_DATA) pTcd = &Adc_Mcl_Sim_aChannel[Channel].Tcd;
+
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DOFF_CITER_U8) = (ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_DOFF_CITER_U8) & 0xFFFFUL) | \
+                                                       ((u32Iter & ADC_MCL_SIM_ITER_MASK_U32) << 16U);
+    ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8) = (ADC_MCL_SIM_TCD(pTcd, ADC_MCL_SIM_CSR_BITER_U8) & 0xFFFFUL) | \
+                                                      ((u32Iter & ADC_MCL_SIM_ITER_MASK_U32) << 16U);
+}
+
+/**
+* @brief          Requests are served to completion, a channel is never seen active.
+* @violates @ref Adc_Mcl_Sim_c_REF_4 External linkage
+*/
+FUNC(boolean, ADC_CODE) Mcl_DmaIsTransferActive(VAR(Mcl_ChannelType, AUTOMATIC) Channel)
+{
+    (void)Channel;
+    return (boolean)FALSE;
+}
+
+#define ADC_STOP_SEC_CODE
+/**
+ * @violates @ref Adc_Mcl_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Mcl_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+#endif /* MCAL_REG_SIMULATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -560,7 +560,7 @@ FUNC(void, ADC_CODE) Adc_Pdb_ConfigurePartialConversion
     REG_WRITE32(PDB_MOD_REG_ADDR32(Unit), u16PeriodPdb);
 
     /* Disable others PDB channels to avoid errors when PDB trigger the disabled channels */
-    for(; u8PdbIndex < ADC_PDB_NUM_MODULES; u8PdbIndex++)
+    for(; u8PdbIndex < ADC_PDB_CHANNELS_U8; u8PdbIndex++)
     {
         /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
         /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
@@ -587,9 +587,15 @@ FUNC(void, ADC_CODE) Adc_Pdb_ConfigurePartialConversion
         }
 #endif /* (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING) */
 
-        /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
-        /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
-        REG_BIT_SET32(PDB_SC_REG_ADDR32(Unit), PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32);
+#if (ADC_PAIRED_GROUPS == STD_ON)
+        /* The counters of a pair are triggered together by Adc_Pdb_StartPairedConversion */
+        if ((boolean)FALSE == Adc_aUnitStatus[Unit].bPdbTriggerHeld)
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+        {
+            /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+            REG_BIT_SET32(PDB_SC_REG_ADDR32(Unit), PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32);
+        }
     }
 #if (ADC_SETCHANNEL_API == STD_OFF)
     /* Avoid compiler warning */
@@ -599,6 +605,313 @@ FUNC(void, ADC_CODE) Adc_Pdb_ConfigurePartialConversion
     SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_12();
 }
 
+#if (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON)
+/**
+* @brief          This function computes the PDB part of the register image of a chunk
+* @details        The values are the ones Adc_Pdb_ConfigurePartialConversion writes for the same
+*                 channels and delays, the SETCHANNEL mask aside: the image holds all of them.
+*
+* @param[in]      pGroupPtr               pointer to group configuration
+* @param[in]      pGroupDelay             delays of the group channels
+* @param[in]      u16CurrentChannel       first channel of the chunk
+* @param[in]      u8NumChannel            number of channels of the chunk
+* @param[out]     pImage                  image to fill
+*
+* @return         void
+*
+*/
+/** @violates @ref Adc_Pdb_c_REF_5 External linkage.*/
+FUNC(void, ADC_CODE) Adc_Pdb_BuildPartialConversionImage
+(
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr,
+    P2CONST(uint16, AUTOMATIC, ADC_APPL_CONST) pGroupDelay,
+    VAR(uint16, AUTOMATIC) u16CurrentChannel,
+    VAR(uint8, AUTOMATIC) u8NumChannel,
+    P2VAR(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage
+)
+{
+    VAR(uint8, AUTOMATIC) u8PdbIndex;
+    VAR(uint8, AUTOMATIC) u8PreTriggerCtr;
+    VAR(uint8, AUTOMATIC) u8PdbChannelUsed;
+    VAR(uint16, AUTOMATIC) u16CurrentCh = u16CurrentChannel;
+    VAR(uint32, AUTOMATIC) u32ChEnable;
+    VAR(uint32, AUTOMATIC) u32ChConfig;
+    VAR(uint8, AUTOMATIC) u8LeftChannel = u8NumChannel;
+    VAR(uint8, AUTOMATIC) u8ChUsed;
+    VAR(uint8, AUTOMATIC) u8DelayCount;
+
+    u8PdbChannelUsed = (uint8)ADC_PDB_CHANNELS_USED(u8NumChannel);
+
+    for(u8PdbIndex = 0U; u8PdbIndex < ADC_PDB_CHANNELS_U8; u8PdbIndex++)
+    {
+        pImage->au32PdbChC1[u8PdbIndex] = 0U;
+        pImage->au8PdbDelayCount[u8PdbIndex] = 0U;
+    }
+
+    for(u8PdbIndex = 0U; u8PdbIndex < u8PdbChannelUsed; u8PdbIndex++)
+    {
+        u8ChUsed = ADC_NUM_CHANNELS_USED(u8LeftChannel);
+        u32ChEnable = (uint32)PDB_CHNC1_MASK[u8ChUsed];
+        u32ChConfig = u32ChEnable;
+        u8DelayCount = 1U;
+
+        if(((uint8)STD_ON == pGroupPtr->u8AdcGroupChannelDelays) && ((uint8)STD_OFF == pGroupPtr->u8AdcGroupBackToBack))
+        {
+            /* Delay mode for all pre-triggers */
+            u32ChConfig |= (u32ChEnable << 8U);
+            for(u8PreTriggerCtr = 0U; u8PreTriggerCtr < u8ChUsed; u8PreTriggerCtr++)
+            {
+                /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+                pImage->au16PdbDelay[u8PdbIndex][u8PreTriggerCtr] = pGroupDelay[u16CurrentCh + u8PreTriggerCtr];
+            }
+            u8DelayCount = u8ChUsed;
+        }
+        else if((uint8)STD_ON == pGroupPtr->u8AdcGroupChannelDelays)
+        {
+            /* Back to back mode, pre-trigger 0 delayed except for PDB channel 0 of the chunks after the first one */
+            if(0U == u16CurrentChannel)
+            {
+                /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+                pImage->au16PdbDelay[u8PdbIndex][0U] = pGroupDelay[0] + ((pGroupPtr->u16PdbDelay)*u8PdbIndex);
+            }
+            else if(u8PdbIndex != 0U)
+            {
+                pImage->au16PdbDelay[u8PdbIndex][0U] = (pGroupPtr->u16PdbDelay)*u8PdbIndex;
+            }
+            else
+            {
+                u8DelayCount = 0U;
+            }
+            u32ChConfig |= ((uint32)u8DelayCount << 8U);
+        }
+        else
+        {
+            u32ChConfig |= (1UL << 8U);
+            pImage->au16PdbDelay[u8PdbIndex][0U] = (pGroupPtr->u16PdbDelay)*u8PdbIndex;
+        }
+
+        u8LeftChannel -= u8ChUsed;
+        u16CurrentCh += u8ChUsed;
+
+        if((uint8)STD_ON == pGroupPtr->u8AdcGroupBackToBack)
+        {
+            u32ChConfig |= ((u32ChEnable - 1U) << 16U);
+        }
+
+        pImage->au32PdbChC1[u8PdbIndex] = u32ChConfig;
+        pImage->au8PdbDelayCount[u8PdbIndex] = u8DelayCount;
+    }
+
+#ifdef ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED
+    if((ADC_CONV_MODE_CONTINUOUS == pGroupPtr->eMode) && ((uint8)STD_ON == pGroupPtr->u8AdcWithoutInterrupt))
+    {
+        pImage->u16PdbPeriod = pGroupPtr->u16PdbPeriod;
+    }
+    else
+#endif /* ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED */
+    if((uint8)STD_ON == pGroupPtr->u8AdcGroupChannelDelays)
+    {
+        if((uint8)STD_OFF == pGroupPtr->u8AdcGroupBackToBack)
+        {
+            /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+            pImage->u16PdbPeriod = pGroupDelay[(u16CurrentChannel + u8NumChannel) - 1U];
+        }
+        else
+        {
+            /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+            pImage->u16PdbPeriod = pGroupDelay[0] + (uint16)((pGroupPtr->u16PdbDelay)*((uint16)u8PdbChannelUsed - 1U));
+        }
+    }
+    else
+    {
+        pImage->u16PdbPeriod = (pGroupPtr->u16PdbDelay)*((uint16)u8PdbChannelUsed - 1U);
+    }
+
+    pImage->u8PdbChannelUsed = u8PdbChannelUsed;
+}
+
+/**
+* @brief          This function configures PDB hardware for a conversion from a register image
+* @details        Same register sequence as Adc_Pdb_ConfigurePartialConversion with the values
+*                 taken from the image built by Adc_Pdb_BuildPartialConversionImage.
+*
+* @param[in]      Unit                    the current HW Unit.
+* @param[in]      pGroupPtr               pointer to group configuration
+* @param[in]      Trigger                 hardware or software trigger
+* @param[in]      pImage                  register image of the chunk
+*
+* @return         void
+*
+*/
+/** @violates @ref Adc_Pdb_c_REF_5 External linkage.*/
+FUNC(void, ADC_CODE) Adc_Pdb_LoadPartialConversionImage
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2CONST(Adc_GroupConfigurationType, AUTOMATIC, ADC_APPL_CONST) pGroupPtr,
+    VAR(Adc_HwTriggerTimerType, AUTOMATIC) Trigger,
+    P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage
+)
+{
+    VAR(uint8, AUTOMATIC) u8PdbIndex;
+    VAR(uint8, AUTOMATIC) u8PreTriggerCtr;
+
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_12();
+    /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+    REG_RMW32(PDB_SC_REG_ADDR32(Unit), PDB_SC_TRGSEL_MASK_U32 | PDB_ENABLED_U32, PDB_TRIGGER_N_SEL_U32((uint32)Trigger) | PDB_ENABLED_U32);
+
+    for(u8PdbIndex = 0U; u8PdbIndex < pImage->u8PdbChannelUsed; u8PdbIndex++)
+    {
+        for(u8PreTriggerCtr = 0U; u8PreTriggerCtr < pImage->au8PdbDelayCount[u8PdbIndex]; u8PreTriggerCtr++)
+        {
+            /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+            REG_WRITE32(PDB_CH_N_DLY_X_REG_ADDR32(Unit, u8PdbIndex, u8PreTriggerCtr), pImage->au16PdbDelay[u8PdbIndex][u8PreTriggerCtr]);
+        }
+        /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(PDB_CH_N_C1_REG_ADDR32(Unit, u8PdbIndex), pImage->au32PdbChC1[u8PdbIndex]);
+    }
+
+    /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(PDB_MOD_REG_ADDR32(Unit), pImage->u16PdbPeriod);
+
+    /* au32PdbChC1 is 0 past the PDB channels used */
+    for(; u8PdbIndex < ADC_PDB_CHANNELS_U8; u8PdbIndex++)
+    {
+        /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+        REG_WRITE32(PDB_CH_N_C1_REG_ADDR32(Unit, u8PdbIndex), pImage->au32PdbChC1[u8PdbIndex]);
+    }
+
+    /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+    REG_BIT_SET32(PDB_SC_REG_ADDR32(Unit), PDB_LOAD_OK_U32);
+
+    if (PDB_SOFTWARE_TRIGGER_U32 == Trigger)
+    {
+#if (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING)
+        if ((boolean) TRUE == pGroupPtr->bAdcDoubleBuffering)
+        {
+            /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+            REG_BIT_SET32(PDB_SC_REG_ADDR32(Unit), PDB_CONTINUOUS_MODE_U32);
+        }
+#endif /* (STD_ON == ADC_ENABLE_DOUBLE_BUFFERING) */
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+        /* The counters of a pair are triggered together by Adc_Pdb_StartPairedConversion */
+        if ((boolean)FALSE == Adc_aUnitStatus[Unit].bPdbTriggerHeld)
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+        {
+            /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+            /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+            REG_BIT_SET32(PDB_SC_REG_ADDR32(Unit), PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32);
+        }
+    }
+#if (STD_OFF == ADC_ENABLE_DOUBLE_BUFFERING)
+    /* Avoid compiler warning */
+    (void)pGroupPtr;
+#endif
+
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_12();
+}
+#endif /* (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) */
+
+#if (ADC_DMA_CHAIN_RELOAD == STD_ON)
+/**
+* @brief          This function lays out the PDB part of a register image as copied by the DMA
+* @details        Fills ADC_PDB_RELOAD_BLOCK_WORDS words to be written from MOD onwards in a single
+*                 transfer. CNT is read only, IDLY keeps its current value, CHnS is written with 0
+*                 which clears the channel flags. Pre-triggers past the delay count get a 0 delay,
+*                 they are either disabled in CHnC1 or back to back.
+*
+* @param[in]      Unit                    the current HW Unit.
+* @param[in]      pImage                  register image of the chunk
+* @param[out]     pu32Block               ADC_PDB_RELOAD_BLOCK_WORDS words to fill
+*
+* @return         void
+*
+*/
+/** @violates @ref Adc_Pdb_c_REF_5 External linkage.*/
+FUNC(void, ADC_CODE) Adc_Pdb_BuildReloadBlock
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2CONST(Adc_RegisterImageType, AUTOMATIC, ADC_APPL_DATA) pImage,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pu32Block
+)
+{
+    VAR(uint8, AUTOMATIC) u8PdbIndex;
+    VAR(uint8, AUTOMATIC) u8PreTriggerCtr;
+    VAR(uint32, AUTOMATIC) u32Word;
+
+    /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+    pu32Block[0] = (uint32)pImage->u16PdbPeriod;
+    /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+    pu32Block[1] = 0UL;
+    /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+    /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+    pu32Block[2] = REG_READ32(PDB_IDLY_REG_ADDR32(Unit));
+
+    u32Word = 3UL;
+    for(u8PdbIndex = 0U; u8PdbIndex < ADC_PDB_CHANNELS_U8; u8PdbIndex++)
+    {
+        /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+        pu32Block[u32Word] = pImage->au32PdbChC1[u8PdbIndex];
+        /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+        pu32Block[u32Word + 1UL] = 0UL;
+        u32Word += 2UL;
+        for(u8PreTriggerCtr = 0U; u8PreTriggerCtr < ADC_PDB_NUM_DELAY_REGISTER; u8PreTriggerCtr++)
+        {
+            if (u8PreTriggerCtr < pImage->au8PdbDelayCount[u8PdbIndex])
+            {
+                /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+                pu32Block[u32Word] = (uint32)pImage->au16PdbDelay[u8PdbIndex][u8PreTriggerCtr];
+            }
+            else
+            {
+                /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+                pu32Block[u32Word] = 0UL;
+            }
+            u32Word++;
+        }
+    }
+}
+
+/**
+* @brief          This function computes the SC writes which start a reloaded chunk
+* @details        The chunks after the first one are software triggered, see
+*                 Adc_Adc12bsarv2_EndDmaPartialConversion. The first word selects the software
+*                 trigger and sets LDOK, the second one sets SWTRIG, both keep the other SC fields.
+*
+* @param[in]      Unit                    the current HW Unit.
+* @param[out]     pu32Sc                  the two SC values, written in this order
+*
+* @return         void
+*
+*/
+/** @violates @ref Adc_Pdb_c_REF_5 External linkage.*/
+FUNC(void, ADC_CODE) Adc_Pdb_BuildReloadTrigger
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pu32Sc
+)
+{
+    VAR(uint32, AUTOMATIC) u32Sc;
+
+    /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+    u32Sc = REG_READ32(PDB_SC_REG_ADDR32(Unit)) & (~(PDB_SC_TRGSEL_MASK_U32 | PDB_LOAD_OK_U32 | PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32));
+    u32Sc |= PDB_TRIGGER_N_SEL_U32(PDB_SOFTWARE_TRIGGER_U32) | PDB_ENABLED_U32;
+    /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+    pu32Sc[0] = u32Sc | PDB_LOAD_OK_U32;
+    /** @violates @ref Adc_Pdb_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
+    pu32Sc[1] = u32Sc | PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32;
+}
+#endif /* (ADC_DMA_CHAIN_RELOAD == STD_ON) */
+
 /**
 * @brief          This function start software conversion via PDB
 * @details        This function is used when no need to reconfigure PDB channels
@@ -615,11 +928,58 @@ FUNC(void, ADC_CODE) Adc_Pdb_StartSoftwareConversion
 )
 {
     SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_13();
+#if (ADC_PAIRED_GROUPS == STD_ON)
+    if ((boolean)FALSE == Adc_aUnitStatus[Unit].bPdbTriggerHeld)
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
+    {
+        /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+        /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+        REG_BIT_SET32(PDB_SC_REG_ADDR32(Unit), PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32);
+    }
+    SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_13();
+}
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+/**
+* @brief          This function triggers the PDB counters of the two units of a paired group.
+* @details        The two SC values are computed first so that only the two register writes
+*                 separate the starts of the counters. Both units must have been configured with
+*                 their software trigger held, which is released here.
+*
+* @param[in]      UnitA                   the HW Unit of the first half.
+* @param[in]      UnitB                   the HW Unit of the second half.
+*
+* @return         void
+*
+*/
+/** @violates @ref Adc_Pdb_c_REF_5 External linkage.*/
+FUNC(void, ADC_CODE) Adc_Pdb_StartPairedConversion
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) UnitA,
+    VAR(Adc_HwUnitType, AUTOMATIC) UnitB
+)
+{
+    VAR(uint32, AUTOMATIC) u32ScA;
+    VAR(uint32, AUTOMATIC) u32ScB;
+
+    SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_13();
+    Adc_aUnitStatus[UnitA].bPdbTriggerHeld = (boolean)FALSE;
+    Adc_aUnitStatus[UnitB].bPdbTriggerHeld = (boolean)FALSE;
+    /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+    u32ScA = REG_READ32(PDB_SC_REG_ADDR32(UnitA)) | PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32;
+    /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+    u32ScB = REG_READ32(PDB_SC_REG_ADDR32(UnitB)) | PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32;
+    /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
+    /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
+    REG_WRITE32(PDB_SC_REG_ADDR32(UnitA), u32ScA);
     /** @violates @ref Adc_Pdb_c_REF_3 cast from unsigned long to pointer */
     /** @violates @ref Adc_Pdb_c_REF_7 A cast should not be performed between a pointer type and an integral type. */
-    REG_BIT_SET32(PDB_SC_REG_ADDR32(Unit), PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32);
+    REG_WRITE32(PDB_SC_REG_ADDR32(UnitB), u32ScB);
     SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_13();
 }
+#endif /* (ADC_PAIRED_GROUPS == STD_ON) */
 
 #ifdef ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED
 /**
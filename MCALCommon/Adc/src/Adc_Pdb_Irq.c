@@ -94,6 +94,7 @@ extern "C"{
 ==================================================================================================*/
 #include "Mcal.h"
 #include "Adc_Pdb.h"
+#include "Adc_Trace.h"
 #ifndef USER_MODE_REG_PROT_ENABLED
 #define USER_MODE_REG_PROT_ENABLED                (ADC_USER_MODE_REG_PROT_ENABLED)
 #endif
@@ -137,6 +138,27 @@ extern "C"{
     #error "Software Version Numbers of Adc_Pdb_Irq.c and Adc_Pdb.h are different"
 #endif
 
+/* Check if source file and Adc_Trace header file are of the same vendor */
+#if (ADC_AR_VENDOR_ID_PDB_IRQ_C != ADC_VENDOR_ID_TRACE)
+    #error "Adc_Pdb_Irq.c and Adc_Trace.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_PDB_IRQ_C != ADC_AR_RELEASE_MAJOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_PDB_IRQ_C != ADC_AR_RELEASE_MINOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_PDB_IRQ_C != ADC_AR_RELEASE_REVISION_VERSION_TRACE) \
+    )
+    #error "AutoSar Version Numbers of Adc_Pdb_Irq.c and Adc_Trace.h are different"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Software version */
+#if ((ADC_SW_MAJOR_VERSION_PDB_IRQ_C != ADC_SW_MAJOR_VERSION_TRACE) || \
+     (ADC_SW_MINOR_VERSION_PDB_IRQ_C != ADC_SW_MINOR_VERSION_TRACE) || \
+     (ADC_SW_PATCH_VERSION_PDB_IRQ_C != ADC_SW_PATCH_VERSION_TRACE) \
+    )
+    #error "Software Version Numbers of Adc_Pdb_Irq.c and Adc_Trace.h are different"
+#endif
+
 /** @violates @ref Adc_Pdb_Irq_c_REF_4 MISRA-C:2004 Rule 1.4: Identifier clash.*/
 #ifndef DISABLE_MCAL_INTERMODULE_ASR_CHECK
  /* Check if source file and Mcal header file are of the same AutoSar version */
@@ -288,6 +310,10 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Pdb_ChannelSequenceError
                 /** @violates @ref Adc_Pdb_Irq_c_REF_3 cast from unsigned long to pointer */
                 /** @violates @ref Adc_Pdb_Irq_c_REF_5 A cast should not be performed between a pointer type and an integral type. */
                 REG_WRITE32(PDB_SC_REG_ADDR32(u8Unit), u32TempSC);
+#if (ADC_EVENT_TRACE == STD_ON)
+                /* The group is the one converting on the unit, known by the trace decoder */
+                Adc_Trace_Record(ADC_TRACE_EV_PDB_ERROR_U8, (Adc_HwUnitType)u8Unit, ADC_TRACE_NO_GROUP_U16, (uint16)u8PDBChannelCount);
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
                 
                 HwIndex = Adc_pCfgPtr->Misc.aHwLogicalId[u8Unit];
                 /** @violates @ref Adc_Pdb_Irq_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
@@ -355,7 +381,7 @@ LOCAL_INLINE FUNC(void, ADC_CODE) Adc_Pdb_ReConfigureDma
     CurrentChannel = (Adc_ChannelIndexType)ADC_PRE_CHANNEL_INDEX(Adc_aGroupStatus[Group].CurrentChannel);
     DmaChannel = (Mcl_ChannelType)Adc_pCfgPtr->Misc.au8Adc_DmaChannel[u8Unit];
     /** @violates @ref Adc_Pdb_Irq_c_REF_6 Array indexing shall be the only allowed form of pointer arithmetic */
-    pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + Adc_aGroupStatus[Group].ResultIndex + (CurrentChannel * Adc_pCfgPtr->pGroups[Group].NumSamples);
+    pResult = Adc_pCfgPtr->pGroups[Group].pResultsBufferPtr[Group] + ADC_RESULT_SAMPLE_OFFSET(Group, Adc_aGroupStatus[Group].ResultIndex) + ((uint32)CurrentChannel * ADC_RESULT_CHANNEL_STRIDE(Group));
     
     /* waiting dma transfering finished before update new setting */
     /* ADC235, ADC068 */
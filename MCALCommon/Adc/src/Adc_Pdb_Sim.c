@@ -0,0 +1,879 @@
+/**
+*   @file    Adc_Pdb_Sim.c
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - PDB host model.
+*   @details Host side model of the PDB counter, the MOD reload, the CHnDLYm pre-trigger delays,
+*            back-to-back chaining and the CHnS sequence error flags. Every pre-trigger, every
+*            acknowledge from the ADC and every sequence error is stored with its timestamp so the
+*            sampling timeline of a group can be reconstructed off-target.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Pdb_Sim_c_REF_1
+* Violates MISRA 2004 Advisory Rule 19.1, only preprocessor statements and comments before "#include"
+* This violation is not fixed since the inclusion of MemMap.h is as per Autosar requirement.
+*
+* @section Adc_Pdb_Sim_c_REF_2
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Pdb_Sim_c_REF_3
+* Violates MISRA 2004 Required Rule 1.4, The compiler/linker shall be checked to ensure that
+* 31 characters significance and case sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section Adc_Pdb_Sim_c_REF_4
+* Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined
+* This violation is due to function like macros defined for register offset decoding.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Adc_Pdb_Sim.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_PDB_SIM_C                    43
+/** @violates @ref Adc_Pdb_Sim_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MAJOR_VERSION_PDB_SIM_C     4
+/** @violates @ref Adc_Pdb_Sim_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MINOR_VERSION_PDB_SIM_C     2
+/** @violates @ref Adc_Pdb_Sim_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_REVISION_VERSION_PDB_SIM_C  2
+#define ADC_SW_MAJOR_VERSION_PDB_SIM_C             1
+#define ADC_SW_MINOR_VERSION_PDB_SIM_C             0
+#define ADC_SW_PATCH_VERSION_PDB_SIM_C             3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if source file and Adc_Pdb_Sim header file are of the same vendor */
+#if (ADC_VENDOR_ID_PDB_SIM_C != ADC_VENDOR_ID_PDB_SIM)
+    #error "Adc_Pdb_Sim.c and Adc_Pdb_Sim.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Pdb_Sim header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_PDB_SIM_C != ADC_AR_RELEASE_MAJOR_VERSION_PDB_SIM) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_PDB_SIM_C != ADC_AR_RELEASE_MINOR_VERSION_PDB_SIM) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_PDB_SIM_C != ADC_AR_RELEASE_REVISION_VERSION_PDB_SIM) \
+    )
+    #error "AutoSar Version Numbers of Adc_Pdb_Sim.c and Adc_Pdb_Sim.h are different"
+#endif
+
+/* Check if source file and Adc_Pdb_Sim header file are of the same Software version */
+#if ((ADC_SW_MAJOR_VERSION_PDB_SIM_C != ADC_SW_MAJOR_VERSION_PDB_SIM) || \
+     (ADC_SW_MINOR_VERSION_PDB_SIM_C != ADC_SW_MINOR_VERSION_PDB_SIM) || \
+     (ADC_SW_PATCH_VERSION_PDB_SIM_C != ADC_SW_PATCH_VERSION_PDB_SIM) \
+    )
+    #error "Software Version Numbers of Adc_Pdb_Sim.c and Adc_Pdb_Sim.h are different"
+#endif
+
+#ifdef MCAL_REG_SIMULATION
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief          State of one modeled PDB.
+*/
+typedef struct
+{
+    uint32 au32Reg[ADC_PDB_SIM_REG_WINDOW_U32 >> 2U];   /**< @brief Register image of the PDB */
+    boolean bRunning;                                   /**< @brief Counter is counting */
+    uint64 u64CycleStart;                               /**< @brief Time at which CNT was 0 */
+    uint8 au8Fired[ADC_PDB_CHANNELS_U8];                /**< @brief Pre-triggers asserted this cycle */
+    uint8 au8Outstanding[ADC_PDB_CHANNELS_U8];          /**< @brief Pre-trigger waiting for COCO */
+    Adc_Pdb_SimIrqType pfErrIrqHandler;                 /**< @brief Sequence error handler */
+} Adc_Pdb_SimUnitType;
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/** @brief No pre-trigger is waiting for the ADC */
+#define ADC_PDB_SIM_NONE_U8                 ((uint8)0xFFU)
+
+/**
+* @brief          Register image word of a PDB, addressed with the PDB_*_REG_ADDR32 macros.
+* @violates @ref Adc_Pdb_Sim_c_REF_4 Function-like macro defined
+*/
+#define ADC_PDB_SIM_REG(Unit, RegAddr)      (Adc_Pdb_Sim_aUnit[(Unit)].au32Reg[((RegAddr) - PDB_ADDR32(Unit)) >> 2U])
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+#define ADC_START_SEC_CONST_32
+/**
+ * @violates @ref Adc_Pdb_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Pdb_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+/** @brief Counter clock divider selected by SC[MULT] */
+static CONST(uint32, ADC_CONST) Adc_Pdb_Sim_au32Mult[4U] = { 1UL, 10UL, 20UL, 40UL };
+
+#define ADC_STOP_SEC_CONST_32
+/**
+ * @violates @ref Adc_Pdb_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Pdb_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+#define ADC_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Pdb_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Pdb_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+static VAR(Adc_Pdb_SimUnitType, ADC_VAR) Adc_Pdb_Sim_aUnit[ADC_PDB_NUM_MODULES];
+static VAR(Adc_Pdb_SimTraceType, ADC_VAR) Adc_Pdb_Sim_aTrace[ADC_PDB_SIM_TRACE_SIZE_U16];
+static VAR(uint16, ADC_VAR) Adc_Pdb_Sim_u16TraceHead;
+static VAR(uint16, ADC_VAR) Adc_Pdb_Sim_u16TraceCount;
+static VAR(boolean, ADC_VAR) Adc_Pdb_Sim_bInIrq;
+
+#define ADC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Pdb_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Pdb_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/**
+ * @violates @ref Adc_Pdb_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Pdb_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+static FUNC(void, ADC_CODE) Adc_Pdb_Sim_Trace
+(
+    VAR(Adc_Pdb_SimEventType, AUTOMATIC) eEvent,
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Channel,
+    VAR(uint8, AUTOMATIC) u8PreTrigger
+);
+
+static FUNC(uint32, ADC_CODE) Adc_Pdb_Sim_CountCycles
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+);
+
+static FUNC(void, ADC_CODE) Adc_Pdb_Sim_StartCycle
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint64, AUTOMATIC) u64Time
+);
+
+static FUNC(void, ADC_CODE) Adc_Pdb_Sim_Fire
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Channel,
+    VAR(uint8, AUTOMATIC) u8PreTrigger
+);
+
+static FUNC(boolean, ADC_CODE) Adc_Pdb_Sim_NextUnitEvent
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(uint64, AUTOMATIC, ADC_APPL_DATA) pTime,
+    P2VAR(uint8, AUTOMATIC, ADC_APPL_DATA) pChannel,
+    P2VAR(uint8, AUTOMATIC, ADC_APPL_DATA) pPreTrigger
+);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          Appends an event to the timestamp trace.
+*/
+static FUNC(void, ADC_CODE) Adc_Pdb_Sim_Trace
+(
+    VAR(Adc_Pdb_SimEventType, AUTOMATIC) eEvent,
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Channel,
+    VAR(uint8, AUTOMATIC) u8PreTrigger
+)
+{
+    P2VAR(Adc_Pdb_SimTraceType, AUTOMATIC, ADC_APPL_DATA) pEntry = &Adc_Pdb_Sim_aTrace[Adc_Pdb_Sim_u16TraceHead];
+
+    pEntry->u64Time = Adc_Adc12bsarv2_Sim_GetTime();
+    pEntry->eEvent = eEvent;
+    pEntry->u8Unit = (uint8)Unit;
+    pEntry->u8Channel = u8Channel;
+    pEntry->u8PreTrigger = u8PreTrigger;
+
+    Adc_Pdb_Sim_u16TraceHead = (uint16)((Adc_Pdb_Sim_u16TraceHead + 1U) % ADC_PDB_SIM_TRACE_SIZE_U16);
+    if (Adc_Pdb_Sim_u16TraceCount < ADC_PDB_SIM_TRACE_SIZE_U16)
+    {
+        Adc_Pdb_Sim_u16TraceCount++;
+    }
+}
+
+/**
+* @brief          Returns the duration of one counter increment.
+* @details        The counter runs from the same clock as the ADC model, divided by the PRESCALER
+*                 and MULT fields of SC.
+*/
+static FUNC(uint32, ADC_CODE) Adc_Pdb_Sim_CountCycles
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(uint32, AUTOMATIC) u32Sc = ADC_PDB_SIM_REG(Unit, PDB_SC_REG_ADDR32(Unit));
+
+    return Adc_Pdb_Sim_au32Mult[(u32Sc >> 2U) & 3UL] << ((u32Sc >> 12U) & 7UL);
+}
+
+/**
+* @brief          Starts a counter cycle: CNT restarts from 0 and all pre-triggers are rearmed.
+*/
+static FUNC(void, ADC_CODE) Adc_Pdb_Sim_StartCycle
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint64, AUTOMATIC) u64Time
+)
+{
+    VAR(uint8, AUTOMATIC) u8Channel;
+
+    Adc_Pdb_Sim_aUnit[Unit].bRunning = (boolean)TRUE;
+    Adc_Pdb_Sim_aUnit[Unit].u64CycleStart = u64Time;
+    for (u8Channel = 0U; u8Channel < ADC_PDB_CHANNELS_U8; u8Channel++)
+    {
+        Adc_Pdb_Sim_aUnit[Unit].au8Fired[u8Channel] = 0U;
+    }
+    Adc_Pdb_Sim_Trace(ADC_PDB_SIM_CYCLE_START, Unit, 0U, 0U);
+}
+
+/**
+* @brief          Asserts a pre-trigger.
+* @details        A channel accepts a new pre-trigger only once the ADC acknowledged the previous
+*                 one with COCO, otherwise the ERR flag of the pre-trigger is set in CHnS and the
+*                 ADC is not triggered.
+*/
+static FUNC(void, ADC_CODE) Adc_Pdb_Sim_Fire
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Channel,
+    VAR(uint8, AUTOMATIC) u8PreTrigger
+)
+{
+    P2VAR(Adc_Pdb_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim = &Adc_Pdb_Sim_aUnit[Unit];
+
+    pSim->au8Fired[u8Channel] |= (uint8)(1U << u8PreTrigger);
+    if (ADC_PDB_SIM_NONE_U8 != pSim->au8Outstanding[u8Channel])
+    {
+        ADC_PDB_SIM_REG(Unit, PDB_CH_N_S_REG_ADDR32(Unit, (uint32)u8Channel)) |= ((uint32)1UL << u8PreTrigger);
+        Adc_Pdb_Sim_Trace(ADC_PDB_SIM_SEQUENCE_ERROR, Unit, u8Channel, u8PreTrigger);
+    }
+    else
+    {
+        pSim->au8Outstanding[u8Channel] = u8PreTrigger;
+        Adc_Pdb_Sim_Trace(ADC_PDB_SIM_PRETRIGGER, Unit, u8Channel, u8PreTrigger);
+        Adc_Adc12bsarv2_Sim_HwTrigger(Unit, (uint8)((u8Channel * ADC_PDB_SIM_PRETRIGGERS_U8) + u8PreTrigger));
+    }
+}
+
+/**
+* @brief          Finds the next timed event of a PDB.
+* @details        Timed events are the pre-triggers which are enabled, not chained back-to-back and
+*                 not yet asserted in this cycle, at CHnDLYm when the delay is selected by TOS or
+*                 at the start of the cycle otherwise, and the reload at MOD.
+*
+* @param[out]     pChannel      Channel of the pre-trigger, ADC_PDB_SIM_NONE_U8 for the reload.
+*
+* @return         boolean       TRUE if the counter is running.
+*/
+static FUNC(boolean, ADC_CODE) Adc_Pdb_Sim_NextUnitEvent
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    P2VAR(uint64, AUTOMATIC, ADC_APPL_DATA) pTime,
+    P2VAR(uint8, AUTOMATIC, ADC_APPL_DATA) pChannel,
+    P2VAR(uint8, AUTOMATIC, ADC_APPL_DATA) pPreTrigger
+)
+{
+    P2VAR(Adc_Pdb_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim = &Adc_Pdb_Sim_aUnit[Unit];
+    VAR(uint64, AUTOMATIC) u64Count = (uint64)Adc_Pdb_Sim_CountCycles(Unit);
+    VAR(uint64, AUTOMATIC) u64Time;
+    VAR(uint32, AUTOMATIC) u32C1;
+    VAR(uint8, AUTOMATIC) u8Channel;
+    VAR(uint8, AUTOMATIC) u8PreTrigger;
+
+    if ((boolean)TRUE == pSim->bRunning)
+    {
+        *pTime = pSim->u64CycleStart + \
+                 (((uint64)(ADC_PDB_SIM_REG(Unit, PDB_MOD_REG_ADDR32(Unit)) & PDB_MOD_MASK_U32) + 1ULL) * u64Count);
+        *pChannel = ADC_PDB_SIM_NONE_U8;
+        *pPreTrigger = ADC_PDB_SIM_NONE_U8;
+        for (u8Channel = 0U; u8Channel < ADC_PDB_CHANNELS_U8; u8Channel++)
+        {
+            u32C1 = ADC_PDB_SIM_REG(Unit, PDB_CH_N_C1_REG_ADDR32(Unit, (uint32)u8Channel));
+            for (u8PreTrigger = 0U; u8PreTrigger < ADC_PDB_SIM_PRETRIGGERS_U8; u8PreTrigger++)
+            {
+                if ((0UL != (u32C1 & PDB_PRE_TRIGGER_CH_ENABLED_MASK_U32((uint32)u8PreTrigger))) && \
+                    ((0U == u8PreTrigger) || (0UL == (u32C1 & PDB_PRE_TRIGGER_BB_CH_MASK_U32((uint32)u8PreTrigger)))) && \
+                    (0U == (pSim->au8Fired[u8Channel] & (uint8)(1U << u8PreTrigger))))
+                {
+                    u64Time = pSim->u64CycleStart;
+                    if (0UL != (u32C1 & PDB_PRE_TRIGGER_OUTPUT_MASK_U32((uint32)u8PreTrigger)))
+                    {
+                        u64Time += (uint64)(ADC_PDB_SIM_REG(Unit, PDB_CH_N_DLY_X_REG_ADDR32(Unit, (uint32)u8Channel, (uint32)u8PreTrigger)) & \
+                                            PDB_CHANNEL_DELAY_MASK_U32) * u64Count;
+                    }
+                    if (u64Time <= *pTime)
+                    {
+                        *pTime = u64Time;
+                        *pChannel = u8Channel;
+                        *pPreTrigger = u8PreTrigger;
+                    }
+                }
+            }
+        }
+    }
+    return pSim->bRunning;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          Puts every modeled PDB in its reset state and clears the trace.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_Reset(void)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint32, AUTOMATIC) u32Index;
+    VAR(uint8, AUTOMATIC) u8Channel;
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES; Unit++)
+    {
+        for (u32Index = 0UL; u32Index < (ADC_PDB_SIM_REG_WINDOW_U32 >> 2U); u32Index++)
+        {
+            Adc_Pdb_Sim_aUnit[Unit].au32Reg[u32Index] = 0UL;
+        }
+        ADC_PDB_SIM_REG(Unit, PDB_MOD_REG_ADDR32(Unit)) = PDB_MOD_RESET_VALUE_U32;
+        ADC_PDB_SIM_REG(Unit, PDB_IDLY_REG_ADDR32(Unit)) = PDB_INTERRUPT_DELAY_RESET_VALUE_U32;
+        for (u8Channel = 0U; u8Channel < ADC_PDB_CHANNELS_U8; u8Channel++)
+        {
+            Adc_Pdb_Sim_aUnit[Unit].au8Fired[u8Channel] = 0U;
+            Adc_Pdb_Sim_aUnit[Unit].au8Outstanding[u8Channel] = ADC_PDB_SIM_NONE_U8;
+        }
+        Adc_Pdb_Sim_aUnit[Unit].bRunning = (boolean)FALSE;
+        Adc_Pdb_Sim_aUnit[Unit].u64CycleStart = 0ULL;
+        Adc_Pdb_Sim_aUnit[Unit].pfErrIrqHandler = NULL_PTR;
+    }
+    Adc_Pdb_Sim_bInIrq = (boolean)FALSE;
+    Adc_Pdb_Sim_ClearTrace();
+}
+
+/**
+* @brief          Registers the function called when a PDB raises its sequence error interrupt.
+*
+* @param[in]      Unit          The PDB unit.
+* @param[in]      pfIrqHandler  Typically Adc_Pdb_ChannelSequenceErrorX, NULL_PTR to mask.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_SetErrIrqHandler
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(Adc_Pdb_SimIrqType, AUTOMATIC) pfIrqHandler
+)
+{
+    if (Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES)
+    {
+        Adc_Pdb_Sim_aUnit[Unit].pfErrIrqHandler = pfIrqHandler;
+    }
+}
+
+/**
+* @brief          Trigger-In of a PDB, used when TRGSEL selects a hardware trigger source.
+*
+* @param[in]      Unit          The PDB unit.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_ExternalTrigger
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit
+)
+{
+    VAR(uint32, AUTOMATIC) u32Sc;
+
+    if (Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES)
+    {
+        u32Sc = ADC_PDB_SIM_REG(Unit, PDB_SC_REG_ADDR32(Unit));
+        if ((PDB_ENABLED_U32 == (u32Sc & PDB_ENABLED_U32)) && \
+            (PDB_TRIGGER_N_SEL_U32(PDB_SOFTWARE_TRIGGER_U32) != (u32Sc & PDB_SC_TRGSEL_MASK_U32)))
+        {
+            Adc_Pdb_Sim_StartCycle(Unit, Adc_Adc12bsarv2_Sim_GetTime());
+        }
+    }
+}
+
+/**
+* @brief          Raises a sequence error on a pre-trigger as if it had fired while busy.
+* @details        The error interrupt is delivered on the next Adc_Adc12bsarv2_Sim_AdvanceTime when
+*                 SC[PDBEIE] is set, so the recovery done by Adc_Pdb_ChannelSequenceError can be
+*                 timed in isolation.
+*
+* @param[in]      Unit          The PDB unit.
+* @param[in]      u8Channel     The PDB channel.
+* @param[in]      u8PreTrigger  The pre-trigger of the channel.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_InjectSequenceError
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Channel,
+    VAR(uint8, AUTOMATIC) u8PreTrigger
+)
+{
+    if ((Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES) && (u8Channel < ADC_PDB_CHANNELS_U8) && \
+        (u8PreTrigger < ADC_PDB_SIM_PRETRIGGERS_U8))
+    {
+        ADC_PDB_SIM_REG(Unit, PDB_CH_N_S_REG_ADDR32(Unit, (uint32)u8Channel)) |= ((uint32)1UL << u8PreTrigger);
+        Adc_Pdb_Sim_Trace(ADC_PDB_SIM_SEQUENCE_ERROR, Unit, u8Channel, u8PreTrigger);
+    }
+}
+
+/**
+* @brief          Returns the number of events held by the trace.
+*
+* @return         uint16      Number of valid entries, at most ADC_PDB_SIM_TRACE_SIZE_U16.
+*
+* @api
+*/
+FUNC(uint16, ADC_CODE) Adc_Pdb_Sim_GetTraceCount(void)
+{
+    return Adc_Pdb_Sim_u16TraceCount;
+}
+
+/**
+* @brief          Reads one event of the trace.
+*
+* @param[in]      u16Index    0 for the oldest event held.
+* @param[out]     pEntry      The event.
+*
+* @return         Std_ReturnType
+* @retval         E_OK        The event was copied.
+* @retval         E_NOT_OK    The index is outside the trace.
+*
+* @api
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_Pdb_Sim_GetTrace
+(
+    VAR(uint16, AUTOMATIC) u16Index,
+    P2VAR(Adc_Pdb_SimTraceType, AUTOMATIC, ADC_APPL_DATA) pEntry
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) Ret = (Std_ReturnType)E_NOT_OK;
+    VAR(uint16, AUTOMATIC) u16Oldest;
+
+    if ((u16Index < Adc_Pdb_Sim_u16TraceCount) && (NULL_PTR != pEntry))
+    {
+        u16Oldest = (uint16)(((Adc_Pdb_Sim_u16TraceHead + ADC_PDB_SIM_TRACE_SIZE_U16) - Adc_Pdb_Sim_u16TraceCount) % ADC_PDB_SIM_TRACE_SIZE_U16);
+        *pEntry = Adc_Pdb_Sim_aTrace[(u16Oldest + u16Index) % ADC_PDB_SIM_TRACE_SIZE_U16];
+        Ret = (Std_ReturnType)E_OK;
+    }
+    return Ret;
+}
+
+/**
+* @brief          Returns the distance between the latest counter starts of two units.
+* @details        Measures how far apart two PDB counters triggered together, for instance the
+*                 two halves of a paired group, actually started.
+*
+* @param[in]      UnitA       First unit.
+* @param[in]      UnitB       Second unit.
+* @param[out]     pSkew       Absolute time between the latest cycle start of each unit.
+*
+* @return         Std_ReturnType
+* @retval         E_OK        The skew was computed.
+* @retval         E_NOT_OK    One of the units has no cycle start in the trace.
+*
+* @api
+*/
+FUNC(Std_ReturnType, ADC_CODE) Adc_Pdb_Sim_GetStartSkew
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) UnitA,
+    VAR(Adc_HwUnitType, AUTOMATIC) UnitB,
+    P2VAR(uint64, AUTOMATIC, ADC_APPL_DATA) pSkew
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) Ret = (Std_ReturnType)E_NOT_OK;
+    VAR(Adc_Pdb_SimTraceType, AUTOMATIC) Entry;
+    VAR(uint64, AUTOMATIC) u64StartA = 0ULL;
+    VAR(uint64, AUTOMATIC) u64StartB = 0ULL;
+    VAR(boolean, AUTOMATIC) bFoundA = (boolean)FALSE;
+    VAR(boolean, AUTOMATIC) bFoundB = (boolean)FALSE;
+    VAR(uint16, AUTOMATIC) u16Index;
+
+    for (u16Index = 0U; u16Index < Adc_Pdb_Sim_u16TraceCount; u16Index++)
+    {
+        (void)Adc_Pdb_Sim_GetTrace(u16Index, &Entry);
+        if (ADC_PDB_SIM_CYCLE_START == Entry.eEvent)
+        {
+            if ((uint8)UnitA == Entry.u8Unit)
+            {
+                u64StartA = Entry.u64Time;
+                bFoundA = (boolean)TRUE;
+            }
+            else if ((uint8)UnitB == Entry.u8Unit)
+            {
+                u64StartB = Entry.u64Time;
+                bFoundB = (boolean)TRUE;
+            }
+            else
+            {
+                /* Other unit */
+            }
+        }
+    }
+
+    if (((boolean)TRUE == bFoundA) && ((boolean)TRUE == bFoundB) && (NULL_PTR != pSkew))
+    {
+        *pSkew = (u64StartA > u64StartB) ? (u64StartA - u64StartB) : (u64StartB - u64StartA);
+        Ret = (Std_ReturnType)E_OK;
+    }
+    return Ret;
+}
+
+/**
+* @brief          Drops every event of the trace.
+*
+* @return         void
+*
+* @api
+*/
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_ClearTrace(void)
+{
+    Adc_Pdb_Sim_u16TraceHead = 0U;
+    Adc_Pdb_Sim_u16TraceCount = 0U;
+}
+
+/**
+* @brief          Reads a PDB register.
+* @details        CNT is derived from the time elapsed in the current cycle.
+*
+* @return         boolean     TRUE if the address belongs to a PDB.
+*/
+FUNC(boolean, ADC_CODE) Adc_Pdb_Sim_ReadReg
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    P2VAR(uint32, AUTOMATIC, ADC_APPL_DATA) pValue
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint32, AUTOMATIC) u32Word = u32Address & (~(uint32)3UL);
+    VAR(boolean, AUTOMATIC) bFound = (boolean)FALSE;
+    P2VAR(Adc_Pdb_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim;
+
+    for (Unit = 0U; (Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES) && ((boolean)FALSE == bFound); Unit++)
+    {
+        if ((u32Word >= PDB_ADDR32(Unit)) && ((u32Word - PDB_ADDR32(Unit)) < ADC_PDB_SIM_REG_WINDOW_U32))
+        {
+            pSim = &Adc_Pdb_Sim_aUnit[Unit];
+            bFound = (boolean)TRUE;
+            if (PDB_CNT_REG_ADDR32(Unit) == u32Word)
+            {
+                *pValue = 0UL;
+                if ((boolean)TRUE == pSim->bRunning)
+                {
+                    *pValue = PDB_COUNTER_VALUE_U32((uint32)((Adc_Adc12bsarv2_Sim_GetTime() - pSim->u64CycleStart) / \
+                                                             (uint64)Adc_Pdb_Sim_CountCycles(Unit)));
+                }
+            }
+            else
+            {
+                *pValue = ADC_PDB_SIM_REG(Unit, u32Word);
+            }
+        }
+    }
+    return bFound;
+}
+
+/**
+* @brief          Writes a PDB register.
+* @details        SWTRIG and LDOK are self clearing and buffered registers take effect at once.
+*                 Clearing PDBEN stops the counter and drops the pending acknowledges. CHnS flags
+*                 are cleared by writing 0.
+*
+* @return         boolean     TRUE if the address belongs to a PDB.
+*/
+FUNC(boolean, ADC_CODE) Adc_Pdb_Sim_WriteReg
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint32, AUTOMATIC) u32Value
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint32, AUTOMATIC) u32Word = u32Address & (~(uint32)3UL);
+    VAR(uint8, AUTOMATIC) u8Channel;
+    VAR(boolean, AUTOMATIC) bFound = (boolean)FALSE;
+    VAR(boolean, AUTOMATIC) bStatus;
+
+    for (Unit = 0U; (Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES) && ((boolean)FALSE == bFound); Unit++)
+    {
+        if ((u32Word >= PDB_ADDR32(Unit)) && ((u32Word - PDB_ADDR32(Unit)) < ADC_PDB_SIM_REG_WINDOW_U32))
+        {
+            bFound = (boolean)TRUE;
+            bStatus = (boolean)FALSE;
+            for (u8Channel = 0U; u8Channel < ADC_PDB_CHANNELS_U8; u8Channel++)
+            {
+                if (PDB_CH_N_S_REG_ADDR32(Unit, (uint32)u8Channel) == u32Word)
+                {
+                    bStatus = (boolean)TRUE;
+                }
+            }
+
+            if (PDB_SC_REG_ADDR32(Unit) == u32Word)
+            {
+                ADC_PDB_SIM_REG(Unit, u32Word) = u32Value & (~(PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32 | PDB_LOAD_OK_U32));
+                if (0UL == (u32Value & PDB_ENABLED_U32))
+                {
+                    Adc_Pdb_Sim_aUnit[Unit].bRunning = (boolean)FALSE;
+                    for (u8Channel = 0U; u8Channel < ADC_PDB_CHANNELS_U8; u8Channel++)
+                    {
+                        Adc_Pdb_Sim_aUnit[Unit].au8Outstanding[u8Channel] = ADC_PDB_SIM_NONE_U8;
+                    }
+                }
+                else if ((0UL != (u32Value & PDB_SOFTWARE_TRIGGER_RESET_COUNTER_U32)) && \
+                         (PDB_TRIGGER_N_SEL_U32(PDB_SOFTWARE_TRIGGER_U32) == (u32Value & PDB_SC_TRGSEL_MASK_U32)))
+                {
+                    Adc_Pdb_Sim_StartCycle(Unit, Adc_Adc12bsarv2_Sim_GetTime());
+                }
+                else
+                {
+                    /* Configuration update only */
+                }
+            }
+            else if ((boolean)TRUE == bStatus)
+            {
+                ADC_PDB_SIM_REG(Unit, u32Word) &= u32Value;
+            }
+            else if (PDB_CNT_REG_ADDR32(Unit) == u32Word)
+            {
+                /* CNT is read only */
+            }
+            else
+            {
+                ADC_PDB_SIM_REG(Unit, u32Word) = u32Value;
+            }
+        }
+    }
+    return bFound;
+}
+
+/**
+* @brief          Returns the time of the earliest timed PDB event.
+*
+* @return         boolean     TRUE if at least one PDB counter is running.
+*/
+FUNC(boolean, ADC_CODE) Adc_Pdb_Sim_GetNextEventTime
+(
+    P2VAR(uint64, AUTOMATIC, ADC_APPL_DATA) pTime
+)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint64, AUTOMATIC) u64Time = 0ULL;
+    VAR(uint8, AUTOMATIC) u8Channel = 0U;
+    VAR(uint8, AUTOMATIC) u8PreTrigger = 0U;
+    VAR(boolean, AUTOMATIC) bFound = (boolean)FALSE;
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES; Unit++)
+    {
+        if ((boolean)TRUE == Adc_Pdb_Sim_NextUnitEvent(Unit, &u64Time, &u8Channel, &u8PreTrigger))
+        {
+            if (((boolean)FALSE == bFound) || (u64Time < *pTime))
+            {
+                *pTime = u64Time;
+            }
+            bFound = (boolean)TRUE;
+        }
+    }
+    return bFound;
+}
+
+/**
+* @brief          Processes every timed PDB event due at the current simulated time.
+* @details        At MOD the counter reloads when SC[CONT] is set and stops otherwise.
+*/
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_ProcessDue(void)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint64, AUTOMATIC) u64Time = 0ULL;
+    VAR(uint8, AUTOMATIC) u8Channel = 0U;
+    VAR(uint8, AUTOMATIC) u8PreTrigger = 0U;
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES; Unit++)
+    {
+        while (((boolean)TRUE == Adc_Pdb_Sim_NextUnitEvent(Unit, &u64Time, &u8Channel, &u8PreTrigger)) && \
+               (u64Time <= Adc_Adc12bsarv2_Sim_GetTime()))
+        {
+            if (ADC_PDB_SIM_NONE_U8 != u8Channel)
+            {
+                Adc_Pdb_Sim_Fire(Unit, u8Channel, u8PreTrigger);
+            }
+            else if (PDB_CONTINUOUS_MODE_U32 == (ADC_PDB_SIM_REG(Unit, PDB_SC_REG_ADDR32(Unit)) & PDB_CONTINUOUS_MODE_U32))
+            {
+                Adc_Pdb_Sim_StartCycle(Unit, u64Time);
+            }
+            else
+            {
+                Adc_Pdb_Sim_aUnit[Unit].bRunning = (boolean)FALSE;
+            }
+        }
+    }
+}
+
+/**
+* @brief          Acknowledge from the ADC model: COCO was set on an SC1n.
+* @details        Releases the channel and asserts the next pre-trigger when it is chained
+*                 back-to-back on the acknowledged one. The chain does not depend on the counter, so
+*                 it goes on after a one-shot cycle reached MOD, as long as the PDB stays enabled.
+*
+* @param[in]      Unit          The ADC unit, driven by the PDB with the same index.
+* @param[in]      u8Sc1Index    The SC1n which completed.
+*/
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_ConversionComplete
+(
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint8, AUTOMATIC) u8Sc1Index
+)
+{
+    VAR(uint8, AUTOMATIC) u8Channel = (uint8)(u8Sc1Index / ADC_PDB_SIM_PRETRIGGERS_U8);
+    VAR(uint8, AUTOMATIC) u8PreTrigger = (uint8)(u8Sc1Index % ADC_PDB_SIM_PRETRIGGERS_U8);
+    VAR(uint8, AUTOMATIC) u8Next = (uint8)(u8PreTrigger + 1U);
+    VAR(uint32, AUTOMATIC) u32C1;
+    P2VAR(Adc_Pdb_SimUnitType, AUTOMATIC, ADC_APPL_DATA) pSim;
+
+    if ((Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES) && (u8Channel < ADC_PDB_CHANNELS_U8))
+    {
+        pSim = &Adc_Pdb_Sim_aUnit[Unit];
+        if (u8PreTrigger == pSim->au8Outstanding[u8Channel])
+        {
+            pSim->au8Outstanding[u8Channel] = ADC_PDB_SIM_NONE_U8;
+            Adc_Pdb_Sim_Trace(ADC_PDB_SIM_CONVERSION_END, Unit, u8Channel, u8PreTrigger);
+
+            u32C1 = ADC_PDB_SIM_REG(Unit, PDB_CH_N_C1_REG_ADDR32(Unit, (uint32)u8Channel));
+            if ((PDB_ENABLED_U32 == (ADC_PDB_SIM_REG(Unit, PDB_SC_REG_ADDR32(Unit)) & PDB_ENABLED_U32)) && \
+                (u8Next < ADC_PDB_SIM_PRETRIGGERS_U8) && \
+                (0UL != (u32C1 & PDB_PRE_TRIGGER_CH_ENABLED_MASK_U32((uint32)u8Next))) && \
+                (0UL != (u32C1 & PDB_PRE_TRIGGER_BB_CH_MASK_U32((uint32)u8Next))) && \
+                (0U == (pSim->au8Fired[u8Channel] & (uint8)(1U << u8Next))))
+            {
+                Adc_Pdb_Sim_Fire(Unit, u8Channel, u8Next);
+            }
+        }
+    }
+}
+
+/**
+* @brief          Calls the error handler of every PDB with SC[PDBEIE] set and an ERR flag raised.
+*/
+FUNC(void, ADC_CODE) Adc_Pdb_Sim_DispatchIrq(void)
+{
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit;
+    VAR(uint8, AUTOMATIC) u8Channel;
+    VAR(boolean, AUTOMATIC) bRaised;
+
+    if ((boolean)FALSE == Adc_Pdb_Sim_bInIrq)
+    {
+        for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_PDB_NUM_MODULES; Unit++)
+        {
+            bRaised = (boolean)FALSE;
+            for (u8Channel = 0U; u8Channel < ADC_PDB_CHANNELS_U8; u8Channel++)
+            {
+                if (0UL != (ADC_PDB_SIM_REG(Unit, PDB_CH_N_S_REG_ADDR32(Unit, (uint32)u8Channel)) & PDB_ERR_FLAGS_MASK_U32))
+                {
+                    bRaised = (boolean)TRUE;
+                }
+            }
+            if (((boolean)TRUE == bRaised) && (NULL_PTR != Adc_Pdb_Sim_aUnit[Unit].pfErrIrqHandler) && \
+                (PDB_ERROR_INTERRUPT_ENABLED_U32 == (ADC_PDB_SIM_REG(Unit, PDB_SC_REG_ADDR32(Unit)) & PDB_ERROR_INTERRUPT_ENABLED_U32)))
+            {
+                Adc_Pdb_Sim_bInIrq = (boolean)TRUE;
+                Adc_Pdb_Sim_aUnit[Unit].pfErrIrqHandler();
+                Adc_Pdb_Sim_bInIrq = (boolean)FALSE;
+            }
+        }
+    }
+}
+
+#define ADC_STOP_SEC_CODE
+/**
+ * @violates @ref Adc_Pdb_Sim_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Pdb_Sim_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+#endif /* MCAL_REG_SIMULATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
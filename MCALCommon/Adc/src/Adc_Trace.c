@@ -0,0 +1,295 @@
+/**
+*   @file    Adc_Trace.c
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - Binary event trace.
+*   @details Fixed size ring of driver events, written from task and interrupt context without a
+*            lock. The ring is read from a RAM dump by tools/Adc_TraceDecode.c.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Adc_Trace_c_REF_1
+* Violates MISRA 2004 Advisory Rule 19.1, only preprocessor statements and comments before "#include"
+* This violation is not fixed since the inclusion of MemMap.h is as per Autosar requirement.
+*
+* @section Adc_Trace_c_REF_2
+* Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h
+* This comes from the order of includes in the .c file and from include dependencies. As a safe
+* approach, any file must include all its dependencies. Header files are already protected against
+* double inclusions.
+*
+* @section Adc_Trace_c_REF_3
+* Violates MISRA 2004 Required Rule 1.4, The compiler/linker shall be checked to ensure that
+* 31 characters significance and case sensitivity are supported for external identifiers.
+* This violation is due to the requirement that requests to have a file version check.
+*
+* @section Adc_Trace_c_REF_4
+* Violates MISRA 2004 Required Rule 8.10, All declarations and definitions of objects or functions
+* at file scope shall have internal linkage unless external linkage is required.
+* The trace ring is located in a RAM dump by its symbol.
+*
+* @section Adc_Trace_c_REF_5
+* Violates MISRA 2004 Required Rule 11.3, A cast should not be performed between a pointer type
+* and an integral type. The default time source is the address of the DWT cycle counter.
+*
+* @section Adc_Trace_c_REF_6
+* Violates MISRA 2004 Advisory Rule 19.7 and 19.13, Function-like macro defined, # and ##
+* preprocessor operators used. The layout check pastes its name to get one distinct typedef per
+* check, which a function cannot provide at compile time.
+*
+* @section [global]
+* Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+* on the significance of more than 31 characters. All compilers used support more than 31 chars for
+* identifiers.
+*/
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Adc_Trace.h"
+#ifndef USER_MODE_REG_PROT_ENABLED
+#define USER_MODE_REG_PROT_ENABLED                (ADC_USER_MODE_REG_PROT_ENABLED)
+#endif
+#include "SilRegMacros.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define ADC_VENDOR_ID_TRACE_C                    43
+/** @violates @ref Adc_Trace_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MAJOR_VERSION_TRACE_C     4
+/** @violates @ref Adc_Trace_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_MINOR_VERSION_TRACE_C     2
+/** @violates @ref Adc_Trace_c_REF_3 The compiler/linker shall be checked */
+#define ADC_AR_RELEASE_REVISION_VERSION_TRACE_C  2
+#define ADC_SW_MAJOR_VERSION_TRACE_C             1
+#define ADC_SW_MINOR_VERSION_TRACE_C             0
+#define ADC_SW_PATCH_VERSION_TRACE_C             3
+
+/*==================================================================================================
+*                                     FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if source file and Adc_Trace header file are of the same vendor */
+#if (ADC_VENDOR_ID_TRACE_C != ADC_VENDOR_ID_TRACE)
+    #error "Adc_Trace.c and Adc_Trace.h have different vendor ids"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Autosar version */
+#if ((ADC_AR_RELEASE_MAJOR_VERSION_TRACE_C != ADC_AR_RELEASE_MAJOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_MINOR_VERSION_TRACE_C != ADC_AR_RELEASE_MINOR_VERSION_TRACE) || \
+     (ADC_AR_RELEASE_REVISION_VERSION_TRACE_C != ADC_AR_RELEASE_REVISION_VERSION_TRACE) \
+    )
+    #error "AutoSar Version Numbers of Adc_Trace.c and Adc_Trace.h are different"
+#endif
+
+/* Check if source file and Adc_Trace header file are of the same Software version */
+#if ((ADC_SW_MAJOR_VERSION_TRACE_C != ADC_SW_MAJOR_VERSION_TRACE) || \
+     (ADC_SW_MINOR_VERSION_TRACE_C != ADC_SW_MINOR_VERSION_TRACE) || \
+     (ADC_SW_PATCH_VERSION_TRACE_C != ADC_SW_PATCH_VERSION_TRACE) \
+    )
+    #error "Software Version Numbers of Adc_Trace.c and Adc_Trace.h are different"
+#endif
+
+/** @violates @ref Adc_Trace_c_REF_3 The compiler/linker shall be checked */
+#ifndef DISABLE_MCAL_INTERMODULE_ASR_CHECK
+ /* Check if source file and SilRegMacros header file are of the same AutoSar version */
+ #if ((ADC_AR_RELEASE_MAJOR_VERSION_TRACE_C != SILREGMACROS_AR_RELEASE_MAJOR_VERSION) || \
+      (ADC_AR_RELEASE_MINOR_VERSION_TRACE_C != SILREGMACROS_AR_RELEASE_MINOR_VERSION) \
+     )
+ #error "AutoSar Version Numbers of Adc_Trace.c and SilRegMacros.h are different"
+ #endif
+#endif
+
+#if (ADC_EVENT_TRACE == STD_ON)
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/** @brief Record of a write index */
+#define ADC_TRACE_INDEX_MASK_U32            ((uint32)ADC_EVENT_TRACE_ENTRIES - 1UL)
+
+/**
+* @brief          Fails the build when the ring types do not have the layout of Adc_TraceFormat.h.
+* @violates @ref Adc_Trace_c_REF_6 Function-like macro defined, # and ## operators used
+*/
+#define ADC_TRACE_LAYOUT_CHECK(Name, Condition) \
+    typedef uint8 Adc_Trace_LayoutCheck##Name[(Condition) ? 1 : -1]
+
+ADC_TRACE_LAYOUT_CHECK(Record, (sizeof(Adc_TraceRecordType) == ADC_TRACE_FORMAT_RECORD_SIZE));
+ADC_TRACE_LAYOUT_CHECK(Buffer, (sizeof(Adc_TraceBufferType) == \
+                                (ADC_TRACE_FORMAT_HEADER_SIZE + (ADC_EVENT_TRACE_ENTRIES * ADC_TRACE_FORMAT_RECORD_SIZE))));
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+#define ADC_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Trace_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Trace_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+/**
+* @brief          Trace ring of the driver events.
+* @violates @ref Adc_Trace_c_REF_4 internal linkage vs external linkage.
+*/
+volatile VAR(Adc_TraceBufferType, ADC_VAR) Adc_TraceBuffer;
+
+#define ADC_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Adc_Trace_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Trace_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+#define ADC_START_SEC_CODE
+/**
+ * @violates @ref Adc_Trace_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Trace_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+/**
+* @brief          Empties the trace ring and writes its header.
+* @details        Called by Adc_Init before any event. Each record gets the commit marker of the
+*                 previous pass over the ring, so that no record is valid until it is written.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Trace_Init(void)
+{
+    VAR(uint32, AUTOMATIC) u32Index;
+
+    Adc_TraceBuffer.u32Magic = ADC_TRACE_MAGIC_U32;
+    Adc_TraceBuffer.u16Version = ADC_TRACE_VERSION_U16;
+    Adc_TraceBuffer.u16Entries = (uint16)ADC_EVENT_TRACE_ENTRIES;
+    Adc_TraceBuffer.u8RecordSize = (uint8)sizeof(Adc_TraceRecordType);
+    Adc_TraceBuffer.au8Reserved[0] = 0U;
+    Adc_TraceBuffer.au8Reserved[1] = 0U;
+    Adc_TraceBuffer.au8Reserved[2] = 0U;
+    for (u32Index = 0UL; u32Index < (uint32)ADC_EVENT_TRACE_ENTRIES; u32Index++)
+    {
+        Adc_TraceBuffer.aRecord[u32Index].u32Time = 0UL;
+        Adc_TraceBuffer.aRecord[u32Index].u16Seq = (uint16)(u32Index - (uint32)ADC_EVENT_TRACE_ENTRIES);
+        Adc_TraceBuffer.aRecord[u32Index].u8Event = 0U;
+        Adc_TraceBuffer.aRecord[u32Index].u8Unit = 0U;
+        Adc_TraceBuffer.aRecord[u32Index].u16Group = ADC_TRACE_NO_GROUP_U16;
+        Adc_TraceBuffer.aRecord[u32Index].u16Data = 0U;
+    }
+    Adc_TraceBuffer.u32Head = 0UL;
+}
+
+/**
+* @brief          Records one event in the trace ring.
+* @details        Callable from any task or interrupt of the core without a lock. The write index
+*                 is read and incremented with two accesses; an interrupt recording events between
+*                 them commits the index first, which is then seen by its commit marker and the
+*                 claim is retried with the next index. This holds as long as fewer than
+*                 ADC_EVENT_TRACE_ENTRIES events are recorded by the preempting interrupts in
+*                 between. The fields are written before the commit marker, the ring being
+*                 volatile, so a record interrupted while written is discarded by the decoder.
+*
+* @param[in]      u8Event       One of ADC_TRACE_EV_x.
+* @param[in]      Unit          Hardware unit of the event.
+* @param[in]      u16Group      Group of the event, ADC_TRACE_NO_GROUP_U16 if none.
+* @param[in]      u16Data       Event data.
+*
+* @return         void
+*/
+FUNC(void, ADC_CODE) Adc_Trace_Record
+(
+    VAR(uint8, AUTOMATIC) u8Event,
+    VAR(Adc_HwUnitType, AUTOMATIC) Unit,
+    VAR(uint16, AUTOMATIC) u16Group,
+    VAR(uint16, AUTOMATIC) u16Data
+)
+{
+    VAR(uint32, AUTOMATIC) u32Index;
+    VAR(uint32, AUTOMATIC) u32Record;
+
+    do
+    {
+        u32Index = Adc_TraceBuffer.u32Head;
+        Adc_TraceBuffer.u32Head = u32Index + 1UL;
+        u32Record = u32Index & ADC_TRACE_INDEX_MASK_U32;
+    } while ((uint16)u32Index == Adc_TraceBuffer.aRecord[u32Record].u16Seq);
+
+    /** @violates @ref Adc_Trace_c_REF_5 A cast should not be performed between a pointer type and an integral type. */
+    Adc_TraceBuffer.aRecord[u32Record].u32Time = ADC_GET_TIMESTAMP();
+    Adc_TraceBuffer.aRecord[u32Record].u8Event = u8Event;
+    Adc_TraceBuffer.aRecord[u32Record].u8Unit = (uint8)Unit;
+    Adc_TraceBuffer.aRecord[u32Record].u16Group = u16Group;
+    Adc_TraceBuffer.aRecord[u32Record].u16Data = u16Data;
+    Adc_TraceBuffer.aRecord[u32Record].u16Seq = (uint16)u32Index;
+}
+
+#define ADC_STOP_SEC_CODE
+/**
+ * @violates @ref Adc_Trace_c_REF_1 only preprocessor statements and comments before "#include"
+ * @violates @ref Adc_Trace_c_REF_2 Repeated include file MemMap.h
+ */
+#include "Adc_MemMap.h"
+
+#endif /* (ADC_EVENT_TRACE == STD_ON) */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
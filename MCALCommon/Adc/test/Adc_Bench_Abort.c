@@ -0,0 +1,191 @@
+/**
+*   @file           Adc_Bench_Abort.c
+*
+*   @brief   AUTOSAR Adc - Preemption abort lock hold time benchmark.
+*   @details Starts a high priority group while a low priority 8 channel group is converting on
+*            unit 0, with the register model taking a given number of cycles to release the
+*            aborted SC1n, and measures the longest hold of ADC_EXCLUSIVE_AREA_19 (the queue
+*            insertion that stops the running group) in model cycles, and the time from the start
+*            request to the notification of the high priority group. Adc_MainFunction is called
+*            every BENCH_PERIOD cycles, ADC_ABORT_TIMEOUT_PERIODS is set by the Makefile above the
+*            longest abort. Built twice by the Makefile: Adc_Bench_Abort with
+*            ADC_ASYNC_ABORT and Adc_Bench_AbortSync without it, where the insertion waits for the
+*            unit. Adc_Bench_Abort also checks that an abort the unit never completes is reported
+*            by the first Adc_MainFunction call after ADC_ABORT_TIMEOUT_PERIODS periods.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define BENCH_ROUNDS        50U
+#define BENCH_LOW_GROUP     0U
+#define BENCH_HIGH_GROUP    1U
+#define BENCH_LOW_CHANNELS  8U
+/** @brief Adc_MainFunction period in model cycles */
+#define BENCH_PERIOD        100UL
+/** @brief Adc_MainFunction periods after which the high priority group is given up */
+#define BENCH_MAX_PERIODS   1000UL
+/** @brief Abort latency never reached by the timeout check */
+#define BENCH_STUCK_CYCLES  100000000UL
+
+static Adc_ValueGroupType Bench_au16Low[BENCH_LOW_CHANNELS];
+static Adc_ValueGroupType Bench_au16High[2];
+static Adc_ValueGroupType Bench_au16Read[BENCH_LOW_CHANNELS];
+static uint64 Bench_u64HighNotifyTime;
+
+static void Bench_OnNotify(Adc_GroupType Group)
+{
+    if (BENCH_HIGH_GROUP == Group)
+    {
+        Bench_u64HighNotifyTime = Adc_Adc12bsarv2_Sim_GetTime();
+    }
+}
+
+static void Bench_MainFunctionPeriod(void)
+{
+    Adc_Test_Run(BENCH_PERIOD);
+#if (ADC_ASYNC_ABORT == STD_ON)
+    Adc_MainFunction();
+#endif /* ADC_ASYNC_ABORT == STD_ON */
+}
+
+/**
+* @brief          Preempts the low priority group and waits for the high priority one.
+*/
+static void Bench_Preempt(uint64 * pu64LockCycles, uint64 * pu64Latency)
+{
+    uint64 u64Start;
+    uint32 u32Channel;
+    uint32 u32Period = 0UL;
+
+    Adc_StartGroupConversion(BENCH_LOW_GROUP);
+    /* Into the conversion of the first channel */
+    Adc_Test_Run(10UL);
+    Adc_Test_ResetLocks();
+    Bench_u64HighNotifyTime = 0ULL;
+    u64Start = Adc_Adc12bsarv2_Sim_GetTime();
+    Adc_StartGroupConversion(BENCH_HIGH_GROUP);
+    *pu64LockCycles = Adc_Test_aLock[19].u64MaxCycles;
+    while ((0ULL == Bench_u64HighNotifyTime) && (u32Period < BENCH_MAX_PERIODS))
+    {
+        Bench_MainFunctionPeriod();
+        u32Period++;
+    }
+    ADC_TEST_CHECK(0ULL != Bench_u64HighNotifyTime);
+    *pu64Latency = Bench_u64HighNotifyTime - u64Start;
+
+    /* The preempted group converts again once the high priority one is done */
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(E_OK == Adc_ReadGroup(BENCH_HIGH_GROUP, Bench_au16Read));
+    ADC_TEST_CHECK((Adc_ValueGroupType)(BENCH_LOW_CHANNELS + 1U) == Bench_au16Read[0]);
+    ADC_TEST_CHECK(E_OK == Adc_ReadGroup(BENCH_LOW_GROUP, Bench_au16Read));
+    for (u32Channel = 0UL; u32Channel < BENCH_LOW_CHANNELS; u32Channel++)
+    {
+        ADC_TEST_CHECK((Adc_ValueGroupType)(u32Channel + 1UL) == Bench_au16Read[u32Channel]);
+    }
+    ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(BENCH_LOW_GROUP));
+    ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(BENCH_HIGH_GROUP));
+}
+
+static void Bench_Latency(uint32 u32AbortCycles)
+{
+    uint64 u64LockMax = 0ULL;
+    uint64 u64LatencyMax = 0ULL;
+    uint64 u64Lock;
+    uint64 u64Latency;
+    uint32 u32Round;
+
+    Adc_Adc12bsarv2_Sim_SetAbortCycles(u32AbortCycles);
+    for (u32Round = 0UL; u32Round < BENCH_ROUNDS; u32Round++)
+    {
+        Bench_Preempt(&u64Lock, &u64Latency);
+        u64LockMax = (u64Lock > u64LockMax) ? u64Lock : u64LockMax;
+        u64LatencyMax = (u64Latency > u64LatencyMax) ? u64Latency : u64LatencyMax;
+    }
+    printf("abort=%5u cycles  EA19 hold max=%5llu cycles  start to notification max=%5llu cycles\n",
+           (unsigned)u32AbortCycles, (unsigned long long)u64LockMax, (unsigned long long)u64LatencyMax);
+}
+
+#if (ADC_ASYNC_ABORT == STD_ON)
+/**
+* @brief          Checks that the abort timeout is counted in Adc_MainFunction periods.
+*/
+static void Bench_Timeout(void)
+{
+    uint32 u32Period;
+
+    Adc_Adc12bsarv2_Sim_SetAbortCycles(BENCH_STUCK_CYCLES);
+    Adc_StartGroupConversion(BENCH_LOW_GROUP);
+    Adc_Test_Run(10UL);
+    Bench_u64HighNotifyTime = 0ULL;
+    Adc_StartGroupConversion(BENCH_HIGH_GROUP);
+    /* However long the periods, only the number of Adc_MainFunction calls matters */
+    for (u32Period = 0UL; u32Period < ADC_ABORT_TIMEOUT_PERIODS; u32Period++)
+    {
+        Adc_Test_Run(BENCH_PERIOD * (u32Period + 1UL));
+        Adc_MainFunction();
+        ADC_TEST_CHECK(0UL == Adc_Test_u32DemFailed);
+    }
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(0ULL == Bench_u64HighNotifyTime);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DemFailed);
+    Adc_MainFunction();
+    ADC_TEST_CHECK(1UL == Adc_Test_u32DemFailed);
+    /* Started anyway, as the blocking stop does; the model drops triggers while it aborts */
+    ADC_TEST_CHECK(ADC_BUSY == Adc_GetGroupStatus(BENCH_HIGH_GROUP));
+    Adc_StopGroupConversion(BENCH_HIGH_GROUP);
+    Adc_StopGroupConversion(BENCH_LOW_GROUP);
+    printf("abort never completed: reported by Adc_MainFunction call %u\n", (unsigned)(ADC_ABORT_TIMEOUT_PERIODS + 1UL));
+}
+#endif /* ADC_ASYNC_ABORT == STD_ON */
+
+int main(void)
+{
+    static const uint32 au32AbortCycles[] = { 0UL, 20UL, 100UL, 400UL, 1600UL };
+    const Adc_GroupConfigurationType Low =
+    {
+        ADC_TEST_GROUP(BENCH_LOW_GROUP),
+        .Priority = 1U,
+        .AssignedChannelCount = BENCH_LOW_CHANNELS
+    };
+    const Adc_GroupConfigurationType High =
+    {
+        ADC_TEST_GROUP(BENCH_HIGH_GROUP),
+        .Priority = 200U,
+        .pAssignment = &Adc_Test_aAssignment[BENCH_LOW_CHANNELS]
+    };
+    uint32 u32Channel;
+    uint32 u32Index;
+
+    Adc_Test_Reset();
+    Adc_Test_SetGroup(BENCH_LOW_GROUP, &Low);
+    Adc_Test_SetGroup(BENCH_HIGH_GROUP, &High);
+    Adc_Test_SetGroupCount(2U);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(BENCH_LOW_GROUP, Bench_au16Low));
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(BENCH_HIGH_GROUP, Bench_au16High));
+    Adc_EnableGroupNotification(BENCH_LOW_GROUP);
+    Adc_EnableGroupNotification(BENCH_HIGH_GROUP);
+    Adc_Test_pfOnNotify = Bench_OnNotify;
+    for (u32Channel = 0UL; u32Channel <= BENCH_LOW_CHANNELS; u32Channel++)
+    {
+        Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, (uint16)(u32Channel + 1UL));
+    }
+
+    printf("%s abort, Adc_MainFunction every %u cycles\n", (ADC_ASYNC_ABORT == STD_ON) ? "asynchronous" : "blocking",
+           (unsigned)BENCH_PERIOD);
+    for (u32Index = 0UL; u32Index < (sizeof(au32AbortCycles) / sizeof(au32AbortCycles[0])); u32Index++)
+    {
+        Bench_Latency(au32AbortCycles[u32Index]);
+    }
+#if (ADC_ASYNC_ABORT == STD_ON)
+    Bench_Timeout();
+#endif /* ADC_ASYNC_ABORT == STD_ON */
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+    return Adc_Test_Result((ADC_ASYNC_ABORT == STD_ON) ? "Adc_Bench_Abort" : "Adc_Bench_AbortSync");
+}
+
+/** @} */
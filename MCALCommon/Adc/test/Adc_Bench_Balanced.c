@@ -0,0 +1,172 @@
+/**
+*   @file           Adc_Bench_Balanced.c
+*
+*   @brief   AUTOSAR Adc - Balanced scan throughput benchmark.
+*   @details Converts 8, 16, 24 and 32 logical channels routed to both units, once as a group of
+*            unit 0 alone and once as a balanced scan split between the halves of a pair on units 0
+*            and 1, checks the results and measures in model cycles the time from the first PDB
+*            counter start to the last end of conversion of a round. The balanced scan converts
+*            half of the channels on each unit, so a round is expected to take about half the
+*            time. A unit converts at most ADC_NUM_SC1_N_REGISTER_USED channels per chunk, the
+*            next chunk being loaded by the end of conversion interrupt: above 16 channels the
+*            unit alone also pays the reloads the halves do not, and its speedup is not only the
+*            one of the split. The chunks of both sides are printed with each result.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define BENCH_ROUNDS        200U
+#define BENCH_CHANNELS_MAX  32U
+/** @brief Start of PDB channel 1, just after the 8 back to back conversions of PDB channel 0 */
+#define BENCH_PDB_CHANNEL_DELAY 150U
+
+/* Logical channel i is channel i of both units */
+#define BENCH_CHANNEL(i)    {{ (i), (i) }}
+#define BENCH_CHANNEL8(i)   BENCH_CHANNEL((i) + 0U), BENCH_CHANNEL((i) + 1U), BENCH_CHANNEL((i) + 2U), \
+                            BENCH_CHANNEL((i) + 3U), BENCH_CHANNEL((i) + 4U), BENCH_CHANNEL((i) + 5U), \
+                            BENCH_CHANNEL((i) + 6U), BENCH_CHANNEL((i) + 7U)
+/** @brief Chunks of ADC_NUM_SC1_N_REGISTER_USED channels a unit converts Channels in */
+#define BENCH_CHUNKS(Channels) (((Channels) + ADC_NUM_SC1_N_REGISTER_USED - 1UL) / ADC_NUM_SC1_N_REGISTER_USED)
+#define BENCH_SCAN(Count)   { .pChannels = Bench_aChannel, .pDelay = Adc_Test_au16Delay, .pPlan = &Bench_Plan, \
+                              .ChannelCount = (Count) }
+
+static const Adc_BalancedChannelType Bench_aChannel[BENCH_CHANNELS_MAX] =
+{
+    BENCH_CHANNEL8(0U), BENCH_CHANNEL8(8U), BENCH_CHANNEL8(16U), BENCH_CHANNEL8(24U)
+};
+static Adc_BalancedPlanType Bench_Plan;
+static const Adc_BalancedScanType Bench_aScan[] = { BENCH_SCAN(8U), BENCH_SCAN(16U), BENCH_SCAN(24U), BENCH_SCAN(32U) };
+
+static Adc_ValueGroupType Bench_aau16Result[2][BENCH_CHANNELS_MAX];
+static Adc_ValueGroupType Bench_au16Read[BENCH_CHANNELS_MAX];
+static Adc_ValueGroupType Bench_au16ReadPair[2U * BENCH_CHANNELS_MAX];
+
+static uint16 Bench_Input(uint32 u32Round, uint32 u32Channel)
+{
+    return (uint16)(((u32Round * 61UL) + (u32Channel * 23UL) + 3UL) & 0xFFFUL);
+}
+
+/* Model cycles from the first counter start to the last end of conversion of the round */
+static uint64 Bench_RoundCycles(void)
+{
+    Adc_Pdb_SimTraceType Entry;
+    uint64 u64First = 0xFFFFFFFFFFFFFFFFULL;
+    uint64 u64Last = 0ULL;
+    uint16 u16Index;
+
+    for (u16Index = 0U; u16Index < Adc_Pdb_Sim_GetTraceCount(); u16Index++)
+    {
+        (void)Adc_Pdb_Sim_GetTrace(u16Index, &Entry);
+        if ((ADC_PDB_SIM_CYCLE_START == Entry.eEvent) && (Entry.u64Time < u64First))
+        {
+            u64First = Entry.u64Time;
+        }
+        if ((ADC_PDB_SIM_CONVERSION_END == Entry.eEvent) && (Entry.u64Time > u64Last))
+        {
+            u64Last = Entry.u64Time;
+        }
+    }
+    return u64Last - u64First;
+}
+
+static uint64 Bench_Channels(const Adc_BalancedScanType * pScan, boolean bBalanced)
+{
+    const uint32 u32Channels = (uint32)pScan->ChannelCount;
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit1 =
+    {
+        .AdcHardwareUnitId = 1U,
+        .u32AdcCfg1Register = 0x4UL,
+        .u32AdcSc2Register = ADC12BSARV2_SC2_ADTRG_HW_U32,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U
+    };
+    uint64 u64Cycles = 0ULL;
+    uint32 u32Round;
+    uint32 u32Channel;
+    Adc_GroupType Group;
+    Adc_HwUnitType Unit;
+
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(1U, &Unit1);
+    for (Group = 0U; Group < 2U; Group++)
+    {
+        const Adc_GroupConfigurationType Config =
+        {
+            ADC_TEST_GROUP(Group),
+            .HwUnit = (Adc_HwUnitType)Group,
+            .pAssignment = &Adc_Test_aAssignment[0],
+            .AssignedChannelCount = (Adc_ChannelIndexType)u32Channels,
+            .u16PdbDelay = BENCH_PDB_CHANNEL_DELAY,
+            .PairedGroup = bBalanced ? (Adc_GroupType)(1U - Group) : ADC_NO_PAIRED_GROUP,
+            .pBalancedScan = bBalanced ? pScan : NULL_PTR
+        };
+
+        Adc_Test_SetGroup(Group, &Config);
+    }
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Bench_aau16Result[0]));
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(1U, Bench_aau16Result[1]));
+
+    for (u32Round = 0UL; u32Round < BENCH_ROUNDS; u32Round++)
+    {
+        for (Unit = 0U; Unit < 2U; Unit++)
+        {
+            for (u32Channel = 0UL; u32Channel < u32Channels; u32Channel++)
+            {
+                Adc_Adc12bsarv2_Sim_SetChannelValue(Unit, (uint8)u32Channel, Bench_Input(u32Round, u32Channel));
+            }
+        }
+        Adc_Pdb_Sim_ClearTrace();
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        u64Cycles += Bench_RoundCycles();
+        if (bBalanced)
+        {
+            ADC_TEST_CHECK(E_OK == Adc_ReadPairedGroup(0U, Bench_au16ReadPair));
+            memcpy(Bench_au16Read, Bench_au16ReadPair, u32Channels * sizeof(Adc_ValueGroupType));
+        }
+        else
+        {
+            ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Bench_au16Read));
+        }
+        for (u32Channel = 0UL; u32Channel < u32Channels; u32Channel++)
+        {
+            ADC_TEST_CHECK(Bench_Input(u32Round, u32Channel) == Bench_au16Read[u32Channel]);
+        }
+    }
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+    return u64Cycles / BENCH_ROUNDS;
+}
+
+int main(void)
+{
+    uint64 u64Single;
+    uint64 u64Balanced;
+    uint32 u32Index;
+    uint32 u32Channels;
+    uint32 u32SingleChunks;
+    uint32 u32HalfChunks;
+
+    for (u32Index = 0UL; u32Index < (sizeof(Bench_aScan) / sizeof(Bench_aScan[0])); u32Index++)
+    {
+        u32Channels = (uint32)Bench_aScan[u32Index].ChannelCount;
+        u32SingleChunks = (uint32)BENCH_CHUNKS(u32Channels);
+        u32HalfChunks = (uint32)BENCH_CHUNKS((u32Channels + 1UL) / 2UL);
+        u64Single = Bench_Channels(&Bench_aScan[u32Index], (boolean)FALSE);
+        u64Balanced = Bench_Channels(&Bench_aScan[u32Index], (boolean)TRUE);
+        ADC_TEST_CHECK((u64Balanced * 10ULL) < (u64Single * 6ULL));
+        printf("channels=%2u one unit=%6llu cycles (%u chunk%s) balanced on two units=%6llu cycles (%u chunk%s per unit) "
+               "speedup=%4.2f%s (mean of %u)\n",
+               (unsigned)u32Channels, (unsigned long long)u64Single, (unsigned)u32SingleChunks, (1UL == u32SingleChunks) ? "" : "s",
+               (unsigned long long)u64Balanced, (unsigned)u32HalfChunks, (1UL == u32HalfChunks) ? "" : "s",
+               (double)u64Single / (double)u64Balanced,
+               (u32SingleChunks == u32HalfChunks) ? "" : ", includes the chunk reloads", BENCH_ROUNDS);
+    }
+    return Adc_Test_Result("Adc_Bench_Balanced");
+}
+
+/** @} */
@@ -0,0 +1,187 @@
+/**
+*   @file           Adc_Bench_Clock.c
+*
+*   @brief   AUTOSAR Adc - Adaptive clock benchmark.
+*   @details Starts, every BENCH_PERIOD model cycles, one 4 channel group of unit 0 (light periods)
+*            or BENCH_GROUPS of them (burst periods), each with a conversion deadline, and prints
+*            the groups converted, the deadline misses and the time spent in each clock
+*            configuration for three policies: the adaptive one (u8ClockFastQueueDepth set), the
+*            normal clock only and the alternate clock only (ADIV 3, clock / 8). A group still
+*            converting when its next start comes is counted as dropped. Checks that the adaptive
+*            policy misses no deadline and spends most of the time on the alternate clock, where
+*            the alternate clock alone misses the deadlines of the bursts.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define BENCH_GROUPS            6U
+#define BENCH_CHANNELS          4U
+/** @brief Model cycles between two start requests */
+#define BENCH_PERIOD            8000UL
+#define BENCH_LIGHT_PERIODS     40UL
+#define BENCH_BURST_PERIODS     40UL
+/** @brief Model cycles from the start request to the first end of conversion */
+#define BENCH_DEADLINE          3000UL
+/** @brief CFG1 of unit 0: ADIV 0, 12 bits */
+#define BENCH_CFG1_NORMAL       0x4UL
+/** @brief CFG1 of the alternate clock: ADIV 3 (clock / 8) */
+#define BENCH_CFG1_ALTERNATE    (BENCH_CFG1_NORMAL | 0x60UL)
+#define BENCH_SAMPLE_TIME       0xCUL
+
+typedef enum
+{
+    BENCH_ADAPTIVE = 0,
+    BENCH_NORMAL,
+    BENCH_ALTERNATE
+} Bench_PolicyType;
+
+/* 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[BENCH_CHANNELS];
+} Bench_aResult[BENCH_GROUPS];
+
+static uint32 Bench_ReadTime(void)
+{
+    return (uint32)Adc_Adc12bsarv2_Sim_GetTime();
+}
+
+/**
+* @brief          Starts the group unless it is still converting.
+*
+* @return         uint32      1 if the group was dropped.
+*/
+static uint32 Bench_Start(Adc_GroupType Group)
+{
+    uint32 u32Dropped = 1UL;
+
+    if (ADC_BUSY != Adc_GetGroupStatus(Group))
+    {
+        Adc_StartGroupConversion(Group);
+        u32Dropped = 0UL;
+    }
+    return u32Dropped;
+}
+
+static void Bench_Policy(Bench_PolicyType ePolicy)
+{
+    static const char * const apName[] = { "adaptive", "always normal", "always alternate" };
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit0 =
+    {
+        .AdcHardwareUnitId = 0U,
+        .u32AdcCfg1Register = BENCH_CFG1_NORMAL,
+        .u32AdcCfg1RegisterAlternate = BENCH_CFG1_ALTERNATE,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U,
+        .pfReadTime = Bench_ReadTime,
+        /* 0 leaves the clock to Adc_SetClockMode */
+        .u8ClockFastQueueDepth = (BENCH_ADAPTIVE == ePolicy) ? 3U : 0U,
+        .u8ClockSlowQueueDepth = 1U,
+        .u32ClockDeadlineMargin = BENCH_DEADLINE / 4UL
+    };
+    Adc_ClockStatisticsType Statistics;
+    uint32 u32Period;
+    uint32 u32Dropped = 0UL;
+    uint32 u32Total;
+    Adc_GroupType Group;
+
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(0U, &Unit0);
+    for (Group = 0U; Group < BENCH_GROUPS; Group++)
+    {
+        const Adc_GroupConfigurationType Config =
+        {
+            ADC_TEST_GROUP(Group),
+            .pAssignment = &Adc_Test_aAssignment[Group * BENCH_CHANNELS],
+            .AssignedChannelCount = BENCH_CHANNELS,
+            .u32SampleTime = BENCH_SAMPLE_TIME,
+            .u32SampleTimeAlternate = BENCH_SAMPLE_TIME,
+            .u32ClockDivideSelect = BENCH_CFG1_NORMAL,
+            .u32ClockDivideSelectAlternate = BENCH_CFG1_ALTERNATE,
+            .u32ConversionDeadline = BENCH_DEADLINE
+        };
+
+        Adc_Test_SetGroup(Group, &Config);
+    }
+    Adc_Test_SetGroupCount(BENCH_GROUPS);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    for (Group = 0U; Group < BENCH_GROUPS; Group++)
+    {
+        ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(Group, Bench_aResult[Group].au16Value));
+    }
+    if (BENCH_ALTERNATE == ePolicy)
+    {
+        ADC_TEST_CHECK(E_OK == Adc_SetClockMode(ADC_ALTERNATE));
+    }
+
+    for (u32Period = 0UL; u32Period < ((2UL * BENCH_LIGHT_PERIODS) + BENCH_BURST_PERIODS); u32Period++)
+    {
+        if ((u32Period >= BENCH_LIGHT_PERIODS) && (u32Period < (BENCH_LIGHT_PERIODS + BENCH_BURST_PERIODS)))
+        {
+            for (Group = 0U; Group < BENCH_GROUPS; Group++)
+            {
+                u32Dropped += Bench_Start(Group);
+            }
+        }
+        else
+        {
+            u32Dropped += Bench_Start(0U);
+        }
+        Adc_Test_Run(BENCH_PERIOD);
+    }
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    /* Every deadline was accounted by the end of its first conversion */
+    ADC_TEST_CHECK(0UL == Adc_aUnitStatus[0].u32DeadlinesPending);
+    ADC_TEST_CHECK(FALSE == Adc_aUnitStatus[0].bEarliestDueStale);
+
+    ADC_TEST_CHECK(E_OK == Adc_GetClockStatistics(0U, &Statistics));
+    u32Total = Statistics.au32Time[ADC_NORMAL] + Statistics.au32Time[ADC_ALTERNATE];
+    printf("%-16s: %3u converted, %2u dropped, %2u deadline misses, %3u%% of the time on the alternate clock, %3u switches\n",
+           apName[ePolicy], (unsigned)(Statistics.au32Conversions[ADC_NORMAL] + Statistics.au32Conversions[ADC_ALTERNATE]),
+           (unsigned)u32Dropped, (unsigned)Statistics.u32DeadlineMisses,
+           (unsigned)(((uint64)Statistics.au32Time[ADC_ALTERNATE] * 100ULL) / (uint64)u32Total),
+           (unsigned)Statistics.u32Switches);
+    if (BENCH_ADAPTIVE == ePolicy)
+    {
+        ADC_TEST_CHECK(0UL == u32Dropped);
+        ADC_TEST_CHECK(0UL == Statistics.u32DeadlineMisses);
+        ADC_TEST_CHECK(Statistics.au32Time[ADC_ALTERNATE] > Statistics.au32Time[ADC_NORMAL]);
+        ADC_TEST_CHECK(0UL < Statistics.au32Conversions[ADC_NORMAL]);
+    }
+    else if (BENCH_NORMAL == ePolicy)
+    {
+        ADC_TEST_CHECK(0UL == Statistics.u32DeadlineMisses);
+        ADC_TEST_CHECK(0UL == Statistics.au32Conversions[ADC_ALTERNATE]);
+    }
+    else
+    {
+        /* The burst does not fit the slow clock */
+        ADC_TEST_CHECK(0UL < Statistics.u32DeadlineMisses);
+        ADC_TEST_CHECK(0UL == Statistics.au32Conversions[ADC_NORMAL]);
+    }
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    uint32 u32Channel;
+
+    for (u32Channel = 0UL; u32Channel < (BENCH_GROUPS * BENCH_CHANNELS); u32Channel++)
+    {
+        Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, (uint16)(u32Channel + 1UL));
+    }
+    printf("%u light, %u burst (%u groups) and %u light periods of %u cycles, deadline %u cycles\n",
+           (unsigned)BENCH_LIGHT_PERIODS, (unsigned)BENCH_BURST_PERIODS, (unsigned)BENCH_GROUPS,
+           (unsigned)BENCH_LIGHT_PERIODS, (unsigned)BENCH_PERIOD, (unsigned)BENCH_DEADLINE);
+    Bench_Policy(BENCH_ADAPTIVE);
+    Bench_Policy(BENCH_NORMAL);
+    Bench_Policy(BENCH_ALTERNATE);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    return Adc_Test_Result("Adc_Bench_Clock");
+}
+
+/** @} */
@@ -0,0 +1,85 @@
+/**
+*   @file           Adc_Bench_DmaChain.c
+*
+*   @brief   AUTOSAR Adc - DMA reload list benchmark.
+*   @details Converts DMA groups of 16, 32 and 48 channels (one to three chunks of 16 SC1n
+*            registers), checks the results and counts the DMA and ADC interrupts and the host
+*            time of a conversion round. Built twice by the Makefile: Adc_Bench_DmaChain loads the
+*            chunks after the first one from the DMA reload list of ADC_DMA_CHAIN_RELOAD,
+*            Adc_Bench_DmaChainOff reloads them from the DMA interrupt of the previous chunk.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define BENCH_ROUNDS        500U
+#define BENCH_CHANNELS_MAX  48U
+
+static Adc_ValueGroupType Bench_au16Result[BENCH_CHANNELS_MAX];
+static Adc_ValueGroupType Bench_au16Read[BENCH_CHANNELS_MAX];
+
+static uint16 Bench_Input(uint32 u32Round, uint32 u32Channel)
+{
+    return (uint16)(((u32Round * 29UL) + (u32Channel * 13UL)) & 0xFFFUL);
+}
+
+static void Bench_Channels(uint32 u32Channels)
+{
+    const Adc_GroupConfigurationType Group =
+    {
+        ADC_TEST_GROUP(0U),
+        .pAssignment = &Adc_Test_aAssignment[0],
+        .AssignedChannelCount = (Adc_ChannelIndexType)u32Channels
+    };
+    Adc_Mcl_SimStatisticsType Dma;
+    Adc_Adc12bsarv2_SimStatisticsType Unit;
+    uint64 u64RoundNs = 0ULL;
+    uint64 u64Start;
+    uint32 u32Round;
+    uint32 u32Channel;
+
+    Adc_Test_Reset();
+    Adc_Test_SetDma(0U, (boolean)TRUE);
+    Adc_Test_SetGroup(0U, &Group);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Bench_au16Result));
+    Adc_EnableGroupNotification(0U);
+
+    for (u32Round = 0UL; u32Round < BENCH_ROUNDS; u32Round++)
+    {
+        for (u32Channel = 0UL; u32Channel < u32Channels; u32Channel++)
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, Bench_Input(u32Round, u32Channel));
+        }
+        u64Start = Adc_Test_GetNs();
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        u64RoundNs += Adc_Test_GetNs() - u64Start;
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Bench_au16Read));
+        for (u32Channel = 0UL; u32Channel < u32Channels; u32Channel++)
+        {
+            ADC_TEST_CHECK(Bench_Input(u32Round, u32Channel) == Bench_au16Read[u32Channel]);
+        }
+    }
+    ADC_TEST_CHECK(BENCH_ROUNDS == Adc_Test_au32Notifications[0]);
+
+    Adc_Mcl_Sim_GetStatistics(ADC_TEST_DMA_CHANNEL(0U), &Dma);
+    Adc_Adc12bsarv2_Sim_GetStatistics(0U, &Unit);
+    printf("channels=%2u DMA interrupts=%4.2f ADC interrupts=%4.2f TCD loads=%4.2f round=%8.1f ns (mean of %u)\n",
+           u32Channels, (double)Dma.u32Interrupts / BENCH_ROUNDS, (double)Unit.u32Interrupts / BENCH_ROUNDS,
+           (double)Dma.u32ScatterGathers / BENCH_ROUNDS, (double)u64RoundNs / BENCH_ROUNDS, BENCH_ROUNDS);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    Bench_Channels(16UL);
+    Bench_Channels(32UL);
+    Bench_Channels(48UL);
+    return Adc_Test_Result((ADC_DMA_CHAIN_RELOAD == STD_ON) ? "Adc_Bench_DmaChain" : "Adc_Bench_DmaChainOff");
+}
+
+/** @} */
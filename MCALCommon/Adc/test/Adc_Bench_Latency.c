@@ -0,0 +1,177 @@
+/**
+*   @file           Adc_Bench_Latency.c
+*
+*   @brief   AUTOSAR Adc - Latency histogram benchmark.
+*   @details Converts a 4 channel group and a group of two chunks of ADC_NUM_SC1_N_REGISTER_USED
+*            channels of unit 0 BENCH_ROUNDS times each and prints the host time per conversion.
+*            Built three times by the Makefile: Adc_Bench_Latency with ADC_LATENCY_HISTOGRAMS, which also
+*            prints the histograms of both groups, in model cycles (the register model serves
+*            DWT CYCCNT), and checks their sample counts, and Adc_Bench_LatencyOff without it, for
+*            the cost of the timestamps. Adc_Bench_LatencyDeferred posts the notifications for
+*            Adc_Main_NotificationDispatcher, called BENCH_ROUND_CYCLES after each start, and
+*            checks that the dispatch and end to end intervals and the NOTIFY trace event are
+*            sampled by the dispatcher, not by the interrupt that posted the notification.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+#include "Adc_Trace.h"
+
+#define BENCH_ROUNDS            1000UL
+#define BENCH_SHORT_GROUP       0U
+#define BENCH_LONG_GROUP        1U
+#define BENCH_SHORT_CHANNELS    4U
+#define BENCH_LONG_CHANNELS     (2U * ADC_NUM_SC1_N_REGISTER_USED)
+/** @brief Model cycles given to each conversion, its notification included */
+#define BENCH_ROUND_CYCLES      20000UL
+/** @brief Smallest bucket of the deferred dispatch intervals, BENCH_ROUND_CYCLES less a conversion is above 2^14 */
+#define BENCH_DEFERRED_BUCKET   15UL
+
+/* 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[BENCH_SHORT_CHANNELS];
+} Bench_Short;
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[BENCH_LONG_CHANNELS];
+} Bench_Long;
+
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+/**
+* @brief          Prints and checks the histogram of one stage of a group.
+*/
+static void Bench_PrintHistogram(Adc_GroupType Group, Adc_LatencyStageType eStage, uint32 u32Expected, uint32 u32MinBucket)
+{
+    static const char * const apStage[] = { "chunk", "dispatch", "end to end" };
+    Adc_LatencyHistogramType Histogram;
+    uint32 u32Bucket;
+    uint32 u32Sum = 0UL;
+
+    ADC_TEST_CHECK(E_OK == Adc_GetLatencyHistogram(Group, eStage, &Histogram));
+    printf("  group %u %-10s: %5u samples, max %6u cycles, buckets", (unsigned)Group, apStage[eStage],
+           (unsigned)Histogram.u32Count, (unsigned)Histogram.u32Max);
+    for (u32Bucket = 0UL; u32Bucket < ADC_LATENCY_BUCKETS; u32Bucket++)
+    {
+        if (0UL != Histogram.au32Bucket[u32Bucket])
+        {
+            printf(" [%u]=%u", (unsigned)u32Bucket, (unsigned)Histogram.au32Bucket[u32Bucket]);
+        }
+        u32Sum += Histogram.au32Bucket[u32Bucket];
+        ADC_TEST_CHECK((u32Bucket >= u32MinBucket) || (0UL == Histogram.au32Bucket[u32Bucket]));
+    }
+    printf("\n");
+    ADC_TEST_CHECK(u32Expected == Histogram.u32Count);
+    ADC_TEST_CHECK(Histogram.u32Count == u32Sum);
+}
+#endif /* ADC_LATENCY_HISTOGRAMS == STD_ON */
+
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+/**
+* @brief          Calls the posted notification of Group and checks its trace event.
+*/
+static void Bench_Dispatch(Adc_GroupType Group)
+{
+    uint32 u32Notifications = Adc_Test_au32Notifications[Group];
+#if (ADC_EVENT_TRACE == STD_ON)
+    uint32 u32Before = (uint32)Adc_Adc12bsarv2_Sim_GetTime();
+    uint32 u32Record;
+#endif /* ADC_EVENT_TRACE == STD_ON */
+
+    /* Posted by the interrupt, not called yet */
+    ADC_TEST_CHECK(u32Notifications == Adc_Test_au32Notifications[Group]);
+    Adc_Main_NotificationDispatcher();
+#if (ADC_EVENT_TRACE == STD_ON)
+    u32Record = (Adc_TraceBuffer.u32Head - 1UL) % ADC_EVENT_TRACE_ENTRIES;
+    ADC_TEST_CHECK(ADC_TRACE_EV_NOTIFY_U8 == Adc_TraceBuffer.aRecord[u32Record].u8Event);
+    ADC_TEST_CHECK((uint16)Group == Adc_TraceBuffer.aRecord[u32Record].u16Group);
+    ADC_TEST_CHECK(Adc_TraceBuffer.aRecord[u32Record].u32Time >= u32Before);
+#endif /* ADC_EVENT_TRACE == STD_ON */
+}
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+
+/**
+* @brief          Converts Group BENCH_ROUNDS times and returns the host time of one conversion.
+*/
+static uint64 Bench_Convert(Adc_GroupType Group)
+{
+    uint64 u64Start;
+    uint32 u32Round;
+    uint32 u32Notifications = Adc_Test_au32Notifications[Group];
+
+    u64Start = Adc_Test_GetNs();
+    for (u32Round = 0UL; u32Round < BENCH_ROUNDS; u32Round++)
+    {
+        Adc_StartGroupConversion(Group);
+        Adc_Test_Run(BENCH_ROUND_CYCLES);
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        Bench_Dispatch(Group);
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+    }
+    u64Start = (Adc_Test_GetNs() - u64Start) / (uint64)BENCH_ROUNDS;
+    ADC_TEST_CHECK(BENCH_ROUNDS == (Adc_Test_au32Notifications[Group] - u32Notifications));
+    ADC_TEST_CHECK(ADC_STREAM_COMPLETED == Adc_GetGroupStatus(Group));
+    return u64Start;
+}
+
+int main(void)
+{
+    const Adc_GroupConfigurationType Short =
+    {
+        ADC_TEST_GROUP(BENCH_SHORT_GROUP),
+        .AssignedChannelCount = BENCH_SHORT_CHANNELS,
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        .bDeferredNotification = (boolean)TRUE
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+    };
+    const Adc_GroupConfigurationType Long =
+    {
+        ADC_TEST_GROUP(BENCH_LONG_GROUP),
+        .pAssignment = &Adc_Test_aAssignment[BENCH_SHORT_CHANNELS],
+        .AssignedChannelCount = BENCH_LONG_CHANNELS,
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        .bDeferredNotification = (boolean)TRUE
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+    };
+    uint64 u64ShortNs;
+    uint64 u64LongNs;
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+    /* The dispatcher runs BENCH_ROUND_CYCLES after the start */
+    const uint32 u32MinBucket = (ADC_DEFERRED_NOTIFICATION == STD_ON) ? BENCH_DEFERRED_BUCKET : 0UL;
+#endif /* ADC_LATENCY_HISTOGRAMS == STD_ON */
+
+    Adc_Test_Reset();
+    Adc_Test_SetGroup(BENCH_SHORT_GROUP, &Short);
+    Adc_Test_SetGroup(BENCH_LONG_GROUP, &Long);
+    Adc_Test_SetGroupCount(2U);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(BENCH_SHORT_GROUP, Bench_Short.au16Value));
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(BENCH_LONG_GROUP, Bench_Long.au16Value));
+    Adc_EnableGroupNotification(BENCH_SHORT_GROUP);
+    Adc_EnableGroupNotification(BENCH_LONG_GROUP);
+
+    u64ShortNs = Bench_Convert(BENCH_SHORT_GROUP);
+    u64LongNs = Bench_Convert(BENCH_LONG_GROUP);
+    printf("latency histograms %s%s: %u channels %llu ns, %u channels %llu ns per conversion on the host\n",
+           (ADC_LATENCY_HISTOGRAMS == STD_ON) ? "on" : "off",
+           (ADC_DEFERRED_NOTIFICATION == STD_ON) ? ", deferred notifications" : "", (unsigned)BENCH_SHORT_CHANNELS,
+           (unsigned long long)u64ShortNs, (unsigned)BENCH_LONG_CHANNELS, (unsigned long long)u64LongNs);
+#if (ADC_LATENCY_HISTOGRAMS == STD_ON)
+    Bench_PrintHistogram(BENCH_SHORT_GROUP, ADC_LATENCY_CHUNK, BENCH_ROUNDS, 0UL);
+    Bench_PrintHistogram(BENCH_SHORT_GROUP, ADC_LATENCY_DISPATCH, BENCH_ROUNDS, u32MinBucket);
+    Bench_PrintHistogram(BENCH_SHORT_GROUP, ADC_LATENCY_END_TO_END, BENCH_ROUNDS, u32MinBucket);
+    Bench_PrintHistogram(BENCH_LONG_GROUP, ADC_LATENCY_CHUNK, 2UL * BENCH_ROUNDS, 0UL);
+    Bench_PrintHistogram(BENCH_LONG_GROUP, ADC_LATENCY_DISPATCH, BENCH_ROUNDS, u32MinBucket);
+    Bench_PrintHistogram(BENCH_LONG_GROUP, ADC_LATENCY_END_TO_END, BENCH_ROUNDS, u32MinBucket);
+#endif /* ADC_LATENCY_HISTOGRAMS == STD_ON */
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+    return Adc_Test_Result((ADC_DEFERRED_NOTIFICATION == STD_ON) ? "Adc_Bench_LatencyDeferred" :
+                           ((ADC_LATENCY_HISTOGRAMS == STD_ON) ? "Adc_Bench_Latency" : "Adc_Bench_LatencyOff"));
+}
+
+/** @} */
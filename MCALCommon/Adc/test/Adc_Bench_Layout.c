@@ -0,0 +1,138 @@
+/**
+*   @file           Adc_Bench_Layout.c
+*
+*   @brief   AUTOSAR Adc - Result buffer layout benchmark.
+*   @details Converts streaming groups of 1 to 16 channels and 8 samples in the channel-major and
+*            in the sample-major layout, and checks that Adc_ReadGroup returns the inputs of the
+*            last sample in both. For each channel count and layout, prints the cost of the end
+*            of conversion interrupt, in register accesses (model cycles) and host time, and the
+*            host time of Adc_ReadGroup. Sample-major samples are copied with a unit stride,
+*            channel-major ones with a stride of NumSamples. Adc_ReadGroup is timed over
+*            BENCH_READS calls, so that the clock reads stay out of the figure.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define BENCH_ROUNDS        2000U
+#define BENCH_READS         16U
+#define BENCH_SAMPLES       8U
+#define BENCH_CHANNELS_MAX  16U
+
+ISR(Adc_Adc12bsarv2_EndGroupConvUnit0);
+
+typedef struct
+{
+    uint64 u64IsrCycles;        /**< @brief Model cycles spent in the interrupts */
+    uint64 u64IsrNs;            /**< @brief Host time spent in the interrupts */
+    uint32 u32Isrs;             /**< @brief Interrupts taken */
+    uint64 u64ReadNs;           /**< @brief Host time of the BENCH_READS reads of every round */
+} Bench_CostType;
+
+static Adc_ValueGroupType Bench_au16Result[BENCH_SAMPLES * BENCH_CHANNELS_MAX];
+static Adc_ValueGroupType Bench_au16Read[BENCH_CHANNELS_MAX];
+static Bench_CostType Bench_Cost;
+
+static uint16 Bench_Input(uint32 u32Round, uint32 u32Channel)
+{
+    return (uint16)(((u32Round * 29UL) + (u32Channel * 131UL) + 3UL) & 0xFFFUL);
+}
+
+/* End of conversion interrupt of unit 0: times the driver handler */
+static void Bench_Isr(void)
+{
+    uint64 u64Time = Adc_Adc12bsarv2_Sim_GetTime();
+    uint64 u64Ns = Adc_Test_GetNs();
+
+    Adc_Adc12bsarv2_EndGroupConvUnit0();
+    Bench_Cost.u64IsrNs += Adc_Test_GetNs() - u64Ns;
+    Bench_Cost.u64IsrCycles += Adc_Adc12bsarv2_Sim_GetTime() - u64Time;
+    Bench_Cost.u32Isrs++;
+}
+
+static void Bench_Layout(Adc_ChannelIndexType Channels, Adc_ResultLayoutType eLayout)
+{
+    uint64 u64Start;
+    uint32 u32Round;
+    uint32 u32Read;
+    uint32 u32Channel;
+
+    Adc_Test_Reset();
+    {
+        const Adc_GroupConfigurationType Group =
+        {
+            ADC_TEST_GROUP(0U),
+            .eAccessMode = ADC_ACCESS_MODE_STREAMING,
+            .eBufferMode = ADC_STREAM_BUFFER_CIRCULAR,
+            .NumSamples = BENCH_SAMPLES,
+            .pAssignment = Adc_Test_aAssignment,
+            .AssignedChannelCount = Channels,
+            .eResultLayout = eLayout
+        };
+
+        Adc_Test_SetGroup(0U, &Group);
+    }
+    Adc_Adc12bsarv2_Sim_SetIrqHandler(0U, Bench_Isr);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Bench_au16Result));
+    memset(&Bench_Cost, 0, sizeof(Bench_Cost));
+
+    for (u32Round = 0UL; u32Round < BENCH_ROUNDS; u32Round++)
+    {
+        for (u32Channel = 0UL; u32Channel < (uint32)Channels; u32Channel++)
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, Bench_Input(u32Round, u32Channel));
+        }
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        memset(Bench_au16Read, 0, sizeof(Bench_au16Read));
+
+        u64Start = Adc_Test_GetNs();
+        for (u32Read = 0UL; u32Read < BENCH_READS; u32Read++)
+        {
+            (void)Adc_ReadGroup(0U, Bench_au16Read);
+        }
+        Bench_Cost.u64ReadNs += Adc_Test_GetNs() - u64Start;
+
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Bench_au16Read));
+        for (u32Channel = 0UL; u32Channel < (uint32)Channels; u32Channel++)
+        {
+            ADC_TEST_CHECK(Bench_Input(u32Round, u32Channel) == Bench_au16Read[u32Channel]);
+        }
+    }
+    /* One interrupt per sample, a sample of up to ADC_NUM_SC1_N_REGISTER_USED channels is one chunk */
+    ADC_TEST_CHECK((BENCH_ROUNDS * BENCH_SAMPLES) == Bench_Cost.u32Isrs);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    Bench_CostType aCost[2];
+    Adc_ChannelIndexType Channels;
+    uint32 u32Layout;
+
+    printf("channels | ISR accesses      ISR ns           | Adc_ReadGroup ns (samples=%u, mean of %u)\n",
+           BENCH_SAMPLES, BENCH_ROUNDS * BENCH_READS);
+    printf("         | ch-major smp-major ch-major smp-major| ch-major smp-major\n");
+    for (Channels = 1U; Channels <= BENCH_CHANNELS_MAX; Channels++)
+    {
+        for (u32Layout = 0UL; u32Layout < 2UL; u32Layout++)
+        {
+            Bench_Layout(Channels, (0UL == u32Layout) ? ADC_RESULT_LAYOUT_CHANNEL_MAJOR : ADC_RESULT_LAYOUT_SAMPLE_MAJOR);
+            aCost[u32Layout] = Bench_Cost;
+        }
+        /* The layout only moves the destination of the result writes */
+        ADC_TEST_CHECK(aCost[0].u64IsrCycles == aCost[1].u64IsrCycles);
+        printf("   %2u    | %8.1f %9.1f %8.1f %9.1f | %8.1f %9.1f\n", (unsigned)Channels,
+               (double)aCost[0].u64IsrCycles / aCost[0].u32Isrs, (double)aCost[1].u64IsrCycles / aCost[1].u32Isrs,
+               (double)aCost[0].u64IsrNs / aCost[0].u32Isrs, (double)aCost[1].u64IsrNs / aCost[1].u32Isrs,
+               (double)aCost[0].u64ReadNs / (BENCH_ROUNDS * BENCH_READS),
+               (double)aCost[1].u64ReadNs / (BENCH_ROUNDS * BENCH_READS));
+    }
+    return Adc_Test_Result("Adc_Bench_Layout");
+}
+
+/** @} */
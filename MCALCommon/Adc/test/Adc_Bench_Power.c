@@ -0,0 +1,112 @@
+/**
+*   @file           Adc_Bench_Power.c
+*
+*   @brief   AUTOSAR Adc - Power duty cycling benchmark.
+*   @details Calls Adc_Main_PowerTransitionManager every BENCH_TICK_CYCLES model cycles and starts
+*            a one shot group of unit 0 every u32PowerPeriodTicks calls, for several periods, and
+*            prints the calls spent by the unit in each power state with the late wakeups. Checks
+*            that every conversion runs with the full power clock (the low power CFG1 divides the
+*            clock by 8), that no start finds the unit in low power and that every result is read
+*            back.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define BENCH_TICKS         1000UL
+/** @brief Model cycles between two calls of the manager */
+#define BENCH_TICK_CYCLES   100UL
+#define BENCH_WAKEUP_TICKS  2U
+/** @brief CFG1 of unit 0: ADIV 0, 12 bits */
+#define BENCH_CFG1_FULL     0x4UL
+/** @brief CFG1 in low power: ADIV 3 (clock / 8) */
+#define BENCH_CFG1_LOW      (BENCH_CFG1_FULL | 0x60UL)
+
+/* 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[2];
+} Bench_Result;
+static Adc_ValueGroupType Bench_au16Read[2];
+
+static void Bench_Period(uint32 u32Period)
+{
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit0 =
+    {
+        .AdcHardwareUnitId = 0U,
+        .u32AdcCfg1Register = BENCH_CFG1_FULL,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U,
+        .u32AdcCfg1RegisterLowPower = BENCH_CFG1_LOW,
+        .u16PowerWakeupTicks = BENCH_WAKEUP_TICKS
+    };
+    const Adc_GroupConfigurationType Group =
+    {
+        ADC_TEST_GROUP(0U),
+        .u32PowerPeriodTicks = u32Period
+    };
+    Adc_PowerStatisticsType Statistics;
+    uint32 u32FullCycles = 0UL;
+    uint32 u32Tick;
+    uint32 u32Starts = 0UL;
+
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(0U, &Unit0);
+    Adc_Test_SetGroup(0U, &Group);
+    Adc_Test_SetGroupCount(1U);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Bench_Result.au16Value));
+
+    for (u32Tick = 0UL; u32Tick < BENCH_TICKS; u32Tick++)
+    {
+        if (0UL == (u32Tick % u32Period))
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(0U, 0U, (uint16)(u32Tick & 0xFFFUL));
+            Adc_StartGroupConversion(0U);
+            if (0UL == u32Tick)
+            {
+                /* The manager has not run yet, the unit is in full power */
+                u32FullCycles = Adc_Adc12bsarv2_Sim_GetConversionCycles(0U);
+            }
+            ADC_TEST_CHECK(u32FullCycles == Adc_Adc12bsarv2_Sim_GetConversionCycles(0U));
+            u32Starts++;
+        }
+        Adc_Test_Run(BENCH_TICK_CYCLES);
+        if (0UL == (u32Tick % u32Period))
+        {
+            ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Bench_au16Read));
+            ADC_TEST_CHECK((Adc_ValueGroupType)(u32Tick & 0xFFFUL) == Bench_au16Read[0]);
+        }
+        Adc_Main_PowerTransitionManager();
+    }
+
+    ADC_TEST_CHECK(E_OK == Adc_GetPowerStatistics(0U, &Statistics));
+    ADC_TEST_CHECK(BENCH_TICKS == (Statistics.au32StateTicks[ADC_FULL_POWER] + Statistics.au32StateTicks[ADC_LOW_POWER]));
+    ADC_TEST_CHECK(0UL < Statistics.au32StateTicks[ADC_LOW_POWER]);
+    ADC_TEST_CHECK(0UL == Statistics.u32LateWakeups);
+    printf("period %2u: full %4u / low %4u calls, %3u transitions, %u late, %u conversions\n",
+           (unsigned)u32Period, (unsigned)Statistics.au32StateTicks[ADC_FULL_POWER],
+           (unsigned)Statistics.au32StateTicks[ADC_LOW_POWER], (unsigned)Statistics.u32Transitions,
+           (unsigned)Statistics.u32LateWakeups, (unsigned)u32Starts);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    static const uint32 au32Period[] = { 5UL, 10UL, 20UL, 50UL };
+    uint32 u32Index;
+
+    printf("%u manager calls of %u cycles, wakeup %u calls\n", (unsigned)BENCH_TICKS, (unsigned)BENCH_TICK_CYCLES,
+           (unsigned)BENCH_WAKEUP_TICKS);
+    for (u32Index = 0UL; u32Index < (sizeof(au32Period) / sizeof(au32Period[0])); u32Index++)
+    {
+        Bench_Period(au32Period[u32Index]);
+    }
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    return Adc_Test_Result("Adc_Bench_Power");
+}
+
+/** @} */
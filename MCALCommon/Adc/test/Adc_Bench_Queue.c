@@ -0,0 +1,136 @@
+/**
+*   @file           Adc_Bench_Queue.c
+*
+*   @brief   AUTOSAR Adc - Software normal queue lock hold time benchmark.
+*   @details Fills the queue of unit 0 up to a given depth with groups of random priorities, then
+*            measures the host time spent in ADC_EXCLUSIVE_AREA_19 by one more insertion
+*            (Adc_StartGroupConversion) and in ADC_EXCLUSIVE_AREA_18 by the removal of a waiting
+*            group (Adc_StopGroupConversion) and by the removal of the group under conversion at its
+*            end. Built twice by the Makefile: Adc_Bench_Queue with the sorted array and
+*            Adc_Bench_QueueBuckets with ADC_PRIORITY_QUEUE_BUCKETS. Both check that the groups are
+*            notified in priority order. The times include one clock read (tens of ns).
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define BENCH_ROUNDS        200U
+#define BENCH_TOP_GROUP     0U
+
+/* Two samples per row keep every buffer 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static Adc_ValueGroupType Bench_aau16Result[ADC_MAX_GROUPS][2];
+static Adc_GroupPriorityType Bench_au8Priority[ADC_MAX_GROUPS];
+static Adc_GroupType Bench_aOrder[ADC_MAX_GROUPS];
+static uint32 Bench_u32Notified;
+
+static void Bench_OnNotify(Adc_GroupType Group)
+{
+    if (Bench_u32Notified < (uint32)ADC_MAX_GROUPS)
+    {
+        Bench_aOrder[Bench_u32Notified] = Group;
+    }
+    Bench_u32Notified++;
+}
+
+static uint64 Bench_AreaNs(uint32 u32Area)
+{
+    return Adc_Test_aLock[u32Area].u64TotalNs;
+}
+
+static void Bench_Depth(Adc_GroupType Depth)
+{
+    uint64 u64InsertNs = 0ULL;
+    uint64 u64RemoveNs = 0ULL;
+    uint64 u64PopNs = 0ULL;
+    Adc_GroupType Stopped = (Adc_GroupType)((Depth / 2U) + 1U);
+    Adc_GroupType Group;
+    uint32 u32Round;
+    uint32 u32Index;
+
+    for (u32Round = 0UL; u32Round < BENCH_ROUNDS; u32Round++)
+    {
+        Bench_u32Notified = 0UL;
+        /* Group under conversion, never preempted, then Depth - 1 waiting groups */
+        for (Group = BENCH_TOP_GROUP; Group < Depth; Group++)
+        {
+            Adc_StartGroupConversion(Group);
+        }
+        Adc_Test_ResetLocks();
+        Adc_StartGroupConversion(Depth);
+        u64InsertNs += Bench_AreaNs(19UL);
+
+        Adc_Test_ResetLocks();
+        Adc_StopGroupConversion(Stopped);
+        u64RemoveNs += Bench_AreaNs(18UL);
+        /* The stop disabled the notification of the group */
+        Adc_EnableGroupNotification(Stopped);
+
+        Adc_Test_ResetLocks();
+        while (0UL == Bench_u32Notified)
+        {
+            Adc_Test_Run(50UL);
+        }
+        u64PopNs += Adc_Test_aLock[18].u64MaxNs;
+
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        ADC_TEST_CHECK((uint32)Depth == Bench_u32Notified);
+        ADC_TEST_CHECK(BENCH_TOP_GROUP == Bench_aOrder[0]);
+        for (u32Index = 2UL; u32Index < Bench_u32Notified; u32Index++)
+        {
+            ADC_TEST_CHECK(Bench_au8Priority[Bench_aOrder[u32Index - 1UL]] >= Bench_au8Priority[Bench_aOrder[u32Index]]);
+        }
+        for (Group = BENCH_TOP_GROUP; Group <= Depth; Group++)
+        {
+            if (Group != Stopped)
+            {
+                ADC_TEST_CHECK(E_OK == Adc_ReadGroup(Group, Bench_aau16Result[Group]));
+            }
+        }
+    }
+    printf("depth=%2u insert=%6.1f ns remove=%6.1f ns pop=%6.1f ns (EA19/EA18 hold, mean of %u)\n",
+           (unsigned)Depth, (double)u64InsertNs / BENCH_ROUNDS, (double)u64RemoveNs / BENCH_ROUNDS,
+           (double)u64PopNs / BENCH_ROUNDS, BENCH_ROUNDS);
+}
+
+int main(void)
+{
+    static const Adc_GroupType aDepth[] = { 1U, 4U, 8U, 16U, 32U, 48U, 62U };
+    uint32 u32Seed = 7UL;
+    Adc_GroupType Group;
+    uint32 u32Index;
+
+    Adc_Test_Reset();
+    for (Group = 0U; Group < (Adc_GroupType)ADC_MAX_GROUPS; Group++)
+    {
+        u32Seed = (u32Seed * 1103515245UL) + 12345UL;
+        Bench_au8Priority[Group] = (BENCH_TOP_GROUP == Group) ? 255U : (Adc_GroupPriorityType)((u32Seed >> 16U) % 255UL);
+        {
+            const Adc_GroupConfigurationType Config =
+            {
+                ADC_TEST_GROUP(Group),
+                .Priority = Bench_au8Priority[Group],
+                .pAssignment = &Adc_Test_aAssignment[Group % 16U]
+            };
+
+            Adc_Test_SetGroup(Group, &Config);
+        }
+    }
+    Adc_Test_pfOnNotify = Bench_OnNotify;
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    for (Group = 0U; Group < (Adc_GroupType)ADC_MAX_GROUPS; Group++)
+    {
+        ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(Group, Bench_aau16Result[Group]));
+        Adc_EnableGroupNotification(Group);
+    }
+    printf("%s queue\n", (ADC_PRIORITY_QUEUE_BUCKETS == STD_ON) ? "bucket" : "array");
+    for (u32Index = 0UL; u32Index < (sizeof(aDepth) / sizeof(aDepth[0])); u32Index++)
+    {
+        Bench_Depth(aDepth[u32Index]);
+    }
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    return Adc_Test_Result((ADC_PRIORITY_QUEUE_BUCKETS == STD_ON) ? "Adc_Bench_QueueBuckets" : "Adc_Bench_Queue");
+}
+
+/** @} */
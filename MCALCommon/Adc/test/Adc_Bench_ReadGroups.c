@@ -0,0 +1,158 @@
+/**
+*   @file           Adc_Bench_ReadGroups.c
+*
+*   @brief   AUTOSAR Adc - Adc_ReadGroups benchmark.
+*   @details Converts 1 to 20 groups of 4 channels, reads them with one Adc_ReadGroups call, checks
+*            the values and measures the host time of the call and the longest hold of exclusive
+*            area 33. The same conversions are then read with one Adc_ReadGroup call per group, and
+*            both times are printed side by side, in total and per group. Built twice by the
+*            Makefile: Adc_Bench_ReadGroups locks area 33 once per group (area 29 for Adc_ReadGroup),
+*            Adc_Bench_ReadGroupsSeqlock reads every group against its publish sequence with
+*            ADC_RESULT_SEQLOCK and enters no exclusive area. The times include one clock read
+*            (tens of ns). Groups beyond the 16th reuse the channels of the first ones.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define BENCH_ROUNDS        2000U
+#define BENCH_GROUPS_MAX    20U
+#define BENCH_CHANNELS      4U
+/** @brief Channel n of a group is converted from Adc_Test_aAssignment[BENCH_CHANNEL(Group, n)] */
+#define BENCH_CHANNEL(Group, Channel) ((((uint32)(Group) * BENCH_CHANNELS) + (uint32)(Channel)) % ADC_TEST_CHANNELS)
+
+static Adc_ValueGroupType Bench_aau16Result[BENCH_GROUPS_MAX][BENCH_CHANNELS];
+static Adc_ValueGroupType Bench_aau16Read[BENCH_GROUPS_MAX][BENCH_CHANNELS];
+static Adc_ReadGroupRequestType Bench_aRequest[BENCH_GROUPS_MAX];
+
+/* The input of a channel depends on the round and on the channel, shared by groups reusing it */
+static uint16 Bench_Input(uint32 u32Round, uint32 u32Group, uint32 u32Channel)
+{
+    return (uint16)(((u32Round * 37UL) + (BENCH_CHANNEL(u32Group, u32Channel) * 101UL) + 5UL) & 0xFFFUL);
+}
+
+static void Bench_Convert(uint32 u32Round, Adc_GroupType Groups)
+{
+    uint32 u32Channel;
+    Adc_GroupType Group;
+
+    for (Group = 0U; Group < Groups; Group++)
+    {
+        for (u32Channel = 0UL; u32Channel < BENCH_CHANNELS; u32Channel++)
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)BENCH_CHANNEL(Group, u32Channel), \
+                                                Bench_Input(u32Round, Group, u32Channel));
+        }
+        Adc_StartGroupConversion(Group);
+    }
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    memset(Bench_aau16Read, 0, sizeof(Bench_aau16Read));
+}
+
+static void Bench_Check(uint32 u32Round, Adc_GroupType Groups)
+{
+    uint32 u32Channel;
+    Adc_GroupType Group;
+
+    for (Group = 0U; Group < Groups; Group++)
+    {
+        for (u32Channel = 0UL; u32Channel < BENCH_CHANNELS; u32Channel++)
+        {
+            ADC_TEST_CHECK(Bench_Input(u32Round, Group, u32Channel) == Bench_aau16Read[Group][u32Channel]);
+        }
+        ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(Group));
+    }
+}
+
+static void Bench_Groups(Adc_GroupType Groups)
+{
+    uint64 u64CallNs = 0ULL;
+    uint64 u64SingleNs = 0ULL;
+    uint64 u64HoldNs = 0ULL;
+    uint32 u32Entries = 0UL;
+    uint64 u64Start;
+    uint32 u32Round;
+    Adc_GroupType Group;
+    Std_ReturnType aReadRet[BENCH_GROUPS_MAX];
+
+    for (u32Round = 0UL; u32Round < BENCH_ROUNDS; u32Round++)
+    {
+        /* All groups in one call */
+        Bench_Convert(u32Round, Groups);
+        for (Group = 0U; Group < Groups; Group++)
+        {
+            Bench_aRequest[Group].Group = Group;
+            Bench_aRequest[Group].pDataBuffer = Bench_aau16Read[Group];
+            Bench_aRequest[Group].ReadResult = (Std_ReturnType)E_NOT_OK;
+        }
+
+        Adc_Test_ResetLocks();
+        u64Start = Adc_Test_GetNs();
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroups(Bench_aRequest, Groups));
+        u64CallNs += Adc_Test_GetNs() - u64Start;
+        u64HoldNs += Adc_Test_aLock[33].u64MaxNs;
+        u32Entries += Adc_Test_aLock[33].u32Count;
+
+        for (Group = 0U; Group < Groups; Group++)
+        {
+            ADC_TEST_CHECK(E_OK == Bench_aRequest[Group].ReadResult);
+        }
+        Bench_Check(u32Round, Groups);
+
+        /* The same groups, one call each */
+        Bench_Convert(u32Round, Groups);
+        u64Start = Adc_Test_GetNs();
+        for (Group = 0U; Group < Groups; Group++)
+        {
+            aReadRet[Group] = Adc_ReadGroup(Group, Bench_aau16Read[Group]);
+        }
+        u64SingleNs += Adc_Test_GetNs() - u64Start;
+
+        for (Group = 0U; Group < Groups; Group++)
+        {
+            ADC_TEST_CHECK(E_OK == aReadRet[Group]);
+        }
+        Bench_Check(u32Round, Groups);
+    }
+    printf("groups=%2u Adc_ReadGroups=%7.1f ns (%5.1f per group) Adc_ReadGroup x%-2u=%7.1f ns (%5.1f per group) "
+           "area 33 entries=%5.1f longest hold=%6.1f ns\n",
+           (unsigned)Groups, (double)u64CallNs / BENCH_ROUNDS, (double)u64CallNs / ((double)BENCH_ROUNDS * Groups),
+           (unsigned)Groups, (double)u64SingleNs / BENCH_ROUNDS, (double)u64SingleNs / ((double)BENCH_ROUNDS * Groups),
+           (double)u32Entries / BENCH_ROUNDS, (double)u64HoldNs / BENCH_ROUNDS);
+}
+
+int main(void)
+{
+    static const Adc_GroupType aGroups[] = { 1U, 2U, 4U, 8U, 10U, 20U };
+    Adc_GroupType Group;
+    uint32 u32Index;
+
+    Adc_Test_Reset();
+    for (Group = 0U; Group < BENCH_GROUPS_MAX; Group++)
+    {
+        const Adc_GroupConfigurationType Config =
+        {
+            ADC_TEST_GROUP(Group),
+            .pAssignment = &Adc_Test_aAssignment[BENCH_CHANNEL(Group, 0U)],
+            .AssignedChannelCount = BENCH_CHANNELS
+        };
+
+        Adc_Test_SetGroup(Group, &Config);
+    }
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    for (Group = 0U; Group < BENCH_GROUPS_MAX; Group++)
+    {
+        ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(Group, Bench_aau16Result[Group]));
+    }
+    printf("%s, mean of %u\n", (ADC_RESULT_SEQLOCK == STD_ON) ? "seqlock reads" : "area 33 per group", BENCH_ROUNDS);
+    for (u32Index = 0UL; u32Index < (sizeof(aGroups) / sizeof(aGroups[0])); u32Index++)
+    {
+        Bench_Groups(aGroups[u32Index]);
+    }
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    return Adc_Test_Result((ADC_RESULT_SEQLOCK == STD_ON) ? "Adc_Bench_ReadGroupsSeqlock" : "Adc_Bench_ReadGroups");
+}
+
+/** @} */
@@ -0,0 +1,150 @@
+/**
+*   @file           Adc_Bench_StartImages.c
+*
+*   @brief   AUTOSAR Adc - Start latency benchmark of the register images.
+*   @details Converts one-shot groups of 16, 24 and 32 channels (one or two chunks of 16 SC1n
+*            registers), read by interrupts and by DMA, and checks the results. Prints the host
+*            time of Adc_StartGroupConversion (minimum and median of the rounds, as the mean
+*            follows the host scheduling), the model cycles (register accesses) from its call
+*            to the start of the PDB counter, and the model cycles from the end of a chunk to the
+*            start of the next one, taken from the PDB trace. Built twice by the Makefile:
+*            Adc_Bench_StartImages copies the chunks from the images of
+*            ADC_PRECOMPUTED_REGISTER_IMAGES (Adc_Pdb_LoadPartialConversionImage),
+*            Adc_Bench_StartImagesOff resolves the channels, delays and PDB period of each chunk.
+*            Both write the same registers: the model cycles are equal, only the host time differs,
+*            and on the host it is mostly the register accesses of the models.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include <stdlib.h>
+#include "Adc_Test.h"
+
+#define BENCH_ROUNDS        1000U
+#define BENCH_CHANNELS_MAX  32U
+
+static Adc_ValueGroupType Bench_au16Result[BENCH_CHANNELS_MAX];
+static Adc_ValueGroupType Bench_au16Read[BENCH_CHANNELS_MAX];
+static uint64 Bench_au64CallNs[BENCH_ROUNDS];
+
+static uint16 Bench_Input(uint32 u32Round, uint32 u32Channel)
+{
+    return (uint16)(((u32Round * 23UL) + (u32Channel * 17UL) + 1UL) & 0xFFFUL);
+}
+
+static int Bench_Compare(const void * pA, const void * pB)
+{
+    const uint64 u64A = *(const uint64 *)pA;
+    const uint64 u64B = *(const uint64 *)pB;
+
+    return (u64A > u64B) ? 1 : ((u64A < u64B) ? -1 : 0);
+}
+
+static void Bench_Channels(uint32 u32Channels, boolean bDma)
+{
+    const Adc_GroupConfigurationType Group =
+    {
+        ADC_TEST_GROUP(0U),
+        .pAssignment = &Adc_Test_aAssignment[0],
+        .AssignedChannelCount = (Adc_ChannelIndexType)u32Channels
+    };
+    Adc_Pdb_SimTraceType Entry;
+    uint64 u64StartCycles = 0ULL;
+    uint64 u64ReloadCycles = 0ULL;
+    uint32 u32Reloads = 0UL;
+    uint64 u64LastEnd;
+    uint64 u64Time;
+    uint64 u64Ns;
+    uint32 u32Round;
+    uint32 u32Channel;
+    uint16 u16Index;
+    boolean bStarted;
+
+    Adc_Test_Reset();
+    Adc_Test_SetDma(0U, bDma);
+    Adc_Test_SetGroup(0U, &Group);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Bench_au16Result));
+
+    for (u32Round = 0UL; u32Round < BENCH_ROUNDS; u32Round++)
+    {
+        for (u32Channel = 0UL; u32Channel < u32Channels; u32Channel++)
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, Bench_Input(u32Round, u32Channel));
+        }
+        Adc_Pdb_Sim_ClearTrace();
+        u64Time = Adc_Adc12bsarv2_Sim_GetTime();
+        u64Ns = Adc_Test_GetNs();
+        Adc_StartGroupConversion(0U);
+        Bench_au64CallNs[u32Round] = Adc_Test_GetNs() - u64Ns;
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+
+        /* First counter start: latency of the call, later ones: reload of the next chunk */
+        bStarted = (boolean)FALSE;
+        u64LastEnd = 0ULL;
+        for (u16Index = 0U; u16Index < Adc_Pdb_Sim_GetTraceCount(); u16Index++)
+        {
+            ADC_TEST_CHECK(E_OK == Adc_Pdb_Sim_GetTrace(u16Index, &Entry));
+            if (ADC_PDB_SIM_CYCLE_START == Entry.eEvent)
+            {
+                if ((boolean)FALSE == bStarted)
+                {
+                    u64StartCycles += Entry.u64Time - u64Time;
+                    bStarted = (boolean)TRUE;
+                }
+                else
+                {
+                    u64ReloadCycles += Entry.u64Time - u64LastEnd;
+                    u32Reloads++;
+                }
+            }
+            else if (ADC_PDB_SIM_CONVERSION_END == Entry.eEvent)
+            {
+                u64LastEnd = Entry.u64Time;
+            }
+            else
+            {
+                /* Pre-triggers */
+            }
+        }
+        ADC_TEST_CHECK(TRUE == bStarted);
+
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Bench_au16Read));
+        for (u32Channel = 0UL; u32Channel < u32Channels; u32Channel++)
+        {
+            ADC_TEST_CHECK(Bench_Input(u32Round, u32Channel) == Bench_au16Read[u32Channel]);
+        }
+    }
+    /* One reload per chunk after the first */
+    ADC_TEST_CHECK((((u32Channels - 1UL) / ADC_NUM_SC1_N_REGISTER_USED) * BENCH_ROUNDS) == u32Reloads);
+    qsort(Bench_au64CallNs, BENCH_ROUNDS, sizeof(Bench_au64CallNs[0]), Bench_Compare);
+
+    printf("%-9s channels=%2u Adc_StartGroupConversion min=%5llu ns median=%5llu ns, %5.1f cycles to the PDB start",
+           (TRUE == bDma) ? "dma" : "interrupt", (unsigned)u32Channels, (unsigned long long)Bench_au64CallNs[0],
+           (unsigned long long)Bench_au64CallNs[BENCH_ROUNDS / 2U], (double)u64StartCycles / BENCH_ROUNDS);
+    if (0UL != u32Reloads)
+    {
+        printf(", chunk reload=%5.1f cycles", (double)u64ReloadCycles / u32Reloads);
+    }
+    printf("\n");
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    uint32 u32Dma;
+
+    printf("%s, %u rounds\n", (ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) ? "register images" : "no register images",
+           BENCH_ROUNDS);
+    for (u32Dma = 0UL; u32Dma < 2UL; u32Dma++)
+    {
+        Bench_Channels(16UL, (boolean)u32Dma);
+        Bench_Channels(24UL, (boolean)u32Dma);
+        Bench_Channels(32UL, (boolean)u32Dma);
+    }
+    return Adc_Test_Result((ADC_PRECOMPUTED_REGISTER_IMAGES == STD_ON) ? "Adc_Bench_StartImages" : "Adc_Bench_StartImagesOff");
+}
+
+/** @} */
@@ -0,0 +1,94 @@
+/**
+*   @file           Adc_Bench_Trace.c
+*
+*   @brief   AUTOSAR Adc - Cost benchmark of the event trace.
+*   @details Calls Adc_Trace_Record in batches and prints the host time of one event (minimum and
+*            median of the batches) and its model cycles, the register access of the timestamp.
+*            Then converts a one-shot group of unit 0 with its notification and prints the events
+*            recorded per conversion, which multiply that cost on the conversion path, and checks
+*            that the ring holds them in order.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include <stdlib.h>
+#include "Adc_Test.h"
+#include "Adc_Trace.h"
+
+#define BENCH_BATCHES       200U
+#define BENCH_EVENTS        1000U
+#define BENCH_ROUNDS        100U
+
+static uint64 Bench_au64BatchNs[BENCH_BATCHES];
+/* 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[1];
+} Bench_Result;
+
+static int Bench_Compare(const void * pA, const void * pB)
+{
+    const uint64 u64A = *(const uint64 *)pA;
+    const uint64 u64B = *(const uint64 *)pB;
+
+    return (u64A > u64B) ? 1 : ((u64A < u64B) ? -1 : 0);
+}
+
+int main(void)
+{
+    uint64 u64Ns;
+    uint64 u64Time;
+    uint64 u64Cycles;
+    uint32 u32Batch;
+    uint32 u32Event;
+    uint32 u32Head;
+    uint32 u32Round;
+    uint32 u32Index;
+
+    Adc_Test_Reset();
+    Adc_Test_SetGroupCount(1U);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+
+    /* Direct calls: the ring write and the timestamp */
+    for (u32Batch = 0UL; u32Batch < BENCH_BATCHES; u32Batch++)
+    {
+        u64Ns = Adc_Test_GetNs();
+        for (u32Event = 0UL; u32Event < BENCH_EVENTS; u32Event++)
+        {
+            Adc_Trace_Record(ADC_TRACE_EV_NOTIFY_U8, 0U, 0U, (uint16)u32Event);
+        }
+        Bench_au64BatchNs[u32Batch] = Adc_Test_GetNs() - u64Ns;
+    }
+    ADC_TEST_CHECK((BENCH_BATCHES * BENCH_EVENTS) == Adc_TraceBuffer.u32Head);
+    u64Time = Adc_Adc12bsarv2_Sim_GetTime();
+    Adc_Trace_Record(ADC_TRACE_EV_NOTIFY_U8, 0U, 0U, 0U);
+    u64Cycles = Adc_Adc12bsarv2_Sim_GetTime() - u64Time;
+    qsort(Bench_au64BatchNs, BENCH_BATCHES, sizeof(Bench_au64BatchNs[0]), Bench_Compare);
+
+    /* Events of a conversion */
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Bench_Result.au16Value));
+    Adc_EnableGroupNotification(0U);
+    u32Head = Adc_TraceBuffer.u32Head;
+    for (u32Round = 0UL; u32Round < BENCH_ROUNDS; u32Round++)
+    {
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Bench_Result.au16Value));
+    }
+    /* The last records are committed in order */
+    for (u32Index = Adc_TraceBuffer.u32Head - (uint32)ADC_EVENT_TRACE_ENTRIES; u32Index != Adc_TraceBuffer.u32Head; u32Index++)
+    {
+        ADC_TEST_CHECK((uint16)u32Index == Adc_TraceBuffer.aRecord[u32Index % (uint32)ADC_EVENT_TRACE_ENTRIES].u16Seq);
+    }
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+
+    printf("Adc_Trace_Record: min=%.1f ns median=%.1f ns per event, %llu model cycles; %.1f events per conversion\n",
+           (double)Bench_au64BatchNs[0] / BENCH_EVENTS, (double)Bench_au64BatchNs[BENCH_BATCHES / 2U] / BENCH_EVENTS,
+           (unsigned long long)u64Cycles, (double)(Adc_TraceBuffer.u32Head - u32Head) / BENCH_ROUNDS);
+    Adc_DeInit();
+    return Adc_Test_Result("Adc_Bench_Trace");
+}
+
+/** @} */
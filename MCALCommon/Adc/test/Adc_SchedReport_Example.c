@@ -0,0 +1,85 @@
+/**
+*   @file           Adc_SchedReport_Example.c
+*
+*   @brief   AUTOSAR Adc - Example configuration of the schedulability report.
+*   @details Configuration analyzed by "make report", assembled with the test harness: on unit 0
+*            the phase currents (3 channels, highest priority), 8 temperatures averaged on 4
+*            samples and 20 diagnostic channels in two chunks at half the clock, the second PDB
+*            channel starting when the first one is done, on unit 1 4 channels sampled at PDB
+*            delays counted with a prescaler of 4. A project links tools/Adc_SchedReport.c with
+*            its own Adc_SchedReport_GetConfig instead.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+/** @brief Pre-trigger delays of group 3, in PDB counts */
+static const uint16 Example_au16Delay[4] = { 0U, 13U, 26U, 39U };
+
+const Adc_ConfigType * Adc_SchedReport_GetConfig(void);
+
+const Adc_ConfigType * Adc_SchedReport_GetConfig(void)
+{
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit1 =
+    {
+        .AdcHardwareUnitId = 1U,
+        .u32AdcCfg1Register = 0x4UL,
+        .u32AdcSc2Register = ADC12BSARV2_SC2_ADTRG_HW_U32,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U,
+        /* PRESCALER 2: 4 PDB input clocks per count */
+        .u32AdcPdbClockSettings = 0x2000UL
+    };
+    const Adc_GroupConfigurationType aGroup[4] =
+    {
+        {
+            ADC_TEST_GROUP(0U),
+            .Priority = 3U,
+            .pAssignment = &Adc_Test_aAssignment[0],
+            .AssignedChannelCount = 3U,
+            .u32SampleTime = 12UL
+        },
+        {
+            ADC_TEST_GROUP(1U),
+            .Priority = 1U,
+            .pAssignment = &Adc_Test_aAssignment[3],
+            .AssignedChannelCount = 8U,
+            .u32SampleTime = 12UL,
+            .u32AvgSelect = ADC12BSARV2_SC3_AVGE_EN_U32
+        },
+        {
+            ADC_TEST_GROUP(2U),
+            .Priority = 0U,
+            .pAssignment = &Adc_Test_aAssignment[11],
+            .AssignedChannelCount = 20U,
+            .u32SampleTime = 12UL,
+            .u32ClockDivideSelect = 0x20UL,
+            .u16PdbDelay = 800U
+        },
+        {
+            ADC_TEST_GROUP(3U),
+            .HwUnit = 1U,
+            .Priority = 2U,
+            .pAssignment = &Adc_Test_aAssignment[0],
+            .AssignedChannelCount = 4U,
+            .u32SampleTime = 12UL,
+            .pDelay = Example_au16Delay,
+            .u8AdcGroupChannelDelays = (uint8)STD_ON,
+            .u8AdcGroupBackToBack = (uint8)STD_OFF
+        }
+    };
+    Adc_GroupType Group;
+
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(1U, &Unit1);
+    for (Group = 0U; Group < 4U; Group++)
+    {
+        Adc_Test_SetGroup(Group, &aGroup[Group]);
+    }
+    Adc_Test_SetGroupCount(4U);
+    return Adc_Test_GetConfig();
+}
+
+/** @} */
@@ -0,0 +1,475 @@
+/**
+*   @file           Adc_Test.c
+*
+*   @brief   AUTOSAR Adc - Host test harness.
+*   @details Run time configuration, model wiring and environment services shared by the test
+*            programs of this directory, see Adc_Test.h.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+
+#include <time.h>
+#include <signal.h>
+#include <sys/time.h>
+#include "Adc_Test.h"
+#include "Det.h"
+#include "Dem.h"
+
+#if (ADC_MAX_GROUPS > 64U)
+#error "Adc_Test.c provides notifications for 64 groups at most"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL VARIABLES
+==================================================================================================*/
+/* The configuration structures have const members: they are assembled in byte storage */
+static union
+{
+    uint64 u64Align;
+    uint8 au8Byte[sizeof(Adc_GroupConfigurationType) * ADC_MAX_GROUPS];
+} Adc_Test_Groups;
+
+static union
+{
+    uint64 u64Align;
+    uint8 au8Byte[sizeof(Adc_Adc12bsarv2_HwUnitConfigurationType) * ADC_MAX_HW_UNITS];
+} Adc_Test_Units, Adc_Test_UnitsPacked;
+
+static union
+{
+    uint64 u64Align;
+    uint8 au8Byte[sizeof(Adc_ConfigType)];
+} Adc_Test_Config;
+
+static boolean Adc_Test_abUnitOn[ADC_MAX_HW_UNITS];
+static boolean Adc_Test_abUnitDma[ADC_MAX_HW_UNITS];
+static Adc_GroupType Adc_Test_GroupCount;
+static uint32 Adc_Test_u32Checks;
+static uint32 Adc_Test_u32Failures;
+/* Timer interrupt, see Adc_Test_StartInterrupt: masked by the outermost exclusive area */
+static void (*volatile Adc_Test_pfInterrupt)(void);
+static volatile sig_atomic_t Adc_Test_bInInterrupt;
+static __thread uint32 Adc_Test_u32LockDepth;
+static __thread uint64 Adc_Test_u64LockStart;
+static __thread uint64 Adc_Test_au64AreaStart[ADC_TEST_EXCLUSIVE_AREAS];
+static __thread uint64 Adc_Test_au64AreaStartNs[ADC_TEST_EXCLUSIVE_AREAS];
+
+static const Adc_Adc12bsarv2_ChannelConfigurationType Adc_Test_aChannel[ADC_TEST_CHANNELS] =
+{
+    {0U}, {1U}, {2U}, {3U}, {4U}, {5U}, {6U}, {7U}, {8U}, {9U}, {10U}, {11U}, {12U}, {13U}, {14U}, {15U},
+    {16U}, {17U}, {18U}, {19U}, {20U}, {21U}, {22U}, {23U}, {24U}, {25U}, {26U}, {27U}, {28U}, {29U}, {30U}, {31U},
+    {32U}, {33U}, {34U}, {35U}, {36U}, {37U}, {38U}, {39U}, {40U}, {41U}, {42U}, {43U}, {44U}, {45U}, {46U}, {47U},
+    {48U}, {49U}, {50U}, {51U}, {52U}, {53U}, {54U}, {55U}, {56U}, {57U}, {58U}, {59U}, {60U}, {61U}, {62U}, {63U}
+};
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+Adc_ValueGroupType * Adc_Test_apResult[ADC_MAX_GROUPS];
+const Adc_GroupDefType Adc_Test_aAssignment[ADC_TEST_CHANNELS] =
+{
+    0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 12U, 13U, 14U, 15U,
+    16U, 17U, 18U, 19U, 20U, 21U, 22U, 23U, 24U, 25U, 26U, 27U, 28U, 29U, 30U, 31U,
+    32U, 33U, 34U, 35U, 36U, 37U, 38U, 39U, 40U, 41U, 42U, 43U, 44U, 45U, 46U, 47U,
+    48U, 49U, 50U, 51U, 52U, 53U, 54U, 55U, 56U, 57U, 58U, 59U, 60U, 61U, 62U, 63U
+};
+const uint16 Adc_Test_au16Delay[ADC_TEST_CHANNELS];
+volatile uint32 Adc_Test_au32Notifications[ADC_MAX_GROUPS];
+void (*Adc_Test_pfOnNotify)(Adc_GroupType Group);
+uint32 Adc_Test_u32DetCount;
+uint8 Adc_Test_u8DetService;
+uint8 Adc_Test_u8DetError;
+uint32 Adc_Test_u32DemFailed;
+uint64 Adc_Test_u64LockMax;
+Adc_Test_LockType Adc_Test_aLock[ADC_TEST_EXCLUSIVE_AREAS];
+
+CONST(Mcal_DemErrorType, ADC_CONST) Adc_E_TimeoutCfg = { (uint32)STD_ON, 0U };
+VAR(Adc_ChannelLimitCheckingType, ADC_VAR) Adc_aChannelsLimitCheckingCfg[ADC_MAX_HW_UNITS][ADC_TEST_LIMIT_CHECK_CHANNELS];
+
+extern FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaTransferComplete0(void);
+extern FUNC(void, ADC_CODE) Adc_Adc12bsarv2_DmaTransferComplete1(void);
+ISR(Adc_Adc12bsarv2_EndGroupConvUnit0);
+ISR(Adc_Adc12bsarv2_EndGroupConvUnit1);
+ISR(Adc_Pdb_ChannelSequenceError0);
+ISR(Adc_Pdb_ChannelSequenceError1);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+static void Adc_Test_Notify(Adc_GroupType Group)
+{
+    Adc_Test_au32Notifications[Group]++;
+    if (NULL_PTR != Adc_Test_pfOnNotify)
+    {
+        Adc_Test_pfOnNotify(Group);
+    }
+}
+
+#define ADC_TEST_NOTIFY(n) static void Adc_Test_Notify##n(void) { Adc_Test_Notify((Adc_GroupType)(n)); }
+#define ADC_TEST_NOTIFY8(n) \
+    ADC_TEST_NOTIFY(n##0) ADC_TEST_NOTIFY(n##1) ADC_TEST_NOTIFY(n##2) ADC_TEST_NOTIFY(n##3) \
+    ADC_TEST_NOTIFY(n##4) ADC_TEST_NOTIFY(n##5) ADC_TEST_NOTIFY(n##6) ADC_TEST_NOTIFY(n##7)
+#define ADC_TEST_NOTIFY_REF8(n) \
+    Adc_Test_Notify##n##0, Adc_Test_Notify##n##1, Adc_Test_Notify##n##2, Adc_Test_Notify##n##3, \
+    Adc_Test_Notify##n##4, Adc_Test_Notify##n##5, Adc_Test_Notify##n##6, Adc_Test_Notify##n##7
+
+/* Group n (octal digits) is notified through Adc_Test_Notify0<n> */
+ADC_TEST_NOTIFY8(00)
+#if (ADC_MAX_GROUPS > 8U)
+ADC_TEST_NOTIFY8(01)
+#endif
+#if (ADC_MAX_GROUPS > 16U)
+ADC_TEST_NOTIFY8(02) ADC_TEST_NOTIFY8(03)
+#endif
+#if (ADC_MAX_GROUPS > 32U)
+ADC_TEST_NOTIFY8(04) ADC_TEST_NOTIFY8(05) ADC_TEST_NOTIFY8(06) ADC_TEST_NOTIFY8(07)
+#endif
+
+const Adc_NotifyType Adc_Test_apfNotify[ADC_MAX_GROUPS] =
+{
+    ADC_TEST_NOTIFY_REF8(00),
+#if (ADC_MAX_GROUPS > 8U)
+    ADC_TEST_NOTIFY_REF8(01),
+#endif
+#if (ADC_MAX_GROUPS > 16U)
+    ADC_TEST_NOTIFY_REF8(02), ADC_TEST_NOTIFY_REF8(03),
+#endif
+#if (ADC_MAX_GROUPS > 32U)
+    ADC_TEST_NOTIFY_REF8(04), ADC_TEST_NOTIFY_REF8(05), ADC_TEST_NOTIFY_REF8(06), ADC_TEST_NOTIFY_REF8(07)
+#endif
+};
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief          Resets the models and the harness: unit 0 alone, interrupt driven, every group
+*                 with the ADC_TEST_GROUP defaults on its own channel.
+*/
+void Adc_Test_Reset(void)
+{
+    Adc_GroupType Group;
+    Adc_HwUnitType Unit;
+
+    Adc_Adc12bsarv2_Sim_Reset();
+    Adc_Mcl_Sim_Reset();
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        const Adc_Adc12bsarv2_HwUnitConfigurationType Default =
+        {
+            .AdcHardwareUnitId = Unit,
+            .u32AdcCfg1Register = 0x4UL,
+            .u32AdcSc2Register = ADC12BSARV2_SC2_ADTRG_HW_U32,
+            .u32AdcDataMask = 0xFFFUL,
+            .Res = (Adc_ResolutionType)12U
+        };
+
+        memcpy(&Adc_Test_Units.au8Byte[sizeof(Default) * Unit], &Default, sizeof(Default));
+        Adc_Test_abUnitOn[Unit] = (boolean)FALSE;
+        Adc_Test_abUnitDma[Unit] = (boolean)FALSE;
+        Adc_Mcl_Sim_SetRequestSource(ADC_TEST_DMA_CHANNEL(Unit), (uint8)Unit);
+    }
+    Adc_Test_abUnitOn[0] = (boolean)TRUE;
+    Adc_Mcl_Sim_SetNotification(ADC_TEST_DMA_CHANNEL(0U), Adc_Adc12bsarv2_DmaTransferComplete0);
+    Adc_Mcl_Sim_SetNotification(ADC_TEST_DMA_CHANNEL(1U), Adc_Adc12bsarv2_DmaTransferComplete1);
+    /* The linked channel ends the major loop of a double buffered group of several channels */
+    Adc_Mcl_Sim_SetNotification(ADC_TEST_DMA_LINK_CHANNEL(0U), Adc_Adc12bsarv2_DmaTransferComplete0);
+    Adc_Mcl_Sim_SetNotification(ADC_TEST_DMA_LINK_CHANNEL(1U), Adc_Adc12bsarv2_DmaTransferComplete1);
+    Adc_Adc12bsarv2_Sim_SetIrqHandler(0U, Adc_Adc12bsarv2_EndGroupConvUnit0);
+    Adc_Adc12bsarv2_Sim_SetIrqHandler(1U, Adc_Adc12bsarv2_EndGroupConvUnit1);
+    Adc_Pdb_Sim_SetErrIrqHandler(0U, Adc_Pdb_ChannelSequenceError0);
+    Adc_Pdb_Sim_SetErrIrqHandler(1U, Adc_Pdb_ChannelSequenceError1);
+
+    for (Group = 0U; Group < (Adc_GroupType)ADC_MAX_GROUPS; Group++)
+    {
+        const Adc_GroupConfigurationType Default = { ADC_TEST_GROUP(Group) };
+
+        Adc_Test_SetGroup(Group, &Default);
+        Adc_Test_apResult[Group] = NULL_PTR;
+        Adc_Test_au32Notifications[Group] = 0UL;
+    }
+    Adc_Test_GroupCount = (Adc_GroupType)ADC_MAX_GROUPS;
+    Adc_Test_pfOnNotify = NULL_PTR;
+    memset(Adc_aChannelsLimitCheckingCfg, 0, sizeof(Adc_aChannelsLimitCheckingCfg));
+    Adc_Test_u32DetCount = 0UL;
+    Adc_Test_u32DemFailed = 0UL;
+    Adc_Test_u8DetService = 0U;
+    Adc_Test_u8DetError = 0U;
+    Adc_Test_ResetLocks();
+}
+
+/**
+* @brief          Replaces the configuration of a group.
+*/
+void Adc_Test_SetGroup(Adc_GroupType Group, const Adc_GroupConfigurationType * pGroup)
+{
+    memcpy(&Adc_Test_Groups.au8Byte[sizeof(*pGroup) * Group], pGroup, sizeof(*pGroup));
+}
+
+/**
+* @brief          Replaces the configuration of a unit and enables it.
+*/
+void Adc_Test_SetUnit(Adc_HwUnitType Unit, const Adc_Adc12bsarv2_HwUnitConfigurationType * pUnit)
+{
+    memcpy(&Adc_Test_Units.au8Byte[sizeof(*pUnit) * Unit], pUnit, sizeof(*pUnit));
+    Adc_Test_abUnitOn[Unit] = (boolean)TRUE;
+}
+
+/**
+* @brief          Sets the number of configured groups.
+*/
+void Adc_Test_SetGroupCount(Adc_GroupType GroupCount)
+{
+    Adc_Test_GroupCount = GroupCount;
+}
+
+/**
+* @brief          Selects DMA (TRUE) or interrupts (FALSE) to read the results of a unit.
+*/
+void Adc_Test_SetDma(Adc_HwUnitType Unit, boolean bDma)
+{
+    Adc_Test_abUnitDma[Unit] = bDma;
+}
+
+/**
+* @brief          Assembles the configuration from the current settings.
+*/
+const Adc_ConfigType * Adc_Test_GetConfig(void)
+{
+    const Adc_Adc12bsarv2_HwUnitConfigurationType * pUnits = (const Adc_Adc12bsarv2_HwUnitConfigurationType *)Adc_Test_Units.au8Byte;
+    Adc_HwUnitType aLogicalId[ADC_MAX_HW_UNITS] = {0U};
+    uint8 u8Units = 0U;
+    Adc_HwUnitType Unit;
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        if ((boolean)TRUE == Adc_Test_abUnitOn[Unit])
+        {
+            aLogicalId[Unit] = (Adc_HwUnitType)u8Units;
+            memcpy(&Adc_Test_UnitsPacked.au8Byte[sizeof(*pUnits) * u8Units], &pUnits[Unit], sizeof(*pUnits));
+            u8Units++;
+        }
+    }
+    {
+        const Adc_ConfigType Config =
+        {
+            .pAdc = (const Adc_Adc12bsarv2_HwUnitConfigurationType *)Adc_Test_UnitsPacked.au8Byte,
+            .pGroups = (const Adc_GroupConfigurationType *)Adc_Test_Groups.au8Byte,
+            .GroupCount = Adc_Test_GroupCount,
+            .pChannels = { Adc_Test_aChannel, Adc_Test_aChannel },
+            .Channels = { (Adc_ChannelIndexType)ADC_TEST_CHANNELS, (Adc_ChannelIndexType)ADC_TEST_CHANNELS },
+            .Misc =
+            {
+                .u8Adc_DmaInterruptSoftware =
+                {
+                    Adc_Test_abUnitDma[0] ? ADC_DMA : ADC_INTERRUPT,
+                    Adc_Test_abUnitDma[1] ? ADC_DMA : ADC_INTERRUPT
+                },
+                .Adc_MaxGroups = Adc_Test_GroupCount,
+                .Adc_MaxHwCfg = u8Units,
+                .au8Adc_DmaChannel = { ADC_TEST_DMA_CHANNEL(0U), ADC_TEST_DMA_CHANNEL(1U) },
+                .au8Adc_DmaDoubleBuffer = { ADC_TEST_DMA_LINK_CHANNEL(0U), ADC_TEST_DMA_LINK_CHANNEL(1U) },
+                .au8Adc_HwUnit = { (uint8)Adc_Test_abUnitOn[0], (uint8)Adc_Test_abUnitOn[1] },
+                .aHwLogicalId = { aLogicalId[0], aLogicalId[1] }
+            }
+        };
+
+        memcpy(Adc_Test_Config.au8Byte, &Config, sizeof(Config));
+    }
+    return (const Adc_ConfigType *)Adc_Test_Config.au8Byte;
+}
+
+/**
+* @brief          Initializes the driver with the current configuration.
+* @return         E_NOT_OK if Adc_Init reported a development error.
+*/
+Std_ReturnType Adc_Test_Init(void)
+{
+    uint32 u32DetCount = Adc_Test_u32DetCount;
+
+    Adc_Init(Adc_Test_GetConfig());
+    return (u32DetCount == Adc_Test_u32DetCount) ? (Std_ReturnType)E_OK : (Std_ReturnType)E_NOT_OK;
+}
+
+/**
+* @brief          Lets the models run for a number of ADC input clock cycles.
+*/
+void Adc_Test_Run(uint32 u32Cycles)
+{
+    Adc_Adc12bsarv2_Sim_AdvanceTime(u32Cycles);
+}
+
+static void Adc_Test_OnTimer(int Signal)
+{
+    (void)Signal;
+    Adc_Test_bInInterrupt = 1;
+    Adc_Test_pfInterrupt();
+    Adc_Test_bInInterrupt = 0;
+}
+
+/**
+* @brief          Calls pfInterrupt every u32PeriodUs microseconds from a timer signal, which
+*                 interrupts the program anywhere but inside an exclusive area, like an interrupt
+*                 of the target. pfInterrupt typically runs the models with Adc_Test_Run.
+*/
+void Adc_Test_StartInterrupt(void (*pfInterrupt)(void), uint32 u32PeriodUs)
+{
+    struct sigaction Action;
+    struct itimerval Timer;
+
+    memset(&Action, 0, sizeof(Action));
+    Action.sa_handler = Adc_Test_OnTimer;
+    (void)sigemptyset(&Action.sa_mask);
+    Adc_Test_pfInterrupt = pfInterrupt;
+    (void)sigaction(SIGALRM, &Action, NULL);
+    Timer.it_interval.tv_sec = 0;
+    Timer.it_interval.tv_usec = (suseconds_t)u32PeriodUs;
+    Timer.it_value = Timer.it_interval;
+    (void)setitimer(ITIMER_REAL, &Timer, NULL);
+}
+
+/**
+* @brief          Stops the timer started by Adc_Test_StartInterrupt.
+*/
+void Adc_Test_StopInterrupt(void)
+{
+    struct itimerval Timer;
+
+    memset(&Timer, 0, sizeof(Timer));
+    (void)setitimer(ITIMER_REAL, &Timer, NULL);
+    (void)signal(SIGALRM, SIG_IGN);
+    Adc_Test_pfInterrupt = NULL;
+}
+
+static void Adc_Test_MaskInterrupt(int How)
+{
+    sigset_t Set;
+
+    if ((NULL != Adc_Test_pfInterrupt) && (0 == Adc_Test_bInInterrupt))
+    {
+        (void)sigemptyset(&Set);
+        (void)sigaddset(&Set, SIGALRM);
+        (void)sigprocmask(How, &Set, NULL);
+    }
+}
+
+void Adc_Test_Check(boolean bCondition, const char * szCondition, const char * szFile, int Line)
+{
+    Adc_Test_u32Checks++;
+    if ((boolean)TRUE != bCondition)
+    {
+        Adc_Test_u32Failures++;
+        printf("%s:%d: check failed: %s\n", szFile, Line, szCondition);
+    }
+}
+
+/**
+* @brief          Prints the verdict of a program.
+* @return         Exit status of the program, non zero if a check failed.
+*/
+int Adc_Test_Result(const char * szName)
+{
+    printf("%s: %u checks, %u failed\n", szName, Adc_Test_u32Checks, Adc_Test_u32Failures);
+    return (0UL == Adc_Test_u32Failures) ? 0 : 1;
+}
+
+/**
+* @brief          Clears the exclusive area statistics.
+*/
+void Adc_Test_ResetLocks(void)
+{
+    memset(Adc_Test_aLock, 0, sizeof(Adc_Test_aLock));
+    Adc_Test_u64LockMax = 0ULL;
+}
+
+/**
+* @brief          Returns the host monotonic time in nanoseconds.
+*/
+uint64 Adc_Test_GetNs(void)
+{
+    struct timespec Now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64)Now.tv_sec * 1000000000ULL) + (uint64)Now.tv_nsec;
+}
+
+void Adc_Test_EnterExclusiveArea(unsigned int Area)
+{
+    uint64 u64Now = Adc_Adc12bsarv2_Sim_GetTime();
+
+    if (0UL == Adc_Test_u32LockDepth)
+    {
+        Adc_Test_MaskInterrupt(SIG_BLOCK);
+        Adc_Test_u64LockStart = u64Now;
+    }
+    Adc_Test_u32LockDepth++;
+    Adc_Test_au64AreaStart[Area] = u64Now;
+    Adc_Test_au64AreaStartNs[Area] = Adc_Test_GetNs();
+}
+
+void Adc_Test_ExitExclusiveArea(unsigned int Area)
+{
+    uint64 u64HeldNs = Adc_Test_GetNs() - Adc_Test_au64AreaStartNs[Area];
+    uint64 u64Now = Adc_Adc12bsarv2_Sim_GetTime();
+    uint64 u64Held = u64Now - Adc_Test_au64AreaStart[Area];
+    Adc_Test_LockType * pLock = &Adc_Test_aLock[Area];
+
+    pLock->u32Count++;
+    pLock->u64TotalNs += u64HeldNs;
+    if (u64HeldNs > pLock->u64MaxNs)
+    {
+        pLock->u64MaxNs = u64HeldNs;
+    }
+    if (u64Held > pLock->u64MaxCycles)
+    {
+        pLock->u64MaxCycles = u64Held;
+    }
+    Adc_Test_u32LockDepth--;
+    if (0UL == Adc_Test_u32LockDepth)
+    {
+        u64Held = u64Now - Adc_Test_u64LockStart;
+        if (u64Held > Adc_Test_u64LockMax)
+        {
+            Adc_Test_u64LockMax = u64Held;
+        }
+        Adc_Test_MaskInterrupt(SIG_UNBLOCK);
+    }
+}
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    (void)ModuleId;
+    (void)InstanceId;
+    Adc_Test_u32DetCount++;
+    Adc_Test_u8DetService = ApiId;
+    Adc_Test_u8DetError = ErrorId;
+    return (Std_ReturnType)E_OK;
+}
+
+void Dem_ReportErrorStatus(Dem_EventIdType EventId, Dem_EventStatusType EventStatus)
+{
+    (void)EventId;
+    if (DEM_EVENT_STATUS_FAILED == EventStatus)
+    {
+        Adc_Test_u32DemFailed++;
+    }
+}
+
+/** @} */
@@ -0,0 +1,151 @@
+/**
+*   @file           Adc_Test.h
+*
+*   @brief   AUTOSAR Adc - Host test harness.
+*   @details Builds a post-build configuration at run time, wires the ADC, PDB and eDMA models
+*            of Adc/src to the driver and provides the Det, Dem and SchM services the driver
+*            needs. Each test program of this directory includes this header, sets up its groups
+*            with Adc_Test_SetGroup and runs the driver against the models.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+
+#ifndef ADC_TEST_H
+#define ADC_TEST_H
+
+#include <stdio.h>
+#include <string.h>
+#include "Adc.h"
+#include "Adc_Cfg.h"
+#include "Adc_Adc12bsarv2_Sim.h"
+#include "Adc_Pdb_Sim.h"
+#include "Adc_Mcl_Sim.h"
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/** @brief Channels of each unit described in the test configuration (ChId equal to the index) */
+#define ADC_TEST_CHANNELS                   64U
+
+/** @brief eDMA channel serving unit u in the test configuration */
+#define ADC_TEST_DMA_CHANNEL(u)             ((uint8)(u))
+/** @brief eDMA channel linked to it for the double buffering of several channels */
+#define ADC_TEST_DMA_LINK_CHANNEL(u)        ((uint8)((u) + 2U))
+
+/** @brief Exclusive areas of the driver, see stub/SchM_Adc.h */
+#define ADC_TEST_EXCLUSIVE_AREAS            46U
+
+/** @brief Model cycles which let any conversion of the tests run to its end */
+#define ADC_TEST_SETTLE_CYCLES              400000UL
+
+/**
+* @brief          Default members of a one shot, software triggered, single access group with one
+*                 channel on unit 0. Designators placed after it override the defaults.
+*/
+#define ADC_TEST_GROUP(Group) \
+    .HwUnit = 0U, \
+    .eAccessMode = ADC_ACCESS_MODE_SINGLE, \
+    .eMode = ADC_CONV_MODE_ONESHOT, \
+    .eType = ADC_CONV_TYPE_NORMAL, \
+    .eTriggerSource = ADC_TRIGG_SRC_SW, \
+    .Notification = Adc_Test_apfNotify[(Group)], \
+    .pResultsBufferPtr = Adc_Test_apResult, \
+    .eBufferMode = ADC_STREAM_BUFFER_LINEAR, \
+    .NumSamples = 1U, \
+    .pAssignment = &Adc_Test_aAssignment[(Group)], \
+    .pDelay = Adc_Test_au16Delay, \
+    .AssignedChannelCount = 1U, \
+    .u8AdcGroupBackToBack = (uint8)STD_ON, \
+    .u16PdbDelay = 400U \
+    ADC_TEST_GROUP_EXTRA
+
+#if (ADC_PAIRED_GROUPS == STD_ON)
+#define ADC_TEST_GROUP_EXTRA , .PairedGroup = ADC_NO_PAIRED_GROUP
+#else
+#define ADC_TEST_GROUP_EXTRA
+#endif
+
+/**
+* @brief          Records a failed check without stopping the program.
+*/
+#define ADC_TEST_CHECK(bCondition) \
+    Adc_Test_Check((boolean)((bCondition) ? TRUE : FALSE), #bCondition, __FILE__, __LINE__)
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief          Hold time of one exclusive area since Adc_Test_Reset.
+*/
+typedef struct
+{
+    uint32 u32Count;        /**< @brief Times the area was entered */
+    uint64 u64MaxCycles;    /**< @brief Longest hold in model cycles (register accesses) */
+    uint64 u64MaxNs;        /**< @brief Longest hold in host nanoseconds */
+    uint64 u64TotalNs;      /**< @brief Sum of the holds in host nanoseconds */
+} Adc_Test_LockType;
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+/** @brief Result buffer pointers of the groups, see Adc_SetupResultBuffer */
+extern Adc_ValueGroupType * Adc_Test_apResult[ADC_MAX_GROUPS];
+/** @brief Channel indexes 0..ADC_TEST_CHANNELS-1, group g defaults to &Adc_Test_aAssignment[g] */
+extern const Adc_GroupDefType Adc_Test_aAssignment[ADC_TEST_CHANNELS];
+/** @brief Zero PDB delays for the default groups */
+extern const uint16 Adc_Test_au16Delay[ADC_TEST_CHANNELS];
+/** @brief Notification of each group, counting into Adc_Test_au32Notifications */
+extern const Adc_NotifyType Adc_Test_apfNotify[ADC_MAX_GROUPS];
+/** @brief Notifications received by each group since Adc_Test_Reset */
+extern volatile uint32 Adc_Test_au32Notifications[ADC_MAX_GROUPS];
+/** @brief Optional hook called by every group notification after counting it */
+extern void (*Adc_Test_pfOnNotify)(Adc_GroupType Group);
+/** @brief Det reports since Adc_Test_Reset and the last one received */
+extern uint32 Adc_Test_u32DetCount;
+extern uint8 Adc_Test_u8DetService;
+extern uint8 Adc_Test_u8DetError;
+/** @brief Failed Dem reports (Adc_E_TimeoutCfg) since Adc_Test_Reset */
+extern uint32 Adc_Test_u32DemFailed;
+/** @brief Longest time, in model cycles, an outermost exclusive area stayed entered */
+extern uint64 Adc_Test_u64LockMax;
+/** @brief Hold times of each exclusive area */
+extern Adc_Test_LockType Adc_Test_aLock[ADC_TEST_EXCLUSIVE_AREAS];
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+void Adc_Test_Reset(void);
+void Adc_Test_SetGroup(Adc_GroupType Group, const Adc_GroupConfigurationType * pGroup);
+void Adc_Test_SetUnit(Adc_HwUnitType Unit, const Adc_Adc12bsarv2_HwUnitConfigurationType * pUnit);
+void Adc_Test_SetGroupCount(Adc_GroupType GroupCount);
+void Adc_Test_SetDma(Adc_HwUnitType Unit, boolean bDma);
+const Adc_ConfigType * Adc_Test_GetConfig(void);
+Std_ReturnType Adc_Test_Init(void);
+void Adc_Test_Run(uint32 u32Cycles);
+void Adc_Test_StartInterrupt(void (*pfInterrupt)(void), uint32 u32PeriodUs);
+void Adc_Test_StopInterrupt(void);
+void Adc_Test_ResetLocks(void);
+uint64 Adc_Test_GetNs(void);
+void Adc_Test_Check(boolean bCondition, const char * szCondition, const char * szFile, int Line);
+int Adc_Test_Result(const char * szName);
+
+#endif /* ADC_TEST_H */
+
+/** @} */
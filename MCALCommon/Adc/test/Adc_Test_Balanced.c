@@ -0,0 +1,140 @@
+/**
+*   @file           Adc_Test_Balanced.c
+*
+*   @brief   AUTOSAR Adc - Balanced scan delay test.
+*   @details Splits a scan of 12 logical channels, some of them routed to a single unit, between
+*            the two halves of a paired group with a distinct PDB delay per logical channel. Checks
+*            the merged results, and, from the PDB trace, that every pre-trigger of each half
+*            fires after the delay configured for the logical channel it converts, not for the
+*            logical channel at the same position of the scan.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_ROUNDS         4U
+#define TEST_CHANNELS       12U
+#define NR                  ADC_BALANCED_NOT_ROUTED
+
+/* Logical channel i is channel i of the units it is routed to */
+static const Adc_BalancedChannelType Test_aChannel[TEST_CHANNELS] =
+{
+    {{ 0U,  0U }}, {{ 1U,  NR }}, {{ 2U,  2U }}, {{ 3U,  3U }}, {{ 4U,  4U }}, {{ 5U,  NR }},
+    {{ 6U,  6U }}, {{ 7U,  7U }}, {{ NR,  8U }}, {{ 9U,  9U }}, {{ 10U, 10U }}, {{ 11U, 11U }}
+};
+static const uint16 Test_au16Delay[TEST_CHANNELS] =
+{
+    100U, 400U, 700U, 1000U, 1300U, 1600U, 1900U, 2200U, 2500U, 2800U, 3100U, 3400U
+};
+static Adc_BalancedPlanType Test_Plan;
+static const Adc_BalancedScanType Test_Scan =
+{
+    .pChannels = Test_aChannel,
+    .pDelay = Test_au16Delay,
+    .pPlan = &Test_Plan,
+    .ChannelCount = TEST_CHANNELS
+};
+
+static Adc_ValueGroupType Test_aau16Result[2][ADC_NUM_SC1_N_REGISTER_USED];
+static Adc_ValueGroupType Test_au16Read[TEST_CHANNELS];
+
+static uint16 Test_Input(uint32 u32Round, uint32 u32Channel)
+{
+    return (uint16)(((u32Round * 83UL) + (u32Channel * 29UL) + 5UL) & 0xFFFUL);
+}
+
+/* Offset of every pre-trigger of the last round from the counter start of its unit */
+static void Test_CheckDelays(void)
+{
+    Adc_Pdb_SimTraceType Entry;
+    uint64 au64Start[2] = { 0ULL, 0ULL };
+    uint32 au32Fired[2] = { 0UL, 0UL };
+    uint16 u16Index;
+    uint8 u8Sc1;
+
+    for (u16Index = 0U; u16Index < Adc_Pdb_Sim_GetTraceCount(); u16Index++)
+    {
+        (void)Adc_Pdb_Sim_GetTrace(u16Index, &Entry);
+        if (ADC_PDB_SIM_CYCLE_START == Entry.eEvent)
+        {
+            au64Start[Entry.u8Unit] = Entry.u64Time;
+        }
+        else if (ADC_PDB_SIM_PRETRIGGER == Entry.eEvent)
+        {
+            u8Sc1 = (uint8)((Entry.u8Channel * 8U) + Entry.u8PreTrigger);
+            ADC_TEST_CHECK((uint64)Test_au16Delay[Test_Plan.aPosition[Entry.u8Unit][u8Sc1]] == (Entry.u64Time - au64Start[Entry.u8Unit]));
+            au32Fired[Entry.u8Unit]++;
+        }
+        else
+        {
+            /* Conversion ends */
+        }
+    }
+    ADC_TEST_CHECK(TEST_CHANNELS == (au32Fired[0] + au32Fired[1]));
+    ADC_TEST_CHECK(0UL != au32Fired[1]);
+}
+
+int main(void)
+{
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit1 =
+    {
+        .AdcHardwareUnitId = 1U,
+        .u32AdcCfg1Register = 0x4UL,
+        .u32AdcSc2Register = ADC12BSARV2_SC2_ADTRG_HW_U32,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U
+    };
+    Adc_GroupType Group;
+    Adc_HwUnitType Unit;
+    uint32 u32Round;
+    uint32 u32Channel;
+
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(1U, &Unit1);
+    for (Group = 0U; Group < 2U; Group++)
+    {
+        const Adc_GroupConfigurationType Half =
+        {
+            ADC_TEST_GROUP(Group),
+            .HwUnit = (Adc_HwUnitType)Group,
+            .u8AdcGroupBackToBack = (uint8)STD_OFF,
+            .u8AdcGroupChannelDelays = (uint8)STD_ON,
+            .u16PdbDelay = 4000U,
+            .PairedGroup = (Adc_GroupType)(1U - Group),
+            .pBalancedScan = &Test_Scan
+        };
+
+        Adc_Test_SetGroup(Group, &Half);
+    }
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_aau16Result[0]));
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(1U, Test_aau16Result[1]));
+
+    for (u32Round = 0UL; u32Round < TEST_ROUNDS; u32Round++)
+    {
+        for (Unit = 0U; Unit < 2U; Unit++)
+        {
+            for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+            {
+                Adc_Adc12bsarv2_Sim_SetChannelValue(Unit, (uint8)u32Channel, Test_Input(u32Round, u32Channel));
+            }
+        }
+        Adc_Pdb_Sim_ClearTrace();
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        Test_CheckDelays();
+        ADC_TEST_CHECK(E_OK == Adc_ReadPairedGroup(0U, Test_au16Read));
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            ADC_TEST_CHECK(Test_Input(u32Round, u32Channel) == Test_au16Read[u32Channel]);
+        }
+    }
+
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+    return Adc_Test_Result("Adc_Test_Balanced");
+}
+
+/** @} */
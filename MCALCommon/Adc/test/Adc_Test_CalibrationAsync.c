@@ -0,0 +1,188 @@
+/**
+*   @file           Adc_Test_CalibrationAsync.c
+*
+*   @brief   AUTOSAR Adc - Asynchronous calibration test.
+*   @details Calibrates unit 0 with Adc_Calibrate, then with Adc_CalibrateAsync completed by the end
+*            of conversion interrupt and by Adc_GetCalibrationState polls, and compares the longest
+*            hold of exclusive area 10: Adc_Calibrate holds it for the whole calibration, the
+*            asynchronous calibration only for its register writes. Then keeps the calibration
+*            from completing, register accesses costing no model time and the interrupt masked,
+*            and checks that it is abandoned after ADC_TIMEOUT_COUNTER polls: SC3[CAL] cleared,
+*            SC3 and CFG1 restored, failure reported to the status, the notification and Dem, and
+*            a new calibration completing normally afterwards.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+#include "StdRegMacros.h"
+
+/** @brief Longest hold of exclusive area 10 by the asynchronous calibration, in register accesses */
+#define TEST_ASYNC_HOLD_MAX 24ULL
+
+ISR(Adc_Adc12bsarv2_EndGroupConvUnit0);
+
+static Adc_CalibrationStatusType Test_Status;
+static uint32 Test_u32Notifications;
+static Std_ReturnType Test_LastResult;
+/** @brief SC3 and CFG1 of unit 0 after Adc_Init, changed by the calibration setup and restored at its end */
+static uint32 Test_u32Sc3;
+static uint32 Test_u32Cfg1;
+/* 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[1];
+} Test_Result;
+static Adc_ValueGroupType Test_au16Read[1];
+
+static void Test_Notify(Adc_HwUnitType Unit, Std_ReturnType Result)
+{
+    ADC_TEST_CHECK(0U == Unit);
+    Test_u32Notifications++;
+    Test_LastResult = Result;
+}
+
+static void Test_Start(void)
+{
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit0 =
+    {
+        .AdcHardwareUnitId = 0U,
+        .u32AdcCfg1Register = 0x4UL,
+        .u32AdcSc2Register = ADC12BSARV2_SC2_ADTRG_HW_U32,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U,
+        .pCalibrationNotification = Test_Notify
+    };
+    const Adc_GroupConfigurationType Group = { ADC_TEST_GROUP(0U) };
+
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(0U, &Unit0);
+    Adc_Test_SetGroup(0U, &Group);
+    Adc_Test_SetGroupCount(1U);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    Test_u32Notifications = 0UL;
+    Test_LastResult = (Std_ReturnType)E_NOT_OK;
+    Test_u32Sc3 = REG_READ32(ADC12BSARV2_SC3_REG_ADDR32(0U));
+    Test_u32Cfg1 = REG_READ32(ADC12BSARV2_CFG1_REG_ADDR32(0U));
+}
+
+/* The unit is back in the setup of its configuration */
+static void Test_CheckRestored(void)
+{
+    ADC_TEST_CHECK(Test_u32Sc3 == REG_READ32(ADC12BSARV2_SC3_REG_ADDR32(0U)));
+    ADC_TEST_CHECK(Test_u32Cfg1 == REG_READ32(ADC12BSARV2_CFG1_REG_ADDR32(0U)));
+}
+
+/* A group converts after the calibration */
+static void Test_Convert(uint16 u16Value)
+{
+    Adc_Adc12bsarv2_Sim_SetChannelValue(0U, 0U, u16Value);
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_Result.au16Value));
+    Adc_StartGroupConversion(0U);
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Test_au16Read));
+    ADC_TEST_CHECK(u16Value == Test_au16Read[0]);
+}
+
+int main(void)
+{
+    Adc_Adc12bsarv2_SimStatisticsType Statistics;
+    uint64 u64Calibration;
+    uint64 u64SyncHold;
+    uint64 u64AsyncHold;
+    uint32 u32Polls;
+
+    /* Adc_Calibrate holds the area for the whole calibration */
+    Test_Start();
+    Adc_Test_ResetLocks();
+    Adc_Calibrate(0U, &Test_Status);
+    ADC_TEST_CHECK(E_OK == Test_Status.Adc_UnitSelfTestStatus);
+    /* Calibration time of the model, with the averaging set up by the driver */
+    Adc_Adc12bsarv2_Sim_GetStatistics(0U, &Statistics);
+    ADC_TEST_CHECK(1UL == Statistics.u32Calibrations);
+    u64Calibration = Statistics.u64BusyCycles;
+    ADC_TEST_CHECK(1UL == Adc_Test_aLock[10].u32Count);
+    u64SyncHold = Adc_Test_aLock[10].u64MaxCycles;
+    ADC_TEST_CHECK(u64SyncHold >= u64Calibration);
+    Test_CheckRestored();
+    Adc_DeInit();
+
+    /* Completed by the end of conversion interrupt: the area is held for the start and the end */
+    Test_Start();
+    Adc_Test_ResetLocks();
+    ADC_TEST_CHECK(E_OK == Adc_CalibrateAsync(0U, &Test_Status));
+    ADC_TEST_CHECK(ADC_CALIBRATION_ONGOING == Adc_GetCalibrationState(0U));
+    /* The unit is busy until the end */
+    Adc_StartGroupConversion(0U);
+    ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(0U));
+    Adc_Test_u32DetCount = 0UL;
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(1UL == Test_u32Notifications);
+    ADC_TEST_CHECK(E_OK == Test_LastResult);
+    ADC_TEST_CHECK(E_OK == Test_Status.Adc_UnitSelfTestStatus);
+    ADC_TEST_CHECK(ADC_CALIBRATION_IDLE == Adc_GetCalibrationState(0U));
+    ADC_TEST_CHECK(2UL == Adc_Test_aLock[10].u32Count);
+    u64AsyncHold = Adc_Test_aLock[10].u64MaxCycles;
+    ADC_TEST_CHECK(TEST_ASYNC_HOLD_MAX >= u64AsyncHold);
+    Test_CheckRestored();
+    Test_Convert(0x123U);
+
+    /* Completed by the polls, the interrupt masked */
+    Adc_Adc12bsarv2_Sim_SetIrqHandler(0U, NULL_PTR);
+    Adc_Test_ResetLocks();
+    ADC_TEST_CHECK(E_OK == Adc_CalibrateAsync(0U, &Test_Status));
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(1UL == Test_u32Notifications);
+    ADC_TEST_CHECK(ADC_CALIBRATION_IDLE == Adc_GetCalibrationState(0U));
+    ADC_TEST_CHECK(2UL == Test_u32Notifications);
+    ADC_TEST_CHECK(E_OK == Test_LastResult);
+    ADC_TEST_CHECK(E_OK == Test_Status.Adc_UnitSelfTestStatus);
+    ADC_TEST_CHECK(TEST_ASYNC_HOLD_MAX >= Adc_Test_aLock[10].u64MaxCycles);
+    Test_CheckRestored();
+
+    /* Abandoned: the register accesses of the polls take no model time, the calibration never ends */
+    Adc_Adc12bsarv2_Sim_GetStatistics(0U, &Statistics);
+    ADC_TEST_CHECK(2UL == Statistics.u32Calibrations);
+    Adc_Adc12bsarv2_Sim_SetAccessCycles(0UL);
+    ADC_TEST_CHECK(E_OK == Adc_CalibrateAsync(0U, &Test_Status));
+    ADC_TEST_CHECK(E_OK == Test_Status.Adc_UnitSelfTestStatus);
+    for (u32Polls = 0UL; (u32Polls <= ADC_TIMEOUT_COUNTER) && (ADC_CALIBRATION_ONGOING == Adc_GetCalibrationState(0U)); u32Polls++)
+    {
+    }
+    Adc_Adc12bsarv2_Sim_SetAccessCycles(ADC_SIM_ACCESS_CYCLES_U32);
+    ADC_TEST_CHECK(ADC_TIMEOUT_COUNTER == u32Polls);
+    ADC_TEST_CHECK(ADC_CALIBRATION_IDLE == Adc_GetCalibrationState(0U));
+    ADC_TEST_CHECK(3UL == Test_u32Notifications);
+    ADC_TEST_CHECK(E_NOT_OK == Test_LastResult);
+    ADC_TEST_CHECK(E_NOT_OK == Test_Status.Adc_UnitSelfTestStatus);
+    ADC_TEST_CHECK(1UL == Adc_Test_u32DemFailed);
+    ADC_TEST_CHECK(TEST_ASYNC_HOLD_MAX >= Adc_Test_aLock[10].u64MaxCycles);
+    Test_CheckRestored();
+    /* The sequence was stopped: no late end of calibration */
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    Adc_Adc12bsarv2_Sim_GetStatistics(0U, &Statistics);
+    ADC_TEST_CHECK(2UL == Statistics.u32Calibrations);
+    ADC_TEST_CHECK(1UL == Statistics.u32Aborts);
+    ADC_TEST_CHECK(3UL == Test_u32Notifications);
+
+    /* The unit calibrates and converts again */
+    Adc_Adc12bsarv2_Sim_SetIrqHandler(0U, Adc_Adc12bsarv2_EndGroupConvUnit0);
+    ADC_TEST_CHECK(E_OK == Adc_CalibrateAsync(0U, &Test_Status));
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(4UL == Test_u32Notifications);
+    ADC_TEST_CHECK(E_OK == Test_LastResult);
+    ADC_TEST_CHECK(E_OK == Test_Status.Adc_UnitSelfTestStatus);
+    Test_CheckRestored();
+    Test_Convert(0x456U);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+
+    printf("calibration=%llu cycles, area 10 longest hold: Adc_Calibrate=%llu Adc_CalibrateAsync=%llu cycles, "
+           "abandoned after %u polls\n", (unsigned long long)u64Calibration, (unsigned long long)u64SyncHold,
+           (unsigned long long)u64AsyncHold, (unsigned)u32Polls);
+    return Adc_Test_Result("Adc_Test_CalibrationAsync");
+}
+
+/** @} */
@@ -0,0 +1,123 @@
+/**
+*   @file           Adc_Test_CalibrationPersist.c
+*
+*   @brief   AUTOSAR Adc - Calibration persistence test.
+*   @details Calibrates unit 0, changes the temperature and checks that Adc_GetCalibrationData
+*            exports the temperature of the calibration, not the current one. Stores the data in
+*            an in-memory flash stand-in, restarts the driver on a reset register model and checks
+*            that Adc_Init restores it, that the restored data keeps its stored temperature when
+*            exported again, and that data too far from the current temperature, or corrupted, is
+*            rejected. Built twice by the Makefile: Adc_Test_CalibrationPersist with Adc_Calibrate,
+*            Adc_Test_CalibrationPersistAsync with Adc_CalibrateAsync.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_CALIBRATION_TEMPERATURE    ((sint16)25)
+#define TEST_EXPORT_TEMPERATURE         ((sint16)31)
+#define TEST_TEMPERATURE_RANGE          ((uint16)10U)
+
+/** @brief Temperature returned by pfReadTemperature */
+static sint16 Test_s16Temperature;
+/** @brief In-memory stand-in of the non-volatile memory holding the calibration */
+static Adc_CalibrationDataType Test_Flash;
+static Adc_CalibrationDataType Test_Export;
+static boolean Test_bStarted;
+
+static sint16 Test_ReadTemperature(void)
+{
+    return Test_s16Temperature;
+}
+
+/**
+* @brief          Restarts the driver on a reset register model, loading Test_Flash if bRestore.
+*/
+static void Test_Start(boolean bRestore)
+{
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit0 =
+    {
+        .AdcHardwareUnitId = 0U,
+        .u32AdcCfg1Register = 0x4UL,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U,
+        .pCalibrationData = ((boolean)TRUE == bRestore) ? &Test_Flash : NULL_PTR,
+        .pfReadTemperature = Test_ReadTemperature,
+        .u16CalibrationTemperatureRange = TEST_TEMPERATURE_RANGE
+    };
+    const Adc_GroupConfigurationType Group = { ADC_TEST_GROUP(0U) };
+
+    if ((boolean)TRUE == Test_bStarted)
+    {
+        Adc_DeInit();
+    }
+    Test_bStarted = (boolean)TRUE;
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(0U, &Unit0);
+    Adc_Test_SetGroup(0U, &Group);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+}
+
+static void Test_Calibrate(void)
+{
+    Adc_CalibrationStatusType Status;
+
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+    ADC_TEST_CHECK(E_OK == Adc_CalibrateAsync(0U, &Status));
+    ADC_TEST_CHECK(ADC_CALIBRATION_ONGOING == Adc_GetCalibrationState(0U));
+    /* The temperature of the completion is the one stored */
+    Test_s16Temperature = TEST_CALIBRATION_TEMPERATURE;
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(ADC_CALIBRATION_IDLE == Adc_GetCalibrationState(0U));
+#else
+    Test_s16Temperature = TEST_CALIBRATION_TEMPERATURE;
+    Adc_Calibrate(0U, &Status);
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
+    ADC_TEST_CHECK(E_OK == Status.Adc_UnitSelfTestStatus);
+}
+
+int main(void)
+{
+    /* Nothing to export before a calibration */
+    Test_s16Temperature = TEST_EXPORT_TEMPERATURE;
+    Test_Start((boolean)FALSE);
+    ADC_TEST_CHECK(ADC_CALIBRATION_NONE == Adc_GetCalibrationOrigin(0U));
+    ADC_TEST_CHECK(E_NOT_OK == Adc_GetCalibrationData(0U, &Test_Export));
+
+    /* Calibration at one temperature, export at another */
+#if (ADC_CALIBRATION_ASYNC == STD_ON)
+    Test_s16Temperature = (sint16)(TEST_CALIBRATION_TEMPERATURE - (sint16)40);
+#endif /* ADC_CALIBRATION_ASYNC == STD_ON */
+    Test_Calibrate();
+    ADC_TEST_CHECK(ADC_CALIBRATION_MEASURED == Adc_GetCalibrationOrigin(0U));
+    Test_s16Temperature = TEST_EXPORT_TEMPERATURE;
+    ADC_TEST_CHECK(E_OK == Adc_GetCalibrationData(0U, &Test_Export));
+    ADC_TEST_CHECK((sint32)TEST_CALIBRATION_TEMPERATURE == Test_Export.s32Temperature);
+    ADC_TEST_CHECK(0UL != Test_Export.u32Clps);
+    memcpy(&Test_Flash, &Test_Export, sizeof(Test_Flash));
+
+    /* Restored within the range: the registers and the stored temperature come back */
+    Test_Start((boolean)TRUE);
+    ADC_TEST_CHECK(ADC_CALIBRATION_RESTORED == Adc_GetCalibrationOrigin(0U));
+    Test_s16Temperature = (sint16)(TEST_EXPORT_TEMPERATURE + (sint16)1);
+    memset(&Test_Export, 0, sizeof(Test_Export));
+    ADC_TEST_CHECK(E_OK == Adc_GetCalibrationData(0U, &Test_Export));
+    ADC_TEST_CHECK(0 == memcmp(&Test_Flash, &Test_Export, sizeof(Test_Flash)));
+
+    /* Too far from the calibration temperature */
+    Test_s16Temperature = (sint16)(TEST_CALIBRATION_TEMPERATURE + (sint16)TEST_TEMPERATURE_RANGE + (sint16)1);
+    Test_Start((boolean)TRUE);
+    ADC_TEST_CHECK(ADC_CALIBRATION_NONE == Adc_GetCalibrationOrigin(0U));
+
+    /* Corrupted data */
+    Test_s16Temperature = TEST_CALIBRATION_TEMPERATURE;
+    Test_Flash.u32Clp0 ^= 1UL;
+    Test_Start((boolean)TRUE);
+    ADC_TEST_CHECK(ADC_CALIBRATION_NONE == Adc_GetCalibrationOrigin(0U));
+
+    return Adc_Test_Result((ADC_CALIBRATION_ASYNC == STD_ON) ? "Adc_Test_CalibrationPersistAsync" : "Adc_Test_CalibrationPersist");
+}
+
+/** @} */
@@ -0,0 +1,175 @@
+/**
+*   @file           Adc_Test_Coalescing.c
+*
+*   @brief   AUTOSAR Adc - Notification coalescing test.
+*   @details Converts a hardware triggered streaming group of unit 0, one external trigger per
+*            sample, with batches of TEST_BATCH samples and a window of TEST_WINDOW cycles, and
+*            checks that a batch is notified when it is full, by Adc_MainFunction once its window
+*            has passed, and by Adc_DisableHardwareTrigger. A software triggered continuous group
+*            checks that Adc_StopGroupConversion notifies the open batch.
+*            Built with ADC_NOTIFICATION_COALESCING (Adc_Test_Coalescing) and with the groups
+*            notified by Adc_Main_NotificationDispatcher (Adc_Test_CoalescingDeferred).
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_HW_GROUP       0U
+#define TEST_SW_GROUP       1U
+#define TEST_SAMPLES        8U
+#define TEST_BATCH          4U
+/** @brief ADC_GET_TIMESTAMP ticks (model cycles) of a batch */
+#define TEST_WINDOW         20000UL
+/** @brief Model cycles from an external trigger to the end of its sample */
+#define TEST_SAMPLE_CYCLES  2000UL
+#define TEST_STEP_CYCLES    20UL
+
+static const Adc_HwTriggerTimerType Test_aTrigger[1] = { 0U };
+static const Adc_NotifyCoalescingType Test_Window = { TEST_BATCH, 0U, TEST_WINDOW };
+static const Adc_NotifyCoalescingType Test_Batch = { TEST_BATCH, 0U, 0UL };
+
+/* 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[TEST_SAMPLES];
+} Test_aResult[2];
+
+/**
+* @brief          Checks the notifications of Group, after the dispatcher for the deferred ones.
+*/
+static void Test_CheckNotified(Adc_GroupType Group, uint32 u32Expected)
+{
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+    uint32 u32Notifications = Adc_Test_au32Notifications[Group];
+
+    Adc_Main_NotificationDispatcher();
+    /* Posted, not called before the dispatcher */
+    ADC_TEST_CHECK((u32Expected == u32Notifications) || ((u32Expected - 1UL) == u32Notifications));
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+    ADC_TEST_CHECK(u32Expected == Adc_Test_au32Notifications[Group]);
+}
+
+static void Test_Sample(void)
+{
+    Adc_Pdb_Sim_ExternalTrigger(0U);
+    Adc_Test_Run(TEST_SAMPLE_CYCLES);
+}
+
+static void Test_HwTrigger(void)
+{
+    uint32 u32Sample;
+
+    Adc_EnableHardwareTrigger(TEST_HW_GROUP);
+    for (u32Sample = 1UL; u32Sample < TEST_BATCH; u32Sample++)
+    {
+        Test_Sample();
+        ADC_TEST_CHECK(u32Sample == Adc_aGroupStatus[TEST_HW_GROUP].NotifyBatchSamples);
+    }
+    Test_CheckNotified(TEST_HW_GROUP, 0UL);
+    /* Full batch */
+    Test_Sample();
+    Test_CheckNotified(TEST_HW_GROUP, 1UL);
+    ADC_TEST_CHECK(0U == Adc_aGroupStatus[TEST_HW_GROUP].NotifyBatchSamples);
+
+    /* A single sample is notified by the main function once the window has passed */
+    Test_Sample();
+    Adc_MainFunction();
+    Test_CheckNotified(TEST_HW_GROUP, 1UL);
+    Adc_Test_Run(TEST_WINDOW);
+    Adc_MainFunction();
+    Test_CheckNotified(TEST_HW_GROUP, 2UL);
+    Adc_MainFunction();
+    Test_CheckNotified(TEST_HW_GROUP, 2UL);
+
+    /* The disable notifies the open batch, once */
+    Test_Sample();
+    Test_Sample();
+    Adc_DisableHardwareTrigger(TEST_HW_GROUP);
+    Test_CheckNotified(TEST_HW_GROUP, 3UL);
+    ADC_TEST_CHECK(0U == Adc_aGroupStatus[TEST_HW_GROUP].NotifyBatchSamples);
+    Adc_Test_Run(TEST_WINDOW);
+    Adc_MainFunction();
+    Test_CheckNotified(TEST_HW_GROUP, 3UL);
+}
+
+static void Test_Stop(void)
+{
+    uint32 u32Steps = 0UL;
+    uint32 u32Notifications;
+
+    Adc_StartGroupConversion(TEST_SW_GROUP);
+    /* Stop in the second batch, with some of its samples completed */
+    while ((u32Steps < (ADC_TEST_SETTLE_CYCLES / TEST_STEP_CYCLES)) &&
+           ((0UL == Adc_Test_au32Notifications[TEST_SW_GROUP]) ||
+            ((TEST_BATCH / 2U) != Adc_aGroupStatus[TEST_SW_GROUP].NotifyBatchSamples)))
+    {
+        Adc_Test_Run(TEST_STEP_CYCLES);
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        Adc_Main_NotificationDispatcher();
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+        u32Steps++;
+    }
+    ADC_TEST_CHECK((TEST_BATCH / 2U) == Adc_aGroupStatus[TEST_SW_GROUP].NotifyBatchSamples);
+    u32Notifications = Adc_Test_au32Notifications[TEST_SW_GROUP];
+    Adc_StopGroupConversion(TEST_SW_GROUP);
+    Test_CheckNotified(TEST_SW_GROUP, u32Notifications + 1UL);
+    ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(TEST_SW_GROUP));
+    ADC_TEST_CHECK(0U == Adc_aGroupStatus[TEST_SW_GROUP].NotifyBatchSamples);
+
+    /* Nothing to notify when no sample completed */
+    Adc_EnableGroupNotification(TEST_SW_GROUP);
+    Adc_StartGroupConversion(TEST_SW_GROUP);
+    Adc_StopGroupConversion(TEST_SW_GROUP);
+    Test_CheckNotified(TEST_SW_GROUP, u32Notifications + 1UL);
+}
+
+int main(void)
+{
+    const Adc_GroupConfigurationType HwGroup =
+    {
+        ADC_TEST_GROUP(TEST_HW_GROUP),
+        .eTriggerSource = ADC_TRIGG_SRC_HW,
+        .pHwResource = Test_aTrigger,
+        .eAccessMode = ADC_ACCESS_MODE_STREAMING,
+        .eBufferMode = ADC_STREAM_BUFFER_CIRCULAR,
+        .NumSamples = TEST_SAMPLES,
+        .pNotifyCoalescing = &Test_Window,
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        .bDeferredNotification = (boolean)TRUE
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+    };
+    const Adc_GroupConfigurationType SwGroup =
+    {
+        ADC_TEST_GROUP(TEST_SW_GROUP),
+        .eMode = ADC_CONV_MODE_CONTINUOUS,
+        .eAccessMode = ADC_ACCESS_MODE_STREAMING,
+        .eBufferMode = ADC_STREAM_BUFFER_CIRCULAR,
+        .NumSamples = TEST_SAMPLES,
+        .pNotifyCoalescing = &Test_Batch,
+#if (ADC_DEFERRED_NOTIFICATION == STD_ON)
+        .bDeferredNotification = (boolean)TRUE
+#endif /* ADC_DEFERRED_NOTIFICATION == STD_ON */
+    };
+
+    Adc_Test_Reset();
+    Adc_Test_SetGroup(TEST_HW_GROUP, &HwGroup);
+    Adc_Test_SetGroup(TEST_SW_GROUP, &SwGroup);
+    Adc_Test_SetGroupCount(2U);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(TEST_HW_GROUP, Test_aResult[TEST_HW_GROUP].au16Value));
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(TEST_SW_GROUP, Test_aResult[TEST_SW_GROUP].au16Value));
+    Adc_EnableGroupNotification(TEST_HW_GROUP);
+    Adc_EnableGroupNotification(TEST_SW_GROUP);
+
+    Test_HwTrigger();
+    Test_Stop();
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+    return Adc_Test_Result((ADC_DEFERRED_NOTIFICATION == STD_ON) ? "Adc_Test_CoalescingDeferred" :
+                           "Adc_Test_Coalescing");
+}
+
+/** @} */
@@ -0,0 +1,88 @@
+/**
+*   @file           Adc_Test_DmaChain.c
+*
+*   @brief   AUTOSAR Adc - DMA reload list test.
+*   @details Converts a 48 channel group (three chunks of 16 SC1n registers) through the DMA with
+*            ADC_DMA_CHAIN_RELOAD and checks the results and that the DMA reloads the second and
+*            third chunks itself: one DMA interrupt per conversion round. Also checks that Adc_Init
+*            rejects a DMA group longer than ADC_MAX_GROUP_CHANNELS instead of falling back to the
+*            interrupt reload.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_ROUNDS         16U
+#define TEST_CHANNELS       ((uint32)ADC_MAX_GROUP_CHANNELS)
+
+static Adc_ValueGroupType Test_au16Result[TEST_CHANNELS];
+static Adc_ValueGroupType Test_au16Read[TEST_CHANNELS];
+
+static uint16 Test_Input(uint32 u32Round, uint32 u32Channel)
+{
+    return (uint16)(((u32Round * 53UL) + (u32Channel * 11UL) + 1UL) & 0xFFFUL);
+}
+
+static void Test_SetGroup(uint32 u32Channels)
+{
+    const Adc_GroupConfigurationType Group =
+    {
+        ADC_TEST_GROUP(0U),
+        .pAssignment = &Adc_Test_aAssignment[0],
+        .AssignedChannelCount = (Adc_ChannelIndexType)u32Channels
+    };
+
+    Adc_Test_Reset();
+    Adc_Test_SetDma(0U, (boolean)TRUE);
+    Adc_Test_SetGroup(0U, &Group);
+}
+
+int main(void)
+{
+    Adc_Mcl_SimStatisticsType Before;
+    Adc_Mcl_SimStatisticsType After;
+    uint32 u32Round;
+    uint32 u32Channel;
+
+    /* One channel more than the reload list holds */
+    Test_SetGroup(TEST_CHANNELS + 1UL);
+    ADC_TEST_CHECK(E_NOT_OK == Adc_Test_Init());
+    ADC_TEST_CHECK((uint8)ADC_INIT_ID == Adc_Test_u8DetService);
+    ADC_TEST_CHECK((uint8)ADC_E_PARAM_CONFIG == Adc_Test_u8DetError);
+
+    Test_SetGroup(TEST_CHANNELS);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_au16Result));
+    Adc_EnableGroupNotification(0U);
+
+    for (u32Round = 0UL; u32Round < TEST_ROUNDS; u32Round++)
+    {
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, Test_Input(u32Round, u32Channel));
+        }
+        Adc_Mcl_Sim_GetStatistics(ADC_TEST_DMA_CHANNEL(0U), &Before);
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        Adc_Mcl_Sim_GetStatistics(ADC_TEST_DMA_CHANNEL(0U), &After);
+
+        ADC_TEST_CHECK((u32Round + 1UL) == Adc_Test_au32Notifications[0]);
+        ADC_TEST_CHECK(1UL == (After.u32Interrupts - Before.u32Interrupts));
+        ADC_TEST_CHECK(0UL != (After.u32ScatterGathers - Before.u32ScatterGathers));
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Test_au16Read));
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            ADC_TEST_CHECK(Test_Input(u32Round, u32Channel) == Test_au16Read[u32Channel]);
+        }
+        ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(0U));
+    }
+
+    printf("channels=%u DMA interrupts per round=%u\n", TEST_CHANNELS, After.u32Interrupts - Before.u32Interrupts);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+    return Adc_Test_Result("Adc_Test_DmaChain");
+}
+
+/** @} */
@@ -0,0 +1,169 @@
+/**
+*   @file           Adc_Test_ExtendedNotification.c
+*
+*   @brief   AUTOSAR Adc - Extended notification test.
+*   @details Converts a continuous circular group of 2 channels and 4 samples on unit 0 with
+*            interrupts, with DMA and with double buffered DMA, with and without the half
+*            interrupt, and checks every call of its extended notification: the sequence number
+*            continues the previous call, the pointer is the slot of that sample in the result
+*            buffer, the count is 1 sample per call, 2 per half and 4 per major loop without the
+*            half interrupt, and the samples hold the input of their sequence number. The model
+*            runs without register access time, one cycle at a time, and the inputs are changed
+*            for every sample. The notification reads the group when its buffer is full, since a
+*            read in ADC_COMPLETED restarts the buffer, and Adc_ReadGroup returns the last sample
+*            passed. The double buffering of several channels ends its major loops on the linked
+*            eDMA channel.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_CHANNELS       2U
+#define TEST_SAMPLES        4U
+#define TEST_CALLS_MAX      32U
+/** @brief Samples converted in each mode */
+#define TEST_SEQUENCE_END   12UL
+/** @brief Bound of the model cycles to wait for TEST_SEQUENCE_END samples */
+#define TEST_CYCLES_MAX     100000UL
+
+typedef enum
+{
+    TEST_INTERRUPT = 0,
+    TEST_DMA,
+    TEST_DOUBLE_BUFFER,
+    TEST_DOUBLE_BUFFER_HALF
+} Test_ModeType;
+
+/* 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[TEST_SAMPLES * TEST_CHANNELS];
+} Test_Result;
+static uint32 Test_u32Calls;
+static uint32 Test_u32Reads;
+static uint32 Test_u32NextSequence;
+static Adc_StreamNumSampleType Test_aCount[TEST_CALLS_MAX];
+
+static uint16 Test_Input(uint32 u32Sequence, uint32 u32Channel)
+{
+    return (uint16)(((u32Sequence * 16UL) + u32Channel + 1UL) & 0xFFFUL);
+}
+
+static void Test_Notify(Adc_GroupType Group, const Adc_ValueGroupType * pSamples, Adc_StreamNumSampleType SampleCount, uint32 u32Sequence)
+{
+    Adc_ValueGroupType au16Read[TEST_CHANNELS];
+    uint32 u32Sample;
+    uint32 u32Channel;
+    boolean bInputs = (boolean)TRUE;
+
+    ADC_TEST_CHECK(0U == Group);
+    ADC_TEST_CHECK(Test_u32NextSequence == u32Sequence);
+    ADC_TEST_CHECK(&Test_Result.au16Value[u32Sequence % TEST_SAMPLES] == pSamples);
+    ADC_TEST_CHECK(((u32Sequence % TEST_SAMPLES) + SampleCount) <= TEST_SAMPLES);
+    for (u32Sample = 0UL; u32Sample < SampleCount; u32Sample++)
+    {
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            if (Test_Input(u32Sequence + u32Sample, u32Channel) != pSamples[(u32Channel * TEST_SAMPLES) + u32Sample])
+            {
+                bInputs = (boolean)FALSE;
+            }
+        }
+    }
+    ADC_TEST_CHECK(TRUE == bInputs);
+
+    /* Read once per buffer: a read of a completed group restarts its buffer */
+    if (ADC_STREAM_COMPLETED == Adc_GetGroupStatus(Group))
+    {
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(Group, au16Read));
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            ADC_TEST_CHECK(pSamples[(u32Channel * TEST_SAMPLES) + SampleCount - 1UL] == au16Read[u32Channel]);
+        }
+        Test_u32Reads++;
+    }
+
+    if (Test_u32Calls < TEST_CALLS_MAX)
+    {
+        Test_aCount[Test_u32Calls] = SampleCount;
+    }
+    Test_u32Calls++;
+    Test_u32NextSequence = u32Sequence + (uint32)SampleCount;
+}
+
+static void Test_Run(Test_ModeType eMode)
+{
+    const boolean bDouble = (boolean)(TEST_DOUBLE_BUFFER <= eMode);
+    const Adc_GroupConfigurationType Group =
+    {
+        ADC_TEST_GROUP(0U),
+        .ExtendedNotification = Test_Notify,
+        .eMode = ADC_CONV_MODE_CONTINUOUS,
+        .eAccessMode = ADC_ACCESS_MODE_STREAMING,
+        .eBufferMode = ADC_STREAM_BUFFER_CIRCULAR,
+        .NumSamples = TEST_SAMPLES,
+        .pAssignment = Adc_Test_aAssignment,
+        .AssignedChannelCount = TEST_CHANNELS,
+        .bAdcDoubleBuffering = bDouble,
+        .bHalfInterrupt = (boolean)(TEST_DOUBLE_BUFFER_HALF == eMode)
+    };
+    Adc_Adc12bsarv2_SimStatisticsType Statistics;
+    uint32 u32Channel;
+    uint32 u32Cycles = 0UL;
+    uint32 u32Call;
+    /* Samples passed to each call */
+    const Adc_StreamNumSampleType Count = (TEST_DOUBLE_BUFFER == eMode) ? TEST_SAMPLES :
+                                          ((TEST_DOUBLE_BUFFER_HALF == eMode) ? (TEST_SAMPLES / 2U) : 1U);
+
+    Test_u32Calls = 0UL;
+    Test_u32Reads = 0UL;
+    Test_u32NextSequence = 0UL;
+    Adc_Test_Reset();
+    Adc_Test_SetDma(0U, (boolean)(TEST_INTERRUPT != eMode));
+    Adc_Test_SetGroup(0U, &Group);
+    Adc_Test_SetGroupCount(1U);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_Result.au16Value));
+    Adc_Adc12bsarv2_Sim_SetAccessCycles(0UL);
+    Adc_EnableGroupNotification(0U);
+    Adc_StartGroupConversion(0U);
+
+    /* Each conversion ends in its own cycle and takes the input of its sample */
+    while ((Test_u32NextSequence < TEST_SEQUENCE_END) && (u32Cycles < TEST_CYCLES_MAX))
+    {
+        Adc_Adc12bsarv2_Sim_GetStatistics(0U, &Statistics);
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, Test_Input(Statistics.u32Conversions / TEST_CHANNELS, u32Channel));
+        }
+        Adc_Test_Run(1UL);
+        u32Cycles++;
+    }
+    Adc_StopGroupConversion(0U);
+
+    ADC_TEST_CHECK(TEST_SEQUENCE_END == Test_u32NextSequence);
+    ADC_TEST_CHECK((TEST_SEQUENCE_END / Count) == Test_u32Calls);
+    ADC_TEST_CHECK((TEST_SEQUENCE_END / TEST_SAMPLES) == Test_u32Reads);
+    for (u32Call = 0UL; (u32Call < Test_u32Calls) && (u32Call < TEST_CALLS_MAX); u32Call++)
+    {
+        ADC_TEST_CHECK(Count == Test_aCount[u32Call]);
+    }
+    /* The classic notification is not called */
+    ADC_TEST_CHECK(0UL == Adc_Test_au32Notifications[0]);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    Test_Run(TEST_INTERRUPT);
+    Test_Run(TEST_DMA);
+    Test_Run(TEST_DOUBLE_BUFFER);
+    Test_Run(TEST_DOUBLE_BUFFER_HALF);
+    return Adc_Test_Result("Adc_Test_ExtendedNotification");
+}
+
+/** @} */
@@ -0,0 +1,94 @@
+/**
+*   @file           Adc_Test_LimitCompare.c
+*
+*   @brief   AUTOSAR Adc - Hardware compare limit checking test.
+*   @details Triggers a hardware triggered group checking one channel against ]100, 200] with
+*            inputs in and out of range, and checks that only the conversions in range are
+*            notified and read back. Built twice by the Makefile: Adc_Test_LimitCompare checks the
+*            range with the ADC compare function, which discards the other conversions without an
+*            interrupt and leaves bLimitCheckFailed unchanged. Adc_Test_LimitSoftware checks it in
+*            the end of conversion handler, which takes one interrupt per conversion and sets
+*            bLimitCheckFailed for the rounds out of range.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_CHANNEL        3U
+#define TEST_LOW            100U
+#define TEST_HIGH           200U
+
+static const Adc_HwTriggerTimerType Test_aTrigger[1] = { 0U };
+static Adc_ValueGroupType Test_au16Result[2];
+static Adc_ValueGroupType Test_au16Read[2];
+
+static const uint16 Test_au16Input[] = { 150U, 300U, 101U, 100U, 0U, 200U, 201U, 4095U, 199U };
+
+int main(void)
+{
+    const Adc_ChannelLimitCheckingType Range = { ADC_RANGE_BETWEEN, TEST_HIGH, TEST_LOW };
+    Adc_Adc12bsarv2_SimStatisticsType Statistics;
+    uint32 u32InRange = 0UL;
+    uint32 u32Index;
+    boolean bInRange;
+
+    Adc_Test_Reset();
+    memcpy(&Adc_aChannelsLimitCheckingCfg[0][TEST_CHANNEL], &Range, sizeof(Range));
+    {
+        const Adc_GroupConfigurationType Group =
+        {
+            ADC_TEST_GROUP(0U),
+            .eTriggerSource = ADC_TRIGG_SRC_HW,
+            .pHwResource = Test_aTrigger,
+            .pAssignment = &Adc_Test_aAssignment[TEST_CHANNEL],
+            .bAdcGroupLimitcheck = (boolean)TRUE
+        };
+
+        Adc_Test_SetGroup(0U, &Group);
+    }
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_au16Result));
+    Adc_EnableGroupNotification(0U);
+    Adc_EnableHardwareTrigger(0U);
+
+    for (u32Index = 0UL; u32Index < (sizeof(Test_au16Input) / sizeof(Test_au16Input[0])); u32Index++)
+    {
+        bInRange = (boolean)((Test_au16Input[u32Index] > TEST_LOW) && (Test_au16Input[u32Index] <= TEST_HIGH));
+        Adc_Adc12bsarv2_Sim_SetChannelValue(0U, TEST_CHANNEL, Test_au16Input[u32Index]);
+        Adc_Pdb_Sim_ExternalTrigger(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        if ((boolean)TRUE == bInRange)
+        {
+            u32InRange++;
+            ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Test_au16Read));
+            ADC_TEST_CHECK(Test_au16Input[u32Index] == Test_au16Read[0]);
+            ADC_TEST_CHECK((boolean)FALSE == Adc_aGroupStatus[0].bLimitCheckFailed);
+        }
+        else
+        {
+            ADC_TEST_CHECK(E_NOT_OK == Adc_ReadGroup(0U, Test_au16Read));
+            ADC_TEST_CHECK((boolean)((ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) ? FALSE : TRUE) == Adc_aGroupStatus[0].bLimitCheckFailed);
+        }
+        ADC_TEST_CHECK(u32InRange == Adc_Test_au32Notifications[0]);
+    }
+
+    Adc_Adc12bsarv2_Sim_GetStatistics(0U, &Statistics);
+#if (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON)
+    ADC_TEST_CHECK(u32InRange == Statistics.u32Interrupts);
+    ADC_TEST_CHECK((u32Index - u32InRange) == Statistics.u32CompareRejects);
+#else
+    ADC_TEST_CHECK(u32Index == Statistics.u32Interrupts);
+    ADC_TEST_CHECK(0UL == Statistics.u32CompareRejects);
+#endif /* (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) */
+    printf("%s compare: rounds=%u in range=%u interrupts=%u compare rejects=%u\n",
+           (ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) ? "hardware" : "software", u32Index, u32InRange,
+           Statistics.u32Interrupts, Statistics.u32CompareRejects);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DisableHardwareTrigger(0U);
+    Adc_DeInit();
+    return Adc_Test_Result((ADC_LIMIT_CHECK_HW_COMPARE == STD_ON) ? "Adc_Test_LimitCompare" : "Adc_Test_LimitSoftware");
+}
+
+/** @} */
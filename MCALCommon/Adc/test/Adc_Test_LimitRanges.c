@@ -0,0 +1,253 @@
+/**
+*   @file           Adc_Test_LimitRanges.c
+*
+*   @brief   AUTOSAR Adc - Limit range test.
+*   @details Checks Adc_CheckConversionValuesInRange for the 7 range kinds and a set of limits,
+*            including reversed, equal and extreme ones, against Test_Baseline, the range switch
+*            of the driver without ADC_LIMIT_CHECK_PRECOMPUTED, for every 16 bit conversion value.
+*            Then converts channel 5 of a checked group at the values around both limits of every
+*            kind, and checks that only the conversions in range are notified and returned.
+*            Finally times the end of conversion interrupt of the group, in model cycles and host
+*            time, for every range kind and without limit checking, and prints the costs.
+*            Built with ADC_LIMIT_CHECK_PRECOMPUTED and a range table of 8 channels per unit
+*            (Adc_Test_LimitRanges), which also checks that Adc_Init rejects a configuration which
+*            checks channel 10, and with the range switch (Adc_Test_LimitRangesSwitch).
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+#include "Adc_Ipw.h"
+
+#define TEST_CHANNEL        5U
+#define TEST_KINDS          7U
+#define TEST_VALUE_MAX      0xFFFUL
+/** @brief Conversions timed per range kind */
+#define TEST_ROUNDS         2000U
+
+typedef struct
+{
+    uint16 u16Low;
+    uint16 u16High;
+} Test_LimitsType;
+
+static const Adc_ChannelRangeSelectType Test_aeKind[TEST_KINDS] =
+{
+    ADC_RANGE_ALWAYS, ADC_RANGE_BETWEEN, ADC_RANGE_NOT_BETWEEN, ADC_RANGE_NOT_OVER_HIGH,
+    ADC_RANGE_NOT_UNDER_LOW, ADC_RANGE_OVER_HIGH, ADC_RANGE_UNDER_LOW
+};
+
+static const char * const Test_aszKind[TEST_KINDS] =
+{
+    "ALWAYS", "BETWEEN", "NOT_BETWEEN", "NOT_OVER_HIGH", "NOT_UNDER_LOW", "OVER_HIGH", "UNDER_LOW"
+};
+
+static const Test_LimitsType Test_aLimits[] =
+{
+    { 100U, 200U }, { 200U, 100U }, { 150U, 150U }, { 0U, (uint16)TEST_VALUE_MAX }, { 0U, 0U },
+    { (uint16)TEST_VALUE_MAX, (uint16)TEST_VALUE_MAX }, { 1U, (uint16)(TEST_VALUE_MAX - 1UL) }
+};
+
+static Adc_ValueGroupType Test_au16Result[2];
+static Adc_ValueGroupType Test_au16Read[2];
+static uint64 Test_u64IsrCycles;
+static uint64 Test_u64IsrNs;
+static uint32 Test_u32Isrs;
+
+ISR(Adc_Adc12bsarv2_EndGroupConvUnit0);
+
+/* The range switch of Adc_CheckConversionValuesInRange without ADC_LIMIT_CHECK_PRECOMPUTED, 12 bit right aligned */
+static boolean Test_Baseline(uint16 u16Value, Adc_ChannelRangeSelectType eKind, uint16 u16Low, uint16 u16High)
+{
+    boolean bInRange = (boolean)FALSE;
+    uint16 u16Masked = (uint16)(u16Value & TEST_VALUE_MAX);
+
+    switch (eKind)
+    {
+        case ADC_RANGE_ALWAYS:          bInRange = (boolean)TRUE; break;
+        case ADC_RANGE_BETWEEN:         bInRange = (boolean)((u16Masked > u16Low) && (u16Masked <= u16High)); break;
+        case ADC_RANGE_NOT_BETWEEN:     bInRange = (boolean)((u16Masked > u16High) || (u16Masked <= u16Low)); break;
+        case ADC_RANGE_NOT_OVER_HIGH:   bInRange = (boolean)(u16Masked <= u16High); break;
+        case ADC_RANGE_NOT_UNDER_LOW:   bInRange = (boolean)(u16Masked > u16Low); break;
+        case ADC_RANGE_OVER_HIGH:       bInRange = (boolean)(u16Masked > u16High); break;
+        case ADC_RANGE_UNDER_LOW:       bInRange = (boolean)(u16Masked <= u16Low); break;
+        default:                        break;
+    }
+    return bInRange;
+}
+
+/* End of conversion interrupt of unit 0: times the driver handler */
+static void Test_Isr(void)
+{
+    uint64 u64Time = Adc_Adc12bsarv2_Sim_GetTime();
+    uint64 u64Ns = Adc_Test_GetNs();
+
+    Adc_Adc12bsarv2_EndGroupConvUnit0();
+    Test_u64IsrNs += Adc_Test_GetNs() - u64Ns;
+    Test_u64IsrCycles += Adc_Adc12bsarv2_Sim_GetTime() - u64Time;
+    Test_u32Isrs++;
+}
+
+static void Test_SetGroup(Adc_ChannelType Channel, Adc_ChannelRangeSelectType eKind, const Test_LimitsType * pLimits,
+                          boolean bLimitCheck)
+{
+    const Adc_ChannelLimitCheckingType Range = { eKind, pLimits->u16High, pLimits->u16Low };
+    const Adc_GroupConfigurationType Group =
+    {
+        ADC_TEST_GROUP(0U),
+        .pAssignment = &Adc_Test_aAssignment[Channel],
+        .bAdcGroupLimitcheck = bLimitCheck
+    };
+
+    Adc_Test_Reset();
+    memcpy(&Adc_aChannelsLimitCheckingCfg[0][Channel], &Range, sizeof(Range));
+    Adc_Test_SetGroup(0U, &Group);
+}
+
+#if (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON)
+static void Test_Reject(void)
+{
+    Test_SetGroup(10U, ADC_RANGE_BETWEEN, &Test_aLimits[0], (boolean)TRUE);
+    ADC_TEST_CHECK(E_NOT_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(ADC_INIT_ID == Adc_Test_u8DetService);
+    ADC_TEST_CHECK(ADC_E_PARAM_CONFIG == Adc_Test_u8DetError);
+    /* The driver stayed uninitialized */
+    Adc_StartGroupConversion(0U);
+    ADC_TEST_CHECK(ADC_E_UNINIT == Adc_Test_u8DetError);
+    ADC_TEST_CHECK(2UL == Adc_Test_u32DetCount);
+    Adc_Test_u32DetCount = 0UL;
+}
+#endif /* (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) */
+
+/* Every 16 bit value, the bits above the resolution are ignored */
+static void Test_Sweep(void)
+{
+    uint32 u32Kind;
+    uint32 u32Limits;
+    uint32 u32Value;
+    uint32 u32Mismatches;
+
+    for (u32Kind = 0UL; u32Kind < TEST_KINDS; u32Kind++)
+    {
+        for (u32Limits = 0UL; u32Limits < (sizeof(Test_aLimits) / sizeof(Test_aLimits[0])); u32Limits++)
+        {
+            Test_SetGroup(TEST_CHANNEL, Test_aeKind[u32Kind], &Test_aLimits[u32Limits], (boolean)TRUE);
+            ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+            u32Mismatches = 0UL;
+            for (u32Value = 0UL; u32Value <= 0xFFFFUL; u32Value++)
+            {
+                if (Test_Baseline((uint16)u32Value, Test_aeKind[u32Kind], Test_aLimits[u32Limits].u16Low, Test_aLimits[u32Limits].u16High) != \
+                    Adc_CheckConversionValuesInRange((Adc_ValueGroupType)u32Value, 0U, TEST_CHANNEL))
+                {
+                    u32Mismatches++;
+                }
+            }
+            ADC_TEST_CHECK(0UL == u32Mismatches);
+            if (0UL != u32Mismatches)
+            {
+                printf("%s ]%u, %u]: %u mismatches\n", Test_aszKind[u32Kind], (unsigned)Test_aLimits[u32Limits].u16Low,
+                       (unsigned)Test_aLimits[u32Limits].u16High, (unsigned)u32Mismatches);
+            }
+            Adc_DeInit();
+        }
+    }
+}
+
+static void Test_Convert(uint16 u16Value, boolean bInRange)
+{
+    uint32 u32Notified = Adc_Test_au32Notifications[0];
+
+    Adc_Adc12bsarv2_Sim_SetChannelValue(0U, TEST_CHANNEL, u16Value);
+    Adc_StartGroupConversion(0U);
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    if ((boolean)TRUE == bInRange)
+    {
+        ADC_TEST_CHECK((u32Notified + 1UL) == Adc_Test_au32Notifications[0]);
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Test_au16Read));
+        ADC_TEST_CHECK(u16Value == Test_au16Read[0]);
+    }
+    else
+    {
+        ADC_TEST_CHECK(u32Notified == Adc_Test_au32Notifications[0]);
+        ADC_TEST_CHECK(E_NOT_OK == Adc_ReadGroup(0U, Test_au16Read));
+        Adc_StopGroupConversion(0U);
+        Adc_EnableGroupNotification(0U);
+    }
+}
+
+/* Conversions around both limits of every kind, through the end of conversion handler */
+static void Test_Boundaries(void)
+{
+    static const Test_LimitsType Limits = { 100U, 200U };
+    static const uint16 au16Value[] = { 0U, 99U, 100U, 101U, 150U, 199U, 200U, 201U, (uint16)TEST_VALUE_MAX };
+    uint32 u32Kind;
+    uint32 u32Value;
+
+    for (u32Kind = 0UL; u32Kind < TEST_KINDS; u32Kind++)
+    {
+        Test_SetGroup(TEST_CHANNEL, Test_aeKind[u32Kind], &Limits, (boolean)TRUE);
+        ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+        ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_au16Result));
+        Adc_EnableGroupNotification(0U);
+        for (u32Value = 0UL; u32Value < (sizeof(au16Value) / sizeof(au16Value[0])); u32Value++)
+        {
+            Test_Convert(au16Value[u32Value], Test_Baseline(au16Value[u32Value], Test_aeKind[u32Kind], Limits.u16Low, Limits.u16High));
+        }
+        ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+        Adc_DeInit();
+    }
+}
+
+/* Mean cost of the interrupt of an in range conversion */
+static void Test_Cost(const char * szName, Adc_ChannelRangeSelectType eKind, boolean bLimitCheck)
+{
+    static const Test_LimitsType Limits = { 100U, 200U };
+    uint32 u32Round;
+    /* In range for every kind but ALWAYS, which accepts it too */
+    uint16 u16Value = ((ADC_RANGE_BETWEEN == eKind) || (ADC_RANGE_NOT_OVER_HIGH == eKind) || (ADC_RANGE_NOT_UNDER_LOW == eKind)) ? 150U :
+                      (((ADC_RANGE_UNDER_LOW == eKind) || (ADC_RANGE_NOT_BETWEEN == eKind)) ? 50U : 250U);
+
+    Test_SetGroup(TEST_CHANNEL, eKind, &Limits, bLimitCheck);
+    Adc_Adc12bsarv2_Sim_SetIrqHandler(0U, Test_Isr);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_au16Result));
+    Adc_Adc12bsarv2_Sim_SetChannelValue(0U, TEST_CHANNEL, u16Value);
+    Test_u64IsrCycles = 0ULL;
+    Test_u64IsrNs = 0ULL;
+    Test_u32Isrs = 0UL;
+    for (u32Round = 0UL; u32Round < TEST_ROUNDS; u32Round++)
+    {
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Test_au16Read));
+        ADC_TEST_CHECK(u16Value == Test_au16Read[0]);
+    }
+    ADC_TEST_CHECK(TEST_ROUNDS == Test_u32Isrs);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    printf("%-14s %5.1f register accesses %6.1f ns\n", szName, (double)Test_u64IsrCycles / Test_u32Isrs,
+           (double)Test_u64IsrNs / Test_u32Isrs);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    uint32 u32Kind;
+
+#if (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON)
+    Test_Reject();
+#endif /* (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) */
+    Test_Sweep();
+    Test_Boundaries();
+
+    printf("end of conversion interrupt, 1 channel, %s, mean of %u:\n",
+           (ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) ? "precomputed ranges" : "range switch", TEST_ROUNDS);
+    Test_Cost("unchecked", ADC_RANGE_ALWAYS, (boolean)FALSE);
+    for (u32Kind = 0UL; u32Kind < TEST_KINDS; u32Kind++)
+    {
+        Test_Cost(Test_aszKind[u32Kind], Test_aeKind[u32Kind], (boolean)TRUE);
+    }
+    return Adc_Test_Result((ADC_LIMIT_CHECK_PRECOMPUTED == STD_ON) ? "Adc_Test_LimitRanges" : "Adc_Test_LimitRangesSwitch");
+}
+
+/** @} */
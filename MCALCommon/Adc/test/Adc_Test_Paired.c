@@ -0,0 +1,156 @@
+/**
+*   @file           Adc_Test_Paired.c
+*
+*   @brief   AUTOSAR Adc - Paired group start test.
+*   @details Converts a pair of 4 channel groups on units 0 and 1 and checks the results of both
+*            halves and that the PDB counters of the two units start one register write apart.
+*            Then keeps a continuous group converting on unit 1 and checks that starting the pair
+*            is rejected without queueing a half on either unit, and that the pair starts again
+*            once unit 1 is free. Built twice by the Makefile: Adc_Test_Paired with the
+*            development error detection, Adc_Test_PairedNoDet without it, where the busy unit is
+*            only caught when both queues are claimed.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_ROUNDS         8U
+#define TEST_CHANNELS       4U
+#define TEST_BUSY_GROUP     2U
+/** @brief The PDB counters are started by two consecutive SC writes, one model cycle apart */
+#define TEST_MAX_SKEW       1ULL
+
+static Adc_ValueGroupType Test_aau16Result[2][TEST_CHANNELS];
+static Adc_ValueGroupType Test_au16BusyResult[2];
+static Adc_ValueGroupType Test_au16Read[TEST_CHANNELS];
+/** @brief Largest start skew measured by Adc_Pdb_Sim_GetStartSkew over the rounds */
+static uint64 Test_u64MaxSkew;
+
+static uint16 Test_Input(uint32 u32Round, Adc_HwUnitType Unit, uint32 u32Channel)
+{
+    return (uint16)(((u32Round * 41UL) + ((uint32)Unit * 557UL) + (u32Channel * 19UL) + 1UL) & 0xFFFUL);
+}
+
+static void Test_ConvertPair(uint32 u32Round)
+{
+    uint64 u64Skew = 0xFFFFFFFFULL;
+    uint32 u32Channel;
+    Adc_HwUnitType Unit;
+
+    for (Unit = 0U; Unit < 2U; Unit++)
+    {
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(Unit, (uint8)u32Channel, Test_Input(u32Round, Unit, u32Channel));
+        }
+    }
+    Adc_StartGroupConversion(0U);
+    ADC_TEST_CHECK(ADC_BUSY == Adc_GetGroupStatus(0U));
+    ADC_TEST_CHECK(ADC_BUSY == Adc_GetGroupStatus(1U));
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+
+    ADC_TEST_CHECK(E_OK == Adc_Pdb_Sim_GetStartSkew(0U, 1U, &u64Skew));
+    ADC_TEST_CHECK(TEST_MAX_SKEW >= u64Skew);
+    Test_u64MaxSkew = (u64Skew > Test_u64MaxSkew) ? u64Skew : Test_u64MaxSkew;
+    for (Unit = 0U; Unit < 2U; Unit++)
+    {
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup((Adc_GroupType)Unit, Test_au16Read));
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            ADC_TEST_CHECK(Test_Input(u32Round, Unit, u32Channel) == Test_au16Read[u32Channel]);
+        }
+        ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus((Adc_GroupType)Unit));
+    }
+}
+
+int main(void)
+{
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit1 =
+    {
+        .AdcHardwareUnitId = 1U,
+        .u32AdcCfg1Register = 0x4UL,
+        .u32AdcSc2Register = ADC12BSARV2_SC2_ADTRG_HW_U32,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U
+    };
+    Adc_GroupType Group;
+    uint32 u32Round;
+    uint32 u32Notifications;
+
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(1U, &Unit1);
+    for (Group = 0U; Group < 2U; Group++)
+    {
+        const Adc_GroupConfigurationType Half =
+        {
+            ADC_TEST_GROUP(Group),
+            .HwUnit = (Adc_HwUnitType)Group,
+            .pAssignment = &Adc_Test_aAssignment[0],
+            .AssignedChannelCount = TEST_CHANNELS,
+            .PairedGroup = (Adc_GroupType)(1U - Group)
+        };
+
+        Adc_Test_SetGroup(Group, &Half);
+    }
+    {
+        const Adc_GroupConfigurationType Busy =
+        {
+            ADC_TEST_GROUP(TEST_BUSY_GROUP),
+            .HwUnit = 1U,
+            .eMode = ADC_CONV_MODE_CONTINUOUS,
+            .pAssignment = &Adc_Test_aAssignment[TEST_CHANNELS]
+        };
+
+        Adc_Test_SetGroup(TEST_BUSY_GROUP, &Busy);
+    }
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_aau16Result[0]));
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(1U, Test_aau16Result[1]));
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(TEST_BUSY_GROUP, Test_au16BusyResult));
+    Adc_EnableGroupNotification(0U);
+    Adc_EnableGroupNotification(1U);
+
+    for (u32Round = 0UL; u32Round < (TEST_ROUNDS / 2UL); u32Round++)
+    {
+        Test_ConvertPair(u32Round);
+    }
+
+    /* Unit 1 busy: the pair is rejected, neither half waits in a queue */
+    Adc_StartGroupConversion(TEST_BUSY_GROUP);
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    Adc_Test_u32DetCount = 0UL;
+    Adc_StartGroupConversion(0U);
+#if (ADC_DEV_ERROR_DETECT == STD_ON)
+    ADC_TEST_CHECK(1UL == Adc_Test_u32DetCount);
+    ADC_TEST_CHECK((uint8)ADC_STARTGROUPCONVERSION_ID == Adc_Test_u8DetService);
+    ADC_TEST_CHECK((uint8)ADC_E_BUSY == Adc_Test_u8DetError);
+#endif /* (ADC_DEV_ERROR_DETECT == STD_ON) */
+    Adc_Test_u32DetCount = 0UL;
+    ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(0U));
+    ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(1U));
+    ADC_TEST_CHECK(1U == Adc_aUnitStatus[1].SwNormalQueueIndex);
+    ADC_TEST_CHECK(0U == Adc_aUnitStatus[0].SwNormalQueueIndex);
+    u32Notifications = Adc_Test_au32Notifications[0];
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(u32Notifications == Adc_Test_au32Notifications[0]);
+    ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(0U));
+    Adc_StopGroupConversion(TEST_BUSY_GROUP);
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+
+    /* Unit 1 free again */
+    for (u32Round = (TEST_ROUNDS / 2UL); u32Round < TEST_ROUNDS; u32Round++)
+    {
+        Test_ConvertPair(u32Round);
+    }
+    ADC_TEST_CHECK(TEST_ROUNDS == Adc_Test_au32Notifications[0]);
+    printf("paired rounds=%u measured start skew max=%llu cycle (bound %llu), busy unit rejected\n", TEST_ROUNDS,
+           (unsigned long long)Test_u64MaxSkew, (unsigned long long)TEST_MAX_SKEW);
+
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+    return Adc_Test_Result((ADC_DEV_ERROR_DETECT == STD_ON) ? "Adc_Test_Paired" : "Adc_Test_PairedNoDet");
+}
+
+/** @} */
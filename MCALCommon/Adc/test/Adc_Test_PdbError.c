@@ -0,0 +1,179 @@
+/**
+*   @file           Adc_Test_PdbError.c
+*
+*   @brief   AUTOSAR Adc - PDB sequence error recovery test.
+*   @details Raises a sequence error with Adc_Pdb_Sim_InjectSequenceError while a 4 channel group
+*            of unit 0 converts, TEST_ROUNDS times, and checks that Adc_Pdb_ChannelSequenceError
+*            clears the ERR flag, restores PDB SC and calls the PDB notification of the unit once.
+*            The counter disabled by the recovery drops the pre-trigger in flight and the
+*            back-to-back chain behind it: the group stays busy until the application restarts it,
+*            and converts correctly once restarted. The recovery is timed in model cycles
+*            (register accesses) and host time and printed. Run with the results read by
+*            interrupts, then by DMA, where the recovery also reprograms the transfer.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_ROUNDS         64U
+#define TEST_CHANNELS       4U
+/** @brief PDB channel and pre-trigger of the injected error */
+#define TEST_PDB_CHANNEL    0U
+#define TEST_PRETRIGGER     1U
+/** @brief Model cycles after the start at which the error is injected, within the first conversion */
+#define TEST_INJECT_CYCLES  20UL
+/** @brief Register accesses of the recovery of an error on channel 0: CH0S and SC reads, SC, CH0S and SC writes */
+#define TEST_RECOVERY_CYCLES 5ULL
+
+ISR(Adc_Pdb_ChannelSequenceError0);
+
+static Adc_ValueGroupType Test_au16Result[TEST_CHANNELS];
+static Adc_ValueGroupType Test_au16Read[TEST_CHANNELS];
+static uint32 Test_u32PdbNotifications;
+static uint32 Test_u32Recoveries;
+static uint64 Test_u64MaxCycles;
+static uint64 Test_u64TotalCycles;
+static uint64 Test_u64MaxNs;
+
+static void Test_PdbNotify(void)
+{
+    Test_u32PdbNotifications++;
+}
+
+/* Error interrupt of PDB 0: times the driver handler */
+static void Test_ErrorIrq(void)
+{
+    uint64 u64Time = Adc_Adc12bsarv2_Sim_GetTime();
+    uint64 u64Ns = Adc_Test_GetNs();
+
+    Adc_Pdb_ChannelSequenceError0();
+    u64Ns = Adc_Test_GetNs() - u64Ns;
+    u64Time = Adc_Adc12bsarv2_Sim_GetTime() - u64Time;
+    Test_u32Recoveries++;
+    Test_u64TotalCycles += u64Time;
+    Test_u64MaxCycles = (u64Time > Test_u64MaxCycles) ? u64Time : Test_u64MaxCycles;
+    Test_u64MaxNs = (u64Ns > Test_u64MaxNs) ? u64Ns : Test_u64MaxNs;
+}
+
+static uint32 Test_ReadPdb(uint32 u32Address)
+{
+    uint32 u32Value = 0UL;
+
+    ADC_TEST_CHECK(TRUE == Adc_Pdb_Sim_ReadReg(u32Address, &u32Value));
+    return u32Value;
+}
+
+static boolean Test_TraceHasError(void)
+{
+    Adc_Pdb_SimTraceType Entry;
+    uint16 u16Index;
+    boolean bFound = (boolean)FALSE;
+
+    for (u16Index = 0U; u16Index < Adc_Pdb_Sim_GetTraceCount(); u16Index++)
+    {
+        if (((Std_ReturnType)E_OK == Adc_Pdb_Sim_GetTrace(u16Index, &Entry)) && (ADC_PDB_SIM_SEQUENCE_ERROR == Entry.eEvent) && \
+            (TEST_PDB_CHANNEL == Entry.u8Channel) && (TEST_PRETRIGGER == Entry.u8PreTrigger))
+        {
+            bFound = (boolean)TRUE;
+        }
+    }
+    return bFound;
+}
+
+static void Test_Recovery(boolean bDma)
+{
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit0 =
+    {
+        .AdcHardwareUnitId = 0U,
+        .u32AdcCfg1Register = 0x4UL,
+        .u32AdcSc2Register = ADC12BSARV2_SC2_ADTRG_HW_U32,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U,
+        .u32AdcPdbClockSettings = PDB_ERROR_INTERRUPT_ENABLED_U32,
+        .pPdbNofitication = Test_PdbNotify
+    };
+    const Adc_GroupConfigurationType Group =
+    {
+        ADC_TEST_GROUP(0U),
+        .pAssignment = Adc_Test_aAssignment,
+        .AssignedChannelCount = TEST_CHANNELS
+    };
+    uint32 u32Round;
+    uint32 u32Channel;
+    uint32 u32Sc;
+
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(0U, &Unit0);
+    Adc_Test_SetDma(0U, bDma);
+    Adc_Test_SetGroup(0U, &Group);
+    Adc_Test_SetGroupCount(1U);
+    Adc_Pdb_Sim_SetErrIrqHandler(0U, Test_ErrorIrq);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_au16Result));
+    Adc_EnableGroupNotification(0U);
+    Test_u32PdbNotifications = 0UL;
+    Test_u32Recoveries = 0UL;
+    Test_u64MaxCycles = 0ULL;
+    Test_u64TotalCycles = 0ULL;
+    Test_u64MaxNs = 0ULL;
+
+    for (u32Round = 0UL; u32Round < TEST_ROUNDS; u32Round++)
+    {
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, (uint16)((u32Round * 61UL) + (u32Channel * 7UL) + 1UL));
+        }
+        Adc_Pdb_Sim_ClearTrace();
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(TEST_INJECT_CYCLES);
+        ADC_TEST_CHECK(ADC_BUSY == Adc_GetGroupStatus(0U));
+        u32Sc = Test_ReadPdb(PDB_SC_REG_ADDR32(0U));
+        Adc_Pdb_Sim_InjectSequenceError(0U, TEST_PDB_CHANNEL, TEST_PRETRIGGER);
+        ADC_TEST_CHECK(TRUE == Test_TraceHasError());
+        /* Delivered on the next step of the models */
+        ADC_TEST_CHECK(u32Round == Test_u32Recoveries);
+        Adc_Test_Run(1UL);
+        ADC_TEST_CHECK((u32Round + 1UL) == Test_u32Recoveries);
+        ADC_TEST_CHECK((u32Round + 1UL) == Test_u32PdbNotifications);
+        ADC_TEST_CHECK(0UL == (Test_ReadPdb(PDB_CH_N_S_REG_ADDR32(0U, TEST_PDB_CHANNEL)) & PDB_ERR_FLAGS_MASK_U32));
+        ADC_TEST_CHECK(u32Sc == Test_ReadPdb(PDB_SC_REG_ADDR32(0U)));
+
+        /* The disabled counter dropped the pre-trigger in flight and the chain behind it: the
+           group waits for the application, told by the PDB notification, to restart it */
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        ADC_TEST_CHECK(u32Round == Adc_Test_au32Notifications[0]);
+        ADC_TEST_CHECK(ADC_BUSY == Adc_GetGroupStatus(0U));
+        Adc_StopGroupConversion(0U);
+        ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(0U));
+        Adc_EnableGroupNotification(0U);
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        ADC_TEST_CHECK((u32Round + 1UL) == Adc_Test_au32Notifications[0]);
+        ADC_TEST_CHECK(ADC_STREAM_COMPLETED == Adc_GetGroupStatus(0U));
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Test_au16Read));
+        for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+        {
+            ADC_TEST_CHECK((uint16)((u32Round * 61UL) + (u32Channel * 7UL) + 1UL) == Test_au16Read[u32Channel]);
+        }
+    }
+    /* A single error per round */
+    ADC_TEST_CHECK(TEST_ROUNDS == Test_u32Recoveries);
+    ADC_TEST_CHECK(TEST_RECOVERY_CYCLES == Test_u64MaxCycles);
+    ADC_TEST_CHECK((TEST_RECOVERY_CYCLES * TEST_ROUNDS) == Test_u64TotalCycles);
+    printf("%-10s: %u recoveries, %llu register accesses max, %llu mean, %llu ns max on the host\n",
+           (TRUE == bDma) ? "dma" : "interrupt", (unsigned)Test_u32Recoveries, (unsigned long long)Test_u64MaxCycles,
+           (unsigned long long)(Test_u64TotalCycles / (uint64)Test_u32Recoveries), (unsigned long long)Test_u64MaxNs);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    Test_Recovery((boolean)FALSE);
+    Test_Recovery((boolean)TRUE);
+    return Adc_Test_Result("Adc_Test_PdbError");
+}
+
+/** @} */
@@ -0,0 +1,90 @@
+/**
+*   @file           Adc_Test_RegisterModel.c
+*
+*   @brief   AUTOSAR Adc - Register model regression test.
+*   @details Converts groups of 1 to ADC_NUM_SC1_N_REGISTER_USED channels, read by interrupts and
+*            by DMA, and checks that the results are the inputs driven into the ADC model. The DMA
+*            transfers go through the eDMA model, which checks that the 32 bit bus addresses
+*            written by the driver map back to the host buffers at full pointer width. Prints the
+*            register accesses per sample measured by the model. Built twice by the Makefile:
+*            Adc_Test_RegisterModel with the 16 SC1n registers of the base bank,
+*            Adc_Test_RegisterModel32 with the 32 SC1n registers of the extended bank, whose
+*            SC1A and RA alias aSC1[0] and aR[0].
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_ROUNDS 8U
+
+static Adc_ValueGroupType Test_au16Result[ADC_NUM_SC1_N_REGISTER_USED];
+static Adc_ValueGroupType Test_au16Read[ADC_NUM_SC1_N_REGISTER_USED];
+
+static uint16 Test_Input(uint32 u32Round, uint32 u32Channel)
+{
+    return (uint16)(((u32Round * 13UL) + (u32Channel * 97UL) + 1UL) & 0xFFFUL);
+}
+
+static void Test_Convert(Adc_ChannelIndexType Channels, boolean bDma)
+{
+    Adc_Adc12bsarv2_SimStatisticsType Statistics;
+    uint32 u32Round;
+    uint32 u32Channel;
+
+    Adc_Test_Reset();
+    Adc_Test_SetDma(0U, bDma);
+    {
+        const Adc_GroupConfigurationType Group = { ADC_TEST_GROUP(0U), .pAssignment = Adc_Test_aAssignment, .AssignedChannelCount = Channels };
+
+        Adc_Test_SetGroup(0U, &Group);
+    }
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_au16Result));
+    Adc_EnableGroupNotification(0U);
+
+    for (u32Round = 0UL; u32Round < TEST_ROUNDS; u32Round++)
+    {
+        for (u32Channel = 0UL; u32Channel < (uint32)Channels; u32Channel++)
+        {
+            Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, Test_Input(u32Round, u32Channel));
+        }
+        Adc_StartGroupConversion(0U);
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        ADC_TEST_CHECK(ADC_STREAM_COMPLETED == Adc_GetGroupStatus(0U));
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Test_au16Read));
+        for (u32Channel = 0UL; u32Channel < (uint32)Channels; u32Channel++)
+        {
+            ADC_TEST_CHECK(Test_Input(u32Round, u32Channel) == Test_au16Read[u32Channel]);
+        }
+    }
+    ADC_TEST_CHECK(TEST_ROUNDS == Adc_Test_au32Notifications[0]);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+
+    Adc_Adc12bsarv2_Sim_GetStatistics(0U, &Statistics);
+    ADC_TEST_CHECK((TEST_ROUNDS * (uint32)Channels) == Statistics.u32Conversions);
+    printf("%-9s channels=%2u conversions=%4u register accesses/sample=%6.2f interrupts/round=%5.2f\n",
+           bDma ? "dma" : "interrupt", (unsigned)Channels, Statistics.u32Conversions,
+           (double)(Statistics.u32RegReads + Statistics.u32RegWrites) / (double)Statistics.u32Conversions,
+           (double)Statistics.u32Interrupts / (double)TEST_ROUNDS);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    static const Adc_ChannelIndexType aChannels[] = { 1U, 2U, 4U, 8U, 16U, 24U, 32U };
+    uint32 u32Index;
+
+    for (u32Index = 0UL; u32Index < (sizeof(aChannels) / sizeof(aChannels[0])); u32Index++)
+    {
+        if ((uint32)aChannels[u32Index] <= (uint32)ADC_NUM_SC1_N_REGISTER_USED)
+        {
+            Test_Convert(aChannels[u32Index], (boolean)FALSE);
+            Test_Convert(aChannels[u32Index], (boolean)TRUE);
+        }
+    }
+    return Adc_Test_Result((ADC_NUM_SC1_N_REGISTER_USED > 16U) ? "Adc_Test_RegisterModel32" : "Adc_Test_RegisterModel");
+}
+
+/** @} */
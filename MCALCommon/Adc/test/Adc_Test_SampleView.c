@@ -0,0 +1,199 @@
+/**
+*   @file           Adc_Test_SampleView.c
+*
+*   @brief   AUTOSAR Adc - Sample view test.
+*   @details Takes views with Adc_GetSampleView on continuous circular groups of unit 0 and checks
+*            that they show the latest sample and that Adc_ValidateSampleView accepts them until
+*            their slot is reused: NumSamples samples later with interrupts, one sample earlier with
+*            DMA, where the slot after the last completed sample is being written. A view of a
+*            running group with NumSamples 1 validates until the next sample with interrupts, never
+*            with DMA. Stopping or restarting a group invalidates its views, and a stopped group
+*            has no view. A completed one-shot group keeps its view valid until restarted.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_CHANNELS       4U
+#define TEST_SAMPLES        4U
+/** @brief Bound of the model cycles to wait for one sample */
+#define TEST_SAMPLE_MAX     2000UL
+
+/* 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[TEST_SAMPLES * TEST_CHANNELS];
+} Test_Result;
+static Adc_ValueGroupType Test_au16Read[TEST_CHANNELS];
+
+static uint16 Test_Input(uint32 u32Phase, uint32 u32Channel)
+{
+    return (uint16)((u32Phase * 0x111UL) + (u32Channel * 9UL) + 5UL);
+}
+
+static void Test_SetInputs(uint32 u32Phase)
+{
+    uint32 u32Channel;
+
+    for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+    {
+        Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, Test_Input(u32Phase, u32Channel));
+    }
+}
+
+/* Runs the models until u32Samples more samples of group 0 completed */
+static void Test_WaitSamples(uint32 u32Samples)
+{
+    uint32 u32Sequence = Adc_aGroupStatus[0].u32SampleSequence;
+    uint32 u32Cycles = 0UL;
+
+    while (((Adc_aGroupStatus[0].u32SampleSequence - u32Sequence) < u32Samples) && (u32Cycles < (u32Samples * TEST_SAMPLE_MAX)))
+    {
+        Adc_Test_Run(1UL);
+        u32Cycles++;
+    }
+    ADC_TEST_CHECK(u32Samples == (Adc_aGroupStatus[0].u32SampleSequence - u32Sequence));
+}
+
+static boolean Test_ViewShows(const Adc_SampleViewType * pView, uint32 u32Phase)
+{
+    uint32 u32Channel;
+    boolean bShows = (boolean)TRUE;
+
+    for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+    {
+        if (Test_Input(u32Phase, u32Channel) != pView->pSample[u32Channel * pView->u32Stride])
+        {
+            bShows = (boolean)FALSE;
+        }
+    }
+    return bShows;
+}
+
+static void Test_Init(Adc_GroupConvModeType eMode, Adc_StreamNumSampleType NumSamples, boolean bDma)
+{
+    const Adc_GroupConfigurationType Group =
+    {
+        ADC_TEST_GROUP(0U),
+        .eMode = eMode,
+        .eAccessMode = ADC_ACCESS_MODE_STREAMING,
+        .eBufferMode = ADC_STREAM_BUFFER_CIRCULAR,
+        .NumSamples = NumSamples,
+        .pAssignment = Adc_Test_aAssignment,
+        .AssignedChannelCount = TEST_CHANNELS
+    };
+
+    Adc_Test_Reset();
+    Adc_Test_SetDma(0U, bDma);
+    Adc_Test_SetGroup(0U, &Group);
+    Adc_Test_SetGroupCount(1U);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_Result.au16Value));
+}
+
+/* A view stays valid for the samples its slot is not reused, then shows the newer sample */
+static void Test_Overwrite(boolean bDma)
+{
+    Adc_SampleViewType View;
+    /* The DMA writes the slot after the last completed sample while the group converts */
+    uint32 u32Valid = (TRUE == bDma) ? (TEST_SAMPLES - 2UL) : (TEST_SAMPLES - 1UL);
+
+    Test_Init(ADC_CONV_MODE_CONTINUOUS, (Adc_StreamNumSampleType)TEST_SAMPLES, bDma);
+    Test_SetInputs(1UL);
+    Adc_StartGroupConversion(0U);
+    /* No sample completed yet */
+    ADC_TEST_CHECK(E_NOT_OK == Adc_GetSampleView(0U, &View));
+
+    Test_WaitSamples(1UL);
+    ADC_TEST_CHECK(E_OK == Adc_GetSampleView(0U, &View));
+    ADC_TEST_CHECK(TEST_CHANNELS == View.ChannelCount);
+    ADC_TEST_CHECK(TRUE == Test_ViewShows(&View, 1UL));
+    ADC_TEST_CHECK(E_OK == Adc_ValidateSampleView(0U, &View));
+
+    Test_SetInputs(2UL);
+    Test_WaitSamples(u32Valid);
+    ADC_TEST_CHECK(TRUE == Test_ViewShows(&View, 1UL));
+    ADC_TEST_CHECK(E_OK == Adc_ValidateSampleView(0U, &View));
+    Test_WaitSamples(TEST_SAMPLES - u32Valid);
+    ADC_TEST_CHECK(E_NOT_OK == Adc_ValidateSampleView(0U, &View));
+    /* The slot was written with the new inputs */
+    ADC_TEST_CHECK(TRUE == Test_ViewShows(&View, 2UL));
+
+    /* A fresh view is valid, and invalidated by the stop */
+    ADC_TEST_CHECK(E_OK == Adc_GetSampleView(0U, &View));
+    ADC_TEST_CHECK(TRUE == Test_ViewShows(&View, 2UL));
+    ADC_TEST_CHECK(E_OK == Adc_ValidateSampleView(0U, &View));
+    Adc_StopGroupConversion(0U);
+    ADC_TEST_CHECK(E_NOT_OK == Adc_ValidateSampleView(0U, &View));
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+
+    /* A stopped group has no view */
+    ADC_TEST_CHECK(E_NOT_OK == Adc_GetSampleView(0U, &View));
+    ADC_TEST_CHECK(1UL == Adc_Test_u32DetCount);
+    ADC_TEST_CHECK(ADC_GETSAMPLEVIEW_ID == Adc_Test_u8DetService);
+    ADC_TEST_CHECK(ADC_E_IDLE == Adc_Test_u8DetError);
+    Adc_Test_u32DetCount = 0UL;
+    Adc_DeInit();
+}
+
+/* NumSamples 1: a single slot, written by the interrupt publishing it or by the DMA in the background */
+static void Test_SingleSample(boolean bDma)
+{
+    Adc_SampleViewType View;
+
+    Test_Init(ADC_CONV_MODE_CONTINUOUS, 1U, bDma);
+    Test_SetInputs(3UL);
+    Adc_StartGroupConversion(0U);
+    Test_WaitSamples(1UL);
+    ADC_TEST_CHECK(E_OK == Adc_GetSampleView(0U, &View));
+    ADC_TEST_CHECK(TRUE == Test_ViewShows(&View, 3UL));
+    ADC_TEST_CHECK(((TRUE == bDma) ? E_NOT_OK : E_OK) == Adc_ValidateSampleView(0U, &View));
+    Test_WaitSamples(1UL);
+    ADC_TEST_CHECK(E_NOT_OK == Adc_ValidateSampleView(0U, &View));
+    Adc_StopGroupConversion(0U);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+}
+
+/* A completed one-shot group is no longer written: its view stays valid until the group restarts */
+static void Test_Restart(boolean bDma)
+{
+    Adc_SampleViewType View;
+
+    Test_Init(ADC_CONV_MODE_ONESHOT, 1U, bDma);
+    Test_SetInputs(4UL);
+    Adc_StartGroupConversion(0U);
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(ADC_STREAM_COMPLETED == Adc_GetGroupStatus(0U));
+    ADC_TEST_CHECK(E_OK == Adc_GetSampleView(0U, &View));
+    ADC_TEST_CHECK(TRUE == Test_ViewShows(&View, 4UL));
+    ADC_TEST_CHECK(E_OK == Adc_ValidateSampleView(0U, &View));
+    /* Reading the group does not write the buffer */
+    ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Test_au16Read));
+    ADC_TEST_CHECK(ADC_IDLE == Adc_GetGroupStatus(0U));
+    ADC_TEST_CHECK(E_OK == Adc_ValidateSampleView(0U, &View));
+    Adc_StartGroupConversion(0U);
+    ADC_TEST_CHECK(E_NOT_OK == Adc_ValidateSampleView(0U, &View));
+    Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+    ADC_TEST_CHECK(E_NOT_OK == Adc_ValidateSampleView(0U, &View));
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    uint32 u32Dma;
+
+    for (u32Dma = 0UL; u32Dma < 2UL; u32Dma++)
+    {
+        Test_Overwrite((boolean)u32Dma);
+        Test_SingleSample((boolean)u32Dma);
+        Test_Restart((boolean)u32Dma);
+    }
+    return Adc_Test_Result("Adc_Test_SampleView");
+}
+
+/** @} */
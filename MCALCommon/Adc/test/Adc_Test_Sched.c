@@ -0,0 +1,217 @@
+/**
+*   @file           Adc_Test_Sched.c
+*
+*   @brief   AUTOSAR Adc - Conversion time and schedulability analysis test.
+*   @details Analyzes four software groups of unit 0 with Adc_Adc12bsarv2_Sched_Analyze and
+*            compares every time with a value computed by hand in the comments, in ADC input
+*            clock cycles: ADC input clock 48 MHz, PDB input clock 80 MHz, PDB prescaler 4, so one
+*            PDB count lasts 2.4 ADC input clock cycles, a conversion adder of 5 ADCK cycles and
+*            50 cycles between two chunks. Also checks the compile-time macros, and that the
+*            delays follow the PDB clock: the same configuration analyzed with the PDB on the ADC
+*            input clock gives longer rounds.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+#include "Adc_Adc12bsarv2_Sched.h"
+
+#define TEST_ADC_HZ         48000000UL
+#define TEST_PDB_HZ         80000000UL
+#define TEST_ADDER          5UL
+#define TEST_CHUNK          50UL
+/** @brief PDB_SC[PRESCALER] 2: 4 PDB input clocks per count */
+#define TEST_PDB_SC         0x2000UL
+
+/* 12 bits: 13 sample + 12 compare + 5 cycles */
+ADC_ADC12BSARV2_SCHED_STATIC_CHECK(Conversion, (30UL == ADC_ADC12BSARV2_SCHED_CONVERSION_CYCLES(0x4UL, 12UL, 0UL, TEST_ADDER)));
+/* 8 averaged samples (AVGS 1), ADIV 2: 30 * 8 * 4 cycles */
+ADC_ADC12BSARV2_SCHED_STATIC_CHECK(Averaged, (960UL == ADC_ADC12BSARV2_SCHED_CONVERSION_CYCLES(0x44UL, 12UL, 0x5UL, TEST_ADDER)));
+/* 13 counts: 52 PDB clocks, 650 ns, 31.2 cycles rounded up */
+#if (ADC_ADC12BSARV2_SCHED_PDB_DELAY_CYCLES(TEST_PDB_SC, 13UL, TEST_ADC_HZ, TEST_PDB_HZ) != 32UL)
+#error "PDB delay of 13 counts"
+#endif
+
+/** @brief Pre-trigger delays of group 1, in PDB counts */
+static const uint16 Test_au16Delay[4] = { 0U, 13U, 26U, 39U };
+static uint32 Test_au32Periods[ADC_MAX_GROUPS];
+static Adc_Adc12bsarv2_SchedReportType Test_Report;
+
+static void Test_Configure(void)
+{
+    const Adc_Adc12bsarv2_HwUnitConfigurationType Unit0 =
+    {
+        .AdcHardwareUnitId = 0U,
+        .u32AdcCfg1Register = 0x4UL,
+        .u32AdcSc2Register = ADC12BSARV2_SC2_ADTRG_HW_U32,
+        .u32AdcDataMask = 0xFFFUL,
+        .Res = (Adc_ResolutionType)12U,
+        .u32AdcPdbClockSettings = TEST_PDB_SC
+    };
+    const Adc_GroupConfigurationType aGroup[4] =
+    {
+        /* 4 channels back-to-back */
+        {
+            ADC_TEST_GROUP(0U),
+            .Priority = 2U,
+            .pAssignment = &Adc_Test_aAssignment[0],
+            .AssignedChannelCount = 4U,
+            .u32SampleTime = 12UL
+        },
+        /* 4 channels at their own pre-trigger delay */
+        {
+            ADC_TEST_GROUP(1U),
+            .Priority = 1U,
+            .pAssignment = &Adc_Test_aAssignment[0],
+            .AssignedChannelCount = 4U,
+            .u32SampleTime = 12UL,
+            .pDelay = Test_au16Delay,
+            .u8AdcGroupChannelDelays = (uint8)STD_ON,
+            .u8AdcGroupBackToBack = (uint8)STD_OFF
+        },
+        /* 20 channels at ADIV 1: chunks of 16 (two PDB channels) and 4 */
+        {
+            ADC_TEST_GROUP(2U),
+            .Priority = 0U,
+            .pAssignment = &Adc_Test_aAssignment[0],
+            .AssignedChannelCount = 20U,
+            .u32SampleTime = 12UL,
+            .u32ClockDivideSelect = 0x20UL,
+            .u16PdbDelay = 201U
+        },
+        /* 1 channel, 8 averaged samples at ADIV 2, 3 samples streamed to a linear buffer */
+        {
+            ADC_TEST_GROUP(3U),
+            .Priority = 0U,
+            .eMode = ADC_CONV_MODE_CONTINUOUS,
+            .eAccessMode = ADC_ACCESS_MODE_STREAMING,
+            .NumSamples = 3U,
+            .u32SampleTime = 12UL,
+            .u32AvgSelect = ADC12BSARV2_SC3_AVGE_EN_U32 | 0x1UL,
+            .u32ClockDivideSelect = 0x40UL
+        }
+    };
+    Adc_GroupType Group;
+
+    Adc_Test_Reset();
+    Adc_Test_SetUnit(0U, &Unit0);
+    for (Group = 0U; Group < 4U; Group++)
+    {
+        Adc_Test_SetGroup(Group, &aGroup[Group]);
+    }
+    Adc_Test_SetGroupCount(4U);
+}
+
+static Std_ReturnType Test_Analyze(uint32 u32PdbHz, uint32 u32Period0, uint32 u32Period1, uint32 u32Period2, uint32 u32Period3)
+{
+    Adc_Adc12bsarv2_SchedParamType Param =
+    {
+        .pPeriods = Test_au32Periods,
+        .u32ChunkOverhead = TEST_CHUNK,
+        .u32ConversionAdder = TEST_ADDER,
+        .u32AdcClockHz = TEST_ADC_HZ,
+        .u32PdbClockHz = u32PdbHz,
+#if (ADC_DUAL_CLOCK_MODE == STD_ON)
+        .eClockMode = ADC_NORMAL
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+    };
+
+    Test_au32Periods[0] = u32Period0;
+    Test_au32Periods[1] = u32Period1;
+    Test_au32Periods[2] = u32Period2;
+    Test_au32Periods[3] = u32Period3;
+    return Adc_Adc12bsarv2_Sched_Analyze(Adc_Test_GetConfig(), &Param, &Test_Report);
+}
+
+static void Test_CheckGroup(Adc_GroupType Group, uint32 u32Conversion, uint32 u32Round, uint32 u32Job)
+{
+    const Adc_Adc12bsarv2_SchedGroupType * pTiming = &Test_Report.aGroup[Group];
+
+    ADC_TEST_CHECK(u32Conversion == pTiming->u32ConversionCycles);
+    ADC_TEST_CHECK(u32Round == pTiming->u32RoundCycles);
+    ADC_TEST_CHECK(u32Job == pTiming->u32JobCycles);
+    ADC_TEST_CHECK(FALSE == pTiming->bSequenceError);
+    ADC_TEST_CHECK(FALSE == pTiming->bChunkOrderError);
+}
+
+static void Test_CheckResponse(Adc_GroupType Group, uint32 u32Response, uint32 u32Queueing, boolean bSchedulable)
+{
+    const Adc_Adc12bsarv2_SchedGroupType * pTiming = &Test_Report.aGroup[Group];
+
+    ADC_TEST_CHECK(u32Response == pTiming->u32ResponseCycles);
+    ADC_TEST_CHECK(u32Queueing == pTiming->u32QueueingCycles);
+    ADC_TEST_CHECK(bSchedulable == pTiming->bSchedulable);
+}
+
+static void Test_CheckUnit(uint32 u32Utilization, uint32 u32MaxQueueing, boolean bSchedulable)
+{
+    ADC_TEST_CHECK(u32Utilization == Test_Report.aUnit[0].u32Utilization);
+    ADC_TEST_CHECK(u32MaxQueueing == Test_Report.aUnit[0].u32MaxQueueingCycles);
+    ADC_TEST_CHECK(bSchedulable == Test_Report.aUnit[0].bSchedulable);
+}
+
+int main(void)
+{
+    Test_Configure();
+
+    /*
+    * Group times:
+    * 0: conversion 30, 4 back-to-back: 120.
+    * 1: pre-triggers at 0, 13, 26 and 39 counts: 0, 31.2, 62.4 and 93.6 cycles, started at 0, 32,
+    *    63 and 94, the last one ends at 124.
+    * 2: conversion 60. Chunk 1: PDB channel 0 converts 8 channels from 0 to 480, PDB channel 1
+    *    starts at 201 counts, 482.4 cycles, from 483 to 963. 50 cycles, then chunk 2: 4 channels,
+    *    240. Round 963 + 50 + 240 = 1253.
+    * 3: conversion 960, job of 3 rounds: 3 * 960 + 2 * 50 = 2980.
+    *
+    * Periods 1000, 2000 and 5000 for groups 0 to 2, higher priority first:
+    * 0: job 120 + longest lower priority conversion 60 (group 2): response 180, queueing 60.
+    * 1: 124 + 60 = 184, + 1 preemption by group 0 restarting the round (120 + 124): 428,
+    *    stable, queueing 304.
+    * 2: 1253, + 2 preemptions by group 0 (2 * (120 + 1253)) + 1 by group 1 (124 + 1253): 5376,
+    *    over the period, queueing 4123.
+    * Utilization: 120 + 62 + 250.6 rounded up, 433 per mille.
+    */
+    ADC_TEST_CHECK(E_NOT_OK == Test_Analyze(TEST_PDB_HZ, 1000UL, 2000UL, 5000UL, 0UL));
+    Test_CheckGroup(0U, 30UL, 120UL, 120UL);
+    Test_CheckGroup(1U, 30UL, 124UL, 124UL);
+    Test_CheckGroup(2U, 60UL, 1253UL, 1253UL);
+    Test_CheckGroup(3U, 960UL, 960UL, 2980UL);
+    Test_CheckResponse(0U, 180UL, 60UL, TRUE);
+    Test_CheckResponse(1U, 428UL, 304UL, TRUE);
+    Test_CheckResponse(2U, 5376UL, 4123UL, FALSE);
+    /* Not analyzed */
+    Test_CheckResponse(3U, 0UL, 0UL, FALSE);
+    Test_CheckUnit(433UL, 4123UL, FALSE);
+
+    /*
+    * Groups 0 and 1 alone:
+    * 0: 120 + 30 (conversion of group 1): 150, queueing 30.
+    * 1: 124 + 244: 368, queueing 244.
+    * Utilization 182 per mille.
+    */
+    ADC_TEST_CHECK(E_OK == Test_Analyze(TEST_PDB_HZ, 1000UL, 2000UL, 0UL, 0UL));
+    Test_CheckResponse(0U, 150UL, 30UL, TRUE);
+    Test_CheckResponse(1U, 368UL, 244UL, TRUE);
+    Test_CheckUnit(182UL, 244UL, TRUE);
+
+    /* Group 3 alone: 2980 in 4000, 745 per mille */
+    ADC_TEST_CHECK(E_OK == Test_Analyze(TEST_PDB_HZ, 0UL, 0UL, 0UL, 4000UL));
+    Test_CheckResponse(3U, 2980UL, 0UL, TRUE);
+    Test_CheckUnit(745UL, 0UL, TRUE);
+
+    /*
+    * PDB on the ADC input clock: one count is 4 cycles.
+    * 1: pre-triggers at 0, 52, 104 and 156, the last one ends at 186.
+    * 2: PDB channel 1 starts at 804: 804 + 480 + 50 + 240 = 1574.
+    */
+    ADC_TEST_CHECK(E_OK == Test_Analyze(TEST_ADC_HZ, 0UL, 0UL, 0UL, 4000UL));
+    Test_CheckGroup(0U, 30UL, 120UL, 120UL);
+    Test_CheckGroup(1U, 30UL, 186UL, 186UL);
+    Test_CheckGroup(2U, 60UL, 1574UL, 1574UL);
+
+    return Adc_Test_Result("Adc_Test_Sched");
+}
+
+/** @} */
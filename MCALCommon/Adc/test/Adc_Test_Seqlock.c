@@ -0,0 +1,168 @@
+/**
+*   @file           Adc_Test_Seqlock.c
+*
+*   @brief   AUTOSAR Adc - Concurrent result publication stress test.
+*   @details A timer interrupt drives a hardware triggered 8 channel group through the models, one
+*            trigger per sample, with inputs which identify the sample on every channel. The
+*            program reads the group with Adc_ReadGroup in a loop meanwhile, and checks that every
+*            copy holds the channels of a single sample and that the samples it returns never go
+*            back.
+*            The group is read by interrupts with one sample, then by DMA with two samples in a
+*            circular buffer. Built with ADC_RESULT_SEQLOCK (Adc_Test_Seqlock) and without it
+*            (Adc_Test_SeqlockOff, the copies run in exclusive area 27). With ADC_RESULT_SEQLOCK only
+*            the buffer restarts after the reads of a completed group enter an exclusive area (30).
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include "Adc_Test.h"
+
+#define TEST_CHANNELS       8U
+#define TEST_SAMPLES        4000UL
+#define TEST_STEP_CYCLES    150UL
+#define TEST_PERIOD_US      20UL
+
+static const Adc_HwTriggerTimerType Test_aTrigger[1] = { 0U };
+static Adc_ValueGroupType Test_au16Result[2U * TEST_CHANNELS];
+static volatile uint32 Test_u32Sample;
+static uint32 Test_u32Interrupts;
+
+/* Channels 0 and 1 hold the sample number, the others a value derived from it */
+static uint16 Test_Input(uint32 u32Sample, uint32 u32Channel)
+{
+    uint32 u32Value;
+
+    if (0UL == u32Channel)
+    {
+        u32Value = u32Sample;
+    }
+    else if (1UL == u32Channel)
+    {
+        u32Value = u32Sample >> 12U;
+    }
+    else
+    {
+        u32Value = u32Sample + (u32Channel * 0x155UL);
+    }
+    return (uint16)(u32Value & 0xFFFUL);
+}
+
+static void Test_Trigger(void)
+{
+    uint32 u32Channel;
+
+    for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+    {
+        Adc_Adc12bsarv2_Sim_SetChannelValue(0U, (uint8)u32Channel, Test_Input(Test_u32Sample, u32Channel));
+    }
+    Adc_Pdb_Sim_ExternalTrigger(0U);
+}
+
+/* Timer interrupt: runs the models, triggers the next sample once the last one is notified */
+static void Test_Interrupt(void)
+{
+    Test_u32Interrupts++;
+    if (Test_u32Sample <= TEST_SAMPLES)
+    {
+        Adc_Test_Run(TEST_STEP_CYCLES);
+        if (Test_u32Sample == Adc_Test_au32Notifications[0])
+        {
+            Test_u32Sample++;
+            if (Test_u32Sample <= TEST_SAMPLES)
+            {
+                Test_Trigger();
+            }
+        }
+    }
+}
+
+static void Test_Stress(boolean bDma)
+{
+    Adc_ValueGroupType au16Read[TEST_CHANNELS];
+    uint32 u32Reads = 0UL;
+    uint32 u32Torn = 0UL;
+    uint32 u32Backwards = 0UL;
+    uint32 u32Last = 0UL;
+    uint32 u32Sample;
+    uint32 u32Channel;
+    uint64 u64Start;
+
+    Adc_Test_Reset();
+    Adc_Test_SetDma(0U, bDma);
+    {
+        const Adc_GroupConfigurationType Group =
+        {
+            ADC_TEST_GROUP(0U),
+            .eTriggerSource = ADC_TRIGG_SRC_HW,
+            .pHwResource = Test_aTrigger,
+            .eAccessMode = bDma ? ADC_ACCESS_MODE_STREAMING : ADC_ACCESS_MODE_SINGLE,
+            .eBufferMode = ADC_STREAM_BUFFER_CIRCULAR,
+            .NumSamples = bDma ? 2U : 1U,
+            .pAssignment = Adc_Test_aAssignment,
+            .AssignedChannelCount = TEST_CHANNELS
+        };
+
+        Adc_Test_SetGroup(0U, &Group);
+    }
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(0U, Test_au16Result));
+    Adc_EnableGroupNotification(0U);
+    Adc_EnableHardwareTrigger(0U);
+
+    Test_u32Interrupts = 0UL;
+    Test_u32Sample = 1UL;
+    Test_Trigger();
+    u64Start = Adc_Test_GetNs();
+    Adc_Test_StartInterrupt(Test_Interrupt, TEST_PERIOD_US);
+    while (Test_u32Sample <= TEST_SAMPLES)
+    {
+        if ((Std_ReturnType)E_OK == Adc_ReadGroup(0U, au16Read))
+        {
+            u32Reads++;
+            u32Sample = (uint32)au16Read[0] | ((uint32)au16Read[1] << 12U);
+            for (u32Channel = 0UL; u32Channel < TEST_CHANNELS; u32Channel++)
+            {
+                if (Test_Input(u32Sample, u32Channel) != au16Read[u32Channel])
+                {
+                    u32Torn++;
+                    break;
+                }
+            }
+            if (u32Sample < u32Last)
+            {
+                u32Backwards++;
+            }
+            u32Last = u32Sample;
+        }
+    }
+    Adc_Test_StopInterrupt();
+
+    printf("%-9s samples=%lu interrupts=%u reads=%u torn=%u backwards=%u area 27 copies=%u (%.1f ms)\n",
+           bDma ? "dma" : "interrupt", TEST_SAMPLES, Test_u32Interrupts, u32Reads, u32Torn, u32Backwards,
+           Adc_Test_aLock[27].u32Count, (double)(Adc_Test_GetNs() - u64Start) / 1.0e6);
+    ADC_TEST_CHECK(TEST_SAMPLES == Adc_Test_au32Notifications[0]);
+    ADC_TEST_CHECK(0UL < u32Reads);
+    ADC_TEST_CHECK(0UL == u32Torn);
+    ADC_TEST_CHECK(0UL == u32Backwards);
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+#if (ADC_RESULT_SEQLOCK == STD_ON)
+    /* The state update after the read no longer masks the handlers */
+    ADC_TEST_CHECK(0UL == Adc_Test_aLock[29].u32Count);
+    /* Only the restart of the buffer of a completed group, which the handlers also write */
+    ADC_TEST_CHECK(Adc_Test_aLock[30].u32Count <= u32Reads);
+    printf("%-9s area 30 restarts=%u, %llu ns max\n", bDma ? "dma" : "interrupt", Adc_Test_aLock[30].u32Count,
+           (unsigned long long)Adc_Test_aLock[30].u64MaxNs);
+#endif /* (ADC_RESULT_SEQLOCK == STD_ON) */
+    Adc_DisableHardwareTrigger(0U);
+    Adc_DeInit();
+}
+
+int main(void)
+{
+    Test_Stress((boolean)FALSE);
+    Test_Stress((boolean)TRUE);
+    return Adc_Test_Result((ADC_RESULT_SEQLOCK == STD_ON) ? "Adc_Test_Seqlock" : "Adc_Test_SeqlockOff");
+}
+
+/** @} */
@@ -0,0 +1,239 @@
+/**
+*   @file           Adc_Test_TraceDecode.c
+*
+*   @brief   AUTOSAR Adc - Event trace dump and decode round trip test.
+*   @details Records the events of conversions of two groups of unit 0 in a ring of 32 entries until
+*            it wrapped several times, writes Adc_TraceBuffer to a binary dump behind 64 bytes of
+*            other data, as saved from a RAM region by a debugger, and decodes it with the
+*            Adc_TraceDecode program built next to this one. Checks the header line, that the
+*            timeline lists the last 32 events of the ring (index, unwrapped time, unit, group and
+*            event as recorded by the driver) and that the group statistics count them. A second
+*            dump with the commit marker of one record broken checks that the decoder discards it.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "Adc_Test.h"
+#include "Adc_Trace.h"
+
+#define TEST_ROUNDS         20U
+#define TEST_PREFIX         64U
+#define TEST_TORN           5U
+#define TEST_PATH_MAX       512U
+#define TEST_LINE_MAX       256U
+
+static const char * const Test_apEventName[ADC_TRACE_FORMAT_EV_LAST + 1U] =
+{
+    "?", "QUEUE_INSERT", "QUEUE_REMOVE", "START", "CHUNK", "END", "LIMIT_FAIL", "ABORT", "PDB_ERROR", "NOTIFY"
+};
+
+/* 4 byte aligned, see Adc_ValidateSetupBufferAlignment */
+static union
+{
+    uint32 u32Align;
+    Adc_ValueGroupType au16Value[2];
+} Test_aResult[2];
+static Adc_TraceBufferType Test_Ring;
+static uint8 Test_au8Dump[TEST_PREFIX + sizeof(Adc_TraceBufferType)];
+static char Test_szDecoder[TEST_PATH_MAX];
+static char Test_szDump[TEST_PATH_MAX];
+
+/* Writes the ring behind TEST_PREFIX bytes which hold no magic word */
+static void Test_WriteDump(const Adc_TraceBufferType * pRing)
+{
+    FILE * pOut = fopen(Test_szDump, "wb");
+
+    memset(Test_au8Dump, 0xA5, TEST_PREFIX);
+    memcpy(&Test_au8Dump[TEST_PREFIX], pRing, sizeof(*pRing));
+    ADC_TEST_CHECK(NULL != pOut);
+    if (NULL != pOut)
+    {
+        ADC_TEST_CHECK(sizeof(Test_au8Dump) == fwrite(Test_au8Dump, 1U, sizeof(Test_au8Dump), pOut));
+        fclose(pOut);
+    }
+}
+
+/* Decodes the dump and compares the timeline with the records of the ring, except u32Torn */
+static void Test_Decode(uint32 u32Torn)
+{
+    const uint32 u32Head = Test_Ring.u32Head;
+    const uint32 u32First = u32Head - (uint32)ADC_EVENT_TRACE_ENTRIES;
+    const Adc_TraceRecordType * pRecord;
+    char szCommand[TEST_PATH_MAX * 2U];
+    char szLine[TEST_LINE_MAX];
+    char szGroup[16];
+    char szEvent[16];
+    unsigned int uiIndex;
+    unsigned long long ullTime;
+    unsigned int uiUnit;
+    unsigned int uiA;
+    unsigned int uiB;
+    unsigned int uiC;
+    unsigned int uiD;
+    uint32 u32Expected = u32First;
+    uint32 u32Valid = 0UL;
+    uint32 au32Ends[2] = { 0UL, 0UL };
+    uint32 au32Notifies[2] = { 0UL, 0UL };
+    uint32 u32Group;
+    uint32 u32Ends;
+    uint32 u32Notifies;
+    uint64 u64Time = 0ULL;
+    uint32 u32PrevTime = 0UL;
+    uint32 u32Header = 0UL;
+    uint32 u32Summary = 0UL;
+    uint32 u32Stats = 0UL;
+    FILE * pIn;
+
+    (void)snprintf(szCommand, sizeof(szCommand), "%s %s", Test_szDecoder, Test_szDump);
+    pIn = popen(szCommand, "r");
+    ADC_TEST_CHECK(NULL != pIn);
+    if (NULL == pIn)
+    {
+        return;
+    }
+    while (NULL != fgets(szLine, sizeof(szLine), pIn))
+    {
+        if (4 == sscanf(szLine, "Adc_TraceBuffer at offset 0x%x: %u entries, %u events recorded, %u overwritten",
+                        &uiA, &uiB, &uiC, &uiD))
+        {
+            ADC_TEST_CHECK(TEST_PREFIX == uiA);
+            ADC_TEST_CHECK(ADC_EVENT_TRACE_ENTRIES == uiB);
+            ADC_TEST_CHECK(u32Head == uiC);
+            ADC_TEST_CHECK(u32First == uiD);
+            u32Header++;
+        }
+        else if (5 == sscanf(szLine, "%u %llu %u %15s %15s", &uiIndex, &ullTime, &uiUnit, szGroup, szEvent))
+        {
+            /* Timeline: the records in index order, the torn one skipped */
+            if (u32Expected == u32Torn)
+            {
+                u32Expected++;
+            }
+            ADC_TEST_CHECK(u32Expected == uiIndex);
+            pRecord = &Test_Ring.aRecord[u32Expected % (uint32)ADC_EVENT_TRACE_ENTRIES];
+            /* Unwrapped from the previous listed record */
+            if (0UL != u32Valid)
+            {
+                u64Time += (uint64)(sint64)(sint32)(pRecord->u32Time - u32PrevTime);
+            }
+            u32PrevTime = pRecord->u32Time;
+            ADC_TEST_CHECK(u64Time == ullTime);
+            ADC_TEST_CHECK(pRecord->u8Unit == uiUnit);
+            ADC_TEST_CHECK((unsigned long)pRecord->u16Group == strtoul(szGroup, NULL, 10));
+            ADC_TEST_CHECK((pRecord->u8Event <= ADC_TRACE_FORMAT_EV_LAST) && (0 == strcmp(Test_apEventName[pRecord->u8Event], szEvent)));
+            if (pRecord->u16Group < 2U)
+            {
+                au32Ends[pRecord->u16Group] += (ADC_TRACE_EV_END_U8 == pRecord->u8Event) ? 1UL : 0UL;
+                au32Notifies[pRecord->u16Group] += (ADC_TRACE_EV_NOTIFY_U8 == pRecord->u8Event) ? 1UL : 0UL;
+            }
+            u32Expected++;
+            u32Valid++;
+        }
+        else if (2 == sscanf(szLine, "%u valid events, %u discarded", &uiA, &uiB))
+        {
+            ADC_TEST_CHECK(u32Valid == uiA);
+            ADC_TEST_CHECK(((u32Torn - u32First) < (uint32)ADC_EVENT_TRACE_ENTRIES ? 1U : 0U) == uiB);
+            u32Summary++;
+        }
+        else if (3 == sscanf(szLine, "group %u: starts=%*u hw_arms=%*u chunks=%*u ends=%u notifications=%u",
+                             &uiA, &uiB, &uiC))
+        {
+            u32Group = uiA;
+            u32Ends = uiB;
+            u32Notifies = uiC;
+            ADC_TEST_CHECK(u32Group < 2UL);
+            if (u32Group < 2UL)
+            {
+                ADC_TEST_CHECK(au32Ends[u32Group] == u32Ends);
+                ADC_TEST_CHECK(au32Notifies[u32Group] == u32Notifies);
+            }
+            u32Stats++;
+        }
+        else
+        {
+            /* Column titles, empty line and intervals */
+        }
+    }
+    ADC_TEST_CHECK(0 == pclose(pIn));
+    ADC_TEST_CHECK(u32Head == u32Expected);
+    ADC_TEST_CHECK(1UL == u32Header);
+    ADC_TEST_CHECK(1UL == u32Summary);
+    ADC_TEST_CHECK(2UL == u32Stats);
+}
+
+int main(int argc, char * argv[])
+{
+    const Adc_GroupConfigurationType aGroup[2] =
+    {
+        { ADC_TEST_GROUP(0U) },
+        { ADC_TEST_GROUP(1U), .pAssignment = &Adc_Test_aAssignment[1], .AssignedChannelCount = 2U }
+    };
+    Adc_GroupType Group;
+    uint32 u32Round;
+
+    (void)argc;
+    /* The decoder is built in the directory of this program */
+    (void)snprintf(Test_szDecoder, sizeof(Test_szDecoder), "%s", argv[0]);
+    if (NULL != strrchr(Test_szDecoder, '/'))
+    {
+        strrchr(Test_szDecoder, '/')[1] = '\0';
+    }
+    else
+    {
+        (void)snprintf(Test_szDecoder, sizeof(Test_szDecoder), "./");
+    }
+    (void)snprintf(Test_szDump, sizeof(Test_szDump), "%s.bin", argv[0]);
+    (void)strncat(Test_szDecoder, "Adc_TraceDecode", sizeof(Test_szDecoder) - strlen(Test_szDecoder) - 1U);
+
+    Adc_Test_Reset();
+    for (Group = 0U; Group < 2U; Group++)
+    {
+        Adc_Test_SetGroup(Group, &aGroup[Group]);
+    }
+    Adc_Test_SetGroupCount(2U);
+    ADC_TEST_CHECK(E_OK == Adc_Test_Init());
+    for (Group = 0U; Group < 2U; Group++)
+    {
+        ADC_TEST_CHECK(E_OK == Adc_SetupResultBuffer(Group, Test_aResult[Group].au16Value));
+        Adc_EnableGroupNotification(Group);
+    }
+    /* Group 0 each round, group 1 queued behind it every other round */
+    for (u32Round = 0UL; u32Round < TEST_ROUNDS; u32Round++)
+    {
+        Adc_StartGroupConversion(0U);
+        if (0UL == (u32Round % 2UL))
+        {
+            Adc_StartGroupConversion(1U);
+        }
+        Adc_Test_Run(ADC_TEST_SETTLE_CYCLES);
+        ADC_TEST_CHECK(ADC_STREAM_COMPLETED == Adc_GetGroupStatus(0U));
+        ADC_TEST_CHECK(E_OK == Adc_ReadGroup(0U, Test_aResult[0].au16Value));
+        if (0UL == (u32Round % 2UL))
+        {
+            ADC_TEST_CHECK(E_OK == Adc_ReadGroup(1U, Test_aResult[1].au16Value));
+        }
+    }
+    ADC_TEST_CHECK(0UL == Adc_Test_u32DetCount);
+    memcpy(&Test_Ring, (const void *)&Adc_TraceBuffer, sizeof(Test_Ring));
+    Adc_DeInit();
+    /* Wrapped more than once */
+    ADC_TEST_CHECK(Test_Ring.u32Head > (2UL * (uint32)ADC_EVENT_TRACE_ENTRIES));
+
+    Test_WriteDump(&Test_Ring);
+    Test_Decode(Test_Ring.u32Head);
+
+    /* A record being written when the dump was taken */
+    Test_Ring.aRecord[(Test_Ring.u32Head + TEST_TORN) % (uint32)ADC_EVENT_TRACE_ENTRIES].u16Seq ^= 0x8000U;
+    Test_WriteDump(&Test_Ring);
+    Test_Decode(Test_Ring.u32Head - (uint32)ADC_EVENT_TRACE_ENTRIES + TEST_TORN);
+    (void)remove(Test_szDump);
+
+    printf("%u events recorded in a ring of %u, decoded from offset %u\n", (unsigned)Test_Ring.u32Head,
+           (unsigned)ADC_EVENT_TRACE_ENTRIES, (unsigned)TEST_PREFIX);
+    return Adc_Test_Result("Adc_Test_TraceDecode");
+}
+
+/** @} */
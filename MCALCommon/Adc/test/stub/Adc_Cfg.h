@@ -0,0 +1,41 @@
+/**
+*   @file           Adc_Cfg.h
+*   @brief   Host test build - configuration types of the Adc driver.
+*   @details The post-build configuration is assembled at run time by Adc_Test.c. The limit
+*            checking table is writable so that the programs can set the ranges they test.
+*/
+#ifndef ADC_CFG_H
+#define ADC_CFG_H
+
+#include "Std_Types.h"
+#include "Adc_CfgDefines.h"
+#include "Adc_Types.h"
+#include "Adc_Adc12bsarv2_CfgEx.h"
+#include "Dem.h"
+#include "Mcal.h"
+
+#define ADC_VENDOR_ID_CFG 43
+#define ADC_AR_RELEASE_MAJOR_VERSION_CFG 4
+#define ADC_AR_RELEASE_MINOR_VERSION_CFG 2
+#define ADC_AR_RELEASE_REVISION_VERSION_CFG 2
+#define ADC_SW_MAJOR_VERSION_CFG 1
+#define ADC_SW_MINOR_VERSION_CFG 0
+#define ADC_SW_PATCH_VERSION_CFG 3
+
+/** @brief Channels of a unit which can carry a limit checking configuration */
+#define ADC_TEST_LIMIT_CHECK_CHANNELS 64U
+
+typedef struct
+{
+    P2CONST(Adc_Adc12bsarv2_HwUnitConfigurationType, ADC_VAR, ADC_APPL_CONST) pAdc;
+    P2CONST(Adc_GroupConfigurationType, ADC_VAR, ADC_APPL_CONST) pGroups;
+    CONST(Adc_GroupType, ADC_CONST) GroupCount;
+    P2CONST(Adc_Adc12bsarv2_ChannelConfigurationType, ADC_VAR, ADC_APPL_CONST) pChannels[ADC_MAX_HW_UNITS];
+    CONST(Adc_ChannelIndexType, ADC_CONST) Channels[ADC_MAX_HW_UNITS];
+    CONST(Adc_Adc12bsarv2_MultiConfigType, ADC_CONST) Misc;
+} Adc_ConfigType;
+
+extern CONST(Mcal_DemErrorType, ADC_CONST) Adc_E_TimeoutCfg;
+extern VAR(Adc_ChannelLimitCheckingType, ADC_VAR) Adc_aChannelsLimitCheckingCfg[ADC_MAX_HW_UNITS][ADC_TEST_LIMIT_CHECK_CHANNELS];
+
+#endif /* ADC_CFG_H */
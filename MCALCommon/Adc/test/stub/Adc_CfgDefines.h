@@ -0,0 +1,197 @@
+/**
+*   @file           Adc_CfgDefines.h
+*   @brief   Host test build - pre-compile configuration of the Adc driver.
+*   @details Two S32K14x units with PDB and DMA. The switches tested by the programs of Adc/test
+*            can be overridden from the command line (-D), ADC_PRECOMPILE_SUPPORT is left undefined
+*            so that Adc_Init takes the configuration built by Adc_Test.c.
+*/
+#ifndef ADC_CFGDEFINES_H
+#define ADC_CFGDEFINES_H
+#include "Std_Types.h"
+#define ADC_VENDOR_ID_CFG_DEFINES 43
+#define ADC_AR_RELEASE_MAJOR_VERSION_CFG_DEFINES 4
+#define ADC_AR_RELEASE_MINOR_VERSION_CFG_DEFINES 2
+#define ADC_AR_RELEASE_REVISION_VERSION_CFG_DEFINES 2
+#define ADC_SW_MAJOR_VERSION_CFG_DEFINES 1
+#define ADC_SW_MINOR_VERSION_CFG_DEFINES 0
+#define ADC_SW_PATCH_VERSION_CFG_DEFINES 3
+#define ADC_SC1_OFFSET_ADDR32 0x0UL
+#define ADC_R_N_OFFSET_ADDR32 0x48UL
+#define ADC_ADCH_MASK_U32 0x3FUL
+#ifndef ADC_NUM_SC1_N_REGISTER
+#define ADC_NUM_SC1_N_REGISTER 16U
+#endif
+#ifndef ADC_NUM_SC1_N_REGISTER_USED
+#define ADC_NUM_SC1_N_REGISTER_USED 16U
+#endif
+#define ADC_PDB_NUM_MODULES 2U
+#ifndef ADC_PDB_CHANNELS_U8
+#define ADC_PDB_CHANNELS_U8 2U
+#endif
+#define ADC_PDB_NUM_DELAY_REGISTER 8U
+#define ADC_PDB_SUPPORTED
+#define ADC_DMA_SUPPORTED
+#define ADC_CURRENT_CHANNEL_USED
+#define ADC_CMR_REGISTER_NOT_SUPPORTED
+#define ADC_UNIT_0_ISR_USED
+#define ADC_UNIT_1_ISR_USED
+#define ADC_UNIT_0_PDB_ERR_ISR_USED
+#define ADC_UNIT_1_PDB_ERR_ISR_USED
+#define ADC_UNIT_0 0U
+#define ADC_UNIT_1 1U
+#define ADC_DMA 1U
+#define ADC_INTERRUPT 0U
+#define ADC_MAX_HW_UNITS 2U
+#define ADC_HW_UNITS(u) (Adc_pCfgPtr->Misc.au8Adc_HwUnit[(u)])
+#ifndef ADC_MAX_GROUPS
+#define ADC_MAX_GROUPS 8U
+#endif
+#ifndef ADC_QUEUE_MAX_DEPTH_MAX
+#define ADC_QUEUE_MAX_DEPTH_MAX 8U
+#endif
+#define ADC_HW_QUEUE 1U
+#define ADC_MAX_HADRWARE_TRIGGERS 1U
+#define ADC_NO_OF_ENABLE_CH_DISABLE_CH_GROUPS 1U
+#define ADC_PRIORITY_NONE 0U
+#define ADC_PRIORITY_HW 1U
+#define ADC_PRIORITY_HW_SW 2U
+#ifndef ADC_PRIORITY_IMPLEMENTATION
+#define ADC_PRIORITY_IMPLEMENTATION ADC_PRIORITY_HW_SW
+#endif
+#ifndef ADC_ENABLE_QUEUING
+#define ADC_ENABLE_QUEUING STD_ON
+#endif
+#ifndef ADC_ENABLE_START_STOP_GROUP_API
+#define ADC_ENABLE_START_STOP_GROUP_API STD_ON
+#endif
+#ifndef ADC_DEINIT_API
+#define ADC_DEINIT_API STD_ON
+#endif
+#ifndef ADC_DEV_ERROR_DETECT
+#define ADC_DEV_ERROR_DETECT STD_ON
+#endif
+#ifndef ADC_VALIDATE_STATE
+#define ADC_VALIDATE_STATE STD_ON
+#endif
+#ifndef ADC_VALIDATE_PARAMS
+#define ADC_VALIDATE_PARAMS STD_ON
+#endif
+#ifndef ADC_VALIDATE_CALL_AND_GROUP
+#define ADC_VALIDATE_CALL_AND_GROUP STD_ON
+#endif
+#ifndef ADC_VALIDATE_CALL_AND_UNIT
+#define ADC_VALIDATE_CALL_AND_UNIT STD_ON
+#endif
+#ifndef ADC_VALIDATE_GLOBAL_CALL
+#define ADC_VALIDATE_GLOBAL_CALL STD_ON
+#endif
+#ifndef ADC_VALIDATE_NOTIFY_CAPABILITY
+#define ADC_VALIDATE_NOTIFY_CAPABILITY STD_ON
+#endif
+#ifndef ADC_VALIDATE_APP_BUFFER_ALIGNMENT
+#define ADC_VALIDATE_APP_BUFFER_ALIGNMENT STD_OFF
+#endif
+#ifndef ADC_GRP_NOTIF_CAPABILITY
+#define ADC_GRP_NOTIF_CAPABILITY STD_ON
+#endif
+#ifndef ADC_HW_TRIGGER_API
+#define ADC_HW_TRIGGER_API STD_ON
+#endif
+#ifndef ADC_READ_GROUP_API
+#define ADC_READ_GROUP_API STD_ON
+#endif
+#ifndef ADC_VERSION_INFO_API
+#define ADC_VERSION_INFO_API STD_ON
+#endif
+#ifndef ADC_ENABLE_LIMIT_CHECK
+#define ADC_ENABLE_LIMIT_CHECK STD_ON
+#endif
+#ifndef ADC_DISABLE_DEM_REPORT_ERROR_STATUS
+#define ADC_DISABLE_DEM_REPORT_ERROR_STATUS STD_OFF
+#endif
+#ifndef ADC_CALIBRATION
+#define ADC_CALIBRATION STD_ON
+#endif
+#ifndef ADC_SELF_TEST
+#define ADC_SELF_TEST STD_OFF
+#endif
+#ifndef ADC_DUAL_CLOCK_MODE
+#define ADC_DUAL_CLOCK_MODE STD_ON
+#endif
+#ifndef ADC_SET_MODE_API
+#define ADC_SET_MODE_API STD_OFF
+#endif
+#ifndef ADC_SETCHANNEL_API
+#define ADC_SETCHANNEL_API STD_OFF
+#endif
+#ifndef ADC_ENABLE_CH_DISABLE_CH_NONAUTO_API
+#define ADC_ENABLE_CH_DISABLE_CH_NONAUTO_API STD_OFF
+#endif
+#ifndef ADC_ENABLE_CONFIGURE_THRESHOLD_NONAUTO_API
+#define ADC_ENABLE_CONFIGURE_THRESHOLD_NONAUTO_API STD_OFF
+#endif
+#ifndef ADC_ENABLE_CTUTRIG_API
+#define ADC_ENABLE_CTUTRIG_API STD_OFF
+#endif
+#ifndef ADC_ENABLE_CTUTRIG_NONAUTO_API
+#define ADC_ENABLE_CTUTRIG_NONAUTO_API STD_OFF
+#endif
+#ifndef ADC_ENABLE_CTU_CONTROL_MODE_API
+#define ADC_ENABLE_CTU_CONTROL_MODE_API STD_OFF
+#endif
+#ifndef ADC_ENABLE_DOUBLE_BUFFERING
+#define ADC_ENABLE_DOUBLE_BUFFERING STD_ON
+#endif
+#ifndef ADC_DOUBLE_BUFFERING_MORE_THAN_ONE_CHANNEL
+#define ADC_DOUBLE_BUFFERING_MORE_THAN_ONE_CHANNEL STD_ON
+#endif
+#ifndef ADC_ENABLE_INITIAL_NOTIFICATION
+#define ADC_ENABLE_INITIAL_NOTIFICATION STD_ON
+#endif
+#ifndef ADC_GET_INJECTED_CONVERSION_STATUS_API
+#define ADC_GET_INJECTED_CONVERSION_STATUS_API STD_OFF
+#endif
+#ifndef ADC_SOFTWARE_INJECTED_CONVERSIONS_USED
+#define ADC_SOFTWARE_INJECTED_CONVERSIONS_USED STD_OFF
+#endif
+#ifndef ADC_HARDWARE_NORMAL_CONVERSIONS_USED
+#define ADC_HARDWARE_NORMAL_CONVERSIONS_USED STD_ON
+#endif
+#ifndef ADC_MULTIPLE_HARDWARE_TRIGGERS
+#define ADC_MULTIPLE_HARDWARE_TRIGGERS STD_OFF
+#endif
+#ifndef ADC_OPTIMIZE_ONESHOT_HW_TRIGGER
+#define ADC_OPTIMIZE_ONESHOT_HW_TRIGGER STD_OFF
+#endif
+#ifndef ADC_SET_ADC_CONV_TIME_ONCE
+#define ADC_SET_ADC_CONV_TIME_ONCE STD_OFF
+#endif
+#ifndef ADC_BYPASS_CONSISTENCY_LOOP
+#define ADC_BYPASS_CONSISTENCY_LOOP STD_OFF
+#endif
+#ifndef ADC_POWER_STATE_SUPPORTED
+#define ADC_POWER_STATE_SUPPORTED STD_OFF
+#endif
+#ifndef ADC_POWER_STATE_ASYNCH_MODE_SUPPORTED
+#define ADC_POWER_STATE_ASYNCH_MODE_SUPPORTED STD_OFF
+#endif
+#ifndef ADC_USER_MODE_REG_PROT_ENABLED
+#define ADC_USER_MODE_REG_PROT_ENABLED STD_OFF
+#endif
+#ifndef ADC_WORK_AROUND_ERRATA_E8188
+#define ADC_WORK_AROUND_ERRATA_E8188 STD_OFF
+#endif
+#define ADC_ALIGN_RIGHT 0U
+#define ADC_ALIGN_LEFT 1U
+#ifndef ADC_RESULT_ALIGNMENT
+#define ADC_RESULT_ALIGNMENT ADC_ALIGN_RIGHT
+#endif
+#ifndef ADC_TIMEOUT_COUNTER
+#define ADC_TIMEOUT_COUNTER 10000UL
+#endif
+#ifndef ADC_DMA_TRANSFER_TIMEOUT
+#define ADC_DMA_TRANSFER_TIMEOUT 10000UL
+#endif
+#define ADC_CONTINUOUS_NO_INTERRUPT_SUPPORTED
+#define ADC_DMA_SCATTER_GATHER_USED
+#endif /* ADC_CFGDEFINES_H */
@@ -0,0 +1,60 @@
+/**
+*   @file           CDD_Mcl.h
+*   @brief   Host test build - eDMA services used by the Adc driver.
+*   @details The services are implemented by the eDMA model in Adc/src/Adc_Mcl_Sim.c.
+*/
+#ifndef CDD_MCL_H
+#define CDD_MCL_H
+
+#include "Std_Types.h"
+
+#define MCL_AR_RELEASE_MAJOR_VERSION 4
+#define MCL_AR_RELEASE_MINOR_VERSION 2
+#define MCL_TYPES_AR_RELEASE_MAJOR_VERSION 4
+#define MCL_TYPES_AR_RELEASE_MINOR_VERSION 2
+#define MCL_DMA_NOTIFICATION_SUPPORTED STD_ON
+
+#define DMA_OFFSET_32_BITS 4U
+#define DMA_SIZE_2BYTES 1U
+#define DMA_SIZE_4BYTES 2U
+#define DMA_TCD_DISABLE_REQ_U8 8U
+#define DMA_TCD_INT_HALF_U8 4U
+#define DMA_TCD_INT_MAJOR_U8 2U
+
+typedef uint8 Mcl_ChannelType;
+
+typedef struct
+{
+    uint32 TCD[8];
+} Mcl_DmaTcdType;
+
+typedef struct
+{
+    uint32 u32saddr;
+    uint32 u32soff;
+    uint32 u32ssize;
+    uint32 u32smod;
+    uint32 u32daddr;
+    uint32 u32doff;
+    uint32 u32dsize;
+    uint32 u32dmod;
+    uint32 u32num_bytes;
+    uint32 u32iter;
+} Mcl_DmaTcdAttributesType;
+
+void Mcl_DmaDisableHwRequest(Mcl_ChannelType Channel);
+void Mcl_DmaEnableHwRequest(Mcl_ChannelType Channel);
+void Mcl_DmaDisableNotification(Mcl_ChannelType Channel);
+Mcl_DmaTcdType * Mcl_DmaGetChannelTcdAddress(Mcl_ChannelType Channel);
+void Mcl_DmaConfigTcd(Mcl_DmaTcdType * pTcd, const Mcl_DmaTcdAttributesType * pAttributes);
+void Mcl_DmaConfigLinkedChannel(Mcl_ChannelType Channel, const Mcl_DmaTcdAttributesType * pAttributes, Mcl_ChannelType LinkedChannel);
+void Mcl_DmaTcdSetFlags(Mcl_DmaTcdType * pTcd, uint8 u8Flags);
+void Mcl_DmaTcdSetSlast(Mcl_DmaTcdType * pTcd, sint32 s32Value);
+void Mcl_DmaTcdSetDlast(Mcl_DmaTcdType * pTcd, sint32 s32Value);
+void Mcl_DmaTcdSetSaddr(Mcl_DmaTcdType * pTcd, uint32 u32Value);
+void Mcl_DmaTcdSetDaddr(Mcl_DmaTcdType * pTcd, uint32 u32Value);
+uint16 Mcl_DmaTcdGetIterCount(const Mcl_DmaTcdType * pTcd);
+void Mcl_DmaUpdateIterCount(Mcl_ChannelType Channel, uint32 u32Iter);
+boolean Mcl_DmaIsTransferActive(Mcl_ChannelType Channel);
+
+#endif /* CDD_MCL_H */
@@ -0,0 +1,21 @@
+/**
+*   @file           Dem.h
+*   @brief   Host test build - Diagnostic Event Manager, implemented by Adc_Test.c.
+*/
+#ifndef DEM_H
+#define DEM_H
+
+#include "Std_Types.h"
+
+#define DEM_AR_RELEASE_MAJOR_VERSION 4
+#define DEM_AR_RELEASE_MINOR_VERSION 2
+
+typedef uint16 Dem_EventIdType;
+typedef uint8 Dem_EventStatusType;
+
+#define DEM_EVENT_STATUS_PASSED 0U
+#define DEM_EVENT_STATUS_FAILED 1U
+
+void Dem_ReportErrorStatus(Dem_EventIdType EventId, Dem_EventStatusType EventStatus);
+
+#endif /* DEM_H */
@@ -0,0 +1,15 @@
+/**
+*   @file           Det.h
+*   @brief   Host test build - Default Error Tracer, implemented by Adc_Test.c.
+*/
+#ifndef DET_H
+#define DET_H
+
+#include "Std_Types.h"
+
+#define DET_AR_RELEASE_MAJOR_VERSION 4
+#define DET_AR_RELEASE_MINOR_VERSION 2
+
+Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
+
+#endif /* DET_H */
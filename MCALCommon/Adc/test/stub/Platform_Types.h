@@ -0,0 +1,64 @@
+/**
+*   @file           Platform_Types.h
+*
+*   @brief   AUTOSAR Base - Platform types of the host test build.
+*   @details Forced in front of every translation unit of the host test build (gcc -include) so
+*            that it replaces Base/include/Platform_Types.h, whose 32 bit types are long based
+*            and therefore 64 bits wide on LP64 hosts. The types below keep the widths of the
+*            Cortex-M4 target.
+*
+*   @addtogroup ADC_TEST
+*   @{
+*/
+
+#ifndef PLATFORM_TYPES_H
+#define PLATFORM_TYPES_H
+
+#define PLATFORM_VENDOR_ID                      43
+#define PLATFORM_AR_RELEASE_MAJOR_VERSION       4
+#define PLATFORM_AR_RELEASE_MINOR_VERSION       2
+#define PLATFORM_AR_RELEASE_REVISION_VERSION    2
+#define PLATFORM_SW_MAJOR_VERSION               1
+#define PLATFORM_SW_MINOR_VERSION               0
+#define PLATFORM_SW_PATCH_VERSION               3
+
+#define CPU_TYPE_8 8
+#define CPU_TYPE_16 16
+#define CPU_TYPE_32 32
+#define CPU_TYPE_64 64
+#define MSB_FIRST 0
+#define LSB_FIRST 1
+#define HIGH_BYTE_FIRST 0
+#define LOW_BYTE_FIRST 1
+#define CPU_TYPE (CPU_TYPE_32)
+#define CPU_BIT_ORDER  (LSB_FIRST)
+#define CPU_BYTE_ORDER (LOW_BYTE_FIRST)
+
+#ifndef TRUE
+    #define TRUE 1
+#endif
+#ifndef FALSE
+    #define FALSE 0
+#endif
+
+typedef unsigned char boolean;
+typedef unsigned char uint8;
+typedef unsigned short uint16;
+typedef unsigned int uint32;
+typedef unsigned long long uint64;
+typedef signed char sint8;
+typedef signed short sint16;
+typedef signed int sint32;
+typedef signed long long sint64;
+typedef unsigned int uint8_least;
+typedef unsigned int uint16_least;
+typedef unsigned int uint32_least;
+typedef signed int sint8_least;
+typedef signed int sint16_least;
+typedef signed int sint32_least;
+typedef float float32;
+typedef double float64;
+
+#endif /* PLATFORM_TYPES_H */
+
+/** @} */
@@ -0,0 +1,30 @@
+/**
+*   @file           SchM_Adc.h
+*   @brief   Host test build - exclusive areas of the Adc driver.
+*   @details Every area is a call into Adc_Test.c, which measures how long each area stays entered,
+*            in model cycles and in host nanoseconds.
+*/
+#ifndef SCHM_ADC_H
+#define SCHM_ADC_H
+
+extern void Adc_Test_EnterExclusiveArea(unsigned int Area);
+extern void Adc_Test_ExitExclusiveArea(unsigned int Area);
+
+#define ADC_TEST_EXCLUSIVE_AREA(n) \
+    static inline void SchM_Enter_Adc_ADC_EXCLUSIVE_AREA_##n(void) { Adc_Test_EnterExclusiveArea(1##n - 100U); } \
+    static inline void SchM_Exit_Adc_ADC_EXCLUSIVE_AREA_##n(void) { Adc_Test_ExitExclusiveArea(1##n - 100U); }
+
+ADC_TEST_EXCLUSIVE_AREA(00) ADC_TEST_EXCLUSIVE_AREA(01) ADC_TEST_EXCLUSIVE_AREA(02) ADC_TEST_EXCLUSIVE_AREA(03)
+ADC_TEST_EXCLUSIVE_AREA(04) ADC_TEST_EXCLUSIVE_AREA(05) ADC_TEST_EXCLUSIVE_AREA(06) ADC_TEST_EXCLUSIVE_AREA(07)
+ADC_TEST_EXCLUSIVE_AREA(08) ADC_TEST_EXCLUSIVE_AREA(09) ADC_TEST_EXCLUSIVE_AREA(10) ADC_TEST_EXCLUSIVE_AREA(11)
+ADC_TEST_EXCLUSIVE_AREA(12) ADC_TEST_EXCLUSIVE_AREA(13) ADC_TEST_EXCLUSIVE_AREA(14) ADC_TEST_EXCLUSIVE_AREA(15)
+ADC_TEST_EXCLUSIVE_AREA(16) ADC_TEST_EXCLUSIVE_AREA(17) ADC_TEST_EXCLUSIVE_AREA(18) ADC_TEST_EXCLUSIVE_AREA(19)
+ADC_TEST_EXCLUSIVE_AREA(20) ADC_TEST_EXCLUSIVE_AREA(21) ADC_TEST_EXCLUSIVE_AREA(22) ADC_TEST_EXCLUSIVE_AREA(23)
+ADC_TEST_EXCLUSIVE_AREA(24) ADC_TEST_EXCLUSIVE_AREA(25) ADC_TEST_EXCLUSIVE_AREA(26) ADC_TEST_EXCLUSIVE_AREA(27)
+ADC_TEST_EXCLUSIVE_AREA(28) ADC_TEST_EXCLUSIVE_AREA(29) ADC_TEST_EXCLUSIVE_AREA(30) ADC_TEST_EXCLUSIVE_AREA(31)
+ADC_TEST_EXCLUSIVE_AREA(32) ADC_TEST_EXCLUSIVE_AREA(33) ADC_TEST_EXCLUSIVE_AREA(34) ADC_TEST_EXCLUSIVE_AREA(35)
+ADC_TEST_EXCLUSIVE_AREA(36) ADC_TEST_EXCLUSIVE_AREA(37) ADC_TEST_EXCLUSIVE_AREA(38) ADC_TEST_EXCLUSIVE_AREA(39)
+ADC_TEST_EXCLUSIVE_AREA(40) ADC_TEST_EXCLUSIVE_AREA(41) ADC_TEST_EXCLUSIVE_AREA(42) ADC_TEST_EXCLUSIVE_AREA(43)
+ADC_TEST_EXCLUSIVE_AREA(44) ADC_TEST_EXCLUSIVE_AREA(45)
+
+#endif /* SCHM_ADC_H */
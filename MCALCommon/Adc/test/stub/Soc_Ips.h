@@ -0,0 +1,16 @@
+/**
+*   @file           Soc_Ips.h
+*   @brief   Host test build - IP versions of the S32K14x.
+*/
+#ifndef SOC_IPS_H
+#define SOC_IPS_H
+
+#define SOC_IPS_VENDOR_ID 43
+#define SOC_IPS_AR_RELEASE_MAJOR_VERSION 4
+#define SOC_IPS_AR_RELEASE_MINOR_VERSION 2
+#define SOC_IPS_AR_RELEASE_REVISION_VERSION 2
+#define SOC_IPS_SW_MAJOR_VERSION 1
+#define SOC_IPS_SW_MINOR_VERSION 0
+#define SOC_IPS_SW_PATCH_VERSION 3
+
+#endif /* SOC_IPS_H */
@@ -0,0 +1,261 @@
+/**
+*   @file    Adc_SchedReport.c
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - Host report of the conversion time and schedulability analysis.
+*   @details Runs Adc_Adc12bsarv2_Sched_Analyze on a driver configuration and prints the timing of
+*            each group, then the utilization and the worst-case queueing latency of each unit.
+*            Host program, built with the driver sources and MCAL_REG_SIMULATION defined, and
+*            linked with a unit returning the configuration to analyze:
+*            @code
+*            const Adc_ConfigType * Adc_SchedReport_GetConfig(void);
+*            @endcode
+*            test/Adc_SchedReport_Example.c returns one assembled with the test harness,
+*            "make report" in test builds the tool with it and runs it. Command line:
+*            @code
+*            Adc_SchedReport -a adc_hz -p pdb_hz -c adder_adck -k chunk_overhead [-l] period_us...
+*            @endcode
+*            adc_hz is the ADC input clock before CFG1[ADIV], pdb_hz the PDB input clock,
+*            adder_adck the ADCK cycles of a conversion besides its sample and compare cycles, from
+*            the data sheet of the device, and chunk_overhead the ADC input clock cycles from the
+*            end of a chunk to the trigger of the next one, measured on the target. -l analyzes
+*            the alternate clock mode. One release period per group follows, in microseconds, 0 or
+*            missing for the groups which are not analyzed. Exits with 0 if every unit is
+*            schedulable, 2 if not and 1 on a usage error.
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Adc_Adc12bsarv2_Sched.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+#define REPORT_OK               0
+#define REPORT_USAGE            1
+#define REPORT_NOT_SCHEDULABLE  2
+
+/*==================================================================================================
+*                                   GLOBAL FUNCTION PROTOTYPES
+==================================================================================================*/
+/* Provided by the configuration linked with the tool */
+const Adc_ConfigType * Adc_SchedReport_GetConfig(void);
+
+/*==================================================================================================
+*                                       LOCAL VARIABLES
+==================================================================================================*/
+static uint32 Report_au32PeriodUs[ADC_MAX_GROUPS];
+static uint32 Report_au32Periods[ADC_MAX_GROUPS];
+static Adc_Adc12bsarv2_SchedReportType Report_Result;
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+static int Report_Usage(const char * szName)
+{
+    fprintf(stderr, "usage: %s -a adc_hz -p pdb_hz -c adder_adck -k chunk_overhead [-l] period_us...\n", szName);
+    return REPORT_USAGE;
+}
+
+static boolean Report_ParseNumber(const char * szText, uint32 * pu32Value)
+{
+    char * pEnd;
+    unsigned long ulValue = strtoul(szText, &pEnd, 0);
+
+    *pu32Value = (uint32)ulValue;
+    return (boolean)(('\0' != szText[0]) && ('\0' == *pEnd) && (ulValue <= 0xFFFFFFFFUL));
+}
+
+/* Cycles in microseconds at the ADC input clock */
+static double Report_Us(uint32 u32Cycles, uint32 u32AdcClockHz)
+{
+    return ((double)u32Cycles * 1000000.0) / (double)u32AdcClockHz;
+}
+
+static void Report_Cycles(uint32 u32Cycles)
+{
+    if (ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 == u32Cycles)
+    {
+        printf(" %9s", "unbounded");
+    }
+    else
+    {
+        printf(" %9u", (unsigned)u32Cycles);
+    }
+}
+
+static void Report_Print(const Adc_ConfigType * pCfg, const Adc_Adc12bsarv2_SchedParamType * pParam)
+{
+    const Adc_Adc12bsarv2_SchedGroupType * pTiming;
+    const Adc_Adc12bsarv2_SchedUnitType * pUnit;
+    Adc_GroupType Group;
+    Adc_HwUnitType Unit;
+    boolean bUsed;
+
+    printf("ADC clock %u Hz, PDB clock %u Hz, conversion adder %u ADCK, chunk overhead %u cycles\n",
+           (unsigned)pParam->u32AdcClockHz, (unsigned)pParam->u32PdbClockHz,
+           (unsigned)pParam->u32ConversionAdder, (unsigned)pParam->u32ChunkOverhead);
+    printf("group unit prio    period conversion     round       job  response  queueing\n");
+    for (Group = 0U; Group < pCfg->GroupCount; Group++)
+    {
+        pTiming = &Report_Result.aGroup[Group];
+        printf("%5u %4u %4u", (unsigned)Group, (unsigned)pCfg->pGroups[Group].HwUnit, (unsigned)pCfg->pGroups[Group].Priority);
+        if (0UL == pParam->pPeriods[Group])
+        {
+            printf(" %9s %10u %9u", "-", (unsigned)pTiming->u32ConversionCycles, (unsigned)pTiming->u32RoundCycles);
+            Report_Cycles(pTiming->u32JobCycles);
+            printf("  not analyzed");
+        }
+        else
+        {
+            printf(" %9u %10u %9u", (unsigned)pParam->pPeriods[Group], (unsigned)pTiming->u32ConversionCycles,
+                   (unsigned)pTiming->u32RoundCycles);
+            Report_Cycles(pTiming->u32JobCycles);
+            Report_Cycles(pTiming->u32ResponseCycles);
+            Report_Cycles(pTiming->u32QueueingCycles);
+            printf("  %s", ((boolean)TRUE == pTiming->bSchedulable) ? "ok" : "late");
+        }
+        if ((boolean)TRUE == pTiming->bSequenceError)
+        {
+            printf(", sequence error");
+        }
+        if ((boolean)TRUE == pTiming->bChunkOrderError)
+        {
+            printf(", chunk order error");
+        }
+        printf("\n");
+    }
+
+    for (Unit = 0U; Unit < (Adc_HwUnitType)ADC_MAX_HW_UNITS; Unit++)
+    {
+        bUsed = (boolean)FALSE;
+        for (Group = 0U; Group < pCfg->GroupCount; Group++)
+        {
+            if ((pCfg->pGroups[Group].HwUnit == Unit) && (0UL != pParam->pPeriods[Group]))
+            {
+                bUsed = (boolean)TRUE;
+            }
+        }
+        if ((boolean)TRUE == bUsed)
+        {
+            pUnit = &Report_Result.aUnit[Unit];
+            printf("unit %u: utilization %u.%u %%, worst-case queueing", (unsigned)Unit,
+                   (unsigned)(pUnit->u32Utilization / 10UL), (unsigned)(pUnit->u32Utilization % 10UL));
+            if (ADC_ADC12BSARV2_SCHED_UNBOUNDED_U32 == pUnit->u32MaxQueueingCycles)
+            {
+                printf(" unbounded");
+            }
+            else
+            {
+                printf(" %u cycles (%.2f us)", (unsigned)pUnit->u32MaxQueueingCycles,
+                       Report_Us(pUnit->u32MaxQueueingCycles, pParam->u32AdcClockHz));
+            }
+            printf(", %s\n", ((boolean)TRUE == pUnit->bSchedulable) ? "schedulable" : "not schedulable");
+        }
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(int argc, char * argv[])
+{
+    const Adc_ConfigType * pCfg = Adc_SchedReport_GetConfig();
+    Adc_Adc12bsarv2_SchedParamType Param;
+    boolean abSet[4] = { (boolean)FALSE, (boolean)FALSE, (boolean)FALSE, (boolean)FALSE };
+    uint32 * pu32Option;
+    uint64 u64Period;
+    Std_ReturnType Result;
+    Adc_GroupType Group = 0U;
+    int Arg;
+    int Option;
+
+    memset(&Param, 0, sizeof(Param));
+    Param.pPeriods = Report_au32Periods;
+#if (ADC_DUAL_CLOCK_MODE == STD_ON)
+    Param.eClockMode = ADC_NORMAL;
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+
+    for (Arg = 1; Arg < argc; Arg++)
+    {
+        if (0 == strcmp(argv[Arg], "-l"))
+        {
+#if (ADC_DUAL_CLOCK_MODE == STD_ON)
+            Param.eClockMode = ADC_ALTERNATE;
+#else
+            fprintf(stderr, "-l: ADC_DUAL_CLOCK_MODE is STD_OFF\n");
+            return REPORT_USAGE;
+#endif /* (ADC_DUAL_CLOCK_MODE == STD_ON) */
+        }
+        else if (('-' == argv[Arg][0]) && ('\0' != argv[Arg][1]) && ('\0' == argv[Arg][2]))
+        {
+            switch (argv[Arg][1])
+            {
+                case 'a': Option = 0; pu32Option = &Param.u32AdcClockHz; break;
+                case 'p': Option = 1; pu32Option = &Param.u32PdbClockHz; break;
+                case 'c': Option = 2; pu32Option = &Param.u32ConversionAdder; break;
+                case 'k': Option = 3; pu32Option = &Param.u32ChunkOverhead; break;
+                default: return Report_Usage(argv[0]);
+            }
+            Arg++;
+            if ((Arg >= argc) || ((boolean)FALSE == Report_ParseNumber(argv[Arg], pu32Option)))
+            {
+                return Report_Usage(argv[0]);
+            }
+            abSet[Option] = (boolean)TRUE;
+        }
+        else if ((Group < pCfg->GroupCount) && ((boolean)TRUE == Report_ParseNumber(argv[Arg], &Report_au32PeriodUs[Group])))
+        {
+            Group++;
+        }
+        else
+        {
+            return Report_Usage(argv[0]);
+        }
+    }
+    if (((boolean)FALSE == abSet[0]) || ((boolean)FALSE == abSet[1]) || ((boolean)FALSE == abSet[2]) || \
+        ((boolean)FALSE == abSet[3]) || (0UL == Param.u32AdcClockHz) || (0UL == Param.u32PdbClockHz))
+    {
+        return Report_Usage(argv[0]);
+    }
+
+    for (Group = 0U; Group < pCfg->GroupCount; Group++)
+    {
+        /* Rounded down: a release period is a shortest time */
+        u64Period = ((uint64)Report_au32PeriodUs[Group] * (uint64)Param.u32AdcClockHz) / 1000000ULL;
+        if (u64Period > 0xFFFFFFFFULL)
+        {
+            fprintf(stderr, "period of group %u too long\n", (unsigned)Group);
+            return REPORT_USAGE;
+        }
+        Report_au32Periods[Group] = (uint32)u64Period;
+    }
+
+    Result = Adc_Adc12bsarv2_Sched_Analyze(pCfg, &Param, &Report_Result);
+    Report_Print(pCfg, &Param);
+    return ((Std_ReturnType)E_OK == Result) ? REPORT_OK : REPORT_NOT_SCHEDULABLE;
+}
+
+/** @} */
@@ -0,0 +1,538 @@
+/**
+*   @file    Adc_TraceDecode.c
+*   @version 1.0.3
+*
+*   @brief   AUTOSAR Adc - Host decoder of the binary event trace.
+*   @details Reads a RAM dump containing Adc_TraceBuffer, recorded by the driver built with
+*            ADC_EVENT_TRACE set to STD_ON, and prints the events as a timeline followed by
+*            statistics of each group. The dump is a raw binary image, e.g. saved by the debugger
+*            from the address of Adc_TraceBuffer or of a whole RAM region; the ring is located by
+*            its magic word. The layout and the event codes come from Adc_TraceFormat.h, shared
+*            with the driver. Host program, built with any C99 compiler (test/Makefile builds it
+*            and checks it on dumps of the driver):
+*            @code
+*            cc -std=c99 -O2 -I../include -o Adc_TraceDecode Adc_TraceDecode.c
+*            Adc_TraceDecode [-f clock_hz] [-o offset] [-q] dump.bin
+*            @endcode
+*
+*   @addtogroup ADC
+*   @{
+*/
+/*==================================================================================================
+*   Project              : AUTOSAR 4.2 MCAL
+*   Platform             : ARM
+*   Peripheral           : ADC12BSARV2
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.2.2
+*   Autosar Revision     : ASR_REL_4_2_REV_0002
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.3
+*   Build Version        : S32K14x_MCAL_1_0_3_RTM_ASR_REL_4_2_REV_0002_28-Feb-20
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017-2020 NXP
+*   All Rights Reserved.
+==================================================================================================*/
+/*==================================================================================================
+==================================================================================================*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "Adc_TraceFormat.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+#define MAX_UNITS               256U
+#define MAX_GROUPS              65535U
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+typedef struct
+{
+    uint64_t u64Time;       /* unwrapped timestamp */
+    uint32_t u32Index;      /* write index */
+    uint8_t u8Event;
+    uint8_t u8Unit;
+    uint16_t u16Group;
+    uint16_t u16Data;
+} Event;
+
+typedef struct
+{
+    uint64_t u64Count;
+    uint64_t u64Sum;
+    uint64_t u64Min;
+    uint64_t u64Max;
+} Interval;
+
+typedef struct
+{
+    int bSeen;
+    uint32_t u32Starts;
+    uint32_t u32HwArms;
+    uint32_t u32Chunks;
+    uint32_t u32Ends;
+    uint32_t u32Notifies;
+    uint32_t u32LimitFails;
+    uint32_t u32Preempted;
+    uint32_t u32Stopped;
+    uint32_t u32HwDisabled;
+    uint32_t u32PdbErrors;
+    uint32_t u32MaxQueue;
+    int bHw;                /* last START armed a hardware trigger */
+    int bRound;             /* a software round is running since u64RoundStart */
+    uint64_t u64RoundStart;
+    int bEnd;               /* an end waits for its notification since u64End */
+    uint64_t u64End;
+    Interval tStartToEnd;
+    Interval tEndToNotify;
+} GroupStats;
+
+typedef struct
+{
+    uint32_t u32Converting;     /* group converting on the unit, ADC_TRACE_FORMAT_NO_GROUP if none */
+    uint32_t u32Aborted;        /* group aborted by the previous event, ADC_TRACE_FORMAT_NO_GROUP if none */
+    uint32_t u32PdbErrors;
+} UnitState;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+static GroupStats *aGroup;
+static UnitState aUnit[MAX_UNITS];
+static double dTickUs;      /* microseconds per tick, 0 to print ticks */
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+static uint32_t Get16(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t Get32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static const char *EventName(uint32_t u32Event)
+{
+    static const char *const apName[] =
+    {
+        "?", "QUEUE_INSERT", "QUEUE_REMOVE", "START", "CHUNK", "END", "LIMIT_FAIL", "ABORT", "PDB_ERROR", "NOTIFY"
+    };
+    return (u32Event <= ADC_TRACE_FORMAT_EV_LAST) ? apName[u32Event] : "?";
+}
+
+static void AddInterval(Interval *pInterval, uint64_t u64Value)
+{
+    if ((0U == pInterval->u64Count) || (u64Value < pInterval->u64Min))
+    {
+        pInterval->u64Min = u64Value;
+    }
+    if (u64Value > pInterval->u64Max)
+    {
+        pInterval->u64Max = u64Value;
+    }
+    pInterval->u64Sum += u64Value;
+    pInterval->u64Count++;
+}
+
+static void PrintTime(uint64_t u64Ticks)
+{
+    if (dTickUs > 0.0)
+    {
+        printf("%12.3fus", (double)u64Ticks * dTickUs);
+    }
+    else
+    {
+        printf("%12llu", (unsigned long long)u64Ticks);
+    }
+}
+
+static void PrintInterval(const char *pName, const Interval *pInterval)
+{
+    if (0U != pInterval->u64Count)
+    {
+        printf("    %-14s n=%-8llu min=", pName, (unsigned long long)pInterval->u64Count);
+        PrintTime(pInterval->u64Min);
+        printf(" avg=");
+        PrintTime(pInterval->u64Sum / pInterval->u64Count);
+        printf(" max=");
+        PrintTime(pInterval->u64Max);
+        printf("\n");
+    }
+}
+
+/* Resolves an abort left open by the previous event of the unit */
+static void CloseAbort(UnitState *pUnit, const Event *pEvent, int bTimeline)
+{
+    uint32_t u32Group = pUnit->u32Aborted;
+
+    if (ADC_TRACE_FORMAT_NO_GROUP != u32Group)
+    {
+        pUnit->u32Aborted = ADC_TRACE_FORMAT_NO_GROUP;
+        if ((ADC_TRACE_FORMAT_EV_QUEUE_REMOVE == pEvent->u8Event) && (u32Group == pEvent->u16Group))
+        {
+            aGroup[u32Group].u32Stopped++;
+            if (bTimeline)
+            {
+                printf("  (group %u stopped)", (unsigned)u32Group);
+            }
+        }
+        else if (0 != aGroup[u32Group].bHw)
+        {
+            aGroup[u32Group].u32HwDisabled++;
+        }
+        else
+        {
+            aGroup[u32Group].u32Preempted++;
+            if (bTimeline)
+            {
+                printf("  (group %u preempted)", (unsigned)u32Group);
+            }
+        }
+    }
+}
+
+static void Account(const Event *pEvent, int bTimeline)
+{
+    UnitState *pUnit = &aUnit[pEvent->u8Unit];
+    GroupStats *pGroup = (ADC_TRACE_FORMAT_NO_GROUP != pEvent->u16Group) ? &aGroup[pEvent->u16Group] : NULL;
+
+    CloseAbort(pUnit, pEvent, bTimeline);
+    if (NULL != pGroup)
+    {
+        pGroup->bSeen = 1;
+    }
+    switch (pEvent->u8Event)
+    {
+        case ADC_TRACE_FORMAT_EV_QUEUE_INSERT:
+            if (pEvent->u16Data > pGroup->u32MaxQueue)
+            {
+                pGroup->u32MaxQueue = pEvent->u16Data;
+            }
+            break;
+        case ADC_TRACE_FORMAT_EV_START:
+            pUnit->u32Converting = pEvent->u16Group;
+            pGroup->bHw = (0U != pEvent->u16Data);
+            if (0 != pGroup->bHw)
+            {
+                pGroup->u32HwArms++;
+                pGroup->bRound = 0;
+            }
+            else
+            {
+                pGroup->u32Starts++;
+                pGroup->bRound = 1;
+                pGroup->u64RoundStart = pEvent->u64Time;
+            }
+            break;
+        case ADC_TRACE_FORMAT_EV_CHUNK:
+            pUnit->u32Converting = pEvent->u16Group;
+            pGroup->u32Chunks++;
+            break;
+        case ADC_TRACE_FORMAT_EV_END:
+            pGroup->u32Chunks++;
+            pGroup->u32Ends++;
+            if (0 != pGroup->bRound)
+            {
+                AddInterval(&pGroup->tStartToEnd, pEvent->u64Time - pGroup->u64RoundStart);
+                /* A continuous group starts its next round here */
+                pGroup->u64RoundStart = pEvent->u64Time;
+            }
+            pGroup->bEnd = 1;
+            pGroup->u64End = pEvent->u64Time;
+            break;
+        case ADC_TRACE_FORMAT_EV_LIMIT_FAIL:
+            pGroup->u32LimitFails++;
+            pGroup->bEnd = 0;
+            break;
+        case ADC_TRACE_FORMAT_EV_ABORT:
+            pUnit->u32Aborted = pEvent->u16Group;
+            pUnit->u32Converting = ADC_TRACE_FORMAT_NO_GROUP;
+            pGroup->bRound = 0;
+            pGroup->bEnd = 0;
+            break;
+        case ADC_TRACE_FORMAT_EV_PDB_ERROR:
+            pUnit->u32PdbErrors++;
+            if (ADC_TRACE_FORMAT_NO_GROUP != pUnit->u32Converting)
+            {
+                aGroup[pUnit->u32Converting].u32PdbErrors++;
+                if (bTimeline)
+                {
+                    printf("  (group %u converting)", (unsigned)pUnit->u32Converting);
+                }
+            }
+            break;
+        case ADC_TRACE_FORMAT_EV_NOTIFY:
+            pGroup->u32Notifies++;
+            if (0 != pGroup->bEnd)
+            {
+                AddInterval(&pGroup->tEndToNotify, pEvent->u64Time - pGroup->u64End);
+                pGroup->bEnd = 0;
+            }
+            break;
+        default:
+            /* QUEUE_REMOVE only closes an abort */
+            break;
+    }
+}
+
+static long FindRing(const uint8_t *pDump, size_t Size, long Offset)
+{
+    size_t Pos;
+
+    if (Offset >= 0)
+    {
+        return ((size_t)Offset + ADC_TRACE_FORMAT_HEADER_SIZE <= Size) && (ADC_TRACE_FORMAT_MAGIC == Get32(&pDump[Offset + ADC_TRACE_FORMAT_HDR_MAGIC])) ? Offset : -1L;
+    }
+    for (Pos = 0U; (Pos + ADC_TRACE_FORMAT_HEADER_SIZE) <= Size; Pos += 4U)
+    {
+        if ((ADC_TRACE_FORMAT_MAGIC == Get32(&pDump[Pos + ADC_TRACE_FORMAT_HDR_MAGIC])) && (ADC_TRACE_FORMAT_VERSION == Get16(&pDump[Pos + ADC_TRACE_FORMAT_HDR_VERSION])))
+        {
+            return (long)Pos;
+        }
+    }
+    return -1L;
+}
+
+static void Usage(void)
+{
+    fprintf(stderr, "usage: Adc_TraceDecode [-f clock_hz] [-o offset] [-q] dump.bin\n"
+                    "  -f  timestamp clock, prints microseconds instead of ticks\n"
+                    "  -o  byte offset of Adc_TraceBuffer in the dump, searched by default\n"
+                    "  -q  statistics only, no timeline\n");
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(int argc, char **argv)
+{
+    const char *pFile = NULL;
+    long Offset = -1L;
+    int bTimeline = 1;
+    int Arg;
+    FILE *pIn;
+    uint8_t *pDump;
+    size_t Size;
+    size_t Cap = 1U << 16;
+    const uint8_t *pRing;
+    uint32_t u32Entries;
+    uint32_t u32Head;
+    uint32_t u32Index;
+    uint32_t u32First;
+    uint32_t u32Valid = 0U;
+    uint32_t u32Torn = 0U;
+    uint32_t u32PrevTime = 0U;
+    uint64_t u64Time = 0U;
+    uint32_t u32Unit;
+    uint32_t u32Group;
+
+    for (Arg = 1; Arg < argc; Arg++)
+    {
+        if ((0 == strcmp(argv[Arg], "-f")) && ((Arg + 1) < argc))
+        {
+            dTickUs = 1.0e6 / strtod(argv[++Arg], NULL);
+        }
+        else if ((0 == strcmp(argv[Arg], "-o")) && ((Arg + 1) < argc))
+        {
+            Offset = strtol(argv[++Arg], NULL, 0);
+        }
+        else if (0 == strcmp(argv[Arg], "-q"))
+        {
+            bTimeline = 0;
+        }
+        else if (('-' != argv[Arg][0]) && (NULL == pFile))
+        {
+            pFile = argv[Arg];
+        }
+        else
+        {
+            Usage();
+            return 2;
+        }
+    }
+    if (NULL == pFile)
+    {
+        Usage();
+        return 2;
+    }
+
+    pIn = fopen(pFile, "rb");
+    if (NULL == pIn)
+    {
+        perror(pFile);
+        return 1;
+    }
+    pDump = malloc(Cap);
+    Size = 0U;
+    while ((NULL != pDump) && (0U != (Cap - Size)))
+    {
+        size_t Read = fread(&pDump[Size], 1U, Cap - Size, pIn);
+        Size += Read;
+        if (Size == Cap)
+        {
+            Cap *= 2U;
+            pDump = realloc(pDump, Cap);
+        }
+        else if (0U == Read)
+        {
+            break;
+        }
+    }
+    fclose(pIn);
+    aGroup = calloc(MAX_GROUPS, sizeof(GroupStats));
+    if ((NULL == pDump) || (NULL == aGroup))
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    Offset = FindRing(pDump, Size, Offset);
+    if (Offset < 0L)
+    {
+        fprintf(stderr, "%s: no Adc_TraceBuffer found\n", pFile);
+        return 1;
+    }
+    pRing = &pDump[Offset];
+    u32Entries = Get16(&pRing[ADC_TRACE_FORMAT_HDR_ENTRIES]);
+    if ((ADC_TRACE_FORMAT_VERSION != Get16(&pRing[ADC_TRACE_FORMAT_HDR_VERSION])) || (ADC_TRACE_FORMAT_RECORD_SIZE != pRing[ADC_TRACE_FORMAT_HDR_RECORD_SIZE]) ||
+        (0U == u32Entries) || (0U != (u32Entries & (u32Entries - 1U))) ||
+        (((size_t)Offset + ADC_TRACE_FORMAT_HEADER_SIZE + ((size_t)u32Entries * ADC_TRACE_FORMAT_RECORD_SIZE)) > Size))
+    {
+        fprintf(stderr, "%s: unsupported trace at offset 0x%lx (version %u, record %u bytes, %u entries)\n",
+                pFile, (unsigned long)Offset, (unsigned)Get16(&pRing[ADC_TRACE_FORMAT_HDR_VERSION]), (unsigned)pRing[ADC_TRACE_FORMAT_HDR_RECORD_SIZE], (unsigned)u32Entries);
+        return 1;
+    }
+    u32Head = Get32(&pRing[ADC_TRACE_FORMAT_HDR_HEAD]);
+    u32First = (u32Head > u32Entries) ? (u32Head - u32Entries) : 0U;
+    for (u32Unit = 0U; u32Unit < MAX_UNITS; u32Unit++)
+    {
+        aUnit[u32Unit].u32Converting = ADC_TRACE_FORMAT_NO_GROUP;
+        aUnit[u32Unit].u32Aborted = ADC_TRACE_FORMAT_NO_GROUP;
+    }
+
+    printf("Adc_TraceBuffer at offset 0x%lx: %u entries, %u events recorded, %u overwritten\n",
+           (unsigned long)Offset, (unsigned)u32Entries, (unsigned)u32Head, (unsigned)u32First);
+    if (bTimeline)
+    {
+        printf("%8s %12s%s %4s %5s  %-12s %s\n", "index", "time", (dTickUs > 0.0) ? "  " : "", "unit", "group", "event", "data");
+    }
+    for (u32Index = u32First; u32Index != u32Head; u32Index++)
+    {
+        const uint8_t *pRecord = &pRing[ADC_TRACE_FORMAT_HEADER_SIZE + ((u32Index & (u32Entries - 1U)) * ADC_TRACE_FORMAT_RECORD_SIZE)];
+        Event Ev;
+        uint32_t u32Time = Get32(&pRecord[ADC_TRACE_FORMAT_REC_TIME]);
+
+        if ((u32Index & 0xFFFFU) != Get16(&pRecord[ADC_TRACE_FORMAT_REC_SEQ]))
+        {
+            /* Overwritten or being written when the dump was taken */
+            u32Torn++;
+            continue;
+        }
+        /* Timestamps of events recorded while another is written may go back slightly */
+        if (0U != u32Valid)
+        {
+            u64Time += (uint64_t)(int64_t)(int32_t)(u32Time - u32PrevTime);
+        }
+        u32PrevTime = u32Time;
+        Ev.u64Time = u64Time;
+        Ev.u32Index = u32Index;
+        Ev.u8Event = pRecord[ADC_TRACE_FORMAT_REC_EVENT];
+        Ev.u8Unit = pRecord[ADC_TRACE_FORMAT_REC_UNIT];
+        Ev.u16Group = (uint16_t)Get16(&pRecord[ADC_TRACE_FORMAT_REC_GROUP]);
+        Ev.u16Data = (uint16_t)Get16(&pRecord[ADC_TRACE_FORMAT_REC_DATA]);
+        if ((0U == Ev.u8Event) || (Ev.u8Event > ADC_TRACE_FORMAT_EV_LAST) ||
+            ((ADC_TRACE_FORMAT_NO_GROUP == Ev.u16Group) != (ADC_TRACE_FORMAT_EV_PDB_ERROR == Ev.u8Event)))
+        {
+            u32Torn++;
+            continue;
+        }
+        u32Valid++;
+        if (bTimeline)
+        {
+            printf("%8u ", (unsigned)u32Index);
+            PrintTime(Ev.u64Time);
+            printf(" %4u ", (unsigned)Ev.u8Unit);
+            if (ADC_TRACE_FORMAT_NO_GROUP != Ev.u16Group)
+            {
+                printf("%5u", (unsigned)Ev.u16Group);
+            }
+            else
+            {
+                printf("%5s", "-");
+            }
+            printf("  %-12s", EventName(Ev.u8Event));
+            switch (Ev.u8Event)
+            {
+                case ADC_TRACE_FORMAT_EV_QUEUE_INSERT: printf(" depth=%u", (unsigned)Ev.u16Data); break;
+                case ADC_TRACE_FORMAT_EV_QUEUE_REMOVE: printf(" index=%u", (unsigned)Ev.u16Data); break;
+                case ADC_TRACE_FORMAT_EV_START: printf(" %s", (0U != Ev.u16Data) ? "hw armed" : "sw"); break;
+                case ADC_TRACE_FORMAT_EV_CHUNK: printf(" next=%u", (unsigned)Ev.u16Data); break;
+                case ADC_TRACE_FORMAT_EV_END: printf(" channels=%u", (unsigned)Ev.u16Data); break;
+                case ADC_TRACE_FORMAT_EV_LIMIT_FAIL: printf(" next=%u", (unsigned)Ev.u16Data); break;
+                case ADC_TRACE_FORMAT_EV_ABORT: printf(" next=%u", (unsigned)Ev.u16Data); break;
+                case ADC_TRACE_FORMAT_EV_PDB_ERROR: printf(" pdb channel=%u", (unsigned)Ev.u16Data); break;
+                default: break;
+            }
+        }
+        Account(&Ev, bTimeline);
+        if (bTimeline)
+        {
+            printf("\n");
+        }
+    }
+    /* An abort at the end of the trace is reported as a preemption if not resolved */
+    for (u32Unit = 0U; u32Unit < MAX_UNITS; u32Unit++)
+    {
+        u32Group = aUnit[u32Unit].u32Aborted;
+        if (ADC_TRACE_FORMAT_NO_GROUP != u32Group)
+        {
+            if (0 != aGroup[u32Group].bHw)
+            {
+                aGroup[u32Group].u32HwDisabled++;
+            }
+            else
+            {
+                aGroup[u32Group].u32Preempted++;
+            }
+        }
+    }
+
+    printf("\n%u valid events, %u discarded\n", (unsigned)u32Valid, (unsigned)u32Torn);
+    for (u32Unit = 0U; u32Unit < MAX_UNITS; u32Unit++)
+    {
+        if (0U != aUnit[u32Unit].u32PdbErrors)
+        {
+            printf("unit %u: %u PDB sequence errors\n", (unsigned)u32Unit, (unsigned)aUnit[u32Unit].u32PdbErrors);
+        }
+    }
+    for (u32Group = 0U; u32Group < MAX_GROUPS; u32Group++)
+    {
+        const GroupStats *pGroup = &aGroup[u32Group];
+
+        if (0 != pGroup->bSeen)
+        {
+            printf("group %u: starts=%u hw_arms=%u chunks=%u ends=%u notifications=%u max_queue=%u\n"
+                   "    limit_fails=%u preempted=%u stopped=%u hw_disabled=%u pdb_errors=%u\n",
+                   (unsigned)u32Group, (unsigned)pGroup->u32Starts, (unsigned)pGroup->u32HwArms, (unsigned)pGroup->u32Chunks,
+                   (unsigned)pGroup->u32Ends, (unsigned)pGroup->u32Notifies, (unsigned)pGroup->u32MaxQueue,
+                   (unsigned)pGroup->u32LimitFails, (unsigned)pGroup->u32Preempted, (unsigned)pGroup->u32Stopped,
+                   (unsigned)pGroup->u32HwDisabled, (unsigned)pGroup->u32PdbErrors);
+            PrintInterval("start->end", &pGroup->tStartToEnd);
+            PrintInterval("end->notify", &pGroup->tEndToNotify);
+        }
+    }
+    free(aGroup);
+    free(pDump);
+    return 0;
+}
+
+/** @} */
@@ -69,6 +69,10 @@ extern "C"{
 * order to prevent the contents of a header being included twice.
 */
 #include "Platform_Types.h"
+#ifdef MCAL_REG_SIMULATION
+/* Host builds only: uintptr_t carries register and host memory addresses at full pointer width */
+#include <stdint.h>
+#endif /* MCAL_REG_SIMULATION */
 
 /*==================================================================================================
 *                               SOURCE FILE VERSION INFORMATION
@@ -361,6 +365,7 @@ extern "C"{
 *                                       DEFINES AND MACROS
 ==================================================================================================*/
 
+#ifndef MCAL_REG_SIMULATION
 /**
 * @brief 8 bits memory write macro
 * @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
@@ -400,6 +405,49 @@ extern "C"{
 */
 #define REG_READ32(address)               (*(volatile uint32*)(address))
 
+#else /* MCAL_REG_SIMULATION */
+
+/**
+* @brief 8 bits register write routed to the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_WRITE8(address, value)        (Mcal_SimRegWrite8((Mcal_SimAddressType)(address), (uint8)(value)))
+/**
+* @brief 16 bits register write routed to the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_WRITE16(address, value)       (Mcal_SimRegWrite16((Mcal_SimAddressType)(address), (uint16)(value)))
+/**
+* @brief 32 bits register write routed to the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_WRITE32(address, value)       (Mcal_SimRegWrite32((Mcal_SimAddressType)(address), (uint32)(value)))
+
+
+/**
+* @brief 8 bits register read routed to the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_READ8(address)                (Mcal_SimRegRead8((Mcal_SimAddressType)(address)))
+/**
+* @brief 16 bits register read routed to the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_READ16(address)               (Mcal_SimRegRead16((Mcal_SimAddressType)(address)))
+/**
+* @brief 32 bits register read routed to the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_READ32(address)               (Mcal_SimRegRead32((Mcal_SimAddressType)(address)))
+
+#endif /* MCAL_REG_SIMULATION */
+
 /**
 * @brief 8 bits indexed memory write macro. Index i must have the data type uint32.
 * @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
@@ -440,6 +488,7 @@ extern "C"{
 #define REG_AREAD32(address, i)            (REG_READ32((address)+((uint32)((i)<<2U))))
 
 
+#ifndef MCAL_REG_SIMULATION
 /**
 * @brief 8 bits bits clearing macro.
 * @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
@@ -499,6 +548,66 @@ extern "C"{
 */
 #define REG_BIT_SET32(address, mask)      ((*(volatile uint32*)(address))|= (mask))
 
+#else /* MCAL_REG_SIMULATION */
+
+/**
+* @brief 8 bits bits clearing macro, read-modify-write through the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_BIT_CLEAR8(address, mask)     (REG_WRITE8((address), (REG_READ8(address)& ((uint8)~(mask)))))
+/**
+* @brief 16 bits bits clearing macro, read-modify-write through the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_BIT_CLEAR16(address, mask)    (REG_WRITE16((address), (REG_READ16(address)& ((uint16)~(mask)))))
+/**
+* @brief 32 bits bits clearing macro, read-modify-write through the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_BIT_CLEAR32(address, mask)    (REG_WRITE32((address), (REG_READ32(address)& ((uint32)~(mask)))))
+
+/**
+* @brief 8 bits bits getting macro, read through the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_BIT_GET8(address, mask)      (REG_READ8(address)& (mask))
+/**
+* @brief 16 bits bits getting macro, read through the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_BIT_GET16(address, mask)     (REG_READ16(address)& (mask))
+/**
+* @brief 32 bits bits getting macro, read through the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_BIT_GET32(address, mask)     (REG_READ32(address)& (mask))
+
+/**
+* @brief 8 bits bits setting macro, read-modify-write through the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_BIT_SET8(address, mask)       (REG_WRITE8((address), (REG_READ8(address)| (mask))))
+/**
+* @brief 16 bits bits setting macro, read-modify-write through the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_BIT_SET16(address, mask)      (REG_WRITE16((address), (REG_READ16(address)| (mask))))
+/**
+* @brief 32 bits bits setting macro, read-modify-write through the host register model.
+* @violates @ref StdRegMacros_h_REF_1 MISRA 2004 Advisory Rule 19.7, A function should be used in
+* preference to a function-like macro.
+*/
+#define REG_BIT_SET32(address, mask)      (REG_WRITE32((address), (REG_READ32(address)| (mask))))
+
+#endif /* MCAL_REG_SIMULATION */
 
 /**
 * @brief 8 bit clear bits and set with new value
@@ -534,6 +643,14 @@ extern "C"{
 /*==================================================================================================
 *                                 STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
+#ifdef MCAL_REG_SIMULATION
+/**
+* @brief Address passed to the register access hooks.
+* @details Peripheral addresses fit in 32 bits, but the hooks also receive host memory addresses,
+*          which need the full pointer width of the host.
+*/
+typedef uintptr_t Mcal_SimAddressType;
+#endif /* MCAL_REG_SIMULATION */
 
 
 /*==================================================================================================
@@ -544,6 +661,20 @@ extern "C"{
 /*==================================================================================================
 *                                     FUNCTION PROTOTYPES
 ==================================================================================================*/
+#ifdef MCAL_REG_SIMULATION
+/**
+* @brief Register access hooks used when MCAL_REG_SIMULATION is defined.
+* @details The REG_* accessors above are redirected to these functions so that the drivers can run
+*          on a host against a register model instead of the memory mapped peripherals. The hooks
+*          are provided by the peripheral model linked into the host build.
+*/
+extern void Mcal_SimRegWrite8(Mcal_SimAddressType Address, uint8 u8Value);
+extern void Mcal_SimRegWrite16(Mcal_SimAddressType Address, uint16 u16Value);
+extern void Mcal_SimRegWrite32(Mcal_SimAddressType Address, uint32 u32Value);
+extern uint8 Mcal_SimRegRead8(Mcal_SimAddressType Address);
+extern uint16 Mcal_SimRegRead16(Mcal_SimAddressType Address);
+extern uint32 Mcal_SimRegRead32(Mcal_SimAddressType Address);
+#endif /* MCAL_REG_SIMULATION */
 
 
 #ifdef __cplusplus